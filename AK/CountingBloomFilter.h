@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Assertions.h>
+#include <AK/NumericLimits.h>
+#include <AK/Types.h>
+
+namespace AK {
+
+// A Bloom filter of 32-bit hashes that supports removal, by keeping a counter instead of a bit per slot.
+// Each hash sets two slots, indexed by its low and high key_bits bits, so the hashes added should be well distributed.
+//
+// may_contain() can return false positives, but never false negatives: a counter that overflows sticks at its
+// maximum value and is never decremented again.
+template<size_t key_bits = 12>
+class CountingBloomFilter {
+public:
+    static_assert(key_bits > 0 && key_bits <= 16);
+    static constexpr size_t slot_count = 1u << key_bits;
+
+    void add(u32 hash)
+    {
+        increment(first_slot(hash));
+        increment(second_slot(hash));
+    }
+
+    // NOTE: The hash must have been added before.
+    void remove(u32 hash)
+    {
+        decrement(first_slot(hash));
+        decrement(second_slot(hash));
+    }
+
+    [[nodiscard]] bool may_contain(u32 hash) const
+    {
+        return m_counters[first_slot(hash)] != 0 && m_counters[second_slot(hash)] != 0;
+    }
+
+    void clear() { m_counters.fill(0); }
+
+    [[nodiscard]] bool is_empty() const
+    {
+        for (auto counter : m_counters) {
+            if (counter != 0)
+                return false;
+        }
+        return true;
+    }
+
+private:
+    static constexpr u32 key_mask = slot_count - 1;
+
+    static constexpr size_t first_slot(u32 hash) { return hash & key_mask; }
+    static constexpr size_t second_slot(u32 hash) { return (hash >> 16) & key_mask; }
+
+    void increment(size_t slot)
+    {
+        if (m_counters[slot] != NumericLimits<u8>::max())
+            ++m_counters[slot];
+    }
+
+    void decrement(size_t slot)
+    {
+        auto& counter = m_counters[slot];
+        if (counter != NumericLimits<u8>::max()) {
+            VERIFY(counter != 0);
+            --counter;
+        }
+    }
+
+    Array<u8, slot_count> m_counters {};
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::CountingBloomFilter;
+#endif
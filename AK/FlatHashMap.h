@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/FlatHashTable.h>
+#include <AK/HashMap.h>
+
+// FlatHashMap is a HashMap backed by a FlatHashTable, see <AK/Forward.h>.
+
+#if USING_AK_GLOBALLY
+using AK::FlatHashMap;
+#endif
@@ -0,0 +1,548 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/BuiltinWrappers.h>
+#include <AK/Error.h>
+#include <AK/HashTable.h>
+#include <AK/Optional.h>
+#include <AK/SIMDExtras.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Traits.h>
+#include <AK/Types.h>
+#include <AK/kmalloc.h>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+namespace AK {
+
+// FlatHashTable is an open addressing hash table in the style of a "Swiss table".
+//
+// Instead of storing a state byte next to every value, it keeps one control byte per slot in a separate array.
+// A control byte is either Empty, Deleted, or holds the low 7 bits of the hash of the value in that slot (H2).
+// Slots are probed in groups of 16: a single vector compare of a group's control bytes against H2 tells us which
+// of the 16 slots may hold the value we're looking for, so we only touch the slots themselves on a likely match.
+// Groups are visited in triangular order, which visits every group once as the group count is a power of two.
+//
+// It has the same API as an unordered HashTable and can be used as HashMap storage through FlatHashMap.
+
+template<typename TableType, typename T>
+class FlatHashTableIterator {
+    friend TableType;
+
+public:
+    bool operator==(FlatHashTableIterator const& other) const { return m_slot == other.m_slot; }
+    bool operator!=(FlatHashTableIterator const& other) const { return m_slot != other.m_slot; }
+    T& operator*() { return *m_slot; }
+    T* operator->() { return m_slot; }
+    void operator++() { skip_to_next(); }
+
+private:
+    void skip_to_next()
+    {
+        if (!m_slot)
+            return;
+        do {
+            ++m_control;
+            ++m_slot;
+            if (m_control == m_control_end) {
+                m_slot = nullptr;
+                return;
+            }
+        } while (!TableType::is_full(*m_control));
+    }
+
+    FlatHashTableIterator(u8 const* control, T* slot, u8 const* control_end)
+        : m_control(control)
+        , m_slot(slot)
+        , m_control_end(control_end)
+    {
+    }
+
+    u8 const* m_control { nullptr };
+    T* m_slot { nullptr };
+    u8 const* m_control_end { nullptr };
+};
+
+template<typename T, typename TraitsForT, bool IsOrdered>
+class FlatHashTable {
+    static_assert(!IsOrdered, "FlatHashTable does not keep insertion order, use OrderedHashTable instead");
+
+    static constexpr size_t group_size = 16;
+    static constexpr u8 control_empty = 0x80;
+    static constexpr u8 control_deleted = 0xfe;
+
+    using Group = SIMD::u8x16;
+
+    template<typename, typename>
+    friend class FlatHashTableIterator;
+
+public:
+    FlatHashTable() = default;
+    explicit FlatHashTable(size_t capacity) { ensure_capacity(capacity); }
+
+    ~FlatHashTable()
+    {
+        if (!m_control)
+            return;
+
+        destroy_all_values();
+        kfree_sized(m_control, allocation_size(m_capacity));
+    }
+
+    FlatHashTable(FlatHashTable const& other)
+    {
+        ensure_capacity(other.size());
+        for (auto& it : other)
+            set(it);
+    }
+
+    FlatHashTable& operator=(FlatHashTable const& other)
+    {
+        FlatHashTable temporary(other);
+        swap(*this, temporary);
+        return *this;
+    }
+
+    FlatHashTable(FlatHashTable&& other) noexcept
+        : m_control(other.m_control)
+        , m_slots(other.m_slots)
+        , m_size(other.m_size)
+        , m_capacity(other.m_capacity)
+        , m_growth_left(other.m_growth_left)
+    {
+        other.m_control = nullptr;
+        other.m_slots = nullptr;
+        other.m_size = 0;
+        other.m_capacity = 0;
+        other.m_growth_left = 0;
+    }
+
+    FlatHashTable& operator=(FlatHashTable&& other) noexcept
+    {
+        FlatHashTable temporary { move(other) };
+        swap(*this, temporary);
+        return *this;
+    }
+
+    friend void swap(FlatHashTable& a, FlatHashTable& b) noexcept
+    {
+        swap(a.m_control, b.m_control);
+        swap(a.m_slots, b.m_slots);
+        swap(a.m_size, b.m_size);
+        swap(a.m_capacity, b.m_capacity);
+        swap(a.m_growth_left, b.m_growth_left);
+    }
+
+    [[nodiscard]] bool is_empty() const { return m_size == 0; }
+    [[nodiscard]] size_t size() const { return m_size; }
+    [[nodiscard]] size_t capacity() const { return m_capacity; }
+
+    template<typename U, size_t N>
+    ErrorOr<void> try_set_from(U (&from_array)[N])
+    {
+        for (size_t i = 0; i < N; ++i)
+            TRY(try_set(from_array[i]));
+        return {};
+    }
+    template<typename U, size_t N>
+    void set_from(U (&from_array)[N])
+    {
+        MUST(try_set_from(from_array));
+    }
+
+    ErrorOr<void> try_ensure_capacity(size_t capacity)
+    {
+        // Like HashTable, "capacity" here means the number of values that can be stored without reallocating.
+        if (capacity <= m_size + m_growth_left)
+            return {};
+        return try_rehash(capacity_for_size(capacity));
+    }
+    void ensure_capacity(size_t capacity)
+    {
+        MUST(try_ensure_capacity(capacity));
+    }
+
+    [[nodiscard]] bool contains(T const& value) const
+    {
+        return find(value) != end();
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] bool contains(K const& value) const
+    {
+        return find(value) != end();
+    }
+
+    using Iterator = FlatHashTableIterator<FlatHashTable, T>;
+    using ConstIterator = FlatHashTableIterator<FlatHashTable const, T const>;
+
+    [[nodiscard]] Iterator begin()
+    {
+        if (auto index = first_full_index(); index.has_value())
+            return iterator_at(*index);
+        return end();
+    }
+
+    [[nodiscard]] Iterator end()
+    {
+        return Iterator(nullptr, nullptr, nullptr);
+    }
+
+    [[nodiscard]] ConstIterator begin() const
+    {
+        if (auto index = first_full_index(); index.has_value())
+            return iterator_at(*index);
+        return end();
+    }
+
+    [[nodiscard]] ConstIterator end() const
+    {
+        return ConstIterator(nullptr, nullptr, nullptr);
+    }
+
+    void clear()
+    {
+        *this = FlatHashTable();
+    }
+
+    void clear_with_capacity()
+    {
+        if (m_capacity == 0)
+            return;
+        destroy_all_values();
+        __builtin_memset(m_control, control_empty, m_capacity);
+        m_size = 0;
+        m_growth_left = max_size_for_capacity(m_capacity);
+    }
+
+    template<typename U = T>
+    ErrorOr<HashSetResult> try_set(U&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace)
+    {
+        auto hash = TraitsForT::hash(value);
+        if (auto index = lookup_index_with_hash(hash, [&](auto& other) { return TraitsForT::equals(other, static_cast<T const&>(value)); }); index.has_value()) {
+            if (existing_entry_behavior == HashSetExistingEntryBehavior::Replace) {
+                m_slots[*index] = forward<U>(value);
+                return HashSetResult::ReplacedExistingEntry;
+            }
+            return HashSetResult::KeptExistingEntry;
+        }
+
+        if (m_growth_left == 0) {
+            // If at least half of the non-growth room is taken up by tombstones, rehashing in place is enough.
+            auto new_capacity = m_size * 2 <= max_size_for_capacity(m_capacity) ? m_capacity : m_capacity * 2;
+            TRY(try_rehash(max(new_capacity, group_size)));
+        }
+
+        insert_new_value(hash, forward<U>(value));
+        return HashSetResult::InsertedNewEntry;
+    }
+    template<typename U = T>
+    HashSetResult set(U&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace)
+    {
+        return MUST(try_set(forward<U>(value), existing_entry_behavior));
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] Iterator find(unsigned hash, TUnaryPredicate predicate)
+    {
+        auto index = lookup_index_with_hash(hash, move(predicate));
+        if (!index.has_value())
+            return end();
+        return iterator_at(*index);
+    }
+
+    [[nodiscard]] Iterator find(T const& value)
+    {
+        return find(TraitsForT::hash(value), [&](auto& other) { return TraitsForT::equals(value, other); });
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] ConstIterator find(unsigned hash, TUnaryPredicate predicate) const
+    {
+        auto index = lookup_index_with_hash(hash, move(predicate));
+        if (!index.has_value())
+            return end();
+        return iterator_at(*index);
+    }
+
+    [[nodiscard]] ConstIterator find(T const& value) const
+    {
+        return find(TraitsForT::hash(value), [&](auto& other) { return TraitsForT::equals(value, other); });
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] Iterator find(K const& value)
+    {
+        return find(Traits<K>::hash(value), [&](auto& other) { return Traits<T>::equals(other, value); });
+    }
+
+    template<Concepts::HashCompatible<T> K, typename TUnaryPredicate>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] Iterator find(K const& value, TUnaryPredicate predicate)
+    {
+        return find(Traits<K>::hash(value), move(predicate));
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] ConstIterator find(K const& value) const
+    {
+        return find(Traits<K>::hash(value), [&](auto& other) { return Traits<T>::equals(other, value); });
+    }
+
+    template<Concepts::HashCompatible<T> K, typename TUnaryPredicate>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] ConstIterator find(K const& value, TUnaryPredicate predicate) const
+    {
+        return find(Traits<K>::hash(value), move(predicate));
+    }
+
+    bool remove(T const& value)
+    {
+        auto it = find(value);
+        if (it != end()) {
+            remove(it);
+            return true;
+        }
+        return false;
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) bool remove(K const& value)
+    {
+        auto it = find(value);
+        if (it != end()) {
+            remove(it);
+            return true;
+        }
+        return false;
+    }
+
+    // This invalidates the iterator
+    void remove(Iterator& iterator)
+    {
+        VERIFY(iterator.m_slot);
+        delete_slot(iterator.m_slot - m_slots);
+        iterator.m_slot = nullptr;
+    }
+
+    template<typename TUnaryPredicate>
+    bool remove_all_matching(TUnaryPredicate const& predicate)
+    {
+        bool has_removed_anything = false;
+        for (size_t i = 0; i < m_capacity; ++i) {
+            if (!is_full(m_control[i]) || !predicate(m_slots[i]))
+                continue;
+            // Deleting a slot never moves other values around, so we can simply carry on.
+            delete_slot(i);
+            has_removed_anything = true;
+        }
+        return has_removed_anything;
+    }
+
+    [[nodiscard]] Vector<T> values() const
+    {
+        Vector<T> list;
+        list.ensure_capacity(size());
+        for (auto& value : *this)
+            list.unchecked_append(value);
+        return list;
+    }
+
+private:
+    static constexpr bool is_full(u8 control) { return (control & 0x80) == 0; }
+    static constexpr size_t h1(unsigned hash) { return hash >> 7; }
+    static constexpr u8 h2(unsigned hash) { return hash & 0x7f; }
+
+    // We keep at least one eighth of the slots empty, so that every probe sequence is guaranteed to terminate.
+    static constexpr size_t max_size_for_capacity(size_t capacity) { return capacity - capacity / 8; }
+
+    static size_t capacity_for_size(size_t size)
+    {
+        size_t capacity = group_size;
+        while (max_size_for_capacity(capacity) < size)
+            capacity *= 2;
+        return capacity;
+    }
+
+    static constexpr size_t slots_offset(size_t capacity) { return align_up_to(capacity, alignof(T)); }
+    static constexpr size_t allocation_size(size_t capacity) { return slots_offset(capacity) + sizeof(T) * capacity; }
+
+    class ProbeSequence {
+    public:
+        ProbeSequence(unsigned hash, size_t group_mask)
+            : m_group(h1(hash) & group_mask)
+            , m_group_mask(group_mask)
+        {
+        }
+
+        size_t offset() const { return m_group * group_size; }
+        void next()
+        {
+            ++m_stride;
+            m_group = (m_group + m_stride) & m_group_mask;
+        }
+
+    private:
+        size_t m_group { 0 };
+        size_t m_stride { 0 };
+        size_t m_group_mask { 0 };
+    };
+
+    ProbeSequence probe_sequence(unsigned hash) const { return ProbeSequence(hash, m_capacity / group_size - 1); }
+
+    Group load_group(size_t offset) const
+    {
+        Group group;
+        __builtin_memcpy(&group, m_control + offset, sizeof(group));
+        return group;
+    }
+
+    static u16 match_byte(Group group, u8 byte)
+    {
+        return SIMD::maskbits(group == byte);
+    }
+
+    // Both Empty and Deleted have their top bit set, so this matches every slot that can take a new value.
+    static u16 match_empty_or_deleted(Group group)
+    {
+        return SIMD::maskbits((SIMD::i8x16)group < 0);
+    }
+
+    template<typename TUnaryPredicate>
+    Optional<size_t> lookup_index_with_hash(unsigned hash, TUnaryPredicate predicate) const
+    {
+        if (is_empty())
+            return {};
+
+        auto probe = probe_sequence(hash);
+        auto fragment = h2(hash);
+        for (;;) {
+            auto group = load_group(probe.offset());
+            for (u16 matches = match_byte(group, fragment); matches; matches &= matches - 1) {
+                auto index = probe.offset() + count_trailing_zeroes(matches);
+                if (predicate(m_slots[index]))
+                    return index;
+            }
+            if (match_byte(group, control_empty))
+                return {};
+            probe.next();
+        }
+    }
+
+    size_t find_insertion_index(unsigned hash) const
+    {
+        auto probe = probe_sequence(hash);
+        for (;;) {
+            if (auto matches = match_empty_or_deleted(load_group(probe.offset())))
+                return probe.offset() + count_trailing_zeroes(matches);
+            probe.next();
+        }
+    }
+
+    template<typename U>
+    void insert_new_value(unsigned hash, U&& value)
+    {
+        auto index = find_insertion_index(hash);
+        if (m_control[index] == control_empty) {
+            VERIFY(m_growth_left > 0);
+            --m_growth_left;
+        }
+        new (&m_slots[index]) T(forward<U>(value));
+        m_control[index] = h2(hash);
+        ++m_size;
+    }
+
+    void delete_slot(size_t index)
+    {
+        VERIFY(is_full(m_control[index]));
+        m_slots[index].~T();
+        --m_size;
+
+        // Probing only continues past a group if it has no empty slots, and slots only become empty again when we
+        // rehash. So if this group still has an empty slot, no probe sequence has ever gone past it, and we can
+        // mark the slot as empty instead of leaving a tombstone behind.
+        auto group_offset = index & ~(group_size - 1);
+        if (match_byte(load_group(group_offset), control_empty)) {
+            m_control[index] = control_empty;
+            ++m_growth_left;
+        } else {
+            m_control[index] = control_deleted;
+        }
+    }
+
+    void destroy_all_values()
+    {
+        if constexpr (!IsTriviallyDestructible<T>) {
+            for (size_t i = 0; i < m_capacity; ++i) {
+                if (is_full(m_control[i]))
+                    m_slots[i].~T();
+            }
+        }
+    }
+
+    ErrorOr<void> try_rehash(size_t new_capacity)
+    {
+        VERIFY(is_power_of_two(new_capacity) && new_capacity >= group_size);
+        VERIFY(max_size_for_capacity(new_capacity) >= m_size);
+
+        auto* new_allocation = static_cast<u8*>(kmalloc(allocation_size(new_capacity)));
+        if (!new_allocation)
+            return Error::from_errno(ENOMEM);
+
+        auto* old_control = m_control;
+        auto* old_slots = m_slots;
+        auto old_capacity = m_capacity;
+
+        m_control = new_allocation;
+        m_slots = reinterpret_cast<T*>(new_allocation + slots_offset(new_capacity));
+        m_capacity = new_capacity;
+        m_growth_left = max_size_for_capacity(new_capacity) - m_size;
+        __builtin_memset(m_control, control_empty, new_capacity);
+
+        if (!old_control)
+            return {};
+
+        for (size_t i = 0; i < old_capacity; ++i) {
+            if (!is_full(old_control[i]))
+                continue;
+            auto hash = TraitsForT::hash(old_slots[i]);
+            auto index = find_insertion_index(hash);
+            new (&m_slots[index]) T(move(old_slots[i]));
+            m_control[index] = h2(hash);
+            old_slots[i].~T();
+        }
+
+        kfree_sized(old_control, allocation_size(old_capacity));
+        return {};
+    }
+
+    Iterator iterator_at(size_t index) { return Iterator(&m_control[index], &m_slots[index], &m_control[m_capacity]); }
+    ConstIterator iterator_at(size_t index) const { return ConstIterator(&m_control[index], &m_slots[index], &m_control[m_capacity]); }
+
+    Optional<size_t> first_full_index() const
+    {
+        for (size_t i = 0; i < m_capacity; ++i) {
+            if (is_full(m_control[i]))
+                return i;
+        }
+        return {};
+    }
+
+    u8* m_control { nullptr };
+    T* m_slots { nullptr };
+    size_t m_size { 0 };
+    size_t m_capacity { 0 };
+    size_t m_growth_left { 0 };
+};
+
+}
+
+#pragma GCC diagnostic pop
+
+#if USING_AK_GLOBALLY
+using AK::FlatHashTable;
+#endif
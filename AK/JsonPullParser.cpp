@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BuiltinWrappers.h>
+#include <AK/CharacterTypes.h>
+#include <AK/FloatingPointStringConversions.h>
+#include <AK/JsonPullParser.h>
+#include <AK/SIMDExtras.h>
+#include <AK/StringUtils.h>
+#include <AK/Utf16View.h>
+
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+namespace AK {
+
+constexpr bool is_space(int ch)
+{
+    return ch == '\t' || ch == '\n' || ch == '\r' || ch == ' ';
+}
+
+// Returns the index of the first '"', '\\' or control character at or after `start`, or the input length if there is none.
+// Strings make up most of a typical document, so we check 16 bytes at a time.
+static size_t find_end_of_plain_string_run(StringView input, size_t start)
+{
+    auto const* bytes = reinterpret_cast<u8 const*>(input.characters_without_null_termination());
+    auto length = input.length();
+    auto index = start;
+
+    for (; index + 16 <= length; index += 16) {
+        SIMD::u8x16 chunk;
+        __builtin_memcpy(&chunk, bytes + index, sizeof(chunk));
+        auto special = (chunk == '"') | (chunk == '\\') | (chunk < 0x20);
+        if (auto mask = SIMD::maskbits(special))
+            return index + count_trailing_zeroes(mask);
+    }
+
+    for (; index < length; ++index) {
+        auto ch = bytes[index];
+        if (ch == '"' || ch == '\\' || ch < 0x20)
+            return index;
+    }
+    return length;
+}
+
+ErrorOr<JsonPullParser::Token> JsonPullParser::next_token()
+{
+    ignore_while(is_space);
+
+    switch (m_state) {
+    case State::ExpectEndOfInput:
+        if (!is_eof())
+            return Error::from_string_literal("JsonPullParser: Didn't consume all input");
+        return Token { TokenType::EndOfInput, {} };
+
+    case State::ExpectSeparatorOrEnd: {
+        auto container = m_containers.last();
+        if (container == Container::Object && consume_specific('}'))
+            return close_container(TokenType::ObjectEnd);
+        if (container == Container::Array && consume_specific(']'))
+            return close_container(TokenType::ArrayEnd);
+        if (!consume_specific(','))
+            return Error::from_string_literal("JsonPullParser: Expected ','");
+        ignore_while(is_space);
+        if (container == Container::Object)
+            return read_key_token();
+        return read_value_token();
+    }
+
+    case State::ExpectKeyOrObjectEnd:
+        if (consume_specific('}'))
+            return close_container(TokenType::ObjectEnd);
+        return read_key_token();
+
+    case State::ExpectValueOrArrayEnd:
+        if (consume_specific(']'))
+            return close_container(TokenType::ArrayEnd);
+        return read_value_token();
+
+    case State::ExpectValue:
+        return read_value_token();
+    }
+    VERIFY_NOT_REACHED();
+}
+
+ErrorOr<bool> JsonPullParser::consume_array_end_or_separator()
+{
+    VERIFY(!m_containers.is_empty() && m_containers.last() == Container::Array);
+    ignore_while(is_space);
+
+    if (m_state == State::ExpectValueOrArrayEnd) {
+        if (!consume_specific(']')) {
+            m_state = State::ExpectValue;
+            return false;
+        }
+        close_container(TokenType::ArrayEnd);
+        return true;
+    }
+
+    if (m_state != State::ExpectSeparatorOrEnd)
+        return Error::from_string_literal("JsonPullParser: Array element was not consumed");
+    if (consume_specific(']')) {
+        close_container(TokenType::ArrayEnd);
+        return true;
+    }
+    if (!consume_specific(','))
+        return Error::from_string_literal("JsonPullParser: Expected ','");
+    m_state = State::ExpectValue;
+    return false;
+}
+
+ErrorOr<JsonPullParser::Token> JsonPullParser::expect_token(TokenType type)
+{
+    auto token = TRY(next_token());
+    if (token.type != type)
+        return Error::from_string_literal("JsonPullParser: Unexpected token");
+    return token;
+}
+
+ErrorOr<void> JsonPullParser::skip_value()
+{
+    auto depth = m_containers.size();
+    auto token = TRY(next_token());
+    if (token.type == TokenType::Key || token.type == TokenType::EndOfInput)
+        return Error::from_string_literal("JsonPullParser: Expected value");
+    while (m_containers.size() > depth)
+        TRY(next_token());
+    return {};
+}
+
+ErrorOr<JsonPullParser::Token> JsonPullParser::read_key_token()
+{
+    if (peek() != '"')
+        return Error::from_string_literal("JsonPullParser: Expected object property name");
+    auto key = TRY(consume_string());
+    ignore_while(is_space);
+    if (!consume_specific(':'))
+        return Error::from_string_literal("JsonPullParser: Expected ':'");
+    m_state = State::ExpectValue;
+    return Token { TokenType::Key, key };
+}
+
+ErrorOr<JsonPullParser::Token> JsonPullParser::read_value_token()
+{
+    switch (peek()) {
+    case '{':
+        ignore();
+        return open_container(Container::Object, TokenType::ObjectStart);
+    case '[':
+        ignore();
+        return open_container(Container::Array, TokenType::ArrayStart);
+    case '"':
+        return finish_value({ TokenType::String, TRY(consume_string()) });
+    case '-':
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9':
+        return finish_value({ TokenType::Number, TRY(consume_number()) });
+    case 't':
+        return consume_literal("true"sv, TokenType::True);
+    case 'f':
+        return consume_literal("false"sv, TokenType::False);
+    case 'n':
+        return consume_literal("null"sv, TokenType::Null);
+    }
+    return Error::from_string_literal("JsonPullParser: Unexpected character");
+}
+
+JsonPullParser::Token JsonPullParser::open_container(Container container, TokenType type)
+{
+    m_containers.append(container);
+    m_state = container == Container::Object ? State::ExpectKeyOrObjectEnd : State::ExpectValueOrArrayEnd;
+    return { type, {} };
+}
+
+JsonPullParser::Token JsonPullParser::close_container(TokenType type)
+{
+    m_containers.take_last();
+    return finish_value({ type, {} });
+}
+
+JsonPullParser::Token JsonPullParser::finish_value(Token token)
+{
+    m_state = m_containers.is_empty() ? State::ExpectEndOfInput : State::ExpectSeparatorOrEnd;
+    return token;
+}
+
+ErrorOr<JsonPullParser::Token> JsonPullParser::consume_literal(StringView literal, TokenType type)
+{
+    if (!consume_specific(literal))
+        return Error::from_string_literal("JsonPullParser: Unexpected character");
+    return finish_value({ type, {} });
+}
+
+ErrorOr<StringView> JsonPullParser::consume_string()
+{
+    if (!consume_specific('"'))
+        return Error::from_string_literal("JsonPullParser: Expected '\"'");
+
+    auto start = m_index;
+    m_index = find_end_of_plain_string_run(m_input, m_index);
+    if (is_eof())
+        return Error::from_string_literal("JsonPullParser: Unterminated string");
+
+    // The common case: no escapes, so the string can be handed out as is.
+    if (peek() == '"') {
+        ignore();
+        return m_input.substring_view(start, m_index - start - 1);
+    }
+
+    m_unescaped_string.clear();
+    m_unescaped_string.append(m_input.substring_view(start, m_index - start));
+
+    auto consume_hex_escape = [&]() -> ErrorOr<u32> {
+        if (tell_remaining() < 4)
+            return Error::from_string_literal("JsonPullParser: EOF while parsing Unicode escape");
+        auto code_unit = AK::StringUtils::convert_to_uint_from_hex(consume(4));
+        if (!code_unit.has_value())
+            return Error::from_string_literal("JsonPullParser: Error while parsing Unicode escape");
+        return *code_unit;
+    };
+
+    for (;;) {
+        if (is_eof())
+            return Error::from_string_literal("JsonPullParser: Unterminated string");
+
+        char ch = consume();
+        if (ch == '"')
+            break;
+        if (ch != '\\')
+            return Error::from_string_literal("JsonPullParser: Error while parsing string");
+        if (is_eof())
+            return Error::from_string_literal("JsonPullParser: EOF while parsing escape sequence");
+
+        switch (consume()) {
+        case '"':
+            m_unescaped_string.append('"');
+            break;
+        case '\\':
+            m_unescaped_string.append('\\');
+            break;
+        case '/':
+            m_unescaped_string.append('/');
+            break;
+        case 'n':
+            m_unescaped_string.append('\n');
+            break;
+        case 'r':
+            m_unescaped_string.append('\r');
+            break;
+        case 't':
+            m_unescaped_string.append('\t');
+            break;
+        case 'b':
+            m_unescaped_string.append('\b');
+            break;
+        case 'f':
+            m_unescaped_string.append('\f');
+            break;
+        case 'u': {
+            auto code_point = TRY(consume_hex_escape());
+            if (Utf16View::is_high_surrogate(code_point) && next_is("\\u")) {
+                auto saved_index = m_index;
+                ignore(2);
+                auto low_surrogate = TRY(consume_hex_escape());
+                if (Utf16View::is_low_surrogate(low_surrogate))
+                    code_point = Utf16View::decode_surrogate_pair(code_point, low_surrogate);
+                else
+                    m_index = saved_index;
+            }
+            m_unescaped_string.append_code_point(code_point);
+            break;
+        }
+        default:
+            return Error::from_string_literal("JsonPullParser: Error while parsing string");
+        }
+
+        auto run_start = m_index;
+        m_index = find_end_of_plain_string_run(m_input, m_index);
+        m_unescaped_string.append(m_input.substring_view(run_start, m_index - run_start));
+    }
+
+    return m_unescaped_string.string_view();
+}
+
+ErrorOr<StringView> JsonPullParser::consume_number()
+{
+    auto start = m_index;
+
+    consume_specific('-');
+    if (!is_ascii_digit(peek()))
+        return Error::from_string_literal("JsonPullParser: Unexpected '-' without further digits");
+
+    if (consume_specific('0')) {
+        if (is_ascii_digit(peek()))
+            return Error::from_string_literal("JsonPullParser: Cannot have leading zeros");
+    } else {
+        ignore_while(is_ascii_digit);
+    }
+
+    if (consume_specific('.')) {
+        if (!is_ascii_digit(peek()))
+            return Error::from_string_literal("JsonPullParser: Must have digits after decimal point");
+        ignore_while(is_ascii_digit);
+    }
+
+    if (next_is('e') || next_is('E')) {
+        ignore();
+        if (next_is('+') || next_is('-'))
+            ignore();
+        if (!is_ascii_digit(peek()))
+            return Error::from_string_literal("JsonPullParser: Must have digits after exponent with an optional sign inbetween");
+        ignore_while(is_ascii_digit);
+    }
+
+    return m_input.substring_view(start, m_index - start);
+}
+
+ErrorOr<void> JsonPullParser::read_into(double& value)
+{
+    auto token = TRY(expect_token(TokenType::Number));
+    auto const* start = token.text.characters_without_null_termination();
+    auto result = parse_floating_point_completely<double>(start, start + token.text.length());
+    if (!result.has_value())
+        return Error::from_string_literal("JsonPullParser: Invalid floating point");
+    value = *result;
+    return {};
+}
+
+ErrorOr<void> JsonPullParser::read_into(bool& value)
+{
+    auto token = TRY(next_token());
+    if (token.type != TokenType::True && token.type != TokenType::False)
+        return Error::from_string_literal("JsonPullParser: Expected boolean");
+    value = token.type == TokenType::True;
+    return {};
+}
+
+ErrorOr<void> JsonPullParser::read_into(DeprecatedString& value)
+{
+    auto token = TRY(expect_token(TokenType::String));
+    value = token.text;
+    return {};
+}
+
+}
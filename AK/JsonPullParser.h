@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/DeprecatedString.h>
+#include <AK/Error.h>
+#include <AK/GenericLexer.h>
+#include <AK/Optional.h>
+#include <AK/StringBuilder.h>
+#include <AK/StringView.h>
+#include <AK/Vector.h>
+
+namespace AK {
+
+// JsonPullParser reads a JSON document one token at a time, without building a JsonValue tree.
+//
+// Strings without escape sequences are handed out as views into the input; strings that need unescaping are decoded
+// into a buffer owned by the parser. Either way, a token's text is only valid until the next token is read.
+//
+// The structure of the document is validated as it is read, and any malformed input results in an error.
+class JsonPullParser : private GenericLexer {
+public:
+    enum class TokenType : u8 {
+        ObjectStart,
+        ObjectEnd,
+        ArrayStart,
+        ArrayEnd,
+        Key,
+        String,
+        Number,
+        True,
+        False,
+        Null,
+        EndOfInput,
+    };
+
+    struct Token {
+        TokenType type { TokenType::EndOfInput };
+
+        // The unescaped string for Key and String tokens, and the source text for Number tokens.
+        StringView text;
+    };
+
+    explicit JsonPullParser(StringView input)
+        : GenericLexer(input)
+    {
+    }
+
+    ErrorOr<Token> next_token();
+
+    // Skips over the next value, including everything nested inside it.
+    ErrorOr<void> skip_value();
+
+    // Reads an object and calls `callback(key)` for each of its members. The callback may read the member's value with
+    // read_into(), for_each_member(), for_each_element() or skip_value(); values it leaves alone are skipped for it.
+    template<typename Callback>
+    ErrorOr<void> for_each_member(Callback callback)
+    {
+        TRY(expect_token(TokenType::ObjectStart));
+        for (;;) {
+            auto token = TRY(next_token());
+            if (token.type == TokenType::ObjectEnd)
+                return {};
+            VERIFY(token.type == TokenType::Key);
+            TRY(callback(token.text));
+            if (m_state == State::ExpectValue)
+                TRY(skip_value());
+        }
+    }
+
+    // Reads an array and calls `callback()` for each of its elements, which must read the element.
+    template<typename Callback>
+    ErrorOr<void> for_each_element(Callback callback)
+    {
+        TRY(expect_token(TokenType::ArrayStart));
+        while (!TRY(consume_array_end_or_separator()))
+            TRY(callback());
+        return {};
+    }
+
+    // Reads the next value straight into a field, so callers can deserialize into their own types.
+    template<Integral T>
+    ErrorOr<void> read_into(T& value)
+    {
+        auto token = TRY(expect_token(TokenType::Number));
+        Optional<T> number;
+        if constexpr (IsSigned<T>)
+            number = token.text.to_int<T>();
+        else
+            number = token.text.to_uint<T>();
+        if (!number.has_value())
+            return Error::from_string_literal("JsonPullParser: Number out of range");
+        value = number.release_value();
+        return {};
+    }
+
+    ErrorOr<void> read_into(double&);
+    ErrorOr<void> read_into(bool&);
+    ErrorOr<void> read_into(DeprecatedString&);
+
+    template<typename T>
+    ErrorOr<T> read()
+    {
+        T value {};
+        TRY(read_into(value));
+        return value;
+    }
+
+private:
+    enum class State : u8 {
+        ExpectValue,
+        ExpectValueOrArrayEnd,
+        ExpectKeyOrObjectEnd,
+        ExpectSeparatorOrEnd,
+        ExpectEndOfInput,
+    };
+
+    enum class Container : u8 {
+        Object,
+        Array,
+    };
+
+    ErrorOr<Token> read_value_token();
+    ErrorOr<Token> read_key_token();
+    ErrorOr<Token> expect_token(TokenType);
+    ErrorOr<bool> consume_array_end_or_separator();
+
+    ErrorOr<StringView> consume_string();
+    ErrorOr<StringView> consume_number();
+    ErrorOr<Token> consume_literal(StringView, TokenType);
+
+    Token open_container(Container, TokenType);
+    Token close_container(TokenType);
+    Token finish_value(Token);
+
+    State m_state { State::ExpectValue };
+    Vector<Container, 16> m_containers;
+    StringBuilder m_unescaped_string;
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::JsonPullParser;
+#endif
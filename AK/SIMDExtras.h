@@ -8,6 +8,10 @@
 
 #include <AK/SIMD.h>
 
+#if defined(__ARM_NEON) && defined(__aarch64__) && !defined(KERNEL)
+#    include <arm_neon.h>
+#endif
+
 // Functions returning vectors or accepting vector arguments have different calling conventions
 // depending on whether the target architecture supports SSE or not. GCC generates warning "psabi"
 // when compiling for non-SSE architectures. We disable this warning because these functions
@@ -77,6 +81,23 @@ ALWAYS_INLINE static i32 maskbits(i32x4 mask)
 #endif
 }
 
+ALWAYS_INLINE static u16 maskbits(i8x16 mask)
+{
+#if defined(__SSE2__)
+    return __builtin_ia32_pmovmskb128((c8x16)mask);
+#elif defined(__ARM_NEON) && defined(__aarch64__) && !defined(KERNEL)
+    // NEON has no movemask: give every lane its own bit, and add up the lanes of each half instead.
+    u8x16 const lane_bits { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    auto bits = (uint8x16_t)((u8x16)(mask < 0) & lane_bits);
+    return vaddv_u8(vget_low_u8(bits)) | (vaddv_u8(vget_high_u8(bits)) << 8);
+#else
+    u16 bits = 0;
+    for (int i = 0; i < 16; ++i)
+        bits |= static_cast<u16>((static_cast<u8>(mask[i]) >> 7) << i);
+    return bits;
+#endif
+}
+
 ALWAYS_INLINE static bool all(i32x4 mask)
 {
     return maskbits(mask) == 15;
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+// The layout of /sys/kernel/processes_binary, which carries the same information as /sys/kernel/processes
+// without the cost of producing and parsing JSON.
+//
+// The file starts with a ProcessStatisticsHeader, followed by records until the end of the file. Every record starts
+// with its type, and is immediately followed by its strings, which are stored back to back in the order they are
+// declared in the record, without null terminators. Thread records belong to the process record preceding them.
+//
+// Records are not aligned in the file, so readers should copy them out before accessing their fields.
+
+constexpr u32 PROCESS_STATISTICS_MAGIC = 0x53505250; // "PRPS"
+constexpr u32 PROCESS_STATISTICS_VERSION = 1;
+
+struct [[gnu::packed]] ProcessStatisticsHeader {
+    u32 magic;
+    u32 version;
+
+    // Changes whenever a process or thread is created or destroyed. If it is the same as in an earlier snapshot,
+    // the processes and their threads appear in the same order as they did back then.
+    u64 generation;
+
+    u64 total_time_scheduled;
+    u64 total_time_scheduled_kernel;
+};
+
+enum class ProcessStatisticsRecordType : u32 {
+    Process = 1,
+    Thread = 2,
+};
+
+struct [[gnu::packed]] ProcessStatisticsRecord {
+    ProcessStatisticsRecordType type;
+    i32 pid;
+    i32 pgid;
+    i32 pgp;
+    i32 sid;
+    u32 uid;
+    u32 gid;
+    i32 ppid;
+    u8 kernel;
+    u8 dumpable;
+    i64 creation_time_ns;
+    u64 amount_virtual;
+    u64 amount_resident;
+    u64 amount_shared;
+    u64 amount_dirty_private;
+    u64 amount_clean_inode;
+    u64 amount_purgeable_volatile;
+    u64 amount_purgeable_nonvolatile;
+
+    u32 name_length;
+    u32 executable_length;
+    u32 tty_length;
+    u32 pledge_length;
+    u32 veil_length;
+};
+
+struct [[gnu::packed]] ThreadStatisticsRecord {
+    ProcessStatisticsRecordType type;
+    i32 tid;
+    u32 times_scheduled;
+    u64 time_user;
+    u64 time_kernel;
+    u32 cpu;
+    u32 priority;
+    u32 syscall_count;
+    u32 inode_faults;
+    u32 zero_faults;
+    u32 cow_faults;
+    u64 unix_socket_read_bytes;
+    u64 unix_socket_write_bytes;
+    u64 ipv4_socket_read_bytes;
+    u64 ipv4_socket_write_bytes;
+    u64 file_read_bytes;
+    u64 file_write_bytes;
+
+    u32 name_length;
+    u32 state_length;
+};
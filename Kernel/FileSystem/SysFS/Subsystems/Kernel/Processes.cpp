@@ -6,6 +6,7 @@
 
 #include <AK/JsonObjectSerializer.h>
 #include <AK/Try.h>
+#include <Kernel/API/ProcessStatistics.h>
 #include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Processes.h>
 #include <Kernel/Sections.h>
 #include <Kernel/TTY/TTY.h>
@@ -24,6 +25,39 @@ UNMAP_AFTER_INIT NonnullRefPtr<SysFSOverallProcesses> SysFSOverallProcesses::mus
     return adopt_ref_if_nonnull(new (nothrow) SysFSOverallProcesses(parent_directory)).release_nonnull();
 }
 
+static ErrorOr<void> build_pledge_string(StringBuilder& builder, Process const& process)
+{
+    if (!process.is_user_process())
+        return {};
+
+#define __ENUMERATE_PLEDGE_PROMISE(promise)    \
+    if (process.has_promised(Pledge::promise)) \
+        TRY(builder.try_append(#promise " "sv));
+    ENUMERATE_PLEDGE_PROMISES
+#undef __ENUMERATE_PLEDGE_PROMISE
+
+    return {};
+}
+
+static StringView veil_string(Process const& process)
+{
+    if (!process.is_user_process())
+        return ""sv;
+
+    switch (process.veil_state()) {
+    case VeilState::None:
+        return "None"sv;
+    case VeilState::Dropped:
+        return "Dropped"sv;
+    case VeilState::Locked:
+    case VeilState::LockedInherited:
+        // Note: We don't reveal if the locked state is either by our choice
+        // or someone else applied it.
+        return "Locked"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
 ErrorOr<void> SysFSOverallProcesses::try_generate(KBufferBuilder& builder)
 {
     auto json = TRY(JsonObjectSerializer<>::try_create(builder));
@@ -32,37 +66,10 @@ ErrorOr<void> SysFSOverallProcesses::try_generate(KBufferBuilder& builder)
     auto build_process = [&](JsonArraySerializer<KBufferBuilder>& array, Process const& process) -> ErrorOr<void> {
         auto process_object = TRY(array.add_object());
 
-        if (process.is_user_process()) {
-            StringBuilder pledge_builder;
-
-#define __ENUMERATE_PLEDGE_PROMISE(promise)    \
-    if (process.has_promised(Pledge::promise)) \
-        TRY(pledge_builder.try_append(#promise " "sv));
-            ENUMERATE_PLEDGE_PROMISES
-#undef __ENUMERATE_PLEDGE_PROMISE
-
-            TRY(process_object.add("pledge"sv, pledge_builder.string_view()));
-
-            switch (process.veil_state()) {
-            case VeilState::None:
-                TRY(process_object.add("veil"sv, "None"));
-                break;
-            case VeilState::Dropped:
-                TRY(process_object.add("veil"sv, "Dropped"));
-                break;
-            case VeilState::Locked:
-                TRY(process_object.add("veil"sv, "Locked"));
-                break;
-            case VeilState::LockedInherited:
-                // Note: We don't reveal if the locked state is either by our choice
-                // or someone else applied it.
-                TRY(process_object.add("veil"sv, "Locked"));
-                break;
-            }
-        } else {
-            TRY(process_object.add("pledge"sv, ""sv));
-            TRY(process_object.add("veil"sv, ""sv));
-        }
+        StringBuilder pledge_builder;
+        TRY(build_pledge_string(pledge_builder, process));
+        TRY(process_object.add("pledge"sv, pledge_builder.string_view()));
+        TRY(process_object.add("veil"sv, veil_string(process)));
 
         TRY(process_object.add("pid"sv, process.pid().value()));
         ProcessGroupID tty_pgid = 0;
@@ -165,4 +172,126 @@ ErrorOr<void> SysFSOverallProcesses::try_generate(KBufferBuilder& builder)
     return {};
 }
 
+UNMAP_AFTER_INIT SysFSOverallProcessesBinary::SysFSOverallProcessesBinary(SysFSDirectory const& parent_directory)
+    : SysFSGlobalInformation(parent_directory)
+{
+}
+
+UNMAP_AFTER_INIT NonnullRefPtr<SysFSOverallProcessesBinary> SysFSOverallProcessesBinary::must_create(SysFSDirectory const& parent_directory)
+{
+    return adopt_ref_if_nonnull(new (nothrow) SysFSOverallProcessesBinary(parent_directory)).release_nonnull();
+}
+
+ErrorOr<void> SysFSOverallProcessesBinary::try_generate(KBufferBuilder& builder)
+{
+    auto append_record = [&](auto const& record) {
+        return builder.append_bytes({ &record, sizeof(record) });
+    };
+
+    auto total_time_scheduled = Scheduler::get_total_time_scheduled();
+    ProcessStatisticsHeader header {
+        .magic = PROCESS_STATISTICS_MAGIC,
+        .version = PROCESS_STATISTICS_VERSION,
+        .generation = Process::process_list_generation(),
+        .total_time_scheduled = total_time_scheduled.total,
+        .total_time_scheduled_kernel = total_time_scheduled.total_kernel,
+    };
+    TRY(append_record(header));
+
+    // Keep this in sync with SysFSOverallProcesses::try_generate() and Core::ProcessStatisticsReader.
+    auto build_process = [&](Process const& process) -> ErrorOr<void> {
+        ProcessStatisticsRecord record {};
+        record.type = ProcessStatisticsRecordType::Process;
+        record.pid = process.pid().value();
+        ProcessGroupID tty_pgid = 0;
+        if (auto tty = process.tty())
+            tty_pgid = tty->pgid();
+        record.pgid = tty_pgid.value();
+        record.pgp = process.pgid().value();
+        record.sid = process.sid().value();
+        auto credentials = process.credentials();
+        record.uid = credentials->uid().value();
+        record.gid = credentials->gid().value();
+        record.ppid = process.ppid().value();
+        record.kernel = process.is_kernel_process();
+        record.dumpable = process.is_dumpable();
+        record.creation_time_ns = process.creation_time().nanoseconds_since_epoch();
+
+        TRY(process.address_space().with([&](auto& space) -> ErrorOr<void> {
+            record.amount_virtual = space->amount_virtual();
+            record.amount_resident = space->amount_resident();
+            record.amount_dirty_private = space->amount_dirty_private();
+            record.amount_clean_inode = TRY(space->amount_clean_inode());
+            record.amount_shared = space->amount_shared();
+            record.amount_purgeable_volatile = space->amount_purgeable_volatile();
+            record.amount_purgeable_nonvolatile = space->amount_purgeable_nonvolatile();
+            return {};
+        }));
+
+        OwnPtr<KString> executable;
+        if (process.executable())
+            executable = TRY(process.executable()->try_serialize_absolute_path());
+        OwnPtr<KString> tty;
+        if (process.tty())
+            tty = TRY(process.tty()->pseudo_name());
+        StringBuilder pledge_builder;
+        TRY(build_pledge_string(pledge_builder, process));
+        auto veil = veil_string(process);
+
+        auto executable_view = executable ? executable->view() : ""sv;
+        auto tty_view = tty ? tty->view() : ""sv;
+        record.executable_length = executable_view.length();
+        record.tty_length = tty_view.length();
+        record.pledge_length = pledge_builder.length();
+        record.veil_length = veil.length();
+
+        TRY(process.name().with([&](auto& process_name) -> ErrorOr<void> {
+            record.name_length = process_name->length();
+            TRY(append_record(record));
+            return builder.append(process_name->view());
+        }));
+        TRY(builder.append(executable_view));
+        TRY(builder.append(tty_view));
+        TRY(builder.append(pledge_builder.string_view()));
+        TRY(builder.append(veil));
+
+        return process.try_for_each_thread([&](Thread const& thread) -> ErrorOr<void> {
+            SpinlockLocker locker(thread.get_lock());
+            ThreadStatisticsRecord thread_record {};
+            thread_record.type = ProcessStatisticsRecordType::Thread;
+            thread_record.tid = thread.tid().value();
+            thread_record.times_scheduled = thread.times_scheduled();
+            thread_record.time_user = thread.time_in_user();
+            thread_record.time_kernel = thread.time_in_kernel();
+            thread_record.cpu = thread.cpu();
+            thread_record.priority = thread.priority();
+            thread_record.syscall_count = thread.syscall_count();
+            thread_record.inode_faults = thread.inode_faults();
+            thread_record.zero_faults = thread.zero_faults();
+            thread_record.cow_faults = thread.cow_faults();
+            thread_record.unix_socket_read_bytes = thread.unix_socket_read_bytes();
+            thread_record.unix_socket_write_bytes = thread.unix_socket_write_bytes();
+            thread_record.ipv4_socket_read_bytes = thread.ipv4_socket_read_bytes();
+            thread_record.ipv4_socket_write_bytes = thread.ipv4_socket_write_bytes();
+            thread_record.file_read_bytes = thread.file_read_bytes();
+            thread_record.file_write_bytes = thread.file_write_bytes();
+
+            auto state = thread.state_string();
+            thread_record.state_length = state.length();
+            return thread.name().with([&](auto& thread_name) -> ErrorOr<void> {
+                thread_record.name_length = thread_name->length();
+                TRY(append_record(thread_record));
+                TRY(builder.append(thread_name->view()));
+                return builder.append(state);
+            });
+        });
+    };
+
+    // FIXME: Do we actually want to expose the colonel process in a Jail environment?
+    TRY(build_process(*Scheduler::colonel()));
+    return Process::for_each_in_same_jail([&](Process& process) -> ErrorOr<void> {
+        return build_process(process);
+    });
+}
+
 }
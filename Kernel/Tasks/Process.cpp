@@ -50,6 +50,7 @@ extern ProcessID g_init_pid;
 RecursiveSpinlock<LockRank::None> g_profiling_lock {};
 static Atomic<pid_t> next_pid;
 static Singleton<SpinlockProtected<Process::AllProcessesList, LockRank::None>> s_all_instances;
+static Atomic<u64> s_process_list_generation;
 READONLY_AFTER_INIT Memory::Region* g_signal_trampoline_region;
 
 static Singleton<MutexProtected<OwnPtr<KString>>> s_hostname;
@@ -64,6 +65,11 @@ SpinlockProtected<Process::AllProcessesList, LockRank::None>& Process::all_insta
     return *s_all_instances;
 }
 
+u64 Process::process_list_generation()
+{
+    return s_process_list_generation.load(AK::MemoryOrder::memory_order_relaxed);
+}
+
 ErrorOr<void> Process::for_each_in_same_jail(Function<ErrorOr<void>(Process&)> callback)
 {
     return Process::current().m_jail_process_list.with([&](auto const& list_ptr) -> ErrorOr<void> {
@@ -207,6 +213,7 @@ void Process::register_new(Process& process)
     all_instances().with([&](auto& list) {
         list.prepend(process);
     });
+    s_process_list_generation.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
 }
 
 ErrorOr<Process::ProcessAndFirstThread> Process::create_user_process(StringView path, UserID uid, GroupID gid, Vector<NonnullOwnPtr<KString>> arguments, Vector<NonnullOwnPtr<KString>> environment, RefPtr<TTY> tty)
@@ -841,6 +848,7 @@ void Process::unblock_waiters(Thread::WaitBlocker::UnblockFlags flags, u8 signal
 
 void Process::remove_from_secondary_lists()
 {
+    s_process_list_generation.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
     m_jail_process_list.with([this](auto& list_ptr) {
         if (list_ptr) {
             list_ptr->attached_processes().with([&](auto& list) {
@@ -1030,6 +1038,7 @@ bool Process::remove_thread(Thread& thread)
             VERIFY(thread_count_before != 0);
         });
     });
+    s_process_list_generation.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
     return thread_count_before == 1;
 }
 
@@ -1042,6 +1051,7 @@ bool Process::add_thread(Thread& thread)
             is_first = protected_data.thread_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed) == 0;
         });
     });
+    s_process_list_generation.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
     return is_first;
 }
 
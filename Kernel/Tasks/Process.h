@@ -917,6 +917,10 @@ private:
 
 public:
     static SpinlockProtected<Process::AllProcessesList, LockRank::None>& all_instances();
+
+    // Changes whenever a process or thread is created or destroyed, so that readers of /sys/kernel/processes_binary
+    // can tell whether anything besides the statistics themselves changed since their last snapshot.
+    static u64 process_list_generation();
 };
 
 class ProcessList : public RefCounted<ProcessList> {
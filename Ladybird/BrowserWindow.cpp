@@ -276,6 +276,12 @@ BrowserWindow::BrowserWindow(Browser::CookieJar& cookie_jar, StringView webdrive
         debug_request("collect-garbage");
     });
 
+    auto* dump_gc_statistics_action = new QAction("Dump GC Statistics", this);
+    debug_menu->addAction(dump_gc_statistics_action);
+    QObject::connect(dump_gc_statistics_action, &QAction::triggered, this, [this] {
+        debug_request("dump-gc-statistics");
+    });
+
     auto* clear_cache_action = new QAction("Clear Cache", this);
     clear_cache_action->setIcon(QIcon(QString("%1/res/icons/browser/clear-cache.png").arg(s_serenity_resource_root.characters())));
     debug_menu->addAction(clear_cache_action);
@@ -13,13 +13,17 @@
 #include <AK/LexicalPath.h>
 #include <AK/Platform.h>
 #include <LibCore/ArgsParser.h>
+#include <LibCore/Directory.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/LocalServer.h>
+#include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
 #include <LibCore/SystemServerTakeover.h>
 #include <LibIPC/ConnectionFromClient.h>
+#include <LibJS/Script.h>
 #include <LibMain/Main.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
+#include <LibWeb/HTML/DecodedImageCache.h>
 #include <LibWeb/Loader/ContentFilter.h>
 #include <LibWeb/Loader/FrameLoader.h>
 #include <LibWeb/Loader/ResourceLoader.h>
@@ -64,12 +68,16 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
     int webcontent_fd_passing_socket { -1 };
     bool is_layout_test_mode = false;
+    size_t decoded_image_budget_in_mib = Web::HTML::DecodedImageCache::default_budget / MiB;
 
     Core::ArgsParser args_parser;
     args_parser.add_option(webcontent_fd_passing_socket, "File descriptor of the passing socket for the WebContent connection", "webcontent-fd-passing-socket", 'c', "webcontent_fd_passing_socket");
     args_parser.add_option(is_layout_test_mode, "Is layout test mode", "layout-test-mode", 0);
+    args_parser.add_option(decoded_image_budget_in_mib, "Memory budget for decoded images, in MiB", "decoded-image-budget", 0, "size");
     args_parser.parse(arguments);
 
+    Web::HTML::DecodedImageCache::the().set_budget(decoded_image_budget_in_mib * MiB);
+
     VERIFY(webcontent_fd_passing_socket >= 0);
 
     Web::Platform::FontPlugin::install(*new Ladybird::FontPluginQt(is_layout_test_mode));
@@ -78,6 +86,13 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
     TRY(Web::Bindings::initialize_main_thread_vm());
 
+    // What was learned from parsing large scripts is kept around for the WebContent processes that load them next.
+    auto script_cache_directory = LexicalPath::join(Core::StandardPaths::cache_directory(), "Ladybird"sv, "Scripts"sv).string();
+    if (auto result = Core::Directory::create(script_cache_directory, Core::Directory::CreateDirectories::Yes); result.is_error())
+        dbgln("Failed to create the script cache in {}, scripts will be parsed from scratch: {}", script_cache_directory, result.error());
+    else
+        JS::Script::set_preparse_data_cache_directory(script_cache_directory);
+
     auto maybe_content_filter_error = load_content_filters();
     if (maybe_content_filter_error.is_error())
         dbgln("Failed to load content filters: {}", maybe_content_filter_error.error());
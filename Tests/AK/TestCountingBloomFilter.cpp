@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/CountingBloomFilter.h>
+#include <AK/HashFunctions.h>
+
+TEST_CASE(construct_empty)
+{
+    CountingBloomFilter filter;
+    EXPECT(filter.is_empty());
+    EXPECT(!filter.may_contain(int_hash(1)));
+}
+
+TEST_CASE(add_and_remove)
+{
+    CountingBloomFilter filter;
+    filter.add(int_hash(1));
+    filter.add(int_hash(2));
+    EXPECT(filter.may_contain(int_hash(1)));
+    EXPECT(filter.may_contain(int_hash(2)));
+
+    filter.remove(int_hash(1));
+    EXPECT(!filter.may_contain(int_hash(1)));
+    EXPECT(filter.may_contain(int_hash(2)));
+
+    filter.remove(int_hash(2));
+    EXPECT(filter.is_empty());
+}
+
+TEST_CASE(hash_added_twice_is_removed_twice)
+{
+    CountingBloomFilter filter;
+    filter.add(int_hash(42));
+    filter.add(int_hash(42));
+    filter.remove(int_hash(42));
+    EXPECT(filter.may_contain(int_hash(42)));
+    filter.remove(int_hash(42));
+    EXPECT(!filter.may_contain(int_hash(42)));
+}
+
+TEST_CASE(no_false_negatives)
+{
+    CountingBloomFilter filter;
+    for (u32 i = 0; i < 1000; ++i)
+        filter.add(int_hash(i));
+    for (u32 i = 0; i < 1000; i += 2)
+        filter.remove(int_hash(i));
+    for (u32 i = 1; i < 1000; i += 2)
+        EXPECT(filter.may_contain(int_hash(i)));
+}
+
+TEST_CASE(saturated_counters_stay_set)
+{
+    CountingBloomFilter filter;
+    for (size_t i = 0; i < 300; ++i)
+        filter.add(int_hash(7));
+    for (size_t i = 0; i < 300; ++i)
+        filter.remove(int_hash(7));
+    EXPECT(filter.may_contain(int_hash(7)));
+
+    filter.clear();
+    EXPECT(filter.is_empty());
+}
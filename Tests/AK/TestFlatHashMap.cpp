@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/DeprecatedString.h>
+#include <AK/FlatHashMap.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Vector.h>
+
+TEST_CASE(construct)
+{
+    using IntIntMap = FlatHashMap<int, int>;
+    EXPECT(IntIntMap().is_empty());
+    EXPECT_EQ(IntIntMap().size(), 0u);
+}
+
+TEST_CASE(construct_from_initializer_list)
+{
+    FlatHashMap<int, DeprecatedString> number_to_string {
+        { 1, "One" },
+        { 2, "Two" },
+        { 3, "Three" },
+    };
+    EXPECT_EQ(number_to_string.is_empty(), false);
+    EXPECT_EQ(number_to_string.size(), 3u);
+    EXPECT_EQ(number_to_string.get(2).value(), "Two");
+}
+
+TEST_CASE(set_replace_and_keep)
+{
+    FlatHashTable<int> table;
+    EXPECT_EQ(table.set(1), AK::HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(table.set(1), AK::HashSetResult::ReplacedExistingEntry);
+    EXPECT_EQ(table.set(1, AK::HashSetExistingEntryBehavior::Keep), AK::HashSetResult::KeptExistingEntry);
+    EXPECT_EQ(table.size(), 1u);
+}
+
+TEST_CASE(range_loop)
+{
+    FlatHashMap<int, DeprecatedString> number_to_string;
+    EXPECT_EQ(number_to_string.set(1, "One"), AK::HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(number_to_string.set(2, "Two"), AK::HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(number_to_string.set(3, "Three"), AK::HashSetResult::InsertedNewEntry);
+
+    int loop_counter = 0;
+    for (auto& it : number_to_string) {
+        EXPECT_EQ(it.value.is_null(), false);
+        ++loop_counter;
+    }
+    EXPECT_EQ(loop_counter, 3);
+}
+
+TEST_CASE(map_remove)
+{
+    FlatHashMap<int, DeprecatedString> number_to_string;
+    number_to_string.set(1, "One");
+    number_to_string.set(2, "Two");
+    number_to_string.set(3, "Three");
+
+    EXPECT_EQ(number_to_string.remove(1), true);
+    EXPECT_EQ(number_to_string.size(), 2u);
+    EXPECT(number_to_string.find(1) == number_to_string.end());
+
+    EXPECT_EQ(number_to_string.remove(3), true);
+    EXPECT_EQ(number_to_string.size(), 1u);
+    EXPECT(number_to_string.find(3) == number_to_string.end());
+    EXPECT(number_to_string.find(2) != number_to_string.end());
+}
+
+TEST_CASE(remove_all_matching)
+{
+    FlatHashMap<int, DeprecatedString> map;
+
+    for (int i = 0; i < 100; ++i)
+        map.set(i, DeprecatedString::number(i));
+
+    EXPECT_EQ(map.remove_all_matching([&](int key, DeprecatedString const&) { return key % 2 == 0; }), true);
+    EXPECT_EQ(map.size(), 50u);
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(map.contains(i), i % 2 != 0);
+
+    EXPECT_EQ(map.remove_all_matching([&](int, DeprecatedString const&) { return true; }), true);
+    EXPECT(map.is_empty());
+    EXPECT_EQ(map.remove_all_matching([&](int, DeprecatedString const&) { return true; }), false);
+}
+
+TEST_CASE(case_insensitive)
+{
+    FlatHashMap<DeprecatedString, int, CaseInsensitiveStringTraits> casemap;
+    EXPECT_EQ(DeprecatedString("nickserv").to_lowercase(), DeprecatedString("NickServ").to_lowercase());
+    EXPECT_EQ(casemap.set("nickserv", 3), AK::HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(casemap.set("NickServ", 3), AK::HashSetResult::ReplacedExistingEntry);
+    EXPECT_EQ(casemap.size(), 1u);
+}
+
+TEST_CASE(many_strings)
+{
+    FlatHashTable<DeprecatedString> strings;
+    for (int i = 0; i < 999; ++i)
+        EXPECT_EQ(strings.set(DeprecatedString::number(i)), AK::HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(strings.size(), 999u);
+    for (int i = 0; i < 999; ++i)
+        EXPECT(strings.contains(DeprecatedString::number(i)));
+    for (int i = 0; i < 999; ++i)
+        EXPECT_EQ(strings.remove(DeprecatedString::number(i)), true);
+    EXPECT_EQ(strings.is_empty(), true);
+}
+
+TEST_CASE(many_collisions)
+{
+    struct StringCollisionTraits : public GenericTraits<DeprecatedString> {
+        static unsigned hash(DeprecatedString const&) { return 0; }
+    };
+
+    FlatHashTable<DeprecatedString, StringCollisionTraits> strings;
+    for (int i = 0; i < 999; ++i)
+        EXPECT_EQ(strings.set(DeprecatedString::number(i)), AK::HashSetResult::InsertedNewEntry);
+
+    EXPECT_EQ(strings.set("foo"), AK::HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(strings.size(), 1000u);
+
+    for (int i = 0; i < 999; ++i)
+        EXPECT_EQ(strings.remove(DeprecatedString::number(i)), true);
+
+    EXPECT(strings.find("foo") != strings.end());
+}
+
+TEST_CASE(tombstone_reuse)
+{
+    FlatHashTable<int> table;
+
+    // Churn through many more values than the table holds at once; tombstones must not make it grow without bound.
+    for (int i = 0; i < 10000; ++i) {
+        table.set(i);
+        if (i >= 8)
+            EXPECT_EQ(table.remove(i - 8), true);
+    }
+    EXPECT_EQ(table.size(), 8u);
+    EXPECT(table.capacity() <= 32u);
+    for (int i = 10000 - 8; i < 10000; ++i)
+        EXPECT(table.contains(i));
+}
+
+TEST_CASE(ensure_capacity)
+{
+    FlatHashTable<int> table;
+    table.ensure_capacity(1000);
+    auto capacity = table.capacity();
+    EXPECT(capacity >= 1000u);
+    for (int i = 0; i < 1000; ++i)
+        table.set(i);
+    EXPECT_EQ(table.capacity(), capacity);
+}
+
+TEST_CASE(clear_with_capacity)
+{
+    FlatHashTable<DeprecatedString> table;
+    for (int i = 0; i < 100; ++i)
+        table.set(DeprecatedString::number(i));
+    auto capacity = table.capacity();
+    table.clear_with_capacity();
+    EXPECT(table.is_empty());
+    EXPECT_EQ(table.capacity(), capacity);
+    EXPECT(table.begin() == table.end());
+    table.set("foo");
+    EXPECT(table.contains("foo"sv));
+}
+
+TEST_CASE(hashmap_of_nonnullownptr_get)
+{
+    struct Object {
+        Object(DeprecatedString const& s)
+            : string(s)
+        {
+        }
+        DeprecatedString string;
+    };
+
+    FlatHashMap<int, NonnullOwnPtr<Object>> objects;
+    objects.set(1, make<Object>("One"));
+    objects.set(2, make<Object>("Two"));
+    objects.set(3, make<Object>("Three"));
+
+    {
+        auto x = objects.get(2);
+        EXPECT_EQ(x.has_value(), true);
+        EXPECT_EQ(x.value()->string, "Two");
+    }
+
+    {
+        // Do it again to make sure that peeking into the map above didn't
+        // remove the value from the map.
+        auto x = objects.get(2);
+        EXPECT_EQ(x.has_value(), true);
+        EXPECT_EQ(x.value()->string, "Two");
+    }
+
+    EXPECT_EQ(objects.size(), 3u);
+}
+
+TEST_CASE(take)
+{
+    FlatHashMap<DeprecatedString, int> map;
+
+    EXPECT(!map.take("foo"sv).has_value());
+    EXPECT(!map.take("bar"sv).has_value());
+
+    map.set("foo"sv, 1);
+    map.set("bar"sv, 2);
+
+    auto foo = map.take("foo"sv);
+    EXPECT_EQ(foo, 1);
+    EXPECT(!map.take("foo"sv).has_value());
+
+    auto bar = map.take("bar"sv);
+    EXPECT_EQ(bar, 2);
+    EXPECT(!map.take("bar"sv).has_value());
+    EXPECT(map.is_empty());
+}
+
+TEST_CASE(clone_to_hash_map)
+{
+    FlatHashMap<int, int> flat_map;
+    for (int i = 0; i < 100; ++i)
+        flat_map.set(i, i * i);
+
+    auto copy = MUST(flat_map.clone());
+    EXPECT_EQ(copy.size(), 100u);
+    EXPECT_EQ(copy.get(9), 81);
+
+    auto hash_map = MUST((flat_map.clone<Traits<int>, Traits<int>, false, HashTable>()));
+    EXPECT_EQ(hash_map.size(), 100u);
+    EXPECT_EQ(hash_map.get(9), 81);
+}
+
+TEST_CASE(move_construct)
+{
+    FlatHashMap<int, int> orig;
+    orig.set(1, 10);
+    orig.set(2, 20);
+
+    FlatHashMap<int, int> second = move(orig);
+
+    EXPECT_EQ(orig.size(), 0u);
+    EXPECT_EQ(orig.get(2), Optional<int>());
+    EXPECT_EQ(second.size(), 2u);
+    EXPECT_EQ(second.get(2), 20);
+}
+
+TEST_CASE(matches_hash_map)
+{
+    // Drive both implementations with the same pseudo-random operations and make sure they agree.
+    HashMap<u32, u32> reference;
+    FlatHashMap<u32, u32> flat;
+    u32 state = 1;
+    auto next = [&] {
+        state = state * 1103515245 + 12345;
+        return (state >> 16) % 4096;
+    };
+
+    for (int i = 0; i < 50000; ++i) {
+        auto key = next();
+        switch (next() % 3) {
+        case 0:
+        case 1:
+            EXPECT_EQ(flat.set(key, i), reference.set(key, i));
+            break;
+        case 2:
+            EXPECT_EQ(flat.remove(key), reference.remove(key));
+            break;
+        }
+    }
+
+    EXPECT_EQ(flat.size(), reference.size());
+    size_t count = 0;
+    for (auto& entry : flat) {
+        EXPECT_EQ(reference.get(entry.key), entry.value);
+        ++count;
+    }
+    EXPECT_EQ(count, reference.size());
+}
+
+static constexpr u32 benchmark_size = 1'000'000;
+
+template<typename MapType>
+static void insert_benchmark()
+{
+    MapType map;
+    for (u32 i = 0; i < benchmark_size; ++i)
+        map.set(i, i);
+    EXPECT_EQ(map.size(), benchmark_size);
+}
+
+template<typename MapType>
+static MapType const& populated_map()
+{
+    static MapType map = [] {
+        MapType map;
+        for (u32 i = 0; i < benchmark_size; ++i)
+            map.set(i * 2, i);
+        return map;
+    }();
+    return map;
+}
+
+template<typename MapType>
+static void lookup_hit_benchmark()
+{
+    auto const& map = populated_map<MapType>();
+    u32 found = 0;
+    for (u32 i = 0; i < benchmark_size; ++i)
+        found += map.contains(i * 2);
+    EXPECT_EQ(found, benchmark_size);
+}
+
+template<typename MapType>
+static void lookup_miss_benchmark()
+{
+    auto const& map = populated_map<MapType>();
+    u32 found = 0;
+    for (u32 i = 0; i < benchmark_size; ++i)
+        found += map.contains(i * 2 + 1);
+    EXPECT_EQ(found, 0u);
+}
+
+template<typename MapType>
+static void iteration_benchmark()
+{
+    auto const& map = populated_map<MapType>();
+    u64 sum = 0;
+    for (int i = 0; i < 10; ++i) {
+        for (auto& entry : map)
+            sum += entry.value;
+    }
+    EXPECT_EQ(sum, 10 * (static_cast<u64>(benchmark_size) * (benchmark_size - 1) / 2));
+}
+
+BENCHMARK_CASE(hash_map_insert)
+{
+    insert_benchmark<HashMap<u32, u32>>();
+}
+
+BENCHMARK_CASE(flat_hash_map_insert)
+{
+    insert_benchmark<FlatHashMap<u32, u32>>();
+}
+
+BENCHMARK_CASE(hash_map_lookup_hit)
+{
+    lookup_hit_benchmark<HashMap<u32, u32>>();
+}
+
+BENCHMARK_CASE(flat_hash_map_lookup_hit)
+{
+    lookup_hit_benchmark<FlatHashMap<u32, u32>>();
+}
+
+BENCHMARK_CASE(hash_map_lookup_miss)
+{
+    lookup_miss_benchmark<HashMap<u32, u32>>();
+}
+
+BENCHMARK_CASE(flat_hash_map_lookup_miss)
+{
+    lookup_miss_benchmark<FlatHashMap<u32, u32>>();
+}
+
+BENCHMARK_CASE(hash_map_iteration)
+{
+    iteration_benchmark<HashMap<u32, u32>>();
+}
+
+BENCHMARK_CASE(flat_hash_map_iteration)
+{
+    iteration_benchmark<FlatHashMap<u32, u32>>();
+}
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/DeprecatedString.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonPullParser.h>
+#include <AK/JsonValue.h>
+#include <AK/StringBuilder.h>
+
+using TokenType = JsonPullParser::TokenType;
+
+static ErrorOr<void> parse_all(StringView input)
+{
+    JsonPullParser parser(input);
+    for (;;) {
+        auto token = TRY(parser.next_token());
+        if (token.type == TokenType::EndOfInput)
+            return {};
+    }
+}
+
+TEST_CASE(tokens)
+{
+    JsonPullParser parser(R"( {"a": [1, -2.5e3, true, false, null], "b": {}, "c": "d"} )"sv);
+
+    auto expect_token = [&](TokenType type, StringView text = {}) {
+        auto token = MUST(parser.next_token());
+        EXPECT_EQ(token.type, type);
+        EXPECT_EQ(token.text, text);
+    };
+
+    expect_token(TokenType::ObjectStart);
+    expect_token(TokenType::Key, "a"sv);
+    expect_token(TokenType::ArrayStart);
+    expect_token(TokenType::Number, "1"sv);
+    expect_token(TokenType::Number, "-2.5e3"sv);
+    expect_token(TokenType::True);
+    expect_token(TokenType::False);
+    expect_token(TokenType::Null);
+    expect_token(TokenType::ArrayEnd);
+    expect_token(TokenType::Key, "b"sv);
+    expect_token(TokenType::ObjectStart);
+    expect_token(TokenType::ObjectEnd);
+    expect_token(TokenType::Key, "c"sv);
+    expect_token(TokenType::String, "d"sv);
+    expect_token(TokenType::ObjectEnd);
+    expect_token(TokenType::EndOfInput);
+}
+
+TEST_CASE(strings_without_escapes_are_not_copied)
+{
+    auto input = R"(["a string that is longer than sixteen bytes"])"sv;
+    JsonPullParser parser(input);
+    MUST(parser.next_token());
+
+    auto token = MUST(parser.next_token());
+    EXPECT_EQ(token.type, TokenType::String);
+    EXPECT_EQ(token.text, "a string that is longer than sixteen bytes"sv);
+    EXPECT_EQ(token.text.characters_without_null_termination(), input.characters_without_null_termination() + 2);
+}
+
+TEST_CASE(string_escapes)
+{
+    auto read_string = [](StringView input) {
+        JsonPullParser parser(input);
+        return MUST(parser.read<DeprecatedString>());
+    };
+
+    EXPECT_EQ(read_string(R"("\"\\\/\n\r\t\b\f")"sv), "\"\\/\n\r\t\b\f"sv);
+    EXPECT_EQ(read_string(R"("before \u00e9 after, padded to more than sixteen bytes")"sv), "before \xc3\xa9 after, padded to more than sixteen bytes"sv);
+    EXPECT_EQ(read_string(R"("\ud83d\ude00")"sv), "\xf0\x9f\x98\x80"sv);
+
+    // A string longer than the parser's unescaping buffer has to stay intact.
+    StringBuilder builder;
+    builder.append("\"\\n"sv);
+    for (size_t i = 0; i < 1000; ++i)
+        builder.append("abcdefghij"sv);
+    builder.append('"');
+    auto long_string = read_string(builder.string_view());
+    EXPECT_EQ(long_string.length(), 10001u);
+    EXPECT(long_string.ends_with("ghij"sv));
+}
+
+TEST_CASE(matches_json_parser_on_number_validation)
+{
+    auto inputs = Array {
+        "-"sv, "00"sv, "-01"sv, ".1"sv, "1."sv, "1.e1"sv, "1e"sv, "1e+"sv, "+1"sv, "0x1"sv, "1x"sv, "1e1e1"sv,
+        "0"sv, "-0"sv, "1.5"sv, "-1.5e-10"sv, "1E+2"sv, "123456789012345678901234567890"sv
+    };
+    for (auto input : inputs)
+        EXPECT_EQ(parse_all(input).is_error(), JsonValue::from_string(input).is_error());
+}
+
+TEST_CASE(malformed_documents)
+{
+    EXPECT(parse_all(""sv).is_error());
+    EXPECT(parse_all("["sv).is_error());
+    EXPECT(parse_all("[1,]"sv).is_error());
+    EXPECT(parse_all("[1 2]"sv).is_error());
+    EXPECT(parse_all("{\"a\" 1}"sv).is_error());
+    EXPECT(parse_all("{\"a\": 1,}"sv).is_error());
+    EXPECT(parse_all("{1: 1}"sv).is_error());
+    EXPECT(parse_all("[}"sv).is_error());
+    EXPECT(parse_all("{]"sv).is_error());
+    EXPECT(parse_all("[] []"sv).is_error());
+    EXPECT(parse_all("\"unterminated"sv).is_error());
+    EXPECT(parse_all("\"control\ncharacter\""sv).is_error());
+    EXPECT(parse_all("\"\\x\""sv).is_error());
+    EXPECT(parse_all("\"\\u12\""sv).is_error());
+    EXPECT(parse_all("tru"sv).is_error());
+
+    EXPECT(!parse_all("[[], {}, [[1]], {\"a\": {\"b\": []}}]"sv).is_error());
+}
+
+TEST_CASE(truncated_escapes)
+{
+    EXPECT(parse_all("\"abc\\"sv).is_error());
+    EXPECT(parse_all("[\"abc\\"sv).is_error());
+    EXPECT(parse_all("\"\\u"sv).is_error());
+    EXPECT(parse_all("\"\\u12"sv).is_error());
+    EXPECT(parse_all("\"\\ud83d\\u"sv).is_error());
+    EXPECT(parse_all("\"\\ud83d\\ude"sv).is_error());
+}
+
+TEST_CASE(skip_value)
+{
+    JsonPullParser parser(R"([{"a": [1, {"b": 2}], "c": "d"}, 3])"sv);
+    EXPECT_EQ(MUST(parser.next_token()).type, TokenType::ArrayStart);
+    MUST(parser.skip_value());
+
+    auto token = MUST(parser.next_token());
+    EXPECT_EQ(token.type, TokenType::Number);
+    EXPECT_EQ(token.text, "3"sv);
+    EXPECT_EQ(MUST(parser.next_token()).type, TokenType::ArrayEnd);
+    EXPECT_EQ(MUST(parser.next_token()).type, TokenType::EndOfInput);
+}
+
+struct Thread {
+    i32 tid { 0 };
+    DeprecatedString name;
+};
+
+struct Process {
+    u32 pid { 0 };
+    bool kernel { false };
+    double load { 0 };
+    Vector<Thread> threads;
+};
+
+TEST_CASE(deserialize_into_structs)
+{
+    JsonPullParser parser(R"({
+        "processes": [
+            { "pid": 1, "kernel": true, "load": 0.5, "unknown": { "nested": [1, 2, 3] }, "threads": [{ "tid": 1, "name": "init" }] },
+            { "pid": 42, "kernel": false, "load": 1e2, "threads": [{ "tid": 42, "name": "a\tb" }, { "tid": 43, "name": "c" }] }
+        ],
+        "total": 2
+    })"sv);
+
+    Vector<Process> processes;
+    u64 total = 0;
+
+    auto result = parser.for_each_member([&](StringView key) -> ErrorOr<void> {
+        if (key == "total"sv)
+            return parser.read_into(total);
+        if (key != "processes"sv)
+            return {};
+        return parser.for_each_element([&]() -> ErrorOr<void> {
+            Process process;
+            TRY(parser.for_each_member([&](StringView key) -> ErrorOr<void> {
+                if (key == "pid"sv)
+                    return parser.read_into(process.pid);
+                if (key == "kernel"sv)
+                    return parser.read_into(process.kernel);
+                if (key == "load"sv)
+                    return parser.read_into(process.load);
+                if (key == "threads"sv) {
+                    return parser.for_each_element([&]() -> ErrorOr<void> {
+                        Thread thread;
+                        TRY(parser.for_each_member([&](StringView key) -> ErrorOr<void> {
+                            if (key == "tid"sv)
+                                return parser.read_into(thread.tid);
+                            if (key == "name"sv)
+                                return parser.read_into(thread.name);
+                            return {};
+                        }));
+                        process.threads.append(move(thread));
+                        return {};
+                    });
+                }
+                return {};
+            }));
+            processes.append(move(process));
+            return {};
+        });
+    });
+
+    EXPECT(!result.is_error());
+    EXPECT_EQ(total, 2u);
+    EXPECT_EQ(processes.size(), 2u);
+    EXPECT_EQ(processes[0].pid, 1u);
+    EXPECT(processes[0].kernel);
+    EXPECT_EQ(processes[0].load, 0.5);
+    EXPECT_EQ(processes[0].threads.size(), 1u);
+    EXPECT_EQ(processes[0].threads[0].name, "init"sv);
+    EXPECT_EQ(processes[1].pid, 42u);
+    EXPECT(!processes[1].kernel);
+    EXPECT_EQ(processes[1].load, 100.0);
+    EXPECT_EQ(processes[1].threads.size(), 2u);
+    EXPECT_EQ(processes[1].threads[0].name, "a\tb"sv);
+    EXPECT_EQ(processes[1].threads[1].tid, 43);
+}
+
+TEST_CASE(read_into_type_mismatch)
+{
+    u8 byte = 0;
+    u32 unsigned_number = 0;
+    bool boolean = false;
+
+    EXPECT(JsonPullParser(R"("1")"sv).read_into(unsigned_number).is_error());
+    EXPECT(JsonPullParser(R"(300)"sv).read_into(byte).is_error());
+    EXPECT(JsonPullParser(R"(-1)"sv).read_into(unsigned_number).is_error());
+    EXPECT(JsonPullParser(R"(1.5)"sv).read_into(unsigned_number).is_error());
+    EXPECT(JsonPullParser(R"(null)"sv).read_into(boolean).is_error());
+}
+
+static DeprecatedString make_benchmark_document()
+{
+    StringBuilder builder;
+    builder.append("{\"processes\":["sv);
+    for (size_t i = 0; i < 1000; ++i) {
+        if (i != 0)
+            builder.append(',');
+        builder.appendff(R"({{"pid":{},"name":"process number {}","executable":"/usr/bin/process","kernel":false,"amount_virtual":{},"threads":[{{"tid":{},"name":"main thread","state":"Running","time_user":{}}}]}})", i, i, i * 4096, i, i * 1000);
+    }
+    builder.append("]}"sv);
+    return builder.to_deprecated_string();
+}
+
+BENCHMARK_CASE(tokenize_document)
+{
+    auto document = make_benchmark_document();
+    for (size_t i = 0; i < 100; ++i)
+        MUST(parse_all(document));
+}
+
+BENCHMARK_CASE(json_value_document)
+{
+    auto document = make_benchmark_document();
+    for (size_t i = 0; i < 100; ++i)
+        (void)MUST(JsonValue::from_string(document));
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteBuffer.h>
+#include <AK/MemoryStream.h>
+#include <Kernel/API/ProcessStatistics.h>
+#include <LibCore/ProcessStatisticsReader.h>
+#include <LibTest/TestCase.h>
+
+struct TestThread {
+    i32 tid;
+    u64 time_user;
+    StringView name;
+    StringView state;
+};
+
+struct TestProcess {
+    i32 pid;
+    u32 uid;
+    StringView name;
+    StringView executable;
+    Vector<TestThread> threads;
+};
+
+static ByteBuffer make_binary_snapshot(u64 generation, Vector<TestProcess> const& processes)
+{
+    ByteBuffer buffer;
+    auto append_record = [&](auto const& record) {
+        buffer.append(&record, sizeof(record));
+    };
+
+    ProcessStatisticsHeader header {};
+    header.magic = PROCESS_STATISTICS_MAGIC;
+    header.version = PROCESS_STATISTICS_VERSION;
+    header.generation = generation;
+    header.total_time_scheduled = 1000;
+    header.total_time_scheduled_kernel = 100;
+    append_record(header);
+
+    for (auto const& process : processes) {
+        ProcessStatisticsRecord record {};
+        record.type = ProcessStatisticsRecordType::Process;
+        record.pid = process.pid;
+        record.uid = process.uid;
+        record.amount_virtual = 0x1'0000'0000;
+        record.name_length = process.name.length();
+        record.executable_length = process.executable.length();
+        record.pledge_length = 5;
+        append_record(record);
+        buffer.append(process.name.bytes());
+        buffer.append(process.executable.bytes());
+        buffer.append("stdio"sv.bytes());
+
+        for (auto const& thread : process.threads) {
+            ThreadStatisticsRecord thread_record {};
+            thread_record.type = ProcessStatisticsRecordType::Thread;
+            thread_record.tid = thread.tid;
+            thread_record.time_user = thread.time_user;
+            thread_record.name_length = thread.name.length();
+            thread_record.state_length = thread.state.length();
+            append_record(thread_record);
+            buffer.append(thread.name.bytes());
+            buffer.append(thread.state.bytes());
+        }
+    }
+    return buffer;
+}
+
+static ErrorOr<void> update(ByteBuffer const& buffer, Core::AllProcessesStatistics& statistics)
+{
+    FixedMemoryStream stream { buffer.bytes() };
+    return Core::ProcessStatisticsReader::update(stream, statistics, false);
+}
+
+TEST_CASE(json)
+{
+    auto json = R"({
+        "processes": [
+            { "pid": 1, "uid": 100, "name": "init", "pledge": "", "amount_virtual": 4294967296, "threads": [{ "tid": 1, "name": "init", "state": "Running" }] }
+        ],
+        "total_time": 1000,
+        "total_time_kernel": 100
+    })"sv;
+    FixedMemoryStream stream { json.bytes() };
+    auto statistics = MUST(Core::ProcessStatisticsReader::get_all(stream, false));
+
+    EXPECT_EQ(statistics.generation, 0u);
+    EXPECT_EQ(statistics.total_time_scheduled, 1000u);
+    EXPECT_EQ(statistics.total_time_scheduled_kernel, 100u);
+    EXPECT_EQ(statistics.processes.size(), 1u);
+    EXPECT_EQ(statistics.processes[0].pid, 1);
+    EXPECT_EQ(statistics.processes[0].uid, 100u);
+    EXPECT_EQ(statistics.processes[0].name, "init"sv);
+    EXPECT_EQ(statistics.processes[0].amount_virtual, 0x1'0000'0000u);
+    EXPECT_EQ(statistics.processes[0].threads.size(), 1u);
+    EXPECT_EQ(statistics.processes[0].threads[0].state, "Running"sv);
+}
+
+TEST_CASE(binary)
+{
+    auto buffer = make_binary_snapshot(5, {
+                                              { 1, 100, "init"sv, "/bin/SystemServer"sv, { { 1, 10, "init"sv, "Running"sv } } },
+                                              { 7, 100, "Shell"sv, "/bin/Shell"sv, { { 7, 20, "Shell"sv, "Blocked"sv }, { 8, 30, "Worker"sv, "Runnable"sv } } },
+                                          });
+    FixedMemoryStream stream { buffer.bytes() };
+    auto statistics = MUST(Core::ProcessStatisticsReader::get_all(stream, false));
+
+    EXPECT_EQ(statistics.generation, 5u);
+    EXPECT_EQ(statistics.total_time_scheduled, 1000u);
+    EXPECT_EQ(statistics.processes.size(), 2u);
+    EXPECT_EQ(statistics.processes[0].executable, "/bin/SystemServer"sv);
+    EXPECT_EQ(statistics.processes[0].pledge, "stdio"sv);
+    EXPECT_EQ(statistics.processes[0].amount_virtual, 0x1'0000'0000u);
+    EXPECT_EQ(statistics.processes[1].pid, 7);
+    EXPECT_EQ(statistics.processes[1].threads.size(), 2u);
+    EXPECT_EQ(statistics.processes[1].threads[1].tid, 8);
+    EXPECT_EQ(statistics.processes[1].threads[1].time_user, 30u);
+    EXPECT_EQ(statistics.processes[1].threads[1].name, "Worker"sv);
+    EXPECT_EQ(statistics.processes[1].threads[1].state, "Runnable"sv);
+}
+
+TEST_CASE(binary_update_reuses_strings)
+{
+    Core::AllProcessesStatistics statistics {};
+    MUST(update(make_binary_snapshot(5, { { 7, 100, "Shell"sv, "/bin/Shell"sv, { { 7, 20, "Shell"sv, "Blocked"sv } } } }), statistics));
+    auto const* executable = statistics.processes[0].executable.characters();
+
+    MUST(update(make_binary_snapshot(5, { { 7, 100, "Shell"sv, "/bin/Shell"sv, { { 7, 25, "Shell"sv, "Running"sv } } } }), statistics));
+    EXPECT_EQ(statistics.processes[0].executable.characters(), executable);
+    EXPECT_EQ(statistics.processes[0].threads[0].time_user, 25u);
+    EXPECT_EQ(statistics.processes[0].threads[0].state, "Running"sv);
+
+    // A new process showed up in front, so the kernel bumped the generation.
+    MUST(update(make_binary_snapshot(6, {
+                                            { 9, 0, "ls"sv, "/bin/ls"sv, { { 9, 1, "ls"sv, "Running"sv } } },
+                                            { 7, 100, "Shell"sv, "/bin/Shell"sv, {} },
+                                        }),
+        statistics));
+    EXPECT_EQ(statistics.generation, 6u);
+    EXPECT_EQ(statistics.processes.size(), 2u);
+    EXPECT_EQ(statistics.processes[0].executable, "/bin/ls"sv);
+    EXPECT_EQ(statistics.processes[1].executable.characters(), executable);
+    EXPECT(statistics.processes[1].threads.is_empty());
+}
+
+TEST_CASE(binary_truncated)
+{
+    auto buffer = make_binary_snapshot(5, { { 7, 100, "Shell"sv, "/bin/Shell"sv, { { 7, 20, "Shell"sv, "Blocked"sv } } } });
+    auto end_of_process = sizeof(ProcessStatisticsHeader) + sizeof(ProcessStatisticsRecord) + "Shell/bin/Shellstdio"sv.length();
+    for (size_t size = 1; size < buffer.size(); ++size) {
+        // Cutting the snapshot between two records leaves a valid, shorter snapshot behind.
+        if (size == sizeof(ProcessStatisticsHeader) || size == end_of_process)
+            continue;
+        FixedMemoryStream stream { buffer.bytes().trim(size) };
+        EXPECT(Core::ProcessStatisticsReader::get_all(stream, false).is_error());
+    }
+}
+
+TEST_CASE(binary_update_keeps_previous_snapshot_on_error)
+{
+    Core::AllProcessesStatistics statistics {};
+    MUST(update(make_binary_snapshot(5, { { 7, 100, "Shell"sv, "/bin/Shell"sv, { { 7, 20, "Shell"sv, "Blocked"sv } } } }), statistics));
+
+    auto buffer = make_binary_snapshot(5, { { 7, 100, "Shell"sv, "/bin/Shell"sv, { { 7, 25, "Shell"sv, "Running"sv } } } });
+    EXPECT(update(MUST(buffer.slice(0, buffer.size() - 1)), statistics).is_error());
+
+    EXPECT_EQ(statistics.generation, 5u);
+    EXPECT_EQ(statistics.processes.size(), 1u);
+    EXPECT_EQ(statistics.processes[0].name, "Shell"sv);
+    EXPECT_EQ(statistics.processes[0].executable, "/bin/Shell"sv);
+    EXPECT_EQ(statistics.processes[0].threads.size(), 1u);
+    EXPECT_EQ(statistics.processes[0].threads[0].time_user, 20u);
+    EXPECT_EQ(statistics.processes[0].threads[0].state, "Blocked"sv);
+}
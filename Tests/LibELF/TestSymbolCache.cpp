@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/CharacterTypes.h>
+#include <AK/GenericLexer.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibTest/TestCase.h>
+#include <dlfcn.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+struct SymbolCacheStatistics {
+    bool enabled { false };
+    size_t lookups { 0 };
+    size_t hits { 0 };
+    size_t invalidations { 0 };
+};
+
+// Runs a dynamically linked program and returns what the loader reported about its symbol cache on stderr.
+static ErrorOr<SymbolCacheStatistics> symbol_cache_statistics_of_program_start(Vector<char const*> environment)
+{
+    auto stderr_fds = TRY(Core::System::pipe2(O_CLOEXEC));
+
+    posix_spawn_file_actions_t file_actions;
+    posix_spawn_file_actions_init(&file_actions);
+    posix_spawn_file_actions_adddup2(&file_actions, stderr_fds[1], STDERR_FILENO);
+
+    char const* arguments[] = { "/bin/true", nullptr };
+    environment.append("_LOADER_SYMBOL_CACHE_STATISTICS=1");
+    environment.append(nullptr);
+    auto pid = TRY(Core::System::posix_spawn("/bin/true"sv, &file_actions, nullptr, const_cast<char**>(arguments), const_cast<char**>(environment.data())));
+    posix_spawn_file_actions_destroy(&file_actions);
+    TRY(Core::System::close(stderr_fds[1]));
+
+    auto stderr_file = TRY(Core::File::adopt_fd(stderr_fds[0], Core::File::OpenMode::Read));
+    auto output = TRY(stderr_file->read_until_eof());
+    auto result = TRY(Core::System::waitpid(pid));
+    if (!WIFEXITED(result.status) || WEXITSTATUS(result.status) != 0)
+        return Error::from_string_literal("Program didn't exit successfully");
+
+    GenericLexer lexer { StringView { output.bytes() } };
+    if (!lexer.consume_specific("Symbol cache: "sv))
+        return Error::from_string_literal("Loader didn't report symbol cache statistics");
+    if (lexer.consume_specific("disabled"sv))
+        return SymbolCacheStatistics {};
+
+    auto consume_number = [&](StringView suffix) -> ErrorOr<size_t> {
+        auto number = lexer.consume_while(is_ascii_digit).to_uint<size_t>();
+        if (!number.has_value() || !lexer.consume_specific(suffix))
+            return Error::from_string_literal("Malformed symbol cache statistics");
+        return number.release_value();
+    };
+    SymbolCacheStatistics statistics { .enabled = true };
+    statistics.lookups = TRY(consume_number(" lookups, "sv));
+    statistics.hits = TRY(consume_number(" hits, "sv));
+    statistics.invalidations = TRY(consume_number(" invalidations"sv));
+    return statistics;
+}
+
+TEST_CASE(symbol_cache_hits_at_startup)
+{
+    auto statistics = TRY_OR_FAIL(symbol_cache_statistics_of_program_start({}));
+    EXPECT(statistics.enabled);
+    EXPECT(statistics.lookups > 0);
+    EXPECT(statistics.hits > 0);
+    EXPECT(statistics.hits < statistics.lookups);
+
+    // All libraries are mapped before the first lookup, so nothing should have thrown the cache away.
+    EXPECT_EQ(statistics.invalidations, 0u);
+}
+
+TEST_CASE(symbol_cache_can_be_disabled)
+{
+    auto statistics = TRY_OR_FAIL(symbol_cache_statistics_of_program_start({ "_LOADER_DISABLE_SYMBOL_CACHE=1" }));
+    EXPECT(!statistics.enabled);
+}
+
+TEST_CASE(symbols_of_libraries_loaded_later_are_found)
+{
+    typedef int (*dynlib_func_t)();
+
+    // Looking the symbol up before the library is loaded must not leave a stale "not found" behind.
+    EXPECT_EQ(dlsym(RTLD_DEFAULT, "dynlibb_function"), nullptr);
+
+    auto libb = dlopen("/usr/Tests/LibELF/libDynlibB.so", 0);
+    EXPECT_NE(libb, nullptr);
+    if (libb == nullptr) {
+        warnln("can't open libDynlibB.so, {}", dlerror());
+        return;
+    }
+
+    auto func_b = (dynlib_func_t)dlsym(RTLD_DEFAULT, "dynlibb_function");
+    EXPECT_NE(func_b, nullptr);
+    EXPECT_EQ(0, func_b());
+
+    dlclose(libb);
+}
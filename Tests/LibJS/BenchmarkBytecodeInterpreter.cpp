@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/AST.h>
+#include <LibJS/Bytecode/Generator.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Interpreter.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+// Small Octane/Kraken-style kernels that spend most of their time in the bytecode dispatch loop.
+static void run_benchmark(StringView source)
+{
+    auto vm = MUST(JS::VM::create());
+    auto ast_interpreter = JS::Interpreter::create<JS::GlobalObject>(*vm);
+    auto script = MUST(JS::Script::parse(source, ast_interpreter->realm()));
+    JS::Bytecode::Interpreter bytecode_interpreter(ast_interpreter->realm());
+
+    auto executable = MUST(JS::Bytecode::Generator::generate(script->parse_node()));
+    JS::Bytecode::Interpreter::optimization_pipeline().perform(*executable);
+
+    auto result = bytecode_interpreter.run(*executable);
+    if (result.is_error())
+        FAIL("unexpected exception");
+}
+
+BENCHMARK_CASE(loops_and_branches)
+{
+    run_benchmark(R"(
+        let sum = 0;
+        for (let i = 0; i < 2000000; ++i) {
+            if (i % 3 === 0)
+                sum += i;
+            else if (i % 3 === 1)
+                sum -= 1;
+            else
+                sum ^= i;
+        }
+    )"sv);
+}
+
+BENCHMARK_CASE(property_access)
+{
+    run_benchmark(R"(
+        function Point(x, y) {
+            this.x = x;
+            this.y = y;
+        }
+        Point.prototype.length = function () {
+            return this.x * this.x + this.y * this.y;
+        };
+        let total = 0;
+        for (let i = 0; i < 300000; ++i) {
+            const point = new Point(i, i + 1);
+            point.x = point.y;
+            total += point.length();
+        }
+    )"sv);
+}
+
+BENCHMARK_CASE(recursive_calls)
+{
+    run_benchmark(R"(
+        function fib(n) {
+            return n < 2 ? n : fib(n - 1) + fib(n - 2);
+        }
+        fib(25);
+    )"sv);
+}
+
+BENCHMARK_CASE(exceptions)
+{
+    run_benchmark(R"(
+        let caught = 0;
+        for (let i = 0; i < 100000; ++i) {
+            try {
+                if (i % 2)
+                    throw i;
+            } catch (e) {
+                ++caught;
+            } finally {
+                --caught;
+            }
+        }
+    )"sv);
+}
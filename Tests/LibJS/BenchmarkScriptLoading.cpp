@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibJS/Interpreter.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+// A bundler-style script: a table of module factories, each with a handful of nested helpers, of which only a few are
+// ever called while the script is loading.
+static DeprecatedString make_bundle_source()
+{
+    StringBuilder builder;
+    builder.append("const modules = [\n"sv);
+    for (size_t module = 0; module < 500; ++module) {
+        builder.appendff("function (exports) {{\n");
+        for (size_t helper = 0; helper < 20; ++helper) {
+            builder.appendff(R"(
+                function helper{}(items, options) {{
+                    const result = [];
+                    for (const item of items) {{
+                        if (options && options.filter && !options.filter(item))
+                            continue;
+                        result.push({{ key: `${{item.name}}-{}`, value: item.value * {} }});
+                    }}
+                    return result.map(entry => entry.value).reduce((a, b) => a + b, 0);
+                }}
+                exports.helper{} = helper{};
+            )",
+                helper, helper, module, helper, helper);
+        }
+        builder.append("},\n"sv);
+    }
+    builder.append("];\n"sv);
+    builder.append("const exports = {};\n"sv);
+    builder.append("for (let i = 0; i < modules.length; i += 50) modules[i](exports);\n"sv);
+    builder.append("exports.helper0([{ name: 'a', value: 1 }]);\n"sv);
+    return builder.to_deprecated_string();
+}
+
+static DeprecatedString const& bundle_source()
+{
+    static auto source = make_bundle_source();
+    return source;
+}
+
+BENCHMARK_CASE(parse_bundle)
+{
+    auto vm = MUST(JS::VM::create());
+    auto interpreter = JS::Interpreter::create<JS::GlobalObject>(*vm);
+    for (size_t i = 0; i < 5; ++i)
+        (void)MUST(JS::Script::parse(bundle_source(), interpreter->realm(), "bundle.js"sv));
+}
+
+BENCHMARK_CASE(parse_and_run_bundle)
+{
+    auto vm = MUST(JS::VM::create());
+    auto interpreter = JS::Interpreter::create<JS::GlobalObject>(*vm);
+    // A filename of its own keeps Script::parse from handing out the program that parse_bundle left behind.
+    auto script = MUST(JS::Script::parse(bundle_source(), interpreter->realm(), "run-bundle.js"sv));
+    if (interpreter->run(*script).is_error())
+        FAIL("unexpected exception");
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/AST.h>
+#include <LibJS/Bytecode/Generator.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Interpreter.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+// String building patterns as they show up in templating code, most of which look at the string while it's being built.
+static void run_benchmark(StringView source)
+{
+    auto vm = MUST(JS::VM::create());
+    auto ast_interpreter = JS::Interpreter::create<JS::GlobalObject>(*vm);
+    auto script = MUST(JS::Script::parse(source, ast_interpreter->realm()));
+    JS::Bytecode::Interpreter bytecode_interpreter(ast_interpreter->realm());
+
+    auto executable = MUST(JS::Bytecode::Generator::generate(script->parse_node()));
+    JS::Bytecode::Interpreter::optimization_pipeline().perform(*executable);
+
+    auto result = bytecode_interpreter.run(*executable);
+    if (result.is_error())
+        FAIL("unexpected exception");
+}
+
+BENCHMARK_CASE(append_and_check_length)
+{
+    run_benchmark(R"(
+        let html = "";
+        for (let i = 0; i < 10000; ++i) {
+            html += `<li class="item-${i % 7}">${i}</li>`;
+            if (html.length > 100000000)
+                throw new Error("too long");
+        }
+    )"sv);
+}
+
+BENCHMARK_CASE(append_without_looking)
+{
+    run_benchmark(R"(
+        let html = "";
+        for (let i = 0; i < 200000; ++i)
+            html += "<td>" + i + "</td>";
+        if (html.length === 0)
+            throw new Error("empty");
+    )"sv);
+}
+
+BENCHMARK_CASE(append_and_read_utf16)
+{
+    run_benchmark(R"(
+        let text = "";
+        let checksum = 0;
+        for (let i = 0; i < 5000; ++i) {
+            text += "Grüße " + i + " ";
+            checksum += text.charCodeAt(text.length - 2);
+        }
+    )"sv);
+}
+
+BENCHMARK_CASE(join_parts)
+{
+    run_benchmark(R"(
+        for (let i = 0; i < 2000; ++i) {
+            const parts = [];
+            for (let j = 0; j < 50; ++j)
+                parts.push(`${i}:${j}`);
+            const joined = parts.join(",");
+            if (!joined.startsWith(`${i}:0`))
+                throw new Error("bad join");
+        }
+    )"sv);
+}
@@ -137,3 +137,49 @@ TEST_CASE(catch_exception)
                             "if (hitCatch !== true) throw new Exception('failed');\n"
                             "if (hitFinally !== true) throw new Exception('failed');");
 }
+
+TEST_CASE(register_allocation_and_fusion)
+{
+    SETUP_AND_PARSE("var o = { x: 1 };\n"
+                    "var s = 0;\n"
+                    "for (var i = 0; i < 10; i++) {\n"
+                    "    if (i % 3 === 0) s += o.x;\n"
+                    "    s += 2 * 3;\n"
+                    "}\n"
+                    "if (s !== 64) throw new Exception('failed');");
+
+    auto executable = MUST(JS::Bytecode::Generator::generate(program));
+    auto& passes = JS::Bytecode::Interpreter::optimization_pipeline(JS::Bytecode::Interpreter::OptimizationLevel::Optimize);
+    passes.perform(*executable);
+
+    auto const& statistics = executable->optimization_statistics;
+    EXPECT(statistics.has_value());
+    EXPECT(statistics->instructions_after < statistics->instructions_before);
+    EXPECT(statistics->registers_after < statistics->registers_before);
+
+    auto result = bytecode_interpreter.run(*executable);
+    EXPECT(!result.is_error());
+}
+
+TEST_CASE(constant_folding_in_full_block)
+{
+    // The merged block ends up almost full, so folding a constant must not leave the rest of it without room.
+    SETUP_AND_PARSE("var s = 0;\n"
+                    "for (var i = 0; i < 10; i++) s += i;\n"
+                    "var a = [];\n"
+                    "a.push(1); a.push(2); a.push(3); a.push(4); a.push(5); a.push(6); a.push(7); a.push(8);\n"
+                    "a.push(1); a.push(2); a.push(3); a.push(4); a.push(5); a.push(6); a.push(7); a.push(8);\n"
+                    "var b = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20];\n"
+                    "var o = { x: { y: { z: { w: 1 } } } };\n"
+                    "var t = o.x.y.z.w + o.x.y.z.w + o.x.y.z.w + o.x.y.z.w + o.x.y.z.w + o.x.y.z.w + o.x.y.z.w + o.x.y.z.w;\n"
+                    "t += o.x.y.z.w + o.x.y.z.w + o.x.y.z.w + o.x.y.z.w + o.x.y.z.w + o.x.y.z.w + o.x.y.z.w + o.x.y.z.w;\n"
+                    "t += 1 + 2;\n"
+                    "if (s !== 45 || a.length !== 16 || b.length !== 20 || t !== 19) throw new Exception('failed');");
+
+    auto executable = MUST(JS::Bytecode::Generator::generate(program));
+    auto& passes = JS::Bytecode::Interpreter::optimization_pipeline(JS::Bytecode::Interpreter::OptimizationLevel::Optimize);
+    passes.perform(*executable);
+
+    auto result = bytecode_interpreter.run(*executable);
+    EXPECT(!result.is_error());
+}
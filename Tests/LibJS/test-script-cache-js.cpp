@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ScopeGuard.h>
+#include <AK/StringBuilder.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibJS/AST.h>
+#include <LibJS/Interpreter.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+// Only scripts of a few KiB and up are worth keeping the parsed program around for.
+static DeprecatedString make_library_source(StringView extra_code = {})
+{
+    StringBuilder builder;
+    builder.append(extra_code);
+    for (size_t i = 0; i < 200; ++i)
+        builder.appendff("function helper{}(x) {{ return x + {}; }}\n", i, i);
+    builder.append("helper199(1);\n"sv);
+    return builder.to_deprecated_string();
+}
+
+TEST_CASE(programs_are_shared_between_realms)
+{
+    auto vm = MUST(JS::VM::create());
+    auto first_interpreter = JS::Interpreter::create<JS::GlobalObject>(*vm);
+    auto second_interpreter = JS::Interpreter::create<JS::GlobalObject>(*vm);
+    auto source = make_library_source();
+
+    auto first_script = MUST(JS::Script::parse(source, first_interpreter->realm(), "library.js"sv));
+    auto second_script = MUST(JS::Script::parse(source, second_interpreter->realm(), "library.js"sv));
+    EXPECT_EQ(&first_script->parse_node(), &second_script->parse_node());
+
+    // The same script in the same realm has to be a separate program.
+    auto third_script = MUST(JS::Script::parse(source, first_interpreter->realm(), "library.js"sv));
+    EXPECT_NE(&first_script->parse_node(), &third_script->parse_node());
+
+    // The filename ends up in the parse nodes, so it has to match as well.
+    auto fourth_script = MUST(JS::Script::parse(source, second_interpreter->realm(), "other.js"sv));
+    EXPECT_NE(&first_script->parse_node(), &fourth_script->parse_node());
+
+    EXPECT_EQ(MUST(first_interpreter->run(*first_script)).as_double(), 200);
+    EXPECT_EQ(MUST(second_interpreter->run(*second_script)).as_double(), 200);
+}
+
+TEST_CASE(programs_with_tagged_templates_are_not_shared)
+{
+    auto vm = MUST(JS::VM::create());
+    auto first_interpreter = JS::Interpreter::create<JS::GlobalObject>(*vm);
+    auto second_interpreter = JS::Interpreter::create<JS::GlobalObject>(*vm);
+    auto source = make_library_source("const tag = strings => strings; tag`template`;\n"sv);
+
+    auto first_script = MUST(JS::Script::parse(source, first_interpreter->realm()));
+    auto second_script = MUST(JS::Script::parse(source, second_interpreter->realm()));
+    EXPECT_NE(&first_script->parse_node(), &second_script->parse_node());
+}
+
+TEST_CASE(least_recently_used_programs_are_dropped)
+{
+    auto vm = MUST(JS::VM::create());
+    auto first_interpreter = JS::Interpreter::create<JS::GlobalObject>(*vm);
+    auto second_interpreter = JS::Interpreter::create<JS::GlobalObject>(*vm);
+
+    // The cache holds at most 128 programs.
+    Vector<NonnullRefPtr<JS::Program const>> programs;
+    Vector<DeprecatedString> sources;
+    for (size_t i = 0; i < 129; ++i) {
+        sources.append(make_library_source(DeprecatedString::formatted("var script{};\n", i)));
+        programs.append(MUST(JS::Script::parse(sources.last(), first_interpreter->realm()))->parse_node());
+    }
+
+    auto first_script = MUST(JS::Script::parse(sources.first(), second_interpreter->realm()));
+    EXPECT_NE(&first_script->parse_node(), programs.first().ptr());
+    auto last_script = MUST(JS::Script::parse(sources.last(), second_interpreter->realm()));
+    EXPECT_EQ(&last_script->parse_node(), programs.last().ptr());
+}
+
+static DeprecatedString create_preparse_data_cache_directory()
+{
+    char pattern[] = "/tmp/script-cache-test.XXXXXX";
+    auto directory = MUST(Core::System::mkdtemp(pattern)).to_deprecated_string();
+    JS::Script::set_preparse_data_cache_directory(directory);
+    return directory;
+}
+
+static Vector<DeprecatedString> files_in(DeprecatedString const& directory)
+{
+    Vector<DeprecatedString> paths;
+    MUST(Core::Directory::for_each_entry(directory, Core::DirIterator::SkipParentAndBaseDir, [&](auto const& entry, auto const& directory) -> ErrorOr<IterationDecision> {
+        paths.append(DeprecatedString::formatted("{}/{}", directory.path(), entry.name));
+        return IterationDecision::Continue;
+    }));
+    return paths;
+}
+
+TEST_CASE(preparse_data_is_kept_on_disk)
+{
+    auto directory = create_preparse_data_cache_directory();
+    ScopeGuard guard = [&] {
+        JS::Script::set_preparse_data_cache_directory({});
+        MUST(FileSystem::remove(directory, FileSystem::RecursionMode::Allowed));
+    };
+
+    auto vm = MUST(JS::VM::create());
+    auto first_interpreter = JS::Interpreter::create<JS::GlobalObject>(*vm);
+    auto second_interpreter = JS::Interpreter::create<JS::GlobalObject>(*vm);
+    auto source = make_library_source("function outer() {\n    function inner() { return arguments.length; }\n    return inner(1, 2);\n}\n"sv);
+
+    auto first_script = MUST(JS::Script::parse(source, first_interpreter->realm(), "first.js"sv));
+    EXPECT_EQ(files_in(directory).size(), 1u);
+
+    // Another filename keeps the parsed program cache out of the way, so this skips over the function bodies instead.
+    auto second_script = MUST(JS::Script::parse(source, second_interpreter->realm(), "second.js"sv));
+    EXPECT_NE(&first_script->parse_node(), &second_script->parse_node());
+    EXPECT_EQ(files_in(directory).size(), 1u);
+
+    EXPECT_EQ(MUST(second_interpreter->run(*second_script)).as_double(), 200);
+    auto check = MUST(JS::Script::parse("outer() === 2 && helper7.toString() === 'function helper7(x) { return x + 7; }'"sv, second_interpreter->realm()));
+    EXPECT(MUST(second_interpreter->run(*check)).as_bool());
+}
+
+TEST_CASE(malformed_preparse_data_is_ignored)
+{
+    auto directory = create_preparse_data_cache_directory();
+    ScopeGuard guard = [&] {
+        JS::Script::set_preparse_data_cache_directory({});
+        MUST(FileSystem::remove(directory, FileSystem::RecursionMode::Allowed));
+    };
+
+    auto vm = MUST(JS::VM::create());
+    auto first_interpreter = JS::Interpreter::create<JS::GlobalObject>(*vm);
+    auto second_interpreter = JS::Interpreter::create<JS::GlobalObject>(*vm);
+    auto source = make_library_source();
+
+    (void)MUST(JS::Script::parse(source, first_interpreter->realm(), "first.js"sv));
+    auto paths = files_in(directory);
+    EXPECT_EQ(paths.size(), 1u);
+
+    // Every function body now claims to end right after it starts.
+    auto file = MUST(Core::File::open(paths.first(), Core::File::OpenMode::ReadWrite));
+    auto bytes = MUST(file->read_until_eof());
+    for (size_t offset = 12; offset + 17 <= bytes.size(); offset += 17)
+        bytes.overwrite(offset + 4, bytes.data() + offset, 4);
+    MUST(file->seek(0, SeekMode::SetPosition));
+    MUST(file->write_until_depleted(bytes));
+    file->close();
+
+    auto second_script = MUST(JS::Script::parse(source, second_interpreter->realm(), "second.js"sv));
+    EXPECT_EQ(MUST(second_interpreter->run(*second_script)).as_double(), 200);
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibCore/ElapsedTimer.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+
+// Generated stand-ins for saved pages, shaped like the bulk of real documents: long runs of text, and markup with
+// many attributes.
+static constexpr size_t page_size = 4 * MiB;
+
+static DeprecatedString make_article_page()
+{
+    StringBuilder builder;
+    builder.append("<!DOCTYPE html><html><head><title>An article</title></head><body>\n"sv);
+    size_t paragraph = 0;
+    while (builder.length() < page_size) {
+        builder.appendff("<h2 id=\"section-{}\">Section {}</h2>\n<p>", paragraph, paragraph);
+        for (size_t sentence = 0; sentence < 8; ++sentence) {
+            builder.append("Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore "sv);
+            builder.append("et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris. "sv);
+            if (sentence % 3 == 0)
+                builder.append("Ça coûte très cher, naïve café — “quoted” text.\n"sv);
+        }
+        builder.append("<em>Emphasis</em> and a <a href=\"#top\">link</a> &amp; an entity.</p>\n"sv);
+        ++paragraph;
+    }
+    builder.append("</body></html>\n"sv);
+    return builder.to_deprecated_string();
+}
+
+static DeprecatedString make_markup_page()
+{
+    StringBuilder builder;
+    builder.append("<!DOCTYPE html><html><head><title>Markup</title></head><body><ul class=\"navigation\">\n"sv);
+    size_t item = 0;
+    while (builder.length() < page_size) {
+        builder.appendff("<li class=\"navigation-item navigation-item--level-2 is-collapsed\" data-item-id=\"{}\">", item);
+        builder.appendff("<a href=\"https://www.example.com/products/category/subcategory/item-{}?ref=navigation&amp;utm_source=menu\" ", item);
+        builder.append("title=\"A fairly long descriptive title for this item\" aria-label='Open the item page' rel=nofollow>"sv);
+        builder.append("<img src=\"/static/images/thumbnails/item.png\" alt=\"Thumbnail\" width=\"64\" height=\"64\" loading=\"lazy\">"sv);
+        builder.append("Item</a></li>\n"sv);
+        ++item;
+    }
+    builder.append("</ul></body></html>\n"sv);
+    return builder.to_deprecated_string();
+}
+
+static void tokenize_and_report(StringView name, StringView input)
+{
+    Web::HTML::HTMLTokenizer tokenizer { input, "utf-8" };
+    size_t token_count = 0;
+
+    auto timer = Core::ElapsedTimer::start_new();
+    for (;;) {
+        auto token = tokenizer.next_token();
+        if (!token.has_value())
+            break;
+        ++token_count;
+    }
+    auto microseconds = max(timer.elapsed_time().to_microseconds(), 1);
+
+    outln("{}: {} bytes, {} tokens in {} ms, {} MB/s", name, input.length(), token_count, microseconds / 1000, input.length() / microseconds);
+}
+
+BENCHMARK_CASE(article_page)
+{
+    auto page = make_article_page();
+    tokenize_and_report("article page"sv, page);
+}
+
+BENCHMARK_CASE(markup_page)
+{
+    auto page = make_markup_page();
+    tokenize_and_report("markup page"sv, page);
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/ElapsedTimer.h>
+#include <LibCore/EventLoop.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/ImageFormats/ImageDecoder.h>
+#include <LibGfx/ImageFormats/PNGWriter.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/HTML/AnimatedBitmapDecodedImageData.h>
+#include <LibWeb/HTML/DecodedImageCache.h>
+#include <LibWeb/Platform/EventLoopPluginSerenity.h>
+#include <LibWeb/Platform/ImageCodecPlugin.h>
+
+using Web::HTML::AnimatedBitmapDecodedImageData;
+using Web::HTML::DecodedImageCache;
+
+class TestImageCodecPlugin final : public Web::Platform::ImageCodecPlugin {
+public:
+    virtual Optional<Web::Platform::DecodedImage> decode_image(ReadonlyBytes bytes) override
+    {
+        ++decode_count;
+        auto decoder = Gfx::ImageDecoder::try_create_for_raw_bytes(bytes);
+        if (!decoder || decoder->frame_count() != 1)
+            return {};
+        auto frame = MUST(decoder->frame(0));
+        return Web::Platform::DecodedImage { false, 0, { { move(frame.image), 0 } } };
+    }
+
+    size_t decode_count { 0 };
+};
+
+static TestImageCodecPlugin& set_up()
+{
+    static Core::EventLoop s_event_loop;
+    static TestImageCodecPlugin* s_plugin = nullptr;
+    if (!s_plugin) {
+        Web::Platform::EventLoopPlugin::install(*new Web::Platform::EventLoopPluginSerenity);
+        s_plugin = new TestImageCodecPlugin;
+        Web::Platform::ImageCodecPlugin::install(*s_plugin);
+    }
+    DecodedImageCache::the().set_budget(DecodedImageCache::default_budget);
+    return *s_plugin;
+}
+
+static void finish_decoding()
+{
+    Core::EventLoop::current().pump(Core::EventLoop::WaitMode::PollForEvents);
+}
+
+static ByteBuffer make_encoded_image(Gfx::IntSize size, u32 seed)
+{
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, size));
+    for (int y = 0; y < size.height(); ++y) {
+        for (int x = 0; x < size.width(); ++x)
+            bitmap->set_pixel(x, y, Gfx::Color(static_cast<u8>(x + seed), static_cast<u8>(y + seed), static_cast<u8>((x ^ y) + seed)));
+    }
+    return MUST(Gfx::PNGWriter::encode(*bitmap));
+}
+
+static NonnullRefPtr<AnimatedBitmapDecodedImageData> make_image(ByteBuffer encoded_data)
+{
+    auto image = Web::Platform::ImageCodecPlugin::the().decode_image(encoded_data).release_value();
+    Vector<AnimatedBitmapDecodedImageData::Frame> frames;
+    frames.append({ image.frames.first().bitmap, 0 });
+    return MUST(AnimatedBitmapDecodedImageData::create(move(frames), 0, false, move(encoded_data)));
+}
+
+TEST_CASE(images_that_are_not_painted_are_dropped_beyond_the_budget)
+{
+    set_up();
+    auto& cache = DecodedImageCache::the();
+
+    auto first = make_image(make_encoded_image({ 100, 100 }, 1));
+    auto second = make_image(make_encoded_image({ 100, 100 }, 2));
+    auto size_of_one_image = first->decoded_size_in_bytes();
+    cache.set_budget(size_of_one_image * 3 / 2);
+
+    // Both images may still be on screen, so neither of them can be dropped yet.
+    EXPECT(first->is_decoded());
+    EXPECT(second->is_decoded());
+    EXPECT_EQ(cache.size_in_bytes(), size_of_one_image * 2);
+
+    // Once only the second image is painted, the first one is dropped.
+    for (size_t i = 0; i < 2; ++i) {
+        cache.did_start_painting();
+        EXPECT(second->bitmap(0, { 100, 100 }));
+    }
+    EXPECT(!first->is_decoded());
+    EXPECT(second->is_decoded());
+    EXPECT_EQ(cache.size_in_bytes(), size_of_one_image);
+
+    // Painting the first image again decodes it again, in the background.
+    cache.did_start_painting();
+    EXPECT(!first->bitmap(0, { 100, 100 }));
+    finish_decoding();
+    EXPECT(first->is_decoded());
+    EXPECT_EQ(first->bitmap(0, { 100, 100 })->size(), Gfx::IntSize(100, 100));
+}
+
+TEST_CASE(images_without_a_size_are_decoded_right_away)
+{
+    set_up();
+    auto& cache = DecodedImageCache::the();
+
+    auto image = make_image(make_encoded_image({ 100, 100 }, 3));
+    cache.set_budget(0);
+    for (size_t i = 0; i < 2; ++i)
+        cache.did_start_painting();
+    EXPECT(!image->is_decoded());
+
+    auto bitmap = image->bitmap(0);
+    EXPECT(bitmap);
+    EXPECT_EQ(bitmap->size(), Gfx::IntSize(100, 100));
+}
+
+TEST_CASE(images_are_decoded_again_at_their_display_size)
+{
+    set_up();
+
+    auto image = make_image(make_encoded_image({ 400, 300 }, 4));
+
+    // The full size frames get painted until the smaller ones have been decoded.
+    EXPECT_EQ(image->bitmap(0, { 100, 75 })->size(), Gfx::IntSize(400, 300));
+    finish_decoding();
+    EXPECT_EQ(image->bitmap(0, { 100, 75 })->size(), Gfx::IntSize(100, 75));
+    EXPECT_EQ(image->intrinsic_width(), 400);
+    EXPECT_EQ(image->intrinsic_height(), 300);
+
+    // Frames at their full size are decoded again for anyone who needs them.
+    EXPECT_EQ(image->bitmap(0)->size(), Gfx::IntSize(400, 300));
+}
+
+TEST_CASE(images_painted_at_several_sizes_are_decoded_for_the_largest)
+{
+    auto& plugin = set_up();
+    auto& cache = DecodedImageCache::the();
+
+    auto image = make_image(make_encoded_image({ 400, 400 }, 5));
+    auto paint = [&] {
+        cache.did_start_painting();
+        (void)image->bitmap(0, { 200, 200 });
+        (void)image->bitmap(0, { 50, 50 });
+        finish_decoding();
+    };
+
+    paint();
+    EXPECT_EQ(image->bitmap(0, { 200, 200 })->size(), Gfx::IntSize(200, 200));
+
+    plugin.decode_count = 0;
+    for (size_t i = 0; i < 4; ++i)
+        paint();
+    EXPECT_EQ(plugin.decode_count, 0u);
+    EXPECT_EQ(image->bitmap(0, { 50, 50 })->size(), Gfx::IntSize(200, 200));
+
+    // Once the image has not been painted at the larger size for a whole paint, it is decoded again at the smaller one.
+    for (size_t i = 0; i < 2; ++i) {
+        cache.did_start_painting();
+        (void)image->bitmap(0, { 50, 50 });
+        finish_decoding();
+    }
+    EXPECT_EQ(plugin.decode_count, 1u);
+    EXPECT_EQ(image->bitmap(0, { 50, 50 })->size(), Gfx::IntSize(50, 50));
+}
+
+// Loads a gallery of large photos that are shown as thumbnails, 12 at a time, and scrolls through it.
+BENCHMARK_CASE(image_gallery)
+{
+    auto& plugin = set_up();
+    auto& cache = DecodedImageCache::the();
+    cache.set_budget(16 * MiB);
+
+    static constexpr size_t image_count = 60;
+    static constexpr size_t images_on_screen = 12;
+    static constexpr Gfx::IntSize image_size { 1024, 768 };
+    static constexpr Gfx::IntSize thumbnail_size { 256, 192 };
+
+    Vector<ByteBuffer> encoded_images;
+    for (size_t i = 0; i < image_count; ++i)
+        encoded_images.append(make_encoded_image(image_size, i));
+
+    Vector<NonnullRefPtr<AnimatedBitmapDecodedImageData>> images;
+    size_t size_at_full_size = 0;
+    size_t peak_size = 0;
+    auto paint = [&](size_t first_on_screen) {
+        cache.did_start_painting();
+        for (size_t i = first_on_screen; i < min(first_on_screen + images_on_screen, images.size()); ++i)
+            (void)images[i]->bitmap(0, thumbnail_size);
+        finish_decoding();
+        peak_size = max(peak_size, cache.size_in_bytes());
+    };
+
+    plugin.decode_count = 0;
+    auto timer = Core::ElapsedTimer::start_new();
+
+    // The page gets painted as the images come in.
+    for (auto& encoded_image : encoded_images) {
+        images.append(make_image(move(encoded_image)));
+        size_at_full_size += images.last()->decoded_size_in_bytes();
+        peak_size = max(peak_size, cache.size_in_bytes());
+        paint(0);
+    }
+
+    for (size_t first_on_screen = 0; first_on_screen + images_on_screen <= image_count; first_on_screen += images_on_screen / 4)
+        paint(first_on_screen);
+
+    outln("image gallery: {} images, {} KiB decoded at full size, at most {} KiB with a budget of {} KiB, {} decodes in {} ms",
+        image_count, size_at_full_size / KiB, peak_size / KiB, cache.budget() / KiB, plugin.decode_count, timer.elapsed_time().to_milliseconds());
+}
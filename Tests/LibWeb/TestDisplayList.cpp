@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <LibGfx/Bitmap.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/RecordingPainter.h>
+#include <LibWeb/Painting/TileCache.h>
+
+using Web::DevicePixelRect;
+using Web::Painting::DisplayList;
+using Web::Painting::RecordingPainter;
+using Web::Painting::TileCache;
+
+static NonnullRefPtr<Gfx::Bitmap> create_bitmap()
+{
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, { 16, 16 }));
+    bitmap->fill(Color::White);
+    return bitmap;
+}
+
+TEST_CASE(recording_does_not_touch_pixels)
+{
+    auto bitmap = create_bitmap();
+    DisplayList display_list;
+    RecordingPainter painter(display_list, bitmap->rect());
+    painter.fill_rect({ 0, 0, 16, 16 }, Color::Red);
+
+    EXPECT_EQ(display_list.command_count(), 1u);
+    EXPECT_EQ(bitmap->get_pixel(8, 8), Color(Color::White));
+
+    display_list.execute(*bitmap);
+    EXPECT_EQ(bitmap->get_pixel(8, 8), Color(Color::Red));
+}
+
+TEST_CASE(translation_and_clip_are_replayed)
+{
+    DisplayList display_list;
+    RecordingPainter painter(display_list, { 0, 0, 16, 16 });
+    painter.save();
+    painter.translate(4, 4);
+    painter.add_clip_rect({ 0, 0, 4, 4 });
+    EXPECT_EQ(painter.translation(), Gfx::IntPoint(4, 4));
+    EXPECT_EQ(painter.clip_rect(), Gfx::IntRect(4, 4, 4, 4));
+    painter.fill_rect({ 0, 0, 8, 8 }, Color::Blue);
+    painter.restore();
+    EXPECT_EQ(painter.translation(), Gfx::IntPoint(0, 0));
+
+    auto bitmap = create_bitmap();
+    display_list.execute(*bitmap);
+    EXPECT_EQ(bitmap->get_pixel(3, 3), Color(Color::White));
+    EXPECT_EQ(bitmap->get_pixel(4, 4), Color(Color::Blue));
+    EXPECT_EQ(bitmap->get_pixel(7, 7), Color(Color::Blue));
+    EXPECT_EQ(bitmap->get_pixel(8, 8), Color(Color::White));
+}
+
+TEST_CASE(fully_clipped_commands_are_dropped)
+{
+    DisplayList display_list;
+    RecordingPainter painter(display_list, { 0, 0, 16, 16 });
+    painter.fill_rect({ 20, 20, 4, 4 }, Color::Red);
+    painter.translate(-10, -10);
+    painter.fill_rect({ 0, 0, 4, 4 }, Color::Red);
+    painter.fill_rect({ 10, 10, 4, 4 }, Color::Green);
+
+    // Only the translation and the last fill are left.
+    EXPECT_EQ(display_list.command_count(), 2u);
+}
+
+TEST_CASE(replay_with_offset)
+{
+    // Record more than the target, as if the target were a viewport scrolled 4 pixels down.
+    DisplayList display_list;
+    RecordingPainter painter(display_list, { 0, -8, 16, 32 });
+    painter.fill_rect({ 0, -4, 16, 4 }, Color::Green);
+    painter.fill_rect({ 0, 0, 16, 4 }, Color::Red);
+
+    auto bitmap = create_bitmap();
+    display_list.execute(*bitmap, { 0, 4 });
+    EXPECT_EQ(bitmap->get_pixel(0, 0), Color(Color::Green));
+    EXPECT_EQ(bitmap->get_pixel(0, 4), Color(Color::Red));
+    EXPECT_EQ(bitmap->get_pixel(0, 8), Color(Color::White));
+}
+
+TEST_CASE(set_translation_ignores_replay_offset)
+{
+    DisplayList display_list;
+    RecordingPainter painter(display_list, { 0, 0, 16, 16 });
+    painter.translate(0, 8);
+    painter.save();
+    painter.set_translation({});
+    painter.fill_rect({ 0, 0, 4, 4 }, Color::Blue);
+    painter.restore();
+    painter.fill_rect({ 8, 0, 4, 4 }, Color::Red);
+
+    auto bitmap = create_bitmap();
+    display_list.execute(*bitmap, { 0, -4 });
+    EXPECT_EQ(bitmap->get_pixel(0, 0), Color(Color::Blue));
+    EXPECT_EQ(bitmap->get_pixel(8, 4), Color(Color::Red));
+    EXPECT_EQ(bitmap->get_pixel(8, 0), Color(Color::White));
+}
+
+TEST_CASE(stacking_context_is_composited_with_opacity)
+{
+    DisplayList display_list;
+    RecordingPainter painter(display_list, { 0, 0, 16, 16 });
+    painter.push_stacking_context({
+        .opacity = 0.5f,
+        .source_rect = { 4, 4, 8, 8 },
+        .transformed_destination_rect = { 4, 4, 8, 8 },
+        .painter_translation = { -4, -4 },
+    });
+    painter.fill_rect({ 4, 4, 8, 8 }, Color::Black);
+    painter.pop_stacking_context();
+
+    auto bitmap = create_bitmap();
+    display_list.execute(*bitmap);
+    EXPECT_EQ(bitmap->get_pixel(0, 0), Color(Color::White));
+    auto blended = bitmap->get_pixel(8, 8);
+    EXPECT(blended.red() > 100 && blended.red() < 160);
+}
+
+TEST_CASE(tile_aligned_rect)
+{
+    EXPECT_EQ(TileCache::tile_aligned_rect({ 0, 0, 256, 256 }), DevicePixelRect(0, 0, 256, 256));
+    EXPECT_EQ(TileCache::tile_aligned_rect({ 1, 1, 256, 256 }), DevicePixelRect(0, 0, 512, 512));
+    EXPECT_EQ(TileCache::tile_aligned_rect({ 300, 10, 10, 10 }), DevicePixelRect(256, 0, 256, 256));
+    EXPECT_EQ(TileCache::tile_aligned_rect({ -1, -300, 2, 2 }), DevicePixelRect(-256, -512, 512, 256));
+    EXPECT(TileCache::tile_aligned_rect({ 10, 10, 0, 0 }).is_empty());
+}
+
+TEST_CASE(tile_cache_only_rasterizes_stale_tiles)
+{
+    // A red stripe at y=100 in a 1024 pixels tall document.
+    DevicePixelRect viewport_rect { 0, 0, 600, 300 };
+    DisplayList display_list;
+    RecordingPainter painter(display_list, { 0, 0, 600, 1024 });
+    painter.fill_rect({ 0, 100, 600, 10 }, Color::Red);
+
+    auto target = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, { 600, 300 }));
+    auto tile_cache = TileCache::create(4);
+    auto paint = [&] {
+        tile_cache->paint({
+                              .display_list = display_list,
+                              .display_list_viewport_rect = {},
+                              .depends_on_viewport_location = false,
+                              .viewport_rect = viewport_rect,
+                              .background_color = Color::White,
+                          },
+            *target);
+    };
+
+    paint();
+    EXPECT_EQ(tile_cache->last_rasterized_tile_count(), 6u);
+    EXPECT_EQ(target->get_pixel(10, 105), Color(Color::Red));
+    EXPECT_EQ(target->get_pixel(10, 115), Color(Color::White));
+
+    paint();
+    EXPECT_EQ(tile_cache->last_rasterized_tile_count(), 0u);
+
+    tile_cache->invalidate({ 300, 260, 10, 10 });
+    paint();
+    EXPECT_EQ(tile_cache->last_rasterized_tile_count(), 1u);
+
+    // Scrolling down within the tiles we already have does not rasterize anything.
+    viewport_rect.set_y(150);
+    paint();
+    EXPECT_EQ(tile_cache->last_rasterized_tile_count(), 0u);
+    EXPECT_EQ(target->get_pixel(10, 0), Color(Color::White));
+
+    // Scrolling further down only rasterizes the new row of tiles.
+    viewport_rect.set_y(300);
+    paint();
+    EXPECT_EQ(tile_cache->last_rasterized_tile_count(), 3u);
+    EXPECT_EQ(tile_cache->tile_count(), 9u);
+
+    viewport_rect.set_y(50);
+    paint();
+    EXPECT_EQ(tile_cache->last_rasterized_tile_count(), 0u);
+    EXPECT_EQ(target->get_pixel(599, 55), Color(Color::Red));
+}
+
+TEST_CASE(tile_cache_with_viewport_relative_content)
+{
+    DevicePixelRect viewport_rect { 0, 0, 300, 300 };
+    DisplayList display_list;
+    RecordingPainter painter(display_list, { 0, 0, 512, 1024 });
+    painter.save();
+    painter.set_translation({});
+    painter.fill_rect({ 0, 0, 10, 10 }, Color::Blue);
+    painter.restore();
+    EXPECT(display_list.has_viewport_relative_content());
+
+    auto target = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, { 300, 300 }));
+    auto tile_cache = TileCache::create(2);
+    auto paint = [&] {
+        tile_cache->paint({
+                              .display_list = display_list,
+                              .display_list_viewport_rect = {},
+                              .depends_on_viewport_location = display_list.has_viewport_relative_content(),
+                              .viewport_rect = viewport_rect,
+                              .background_color = Color::White,
+                          },
+            *target);
+    };
+
+    paint();
+    EXPECT_EQ(tile_cache->last_rasterized_tile_count(), 4u);
+    EXPECT_EQ(target->get_pixel(5, 5), Color(Color::Blue));
+
+    // The fixed content has to stay in place, so every visible tile is rasterized again.
+    viewport_rect.set_y(20);
+    paint();
+    EXPECT_EQ(tile_cache->last_rasterized_tile_count(), 4u);
+    EXPECT_EQ(target->get_pixel(5, 5), Color(Color::Blue));
+    EXPECT_EQ(target->get_pixel(5, 15), Color(Color::White));
+}
@@ -197,6 +197,39 @@ TEST_CASE(doctype)
     EXPECT_END_TAG_TOKEN(html);
 }
 
+TEST_CASE(long_runs_of_text)
+{
+    // Long enough for the tokenizer to consume the text in several runs, some of which end in the middle of a multi-byte code point.
+    StringBuilder builder;
+    for (size_t i = 0; i < 200; ++i)
+        builder.append("a\u00e9\u20ac\U0001F600\r\n"sv);
+    auto text = builder.to_deprecated_string();
+
+    StringBuilder input_builder;
+    input_builder.appendff("{}<p title=\"{}\">", text, text);
+    auto tokens = run_tokenizer(input_builder.string_view());
+
+    auto expected_text = text.replace("\r\n"sv, "\n"sv, ReplaceMode::All);
+    BEGIN_ENUMERATION(tokens);
+    size_t line = 0;
+    size_t column = 0;
+    for (auto code_point : Utf8View { expected_text }) {
+        if (code_point == '\n') {
+            line++;
+            column = 0;
+        } else {
+            column++;
+        }
+        EXPECT_EQ(current_token->start_position().line, line);
+        EXPECT_EQ(current_token->start_position().column, column);
+        EXPECT_CHARACTER_TOKEN(code_point);
+    }
+    EXPECT_START_TAG_TOKEN(p);
+    EXPECT_TAG_TOKEN_ATTRIBUTE(title, expected_text);
+    EXPECT_END_OF_FILE_TOKEN();
+    END_ENUMERATION();
+}
+
 // NOTE: This relies on the format of HTMLToken::to_string() staying the same.
 //       If that changes, or something is added to the test HTML, the hash needs to be adjusted.
 TEST_CASE(regression)
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/EventLoop.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/Loader/LoadRequest.h>
+#include <LibWeb/Loader/ResourceLoader.h>
+#include <LibWeb/Platform/EventLoopPluginSerenity.h>
+
+class TestConnectorRequest final : public Web::ResourceLoaderConnectorRequest {
+public:
+    virtual void set_should_buffer_all_input(bool) override { }
+    virtual bool stop() override { return true; }
+    virtual void stream_into(Stream&) override { }
+
+    void finish(StringView payload)
+    {
+        HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> response_headers;
+        response_headers.set("Content-Type", "text/javascript");
+        on_buffered_request_finish(true, payload.length(), response_headers, 200, payload.bytes());
+    }
+};
+
+class TestConnector final : public Web::ResourceLoaderConnector {
+public:
+    virtual void prefetch_dns(AK::URL const&) override { }
+    virtual void preconnect(AK::URL const&) override { }
+
+    virtual RefPtr<Web::ResourceLoaderConnectorRequest> start_request(DeprecatedString const&, AK::URL const&, HashMap<DeprecatedString, DeprecatedString> const&, ReadonlyBytes, Core::ProxyData const&) override
+    {
+        auto request = adopt_ref(*new TestConnectorRequest);
+        started_requests.append(request);
+        return request;
+    }
+
+    Vector<NonnullRefPtr<TestConnectorRequest>> started_requests;
+};
+
+static TestConnector& set_up()
+{
+    static Core::EventLoop s_event_loop;
+    static RefPtr<TestConnector> s_connector;
+    if (!s_connector) {
+        Web::Platform::EventLoopPlugin::install(*new Web::Platform::EventLoopPluginSerenity);
+        s_connector = adopt_ref(*new TestConnector);
+        Web::ResourceLoader::initialize(s_connector);
+    }
+    s_connector->started_requests.clear();
+    return *s_connector;
+}
+
+static Web::LoadRequest make_request(StringView url, StringView cookie)
+{
+    Web::LoadRequest request;
+    request.set_url(AK::URL(url));
+    request.set_header("Cookie", cookie);
+    return request;
+}
+
+// Fetch sends more headers than the speculative request made by the HTML parser, which only carries the cookies.
+static Web::LoadRequest make_fetch_request(StringView url, StringView cookie)
+{
+    auto request = make_request(url, cookie);
+    request.set_header("Accept", "*/*");
+    request.set_header("Accept-Language", "en-US");
+    request.set_header("User-Agent", Web::default_user_agent);
+    return request;
+}
+
+struct LoadResult {
+    bool finished { false };
+    ByteBuffer data;
+};
+
+static void load(Web::LoadRequest& request, LoadResult& result)
+{
+    Web::ResourceLoader::the().load(
+        request,
+        [&](auto data, auto&, auto) {
+            result.finished = true;
+            result.data = MUST(ByteBuffer::copy(data));
+        },
+        [&](auto&, auto) {
+            result.finished = true;
+        });
+}
+
+TEST_CASE(pending_speculative_load_is_handed_over_to_fetch)
+{
+    auto& connector = set_up();
+
+    auto speculative_request = make_request("http://example.com/pending.js"sv, "a=1"sv);
+    Web::ResourceLoader::the().load_speculatively(speculative_request);
+    EXPECT_EQ(connector.started_requests.size(), 1u);
+
+    LoadResult result;
+    auto fetch_request = make_fetch_request("http://example.com/pending.js"sv, "a=1"sv);
+    load(fetch_request, result);
+    EXPECT_EQ(connector.started_requests.size(), 1u);
+    EXPECT(!result.finished);
+
+    connector.started_requests.first()->finish("pending();"sv);
+    EXPECT(result.finished);
+    EXPECT_EQ(StringView { result.data.bytes() }, "pending();"sv);
+}
+
+TEST_CASE(finished_speculative_load_is_handed_over_to_fetch)
+{
+    auto& connector = set_up();
+
+    auto speculative_request = make_request("http://example.com/finished.js"sv, "a=1"sv);
+    Web::ResourceLoader::the().load_speculatively(speculative_request);
+    connector.started_requests.first()->finish("finished();"sv);
+
+    LoadResult result;
+    auto fetch_request = make_fetch_request("http://example.com/finished.js"sv, "a=1"sv);
+    load(fetch_request, result);
+    EXPECT_EQ(connector.started_requests.size(), 1u);
+
+    Core::EventLoop::current().pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT(result.finished);
+    EXPECT_EQ(StringView { result.data.bytes() }, "finished();"sv);
+}
+
+TEST_CASE(speculative_load_with_other_cookies_is_not_handed_over)
+{
+    auto& connector = set_up();
+
+    auto speculative_request = make_request("http://example.com/cookies.js"sv, "a=1"sv);
+    Web::ResourceLoader::the().load_speculatively(speculative_request);
+
+    LoadResult result;
+    auto fetch_request = make_fetch_request("http://example.com/cookies.js"sv, "a=2"sv);
+    load(fetch_request, result);
+    EXPECT_EQ(connector.started_requests.size(), 2u);
+
+    connector.started_requests.first()->finish("speculative();"sv);
+    EXPECT(!result.finished);
+    connector.started_requests.last()->finish("fetched();"sv);
+    EXPECT(result.finished);
+    EXPECT_EQ(StringView { result.data.bytes() }, "fetched();"sv);
+}
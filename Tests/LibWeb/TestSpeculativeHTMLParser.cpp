@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/Parser/SpeculativeHTMLParser.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/SVG/TagNames.h>
+
+using Web::HTML::SpeculativeHTMLParser;
+using Priority = SpeculativeHTMLParser::Priority;
+
+static Vector<SpeculativeHTMLParser::SpeculativeFetch> find_fetches(StringView input, bool scripting_enabled = true)
+{
+    static bool s_strings_initialized = false;
+    if (!s_strings_initialized) {
+        MUST(Web::HTML::AttributeNames::initialize_strings());
+        MUST(Web::HTML::TagNames::initialize_strings());
+        MUST(Web::SVG::TagNames::initialize_strings());
+        s_strings_initialized = true;
+    }
+
+    return SpeculativeHTMLParser::find_speculative_fetches(input, AK::URL("http://example.com/dir/page.html"sv), false, scripting_enabled);
+}
+
+TEST_CASE(scripts_and_stylesheets_come_before_images)
+{
+    auto fetches = find_fetches(R"~~~(
+        <img src="a.png">
+        <script src="/b.js"></script>
+        <p>Text</p>
+        <link rel="stylesheet" href="c.css">
+        <img src="a.png">
+        <img src="http://other.example.com/d.png">
+    )~~~"sv);
+
+    EXPECT_EQ(fetches.size(), 4u);
+    EXPECT_EQ(fetches[0].url, AK::URL("http://example.com/b.js"sv));
+    EXPECT_EQ(fetches[0].priority, Priority::High);
+    EXPECT_EQ(fetches[1].url, AK::URL("http://example.com/dir/c.css"sv));
+    EXPECT_EQ(fetches[1].priority, Priority::High);
+    EXPECT_EQ(fetches[2].url, AK::URL("http://example.com/dir/a.png"sv));
+    EXPECT_EQ(fetches[2].priority, Priority::Low);
+    EXPECT_EQ(fetches[3].url, AK::URL("http://other.example.com/d.png"sv));
+}
+
+TEST_CASE(tags_in_raw_text_are_ignored)
+{
+    auto fetches = find_fetches(R"~~~(
+        <script src="a.js">document.write('<img src="no.png">');</script>
+        <style>/* <link rel=stylesheet href=no.css> */</style>
+        <textarea><img src="no.png"></textarea>
+        <noscript><img src="no.png"></noscript>
+        <template><img src="no.png"></template>
+        <svg><script href="no.js"></script><image href="no.png"/></svg>
+        <img src="yes.png">
+    )~~~"sv);
+
+    EXPECT_EQ(fetches.size(), 2u);
+    EXPECT_EQ(fetches[0].url, AK::URL("http://example.com/dir/a.js"sv));
+    EXPECT_EQ(fetches[1].url, AK::URL("http://example.com/dir/yes.png"sv));
+}
+
+TEST_CASE(noscript_is_scanned_without_scripting)
+{
+    auto fetches = find_fetches(R"~~~(<script src="a.js"></script><noscript><img src="b.png"></noscript>)~~~"sv, false);
+
+    EXPECT_EQ(fetches.size(), 1u);
+    EXPECT_EQ(fetches[0].url, AK::URL("http://example.com/dir/b.png"sv));
+}
+
+TEST_CASE(only_fetched_resources_are_found)
+{
+    auto fetches = find_fetches(R"~~~(
+        <script type="text/template" src="no.js"></script>
+        <script nomodule src="no.js"></script>
+        <script type="module" src="module.js"></script>
+        <script language="javascript" src="classic.js"></script>
+        <link rel="alternate stylesheet" href="no.css">
+        <link rel="icon" href="no.ico">
+        <img srcset="no.png 1x, no@2x.png 2x" src="no.png">
+        <picture><source srcset="no.webp"><img src="no.png"></picture>
+    )~~~"sv);
+
+    EXPECT_EQ(fetches.size(), 2u);
+    EXPECT_EQ(fetches[0].url, AK::URL("http://example.com/dir/module.js"sv));
+    EXPECT_EQ(fetches[1].url, AK::URL("http://example.com/dir/classic.js"sv));
+}
+
+TEST_CASE(base_element_changes_the_base_url)
+{
+    auto fetches = find_fetches(R"~~~(
+        <img src="a.png">
+        <base href="/assets/">
+        <base href="/ignored/">
+        <img src="b.png">
+    )~~~"sv);
+
+    EXPECT_EQ(fetches.size(), 2u);
+    EXPECT_EQ(fetches[0].url, AK::URL("http://example.com/dir/a.png"sv));
+    EXPECT_EQ(fetches[1].url, AK::URL("http://example.com/assets/b.png"sv));
+}
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/EventLoop.h>
+#include <LibCore/System.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibTest/TestCase.h>
+#include <RequestServer/DiskCache.h>
+#include <time.h>
+
+using RequestServer::CacheableRequest;
+using RequestServer::DiskCache;
+
+using ResponseHeaders = HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits>;
+
+class TemporaryCache {
+public:
+    explicit TemporaryCache(u64 size_limit = DiskCache::default_size_limit)
+    {
+        char pattern[] = "/tmp/disk-cache-test.XXXXXX";
+        m_directory = MUST(Core::System::mkdtemp(pattern)).to_deprecated_string();
+        m_cache = MUST(DiskCache::create(m_directory, size_limit));
+    }
+
+    ~TemporaryCache()
+    {
+        m_cache = nullptr;
+        MUST(FileSystem::remove(m_directory, FileSystem::RecursionMode::Allowed));
+    }
+
+    DiskCache* operator->() { return m_cache.ptr(); }
+
+private:
+    static inline Core::EventLoop s_event_loop;
+
+    DeprecatedString m_directory;
+    OwnPtr<DiskCache> m_cache;
+};
+
+static DeprecatedString http_date(UnixDateTime time)
+{
+    time_t seconds = time.seconds_since_epoch();
+    struct tm tm;
+    gmtime_r(&seconds, &tm);
+    char buffer[64];
+    strftime(buffer, sizeof(buffer), "%a, %d %b %Y %T GMT", &tm);
+    return buffer;
+}
+
+static UnixDateTime seconds_ago(i64 seconds)
+{
+    return UnixDateTime::from_seconds_since_epoch(UnixDateTime::now().seconds_since_epoch() - seconds);
+}
+
+static CacheableRequest make_request(StringView url, UnixDateTime request_time = UnixDateTime::now())
+{
+    return { .url = URL(url), .request_headers = {}, .request_time = request_time, .revalidated_response = {} };
+}
+
+static void store(TemporaryCache& cache, CacheableRequest const& request, ResponseHeaders const& response_headers, StringView body, UnixDateTime response_time = UnixDateTime::now())
+{
+    cache->store(request, 200, response_headers, body.bytes(), response_time);
+}
+
+TEST_CASE(fresh_responses_are_served_from_the_cache)
+{
+    TemporaryCache cache;
+    auto request = make_request("http://example.com/fresh"sv);
+    store(cache, request, { { "Date", http_date(UnixDateTime::now()) }, { "Cache-Control", "max-age=60" } }, "Well hello friends"sv);
+
+    auto response = cache->find(request.url, {});
+    EXPECT(response.has_value());
+    EXPECT_EQ(response->status_code, 200u);
+    EXPECT(!response->needs_revalidation);
+    EXPECT_EQ(StringView { response->body.bytes() }, "Well hello friends"sv);
+    EXPECT_EQ(cache->entry_count(), 1u);
+
+    EXPECT(!cache->find(URL("http://example.com/other"sv), {}).has_value());
+}
+
+TEST_CASE(responses_without_an_expiration_time_or_validators_are_not_stored)
+{
+    TemporaryCache cache;
+    store(cache, make_request("http://example.com/a"sv), { { "Date", http_date(UnixDateTime::now()) } }, "a"sv);
+    store(cache, make_request("http://example.com/b"sv), { { "Cache-Control", "no-store, max-age=60" } }, "b"sv);
+    EXPECT_EQ(cache->entry_count(), 0u);
+}
+
+TEST_CASE(age_and_freshness)
+{
+    TemporaryCache cache;
+
+    // The response was generated 100 seconds ago, so with a max-age of 60 it is stale.
+    auto stale_request = make_request("http://example.com/stale"sv);
+    store(cache, stale_request, { { "Date", http_date(seconds_ago(100)) }, { "Cache-Control", "max-age=60" }, { "ETag", "\"1\"" } }, "stale"sv);
+    auto stale = cache->find(stale_request.url, {});
+    EXPECT(stale.has_value());
+    EXPECT(stale->needs_revalidation);
+    EXPECT(stale->response_headers.get("Age"sv)->to_uint<u32>().value() >= 100u);
+
+    // An Age header counts towards the age as well.
+    auto aged_request = make_request("http://example.com/aged"sv);
+    store(cache, aged_request, { { "Date", http_date(UnixDateTime::now()) }, { "Cache-Control", "max-age=60" }, { "Age", "90" } }, "aged"sv);
+    EXPECT(!cache->find(aged_request.url, {}).has_value());
+
+    // Stale responses without validators are of no use.
+    EXPECT_EQ(cache->entry_count(), 2u);
+
+    auto expires_request = make_request("http://example.com/expires"sv);
+    store(cache, expires_request, { { "Date", http_date(UnixDateTime::now()) }, { "Expires", http_date(UnixDateTime::from_seconds_since_epoch(UnixDateTime::now().seconds_since_epoch() + 120)) } }, "expires"sv);
+    auto expires = cache->find(expires_request.url, {});
+    EXPECT(expires.has_value());
+    EXPECT(!expires->needs_revalidation);
+
+    // Heuristic freshness is 10% of the time since the last modification.
+    auto heuristic_request = make_request("http://example.com/heuristic"sv);
+    store(cache, heuristic_request, { { "Date", http_date(seconds_ago(50)) }, { "Last-Modified", http_date(seconds_ago(1050)) } }, "heuristic"sv);
+    auto heuristic = cache->find(heuristic_request.url, {});
+    EXPECT(heuristic.has_value());
+    EXPECT(!heuristic->needs_revalidation);
+    EXPECT(cache->find(heuristic_request.url, { { "Cache-Control", "max-age=10" } })->needs_revalidation);
+    EXPECT(cache->find(heuristic_request.url, { { "Cache-Control", "min-fresh=60" } })->needs_revalidation);
+}
+
+TEST_CASE(revalidation_refreshes_the_stored_response)
+{
+    TemporaryCache cache;
+    auto request = make_request("http://example.com/revalidated"sv);
+    store(cache, request, { { "Date", http_date(seconds_ago(100)) }, { "Cache-Control", "max-age=60" }, { "ETag", "\"1\"" }, { "X-Version", "1" } }, "body"sv);
+
+    auto stale = cache->find(request.url, {});
+    EXPECT(stale->needs_revalidation);
+
+    HashMap<DeprecatedString, DeprecatedString> conditional_headers;
+    DiskCache::add_validators(*stale, conditional_headers);
+    EXPECT_EQ(conditional_headers.get("If-None-Match").value(), "\"1\""sv);
+
+    auto revalidation_request = make_request("http://example.com/revalidated"sv);
+    auto response = cache->update_after_revalidation(revalidation_request, { { "Date", http_date(UnixDateTime::now()) }, { "Cache-Control", "max-age=60" }, { "ETag", "\"1\"" }, { "X-Version", "2" }, { "Content-Length", "0" } }, UnixDateTime::now());
+    EXPECT(response.has_value());
+    EXPECT(!response->needs_revalidation);
+    EXPECT_EQ(StringView { response->body.bytes() }, "body"sv);
+    EXPECT_EQ(response->response_headers.get("X-Version"sv).value(), "2"sv);
+    EXPECT(!response->response_headers.contains("Content-Length"sv));
+
+    auto fresh = cache->find(request.url, {});
+    EXPECT(!fresh->needs_revalidation);
+
+    EXPECT(!cache->update_after_revalidation(make_request("http://example.com/unknown"sv), {}, UnixDateTime::now()).has_value());
+}
+
+TEST_CASE(vary)
+{
+    TemporaryCache cache;
+    auto request = make_request("http://example.com/vary"sv);
+    request.request_headers.set("accept-language", "en");
+    store(cache, request, { { "Date", http_date(UnixDateTime::now()) }, { "Cache-Control", "max-age=60" }, { "Vary", "Accept-Language" } }, "Hello"sv);
+
+    EXPECT(cache->find(request.url, { { "Accept-Language", "en" } }).has_value());
+    EXPECT(!cache->find(request.url, { { "Accept-Language", "de" } }).has_value());
+    EXPECT(!cache->find(request.url, {}).has_value());
+
+    store(cache, make_request("http://example.com/vary-all"sv), { { "Cache-Control", "max-age=60" }, { "Vary", "*" } }, "Hello"sv);
+    EXPECT_EQ(cache->entry_count(), 1u);
+}
+
+TEST_CASE(cookies_are_not_stored)
+{
+    TemporaryCache cache;
+    auto request = make_request("http://example.com/cookies"sv);
+    store(cache, request, { { "Date", http_date(seconds_ago(100)) }, { "Cache-Control", "max-age=60" }, { "ETag", "\"1\"" }, { "Set-Cookie", "a=1" }, { "Set-Cookie2", "b=2" } }, "cookies"sv);
+
+    auto stored = cache->find(request.url, {});
+    EXPECT(!stored->response_headers.contains("Set-Cookie"sv));
+    EXPECT(!stored->response_headers.contains("Set-Cookie2"sv));
+
+    auto revalidated = cache->update_after_revalidation(request, { { "Cache-Control", "max-age=60" }, { "Set-Cookie", "c=3" } }, UnixDateTime::now());
+    EXPECT(!revalidated->response_headers.contains("Set-Cookie"sv));
+}
+
+TEST_CASE(least_recently_used_responses_are_evicted)
+{
+    // Bodies may be up to an eighth of the size limit.
+    TemporaryCache cache(800);
+    ResponseHeaders headers { { "Cache-Control", "max-age=60" } };
+    auto body_of_100_bytes = [](char c) { return DeprecatedString::repeated(c, 100); };
+
+    for (char c = 'a'; c < 'i'; ++c)
+        store(cache, make_request(DeprecatedString::formatted("http://example.com/{}", c)), headers, body_of_100_bytes(c));
+    EXPECT_EQ(cache->entry_count(), 8u);
+    EXPECT_EQ(cache->size(), 800u);
+
+    // Using "a" makes "b" the least recently used response.
+    EXPECT(cache->find(URL("http://example.com/a"sv), {}).has_value());
+    store(cache, make_request("http://example.com/i"sv), headers, body_of_100_bytes('i'));
+
+    EXPECT_EQ(cache->entry_count(), 8u);
+    EXPECT_EQ(cache->size(), 800u);
+    EXPECT(cache->find(URL("http://example.com/a"sv), {}).has_value());
+    EXPECT(!cache->find(URL("http://example.com/b"sv), {}).has_value());
+    EXPECT(cache->find(URL("http://example.com/i"sv), {}).has_value());
+
+    // Bodies that are too large are not stored at all.
+    store(cache, make_request("http://example.com/large"sv), headers, DeprecatedString::repeated('x', 101));
+    EXPECT(!cache->find(URL("http://example.com/large"sv), {}).has_value());
+    EXPECT_EQ(cache->entry_count(), 8u);
+}
+
+TEST_CASE(identical_bodies_are_stored_once)
+{
+    TemporaryCache cache;
+    ResponseHeaders headers { { "Cache-Control", "max-age=60" } };
+    store(cache, make_request("http://example.com/one"sv), headers, "same"sv);
+    store(cache, make_request("http://example.com/two"sv), headers, "same"sv);
+    EXPECT_EQ(cache->entry_count(), 2u);
+    EXPECT_EQ(cache->size(), 4u);
+
+    cache->invalidate(URL("http://example.com/one"sv));
+    EXPECT_EQ(cache->size(), 4u);
+    EXPECT_EQ(StringView { cache->find(URL("http://example.com/two"sv), {})->body.bytes() }, "same"sv);
+}
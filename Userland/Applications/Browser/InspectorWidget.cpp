@@ -117,6 +117,14 @@ InspectorWidget::InspectorWidget()
     m_element_size_view = box_model_widget.add<ElementSizePreviewWidget>();
     m_element_size_view->set_should_hide_unnecessary_scrollbars(true);
 
+    auto& layout_statistics_table_container = bottom_tab_widget.add_tab<GUI::Widget>("Layout"_short_string);
+    layout_statistics_table_container.set_layout<GUI::VerticalBoxLayout>(4);
+    m_layout_statistics_table_view = layout_statistics_table_container.add<GUI::TableView>();
+
+    auto& style_statistics_table_container = bottom_tab_widget.add_tab<GUI::Widget>("Style"_short_string);
+    style_statistics_table_container.set_layout<GUI::VerticalBoxLayout>(4);
+    m_style_statistics_table_view = style_statistics_table_container.add<GUI::TableView>();
+
     m_dom_tree_view->set_focus(true);
 }
 
@@ -132,6 +140,15 @@ void InspectorWidget::select_default_node()
 void InspectorWidget::set_dom_json(StringView json)
 {
     m_dom_tree_view->set_model(WebView::DOMTreeModel::create(json, *m_dom_tree_view));
+
+    auto dom_tree = JsonValue::from_string(json);
+    if (!dom_tree.is_error() && dom_tree.value().is_object()) {
+        if (auto layout_statistics = dom_tree.value().as_object().get_object("layout_statistics"sv); layout_statistics.has_value())
+            m_layout_statistics_table_view->set_model(WebView::StylePropertiesModel::create(layout_statistics->to_deprecated_string()));
+        if (auto style_statistics = dom_tree.value().as_object().get_object("style_statistics"sv); style_statistics.has_value())
+            m_style_statistics_table_view->set_model(WebView::StylePropertiesModel::create(style_statistics->to_deprecated_string()));
+    }
+
     if (m_pending_selection.has_value())
         set_selection(m_pending_selection.release_value());
     else
@@ -142,6 +159,8 @@ void InspectorWidget::set_dom_json(StringView json)
 void InspectorWidget::clear_dom_json()
 {
     m_dom_tree_view->set_model(nullptr);
+    m_layout_statistics_table_view->set_model(nullptr);
+    m_style_statistics_table_view->set_model(nullptr);
     clear_style_json();
     m_dom_loaded = false;
 }
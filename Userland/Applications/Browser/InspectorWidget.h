@@ -66,6 +66,8 @@ private:
     RefPtr<GUI::TableView> m_computed_style_table_view;
     RefPtr<GUI::TableView> m_resolved_style_table_view;
     RefPtr<GUI::TableView> m_custom_properties_table_view;
+    RefPtr<GUI::TableView> m_layout_statistics_table_view;
+    RefPtr<GUI::TableView> m_style_statistics_table_view;
     RefPtr<ElementSizePreviewWidget> m_element_size_view;
 
     Web::Layout::BoxModelMetrics m_node_box_sizing;
@@ -10,6 +10,7 @@
 #include <AK/DeprecatedString.h>
 #include <AK/HashMap.h>
 #include <AK/Vector.h>
+#include <LibCore/ProcessStatisticsReader.h>
 #include <LibGUI/Icon.h>
 #include <LibGUI/Model.h>
 #include <LibGUI/ModelIndex.h>
@@ -245,6 +246,7 @@ private:
     Vector<NonnullOwnPtr<Process>> m_processes;
     Vector<NonnullOwnPtr<CpuInfo>> m_cpus;
     GUI::Icon m_kernel_process_icon;
+    Core::AllProcessesStatistics m_all_processes {};
     u64 m_total_time_scheduled { 0 };
     u64 m_total_time_scheduled_kernel { 0 };
     bool m_has_total_scheduled_time { false };
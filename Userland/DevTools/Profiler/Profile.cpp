@@ -10,6 +10,7 @@
 #include "SamplesModel.h"
 #include "SourceModel.h"
 #include <AK/HashTable.h>
+#include <AK/JsonPullParser.h>
 #include <AK/LexicalPath.h>
 #include <AK/QuickSort.h>
 #include <AK/RefPtr.h>
@@ -232,15 +233,110 @@ void Profile::rebuild_tree()
 Optional<MappedObject> g_kernel_debuginfo_object;
 OwnPtr<Debug::DebugInfo> g_kernel_debug_info;
 
+namespace {
+
+// The fields of a perfcore event that we care about. Events are read straight into these instead of going through a
+// JsonValue tree, as perfcore files for longer recordings easily contain millions of stack frames.
+struct PerfEvent {
+    DeprecatedString type;
+    u64 timestamp { 0 };
+    u32 lost_samples { 0 };
+    pid_t pid { 0 };
+    pid_t tid { 0 };
+    FlatPtr ptr { 0 };
+    size_t size { 0 };
+    FlatPtr arg1 { 0 };
+    FlatPtr arg2 { 0 };
+    DeprecatedString name;
+    pid_t parent_pid { 0 };
+    DeprecatedString executable;
+    pid_t parent_tid { 0 };
+    FlatPtr filename_index { 0 };
+    int fd { 0 };
+    size_t start_timestamp { 0 };
+    bool success { false };
+    Vector<u64> stack;
+};
+
+}
+
+static ErrorOr<void> read_perf_event(JsonPullParser& parser, PerfEvent& event)
+{
+    return parser.for_each_member([&](StringView key) -> ErrorOr<void> {
+        if (key == "type"sv)
+            return parser.read_into(event.type);
+        if (key == "timestamp"sv)
+            return parser.read_into(event.timestamp);
+        if (key == "lost_samples"sv)
+            return parser.read_into(event.lost_samples);
+        if (key == "pid"sv)
+            return parser.read_into(event.pid);
+        if (key == "tid"sv)
+            return parser.read_into(event.tid);
+        if (key == "ptr"sv)
+            return parser.read_into(event.ptr);
+        if (key == "size"sv)
+            return parser.read_into(event.size);
+        if (key == "arg1"sv)
+            return parser.read_into(event.arg1);
+        if (key == "arg2"sv)
+            return parser.read_into(event.arg2);
+        if (key == "name"sv)
+            return parser.read_into(event.name);
+        if (key == "parent_pid"sv)
+            return parser.read_into(event.parent_pid);
+        if (key == "executable"sv)
+            return parser.read_into(event.executable);
+        if (key == "parent_tid"sv)
+            return parser.read_into(event.parent_tid);
+        if (key == "filename_index"sv)
+            return parser.read_into(event.filename_index);
+        if (key == "fd"sv)
+            return parser.read_into(event.fd);
+        if (key == "start_timestamp"sv)
+            return parser.read_into(event.start_timestamp);
+        if (key == "success"sv)
+            return parser.read_into(event.success);
+        if (key == "stack"sv) {
+            return parser.for_each_element([&]() -> ErrorOr<void> {
+                TRY(event.stack.try_append(TRY(parser.read<u64>())));
+                return {};
+            });
+        }
+        return {};
+    });
+}
+
 ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path)
 {
     auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
-
-    auto json = JsonValue::from_string(TRY(file->read_until_eof()));
-    if (json.is_error() || !json.value().is_object())
-        return Error::from_string_literal("Invalid perfcore format (not a JSON object)");
-
-    auto const& object = json.value().as_object();
+    auto file_contents = TRY(file->read_until_eof());
+
+    Optional<Vector<DeprecatedString>> strings;
+    Optional<Vector<PerfEvent>> perf_events;
+
+    JsonPullParser parser { file_contents };
+    auto parse_result = parser.for_each_member([&](StringView key) -> ErrorOr<void> {
+        if (key == "strings"sv) {
+            strings = Vector<DeprecatedString> {};
+            return parser.for_each_element([&]() -> ErrorOr<void> {
+                TRY(strings->try_append(TRY(parser.read<DeprecatedString>())));
+                return {};
+            });
+        }
+        if (key == "events"sv) {
+            perf_events = Vector<PerfEvent> {};
+            return parser.for_each_element([&]() -> ErrorOr<void> {
+                PerfEvent perf_event;
+                TRY(read_perf_event(parser, perf_event));
+                TRY(perf_events->try_append(move(perf_event)));
+                return {};
+            });
+        }
+        return {};
+    });
+    if (parse_result.is_error())
+        return Error::from_string_literal("Invalid perfcore format (malformed JSON)");
 
     if (!g_kernel_debuginfo_object.has_value()) {
         auto debuginfo_file_or_error = Core::MappedFile::map("/boot/Kernel.debug"sv);
@@ -251,62 +347,54 @@ ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path
         }
     }
 
-    auto strings_value = object.get_array("strings"sv);
-    if (!strings_value.has_value())
+    if (!strings.has_value())
         return Error::from_string_literal("Malformed profile (strings is not an array)");
-    auto const& strings = strings_value.value();
 
     HashMap<FlatPtr, DeprecatedString> profile_strings;
-    for (FlatPtr string_id = 0; string_id < strings.size(); ++string_id) {
-        auto const& value = strings.at(string_id);
-        profile_strings.set(string_id, value.to_deprecated_string());
-    }
+    for (FlatPtr string_id = 0; string_id < strings->size(); ++string_id)
+        profile_strings.set(string_id, strings->at(string_id));
 
-    auto events_value = object.get_array("events"sv);
-    if (!events_value.has_value())
+    if (!perf_events.has_value())
         return Error::from_string_literal("Malformed profile (events is not an array)");
-    auto const& perf_events = events_value.value();
 
     Vector<NonnullOwnPtr<Process>> all_processes;
     HashMap<pid_t, Process*> current_processes;
     Vector<Event> events;
     EventSerialNumber next_serial;
 
-    for (auto const& perf_event_value : perf_events.values()) {
-        auto const& perf_event = perf_event_value.as_object();
-
+    for (auto const& perf_event : *perf_events) {
         Event event;
 
         event.serial = next_serial;
         next_serial.increment();
-        event.timestamp = perf_event.get_u64("timestamp"sv).value_or(0);
-        event.lost_samples = perf_event.get_u32("lost_samples"sv).value_or(0);
-        event.pid = perf_event.get_i32("pid"sv).value_or(0);
-        event.tid = perf_event.get_i32("tid"sv).value_or(0);
+        event.timestamp = perf_event.timestamp;
+        event.lost_samples = perf_event.lost_samples;
+        event.pid = perf_event.pid;
+        event.tid = perf_event.tid;
 
-        auto type_string = perf_event.get_deprecated_string("type"sv).value_or({});
+        auto const& type_string = perf_event.type;
 
         if (type_string == "sample"sv) {
             event.data = Event::SampleData {};
         } else if (type_string == "malloc"sv) {
             event.data = Event::MallocData {
-                .ptr = perf_event.get_addr("ptr"sv).value_or(0),
-                .size = perf_event.get_integer<size_t>("size"sv).value_or(0),
+                .ptr = perf_event.ptr,
+                .size = perf_event.size,
             };
         } else if (type_string == "free"sv) {
             event.data = Event::FreeData {
-                .ptr = perf_event.get_addr("ptr"sv).value_or(0),
+                .ptr = perf_event.ptr,
             };
         } else if (type_string == "signpost"sv) {
-            auto string_id = perf_event.get_addr("arg1"sv).value_or(0);
+            auto string_id = perf_event.arg1;
             event.data = Event::SignpostData {
                 .string = profile_strings.get(string_id).value_or(DeprecatedString::formatted("Signpost #{}", string_id)),
-                .arg = perf_event.get_addr("arg2"sv).value_or(0),
+                .arg = perf_event.arg2,
             };
         } else if (type_string == "mmap"sv) {
-            auto ptr = perf_event.get_addr("ptr"sv).value_or(0);
-            auto size = perf_event.get_integer<size_t>("size"sv).value_or(0);
-            auto name = perf_event.get_deprecated_string("name"sv).value_or({});
+            auto ptr = perf_event.ptr;
+            auto size = perf_event.size;
+            auto const& name = perf_event.name;
 
             event.data = Event::MmapData {
                 .ptr = ptr,
@@ -320,13 +408,13 @@ ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path
             continue;
         } else if (type_string == "munmap"sv) {
             event.data = Event::MunmapData {
-                .ptr = perf_event.get_addr("ptr"sv).value_or(0),
-                .size = perf_event.get_integer<size_t>("size"sv).value_or(0),
+                .ptr = perf_event.ptr,
+                .size = perf_event.size,
             };
             continue;
         } else if (type_string == "process_create"sv) {
-            auto parent_pid = perf_event.get_integer<pid_t>("parent_pid"sv).value_or(0);
-            auto executable = perf_event.get_deprecated_string("executable"sv).value_or({});
+            auto parent_pid = perf_event.parent_pid;
+            auto const& executable = perf_event.executable;
             event.data = Event::ProcessCreateData {
                 .parent_pid = parent_pid,
                 .executable = executable,
@@ -344,7 +432,7 @@ ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path
             all_processes.append(move(sampled_process));
             continue;
         } else if (type_string == "process_exec"sv) {
-            auto executable = perf_event.get_deprecated_string("executable"sv).value_or({});
+            auto const& executable = perf_event.executable;
             event.data = Event::ProcessExecData {
                 .executable = executable,
             };
@@ -372,7 +460,7 @@ ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path
             current_processes.remove(event.pid);
             continue;
         } else if (type_string == "thread_create"sv) {
-            auto parent_tid = perf_event.get_integer<pid_t>("parent_tid"sv).value_or(0);
+            auto parent_tid = perf_event.parent_tid;
             event.data = Event::ThreadCreateData {
                 .parent_tid = parent_tid,
             };
@@ -386,13 +474,13 @@ ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path
                 it->value->handle_thread_exit(event.tid, event.serial);
             continue;
         } else if (type_string == "read"sv) {
-            auto const string_index = perf_event.get_addr("filename_index"sv).value_or(0);
+            auto const string_index = perf_event.filename_index;
             event.data = Event::ReadData {
-                .fd = perf_event.get_integer<int>("fd"sv).value_or(0),
-                .size = perf_event.get_integer<size_t>("size"sv).value_or(0),
+                .fd = perf_event.fd,
+                .size = perf_event.size,
                 .path = profile_strings.get(string_index).value(),
-                .start_timestamp = perf_event.get_integer<size_t>("start_timestamp"sv).value_or(0),
-                .success = perf_event.get_bool("success"sv).value_or(false)
+                .start_timestamp = perf_event.start_timestamp,
+                .success = perf_event.success
             };
         } else {
             dbgln("Unknown event type '{}'", type_string);
@@ -401,12 +489,8 @@ ErrorOr<NonnullOwnPtr<Profile>> Profile::load_from_perfcore_file(StringView path
 
         auto maybe_kernel_base = Symbolication::kernel_base();
 
-        auto stack = perf_event.get_array("stack"sv);
-        VERIFY(stack.has_value());
-        auto const& stack_array = stack.value();
-        for (ssize_t i = stack_array.values().size() - 1; i >= 0; --i) {
-            auto const& frame = stack_array.at(i);
-            auto ptr = frame.to_number<u64>();
+        for (ssize_t i = perf_event.stack.size() - 1; i >= 0; --i) {
+            auto ptr = perf_event.stack[i];
             u32 offset = 0;
             DeprecatedFlyString object_name;
             DeprecatedString symbol;
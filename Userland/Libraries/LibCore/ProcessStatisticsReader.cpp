@@ -5,9 +5,9 @@
  */
 
 #include <AK/ByteBuffer.h>
-#include <AK/JsonArray.h>
-#include <AK/JsonObject.h>
-#include <AK/JsonValue.h>
+#include <AK/HashMap.h>
+#include <AK/JsonPullParser.h>
+#include <Kernel/API/ProcessStatistics.h>
 #include <LibCore/File.h>
 #include <LibCore/ProcessStatisticsReader.h>
 #include <pwd.h>
@@ -16,83 +16,306 @@ namespace Core {
 
 HashMap<uid_t, DeprecatedString> ProcessStatisticsReader::s_usernames;
 
-ErrorOr<AllProcessesStatistics> ProcessStatisticsReader::get_all(SeekableStream& proc_all_file, bool include_usernames)
+static ErrorOr<void> read_thread_statistics(JsonPullParser& parser, Core::ThreadStatistics& thread)
 {
-    TRY(proc_all_file.seek(0, SeekMode::SetPosition));
+    return parser.for_each_member([&](StringView key) -> ErrorOr<void> {
+        if (key == "tid"sv)
+            return parser.read_into(thread.tid);
+        if (key == "times_scheduled"sv)
+            return parser.read_into(thread.times_scheduled);
+        if (key == "name"sv)
+            return parser.read_into(thread.name);
+        if (key == "state"sv)
+            return parser.read_into(thread.state);
+        if (key == "time_user"sv)
+            return parser.read_into(thread.time_user);
+        if (key == "time_kernel"sv)
+            return parser.read_into(thread.time_kernel);
+        if (key == "cpu"sv)
+            return parser.read_into(thread.cpu);
+        if (key == "priority"sv)
+            return parser.read_into(thread.priority);
+        if (key == "syscall_count"sv)
+            return parser.read_into(thread.syscall_count);
+        if (key == "inode_faults"sv)
+            return parser.read_into(thread.inode_faults);
+        if (key == "zero_faults"sv)
+            return parser.read_into(thread.zero_faults);
+        if (key == "cow_faults"sv)
+            return parser.read_into(thread.cow_faults);
+        if (key == "unix_socket_read_bytes"sv)
+            return parser.read_into(thread.unix_socket_read_bytes);
+        if (key == "unix_socket_write_bytes"sv)
+            return parser.read_into(thread.unix_socket_write_bytes);
+        if (key == "ipv4_socket_read_bytes"sv)
+            return parser.read_into(thread.ipv4_socket_read_bytes);
+        if (key == "ipv4_socket_write_bytes"sv)
+            return parser.read_into(thread.ipv4_socket_write_bytes);
+        if (key == "file_read_bytes"sv)
+            return parser.read_into(thread.file_read_bytes);
+        if (key == "file_write_bytes"sv)
+            return parser.read_into(thread.file_write_bytes);
+        return {};
+    });
+}
 
-    AllProcessesStatistics all_processes_statistics;
+static ErrorOr<void> read_process_statistics(JsonPullParser& parser, Core::ProcessStatistics& process)
+{
+    return parser.for_each_member([&](StringView key) -> ErrorOr<void> {
+        if (key == "pid"sv)
+            return parser.read_into(process.pid);
+        if (key == "pgid"sv)
+            return parser.read_into(process.pgid);
+        if (key == "pgp"sv)
+            return parser.read_into(process.pgp);
+        if (key == "sid"sv)
+            return parser.read_into(process.sid);
+        if (key == "uid"sv)
+            return parser.read_into(process.uid);
+        if (key == "gid"sv)
+            return parser.read_into(process.gid);
+        if (key == "ppid"sv)
+            return parser.read_into(process.ppid);
+        if (key == "kernel"sv)
+            return parser.read_into(process.kernel);
+        if (key == "name"sv)
+            return parser.read_into(process.name);
+        if (key == "executable"sv)
+            return parser.read_into(process.executable);
+        if (key == "tty"sv)
+            return parser.read_into(process.tty);
+        if (key == "pledge"sv)
+            return parser.read_into(process.pledge);
+        if (key == "veil"sv)
+            return parser.read_into(process.veil);
+        if (key == "creation_time"sv) {
+            process.creation_time = UnixDateTime::from_nanoseconds_since_epoch(TRY(parser.read<i64>()));
+            return {};
+        }
+        if (key == "amount_virtual"sv)
+            return parser.read_into(process.amount_virtual);
+        if (key == "amount_resident"sv)
+            return parser.read_into(process.amount_resident);
+        if (key == "amount_shared"sv)
+            return parser.read_into(process.amount_shared);
+        if (key == "amount_dirty_private"sv)
+            return parser.read_into(process.amount_dirty_private);
+        if (key == "amount_clean_inode"sv)
+            return parser.read_into(process.amount_clean_inode);
+        if (key == "amount_purgeable_volatile"sv)
+            return parser.read_into(process.amount_purgeable_volatile);
+        if (key == "amount_purgeable_nonvolatile"sv)
+            return parser.read_into(process.amount_purgeable_nonvolatile);
+        if (key == "threads"sv) {
+            return parser.for_each_element([&]() -> ErrorOr<void> {
+                Core::ThreadStatistics thread {};
+                TRY(read_thread_statistics(parser, thread));
+                TRY(process.threads.try_append(move(thread)));
+                return {};
+            });
+        }
+        return {};
+    });
+}
 
-    auto file_contents = TRY(proc_all_file.read_until_eof());
-    auto json_obj = TRY(JsonValue::from_string(file_contents)).as_object();
-    json_obj.get_array("processes"sv)->for_each([&](auto& value) {
-        const JsonObject& process_object = value.as_object();
-        Core::ProcessStatistics process;
-
-        // kernel data first
-        process.pid = process_object.get_u32("pid"sv).value_or(0);
-        process.pgid = process_object.get_u32("pgid"sv).value_or(0);
-        process.pgp = process_object.get_u32("pgp"sv).value_or(0);
-        process.sid = process_object.get_u32("sid"sv).value_or(0);
-        process.uid = process_object.get_u32("uid"sv).value_or(0);
-        process.gid = process_object.get_u32("gid"sv).value_or(0);
-        process.ppid = process_object.get_u32("ppid"sv).value_or(0);
-        process.kernel = process_object.get_bool("kernel"sv).value_or(false);
-        process.name = process_object.get_deprecated_string("name"sv).value_or("");
-        process.executable = process_object.get_deprecated_string("executable"sv).value_or("");
-        process.tty = process_object.get_deprecated_string("tty"sv).value_or("");
-        process.pledge = process_object.get_deprecated_string("pledge"sv).value_or("");
-        process.veil = process_object.get_deprecated_string("veil"sv).value_or("");
-        process.creation_time = UnixDateTime::from_nanoseconds_since_epoch(process_object.get_i64("creation_time"sv).value_or(0));
-        process.amount_virtual = process_object.get_u32("amount_virtual"sv).value_or(0);
-        process.amount_resident = process_object.get_u32("amount_resident"sv).value_or(0);
-        process.amount_shared = process_object.get_u32("amount_shared"sv).value_or(0);
-        process.amount_dirty_private = process_object.get_u32("amount_dirty_private"sv).value_or(0);
-        process.amount_clean_inode = process_object.get_u32("amount_clean_inode"sv).value_or(0);
-        process.amount_purgeable_volatile = process_object.get_u32("amount_purgeable_volatile"sv).value_or(0);
-        process.amount_purgeable_nonvolatile = process_object.get_u32("amount_purgeable_nonvolatile"sv).value_or(0);
-
-        auto& thread_array = process_object.get_array("threads"sv).value();
-        process.threads.ensure_capacity(thread_array.size());
-        thread_array.for_each([&](auto& value) {
-            auto& thread_object = value.as_object();
-            Core::ThreadStatistics thread;
-            thread.tid = thread_object.get_u32("tid"sv).value_or(0);
-            thread.times_scheduled = thread_object.get_u32("times_scheduled"sv).value_or(0);
-            thread.name = thread_object.get_deprecated_string("name"sv).value_or("");
-            thread.state = thread_object.get_deprecated_string("state"sv).value_or("");
-            thread.time_user = thread_object.get_u64("time_user"sv).value_or(0);
-            thread.time_kernel = thread_object.get_u64("time_kernel"sv).value_or(0);
-            thread.cpu = thread_object.get_u32("cpu"sv).value_or(0);
-            thread.priority = thread_object.get_u32("priority"sv).value_or(0);
-            thread.syscall_count = thread_object.get_u32("syscall_count"sv).value_or(0);
-            thread.inode_faults = thread_object.get_u32("inode_faults"sv).value_or(0);
-            thread.zero_faults = thread_object.get_u32("zero_faults"sv).value_or(0);
-            thread.cow_faults = thread_object.get_u32("cow_faults"sv).value_or(0);
-            thread.unix_socket_read_bytes = thread_object.get_u64("unix_socket_read_bytes"sv).value_or(0);
-            thread.unix_socket_write_bytes = thread_object.get_u64("unix_socket_write_bytes"sv).value_or(0);
-            thread.ipv4_socket_read_bytes = thread_object.get_u64("ipv4_socket_read_bytes"sv).value_or(0);
-            thread.ipv4_socket_write_bytes = thread_object.get_u64("ipv4_socket_write_bytes"sv).value_or(0);
-            thread.file_read_bytes = thread_object.get_u64("file_read_bytes"sv).value_or(0);
-            thread.file_write_bytes = thread_object.get_u64("file_write_bytes"sv).value_or(0);
-            process.threads.append(move(thread));
+ErrorOr<AllProcessesStatistics> ProcessStatisticsReader::get_all_from_json(StringView file_contents, bool include_usernames)
+{
+    AllProcessesStatistics all_processes_statistics {};
+
+    // This is polled continuously by SystemMonitor and friends, so read straight into the statistics structs
+    // instead of building a JsonValue tree first.
+    JsonPullParser parser { file_contents };
+    TRY(parser.for_each_member([&](StringView key) -> ErrorOr<void> {
+        if (key == "total_time"sv)
+            return parser.read_into(all_processes_statistics.total_time_scheduled);
+        if (key == "total_time_kernel"sv)
+            return parser.read_into(all_processes_statistics.total_time_scheduled_kernel);
+        if (key != "processes"sv)
+            return {};
+
+        return parser.for_each_element([&]() -> ErrorOr<void> {
+            Core::ProcessStatistics process {};
+            TRY(read_process_statistics(parser, process));
+
+            // and synthetic data last
+            if (include_usernames)
+                process.username = username_from_uid(process.uid);
+            TRY(all_processes_statistics.processes.try_append(move(process)));
+            return {};
         });
+    }));
+
+    return all_processes_statistics;
+}
+
+static void update_string(DeprecatedString& string, StringView new_value)
+{
+    if (string.is_null() || string != new_value)
+        string = new_value;
+}
+
+ErrorOr<void> ProcessStatisticsReader::update_from_binary(ReadonlyBytes bytes, AllProcessesStatistics& statistics, bool include_usernames)
+{
+    size_t offset = 0;
+    auto read_record = [&]<typename T>() -> ErrorOr<T> {
+        if (bytes.size() - offset < sizeof(T))
+            return Error::from_string_literal("Truncated process statistics record");
+        T record;
+        __builtin_memcpy(&record, bytes.offset_pointer(offset), sizeof(T));
+        offset += sizeof(T);
+        return record;
+    };
+    auto read_string = [&](u32 length) -> ErrorOr<StringView> {
+        if (bytes.size() - offset < length)
+            return Error::from_string_literal("Truncated process statistics string");
+        auto string = StringView { bytes.slice(offset, length) };
+        offset += length;
+        return string;
+    };
+    auto next_record_type = [&]() -> Optional<ProcessStatisticsRecordType> {
+        if (bytes.size() - offset < sizeof(ProcessStatisticsRecordType))
+            return {};
+        ProcessStatisticsRecordType type;
+        __builtin_memcpy(&type, bytes.offset_pointer(offset), sizeof(type));
+        return type;
+    };
+
+    auto header = TRY(read_record.operator()<ProcessStatisticsHeader>());
+    if (header.magic != PROCESS_STATISTICS_MAGIC || header.version != PROCESS_STATISTICS_VERSION)
+        return Error::from_string_literal("Unsupported process statistics format");
+
+    // Reuse the entries of the previous snapshot for processes that are still around. If nothing was created or
+    // destroyed in the meantime, everything is in the same place as last time and we don't even have to look.
+    // NOTE: The entries are copied rather than moved, so `statistics` stays intact if the snapshot turns out to be
+    //       malformed. Their strings are shared, so this doesn't allocate any new ones.
+    auto const& previous_processes = statistics.processes;
+    bool same_layout = statistics.generation != 0 && statistics.generation == header.generation;
+    HashMap<pid_t, size_t> previous_process_indices;
+    if (!same_layout) {
+        for (size_t i = 0; i < previous_processes.size(); ++i)
+            TRY(previous_process_indices.try_set(previous_processes[i].pid, i));
+    }
+    auto find_previous_process = [&](size_t index, pid_t pid) -> Optional<ProcessStatistics> {
+        if (same_layout) {
+            if (index < previous_processes.size() && previous_processes[index].pid == pid)
+                return previous_processes[index];
+            return {};
+        }
+        if (auto previous_index = previous_process_indices.get(pid); previous_index.has_value())
+            return previous_processes[*previous_index];
+        return {};
+    };
+
+    AllProcessesStatistics updated_statistics {};
+    TRY(updated_statistics.processes.try_ensure_capacity(previous_processes.size()));
+    updated_statistics.generation = header.generation;
+    updated_statistics.total_time_scheduled = header.total_time_scheduled;
+    updated_statistics.total_time_scheduled_kernel = header.total_time_scheduled_kernel;
+
+    while (offset < bytes.size()) {
+        if (next_record_type() != ProcessStatisticsRecordType::Process)
+            return Error::from_string_literal("Expected process statistics record");
+        auto record = TRY(read_record.operator()<ProcessStatisticsRecord>());
+
+        auto process = find_previous_process(updated_statistics.processes.size(), record.pid).value_or({});
+        process.pid = record.pid;
+        process.pgid = record.pgid;
+        process.pgp = record.pgp;
+        process.sid = record.sid;
+        process.uid = record.uid;
+        process.gid = record.gid;
+        process.ppid = record.ppid;
+        process.kernel = record.kernel;
+        process.creation_time = UnixDateTime::from_nanoseconds_since_epoch(record.creation_time_ns);
+        process.amount_virtual = record.amount_virtual;
+        process.amount_resident = record.amount_resident;
+        process.amount_shared = record.amount_shared;
+        process.amount_dirty_private = record.amount_dirty_private;
+        process.amount_clean_inode = record.amount_clean_inode;
+        process.amount_purgeable_volatile = record.amount_purgeable_volatile;
+        process.amount_purgeable_nonvolatile = record.amount_purgeable_nonvolatile;
+        update_string(process.name, TRY(read_string(record.name_length)));
+        update_string(process.executable, TRY(read_string(record.executable_length)));
+        update_string(process.tty, TRY(read_string(record.tty_length)));
+        update_string(process.pledge, TRY(read_string(record.pledge_length)));
+        update_string(process.veil, TRY(read_string(record.veil_length)));
+
+        // Threads are matched up by position, which is good enough: they're only ever appended to or removed from
+        // a process' thread list, and anything that doesn't line up simply gets overwritten.
+        size_t thread_count = 0;
+        while (next_record_type() == ProcessStatisticsRecordType::Thread) {
+            auto thread_record = TRY(read_record.operator()<ThreadStatisticsRecord>());
+            if (thread_count == process.threads.size())
+                TRY(process.threads.try_append({}));
+            auto& thread = process.threads[thread_count++];
+            thread.tid = thread_record.tid;
+            thread.times_scheduled = thread_record.times_scheduled;
+            thread.time_user = thread_record.time_user;
+            thread.time_kernel = thread_record.time_kernel;
+            thread.cpu = thread_record.cpu;
+            thread.priority = thread_record.priority;
+            thread.syscall_count = thread_record.syscall_count;
+            thread.inode_faults = thread_record.inode_faults;
+            thread.zero_faults = thread_record.zero_faults;
+            thread.cow_faults = thread_record.cow_faults;
+            thread.unix_socket_read_bytes = thread_record.unix_socket_read_bytes;
+            thread.unix_socket_write_bytes = thread_record.unix_socket_write_bytes;
+            thread.ipv4_socket_read_bytes = thread_record.ipv4_socket_read_bytes;
+            thread.ipv4_socket_write_bytes = thread_record.ipv4_socket_write_bytes;
+            thread.file_read_bytes = thread_record.file_read_bytes;
+            thread.file_write_bytes = thread_record.file_write_bytes;
+            update_string(thread.name, TRY(read_string(thread_record.name_length)));
+            update_string(thread.state, TRY(read_string(thread_record.state_length)));
+        }
+        process.threads.shrink(thread_count);
 
         // and synthetic data last
-        if (include_usernames) {
+        if (include_usernames)
             process.username = username_from_uid(process.uid);
-        }
-        all_processes_statistics.processes.append(move(process));
-    });
+        TRY(updated_statistics.processes.try_append(move(process)));
+    }
 
-    all_processes_statistics.total_time_scheduled = json_obj.get_u64("total_time"sv).value_or(0);
-    all_processes_statistics.total_time_scheduled_kernel = json_obj.get_u64("total_time_kernel"sv).value_or(0);
-    return all_processes_statistics;
+    statistics = move(updated_statistics);
+    return {};
+}
+
+ErrorOr<void> ProcessStatisticsReader::update(SeekableStream& proc_all_file, AllProcessesStatistics& statistics, bool include_usernames)
+{
+    TRY(proc_all_file.seek(0, SeekMode::SetPosition));
+    auto file_contents = TRY(proc_all_file.read_until_eof());
+
+    u32 magic = 0;
+    if (file_contents.size() >= sizeof(magic))
+        __builtin_memcpy(&magic, file_contents.data(), sizeof(magic));
+    if (magic == PROCESS_STATISTICS_MAGIC)
+        return update_from_binary(file_contents, statistics, include_usernames);
+
+    statistics = TRY(get_all_from_json(file_contents, include_usernames));
+    return {};
+}
+
+ErrorOr<void> ProcessStatisticsReader::update(AllProcessesStatistics& statistics, bool include_usernames)
+{
+    // Prefer the binary format, but keep working for programs that have only unveiled the JSON one.
+    auto proc_all_file_or_error = Core::File::open("/sys/kernel/processes_binary"sv, Core::File::OpenMode::Read);
+    if (proc_all_file_or_error.is_error())
+        proc_all_file_or_error = Core::File::open("/sys/kernel/processes"sv, Core::File::OpenMode::Read);
+    auto proc_all_file = TRY(proc_all_file_or_error);
+    return update(*proc_all_file, statistics, include_usernames);
+}
+
+ErrorOr<AllProcessesStatistics> ProcessStatisticsReader::get_all(SeekableStream& proc_all_file, bool include_usernames)
+{
+    AllProcessesStatistics statistics {};
+    TRY(update(proc_all_file, statistics, include_usernames));
+    return statistics;
 }
 
 ErrorOr<AllProcessesStatistics> ProcessStatisticsReader::get_all(bool include_usernames)
 {
-    auto proc_all_file = TRY(Core::File::open("/sys/kernel/processes"sv, Core::File::OpenMode::Read));
-    return get_all(*proc_all_file, include_usernames);
+    AllProcessesStatistics statistics {};
+    TRY(update(statistics, include_usernames));
+    return statistics;
 }
 
 DeprecatedString ProcessStatisticsReader::username_from_uid(uid_t uid)
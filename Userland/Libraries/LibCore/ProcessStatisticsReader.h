@@ -35,7 +35,7 @@ struct ThreadStatistics {
 };
 
 struct ProcessStatistics {
-    // Keep this in sync with /sys/kernel/processes.
+    // Keep this in sync with /sys/kernel/processes and Kernel/API/ProcessStatistics.h.
     // From the kernel side:
     pid_t pid;
     pid_t pgid;
@@ -69,6 +69,9 @@ struct AllProcessesStatistics {
     Vector<ProcessStatistics> processes;
     u64 total_time_scheduled;
     u64 total_time_scheduled_kernel;
+
+    // The kernel's process list generation at the time of the snapshot, or 0 if it wasn't read from /sys/kernel/processes_binary.
+    u64 generation { 0 };
 };
 
 class ProcessStatisticsReader {
@@ -76,7 +79,14 @@ public:
     static ErrorOr<AllProcessesStatistics> get_all(SeekableStream&, bool include_usernames = true);
     static ErrorOr<AllProcessesStatistics> get_all(bool include_usernames = true);
 
+    // Refreshes an earlier snapshot in place. Processes and threads that are still around keep their entries, and their
+    // strings are only reallocated if they changed, which makes this a lot cheaper than get_all() for callers that poll.
+    static ErrorOr<void> update(SeekableStream&, AllProcessesStatistics&, bool include_usernames = true);
+    static ErrorOr<void> update(AllProcessesStatistics&, bool include_usernames = true);
+
 private:
+    static ErrorOr<void> update_from_binary(ReadonlyBytes, AllProcessesStatistics&, bool include_usernames);
+    static ErrorOr<AllProcessesStatistics> get_all_from_json(StringView, bool include_usernames);
     static DeprecatedString username_from_uid(uid_t);
     static HashMap<uid_t, DeprecatedString> s_usernames;
 };
@@ -86,6 +86,21 @@ DeprecatedString StandardPaths::data_directory()
     return LexicalPath::canonicalized_path(builder.to_deprecated_string());
 }
 
+DeprecatedString StandardPaths::cache_directory()
+{
+    if (auto* cache_directory = getenv("XDG_CACHE_HOME"))
+        return LexicalPath::canonicalized_path(cache_directory);
+
+    StringBuilder builder;
+    builder.append(home_directory());
+#if defined(AK_OS_MACOS)
+    builder.append("/Library/Caches"sv);
+#else
+    builder.append("/.cache"sv);
+#endif
+    return LexicalPath::canonicalized_path(builder.to_deprecated_string());
+}
+
 ErrorOr<DeprecatedString> StandardPaths::runtime_directory()
 {
     if (auto* data_directory = getenv("XDG_RUNTIME_DIR"))
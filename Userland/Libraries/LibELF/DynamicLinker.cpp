@@ -57,6 +57,9 @@ static DeprecatedString s_cwd;
 
 static bool s_allowed_to_check_environment_variables { false };
 static bool s_do_breakpoint_trap_before_entry { false };
+static bool s_disable_symbol_cache { false };
+static bool s_print_symbol_cache_statistics { false };
+static bool s_bind_now { false };
 static StringView s_ld_library_path;
 static StringView s_main_program_pledge_promises;
 static DeprecatedString s_loader_pledge_promises;
@@ -66,7 +69,16 @@ static Result<void*, DlErrorMessage> __dlopen(char const* filename, int flags);
 static Result<void*, DlErrorMessage> __dlsym(void* handle, char const* symbol_name);
 static Result<void, DlErrorMessage> __dladdr(void const* addr, Dl_info* info);
 
-Optional<DynamicObject::SymbolLookupResult> DynamicLinker::lookup_global_symbol(StringView name)
+// While the initial set of libraries is being relocated, the same handful of symbols (malloc, free, AK helpers, vtables...)
+// are looked up over and over again by every object. The set of global objects doesn't change during that time and no
+// other threads exist yet, so we can memoize the results. The cache is discarded once relocation is done.
+static bool s_symbol_cache_enabled { false };
+static HashMap<StringView, Optional<DynamicObject::SymbolLookupResult>> s_symbol_cache;
+static size_t s_symbol_cache_lookups { 0 };
+static size_t s_symbol_cache_hits { 0 };
+static size_t s_symbol_cache_invalidations { 0 };
+
+static Optional<DynamicObject::SymbolLookupResult> lookup_global_symbol_uncached(StringView name)
 {
     Optional<DynamicObject::SymbolLookupResult> weak_result;
 
@@ -85,6 +97,54 @@ Optional<DynamicObject::SymbolLookupResult> DynamicLinker::lookup_global_symbol(
     return weak_result;
 }
 
+Optional<DynamicObject::SymbolLookupResult> DynamicLinker::lookup_global_symbol(StringView name)
+{
+    if (!s_symbol_cache_enabled)
+        return lookup_global_symbol_uncached(name);
+
+    ++s_symbol_cache_lookups;
+    if (auto cached_result = s_symbol_cache.get(name); cached_result.has_value()) {
+        ++s_symbol_cache_hits;
+        return cached_result.release_value();
+    }
+
+    auto result = lookup_global_symbol_uncached(name);
+    s_symbol_cache.set(name, result);
+    return result;
+}
+
+static void enable_symbol_cache()
+{
+    VERIFY(!s_symbol_cache_enabled);
+    s_symbol_cache_enabled = true;
+    s_symbol_cache_lookups = 0;
+    s_symbol_cache_hits = 0;
+    s_symbol_cache_invalidations = 0;
+}
+
+static void set_global_object(DeprecatedString const& filepath, DynamicObject& object)
+{
+    s_global_objects.set(filepath, object);
+
+    // The new object may define symbols that were looked up (and maybe not found) before.
+    if (!s_symbol_cache.is_empty()) {
+        s_symbol_cache.clear();
+        ++s_symbol_cache_invalidations;
+    }
+}
+
+static void discard_symbol_cache()
+{
+    if (!s_symbol_cache_enabled)
+        return;
+
+    dbgln_if(DYNAMIC_LOAD_DEBUG, "Symbol cache: {} entries, {} lookups, {} hits, {} invalidations", s_symbol_cache.size(), s_symbol_cache_lookups, s_symbol_cache_hits, s_symbol_cache_invalidations);
+    if (s_print_symbol_cache_statistics)
+        warnln("Symbol cache: {} lookups, {} hits, {} invalidations", s_symbol_cache_lookups, s_symbol_cache_hits, s_symbol_cache_invalidations);
+    s_symbol_cache_enabled = false;
+    s_symbol_cache.clear();
+}
+
 static Result<NonnullRefPtr<DynamicLoader>, DlErrorMessage> map_library(DeprecatedString const& filepath, int fd)
 {
     VERIFY(filepath.starts_with('/'));
@@ -100,7 +160,7 @@ static Result<NonnullRefPtr<DynamicLoader>, DlErrorMessage> map_library(Deprecat
 
     // This actually maps the library at the intended and final place.
     auto main_library_object = loader->map();
-    s_global_objects.set(filepath, *main_library_object);
+    set_global_object(filepath, *main_library_object);
 
     return loader;
 }
@@ -387,7 +447,7 @@ static Result<void, DlErrorMessage> link_main_library(DeprecatedString const& pa
     for (auto& loader : loaders) {
         auto dynamic_object = loader->map();
         if (dynamic_object)
-            s_global_objects.set(dynamic_object->filepath(), *dynamic_object);
+            set_global_object(dynamic_object->filepath(), *dynamic_object);
     }
 
     for (auto& loader : loaders) {
@@ -398,7 +458,7 @@ static Result<void, DlErrorMessage> link_main_library(DeprecatedString const& pa
     }
 
     for (auto& loader : loaders) {
-        auto result = loader->load_stage_3(flags);
+        auto result = loader->load_stage_3();
         VERIFY(!result.is_error());
         auto& object = result.value();
 
@@ -424,6 +484,9 @@ static Result<void, DlErrorMessage> link_main_library(DeprecatedString const& pa
         }
     }
 
+    // Initializers may spawn threads that resolve PLT entries lazily, so stop memoizing lookups before running them.
+    discard_symbol_cache();
+
     drop_loader_promise("prot_exec"sv);
 
     for (auto& loader : loaders) {
@@ -479,9 +542,13 @@ static Optional<DlErrorMessage> verify_tls_for_dlopen(DynamicLoader const& loade
 
 static Result<void*, DlErrorMessage> __dlopen(char const* filename, int flags)
 {
-    // FIXME: RTLD_NOW and RTLD_LOCAL are not supported
-    flags &= ~RTLD_NOW;
-    flags |= RTLD_LAZY;
+    // FIXME: RTLD_LOCAL is not supported
+    if (s_bind_now || (flags & RTLD_NOW)) {
+        flags &= ~RTLD_LAZY;
+        flags |= RTLD_NOW;
+    } else {
+        flags |= RTLD_LAZY;
+    }
     flags &= ~RTLD_LOCAL;
     flags |= RTLD_GLOBAL;
 
@@ -602,6 +669,20 @@ static void read_environment_variables()
             s_do_breakpoint_trap_before_entry = true;
         }
 
+        if (env_string == "_LOADER_DISABLE_SYMBOL_CACHE=1"sv) {
+            s_disable_symbol_cache = true;
+        }
+
+        if (env_string == "_LOADER_SYMBOL_CACHE_STATISTICS=1"sv) {
+            s_print_symbol_cache_statistics = true;
+        }
+
+        // Like other loaders, any non-empty value of LD_BIND_NOW makes us resolve all PLT entries up front.
+        constexpr auto bind_now_string = "LD_BIND_NOW="sv;
+        if (env_string.starts_with(bind_now_string) && env_string.length() > bind_now_string.length()) {
+            s_bind_now = true;
+        }
+
         constexpr auto library_path_string = "LD_LIBRARY_PATH="sv;
         if (env_string.starts_with(library_path_string)) {
             s_ld_library_path = env_string.substring_view(library_path_string.length());
@@ -660,7 +741,12 @@ void ELF::DynamicLinker::linker_main(DeprecatedString&& main_program_path, int m
     allocate_tls();
 
     auto entry_point_function = [&main_program_path] {
-        auto result = link_main_library(main_program_path, RTLD_GLOBAL | RTLD_LAZY);
+        if (!s_disable_symbol_cache)
+            enable_symbol_cache();
+        else if (s_print_symbol_cache_statistics)
+            warnln("Symbol cache: disabled");
+
+        auto result = link_main_library(main_program_path, RTLD_GLOBAL | (s_bind_now ? RTLD_NOW : RTLD_LAZY));
         if (result.is_error()) {
             warnln("{}", result.error().text);
             _exit(1);
@@ -668,6 +754,8 @@ void ELF::DynamicLinker::linker_main(DeprecatedString&& main_program_path, int m
 
         drop_loader_promise("rpath"sv);
 
+        dbgln_if(DYNAMIC_LOAD_DEBUG, "Bound {} PLT entries eagerly before entering {}", DynamicLoader::eagerly_bound_plt_entry_count(), main_program_path);
+
         auto& main_executable_loader = *s_loaders.get(main_program_path);
         auto entry_point = main_executable_loader->image().entry();
         if (main_executable_loader->is_dynamic())
@@ -7,6 +7,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <AK/Debug.h>
 #include <AK/Optional.h>
 #include <AK/QuickSort.h>
@@ -37,6 +38,9 @@ static void* mmap_with_name(void* addr, size_t length, int prot, int flags, int
 
 namespace ELF {
 
+static Atomic<size_t> s_eagerly_bound_plt_entries { 0 };
+static Atomic<size_t> s_lazily_bound_plt_entries { 0 };
+
 Result<NonnullRefPtr<DynamicLoader>, DlErrorMessage> DynamicLoader::try_create(int fd, DeprecatedString filepath)
 {
     VERIFY(filepath.starts_with('/'));
@@ -194,11 +198,11 @@ bool DynamicLoader::load_stage_2(unsigned flags)
             }
         }
     }
-    do_main_relocations();
+    do_main_relocations(flags);
     return true;
 }
 
-void DynamicLoader::do_main_relocations()
+void DynamicLoader::do_main_relocations(unsigned flags)
 {
     do_relr_relocations();
 
@@ -225,8 +229,8 @@ void DynamicLoader::do_main_relocations()
             *((FlatPtr*)relocation.address().as_ptr()) += m_dynamic_object->base_address().get();
     };
 
-    // FIXME: Or LD_BIND_NOW is set?
-    if (m_dynamic_object->must_bind_now()) {
+    if (m_dynamic_object->must_bind_now() || (flags & RTLD_NOW)) {
+        size_t bound_entries = 0;
         m_dynamic_object->plt_relocation_section().for_each_relocation([&](DynamicObject::Relocation const& relocation) {
             if (relocation.type() == R_X86_64_IRELATIVE || relocation.type() == R_AARCH64_IRELATIVE) {
                 m_direct_ifunc_relocations.append(relocation);
@@ -245,9 +249,12 @@ void DynamicLoader::do_main_relocations()
                 fixup_trampoline_pointer(relocation);
                 break;
             case RelocationResult::Success:
+                ++bound_entries;
                 break;
             }
         });
+        s_eagerly_bound_plt_entries += bound_entries;
+        dbgln_if(DYNAMIC_LOAD_DEBUG, "{}: Bound {} PLT entries eagerly", m_filepath, bound_entries);
     } else {
         m_dynamic_object->plt_relocation_section().for_each_relocation([&](DynamicObject::Relocation const& relocation) {
             if (relocation.type() == R_X86_64_IRELATIVE || relocation.type() == R_AARCH64_IRELATIVE) {
@@ -259,13 +266,13 @@ void DynamicLoader::do_main_relocations()
     }
 }
 
-Result<NonnullRefPtr<DynamicObject>, DlErrorMessage> DynamicLoader::load_stage_3(unsigned flags)
+Result<NonnullRefPtr<DynamicObject>, DlErrorMessage> DynamicLoader::load_stage_3()
 {
     do_lazy_relocations();
-    if (flags & RTLD_LAZY) {
-        if (m_dynamic_object->has_plt())
-            setup_plt_trampoline();
-    }
+
+    // Even when binding eagerly, IFUNC PLT entries are only resolved below and may end up going through the trampoline.
+    if (m_dynamic_object->has_plt())
+        setup_plt_trampoline();
 
     // IFUNC resolvers can only be called after the PLT has been populated,
     // as they may call arbitrary functions via the PLT.
@@ -735,9 +742,21 @@ extern "C" FlatPtr _fixup_plt_entry(DynamicObject* object, u32 relocation_offset
         dbgln("Loader.so: {} unresolved symbol '{}'", object->filepath(), relocation.symbol().name());
         VERIFY_NOT_REACHED();
     }
+    [[maybe_unused]] auto lazily_bound_entries = ++s_lazily_bound_plt_entries;
+    dbgln_if(DYNAMIC_LOAD_DEBUG, "{}: Lazily bound '{}' ({} lazy, {} eager bindings so far)", object->filepath(), relocation.symbol().name(), lazily_bound_entries, s_eagerly_bound_plt_entries.load());
     return *reinterpret_cast<FlatPtr*>(relocation.address().as_ptr());
 }
 
+size_t DynamicLoader::eagerly_bound_plt_entry_count()
+{
+    return s_eagerly_bound_plt_entries;
+}
+
+size_t DynamicLoader::lazily_bound_plt_entry_count()
+{
+    return s_lazily_bound_plt_entries;
+}
+
 void DynamicLoader::call_object_init_functions()
 {
     typedef void (*InitFunc)();
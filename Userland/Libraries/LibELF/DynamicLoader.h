@@ -67,7 +67,7 @@ public:
     bool load_stage_2(unsigned flags);
 
     // Stage 3 of loading: lazy relocations
-    Result<NonnullRefPtr<DynamicObject>, DlErrorMessage> load_stage_3(unsigned flags);
+    Result<NonnullRefPtr<DynamicObject>, DlErrorMessage> load_stage_3();
 
     // Stage 4 of loading: initializers
     void load_stage_4();
@@ -90,6 +90,10 @@ public:
 
     DynamicObject const& dynamic_object() const;
 
+    // Number of PLT entries resolved at load time (DF_BIND_NOW, RTLD_NOW or LD_BIND_NOW) and through the PLT trampoline.
+    static size_t eagerly_bound_plt_entry_count();
+    static size_t lazily_bound_plt_entry_count();
+
     bool is_fully_relocated() const { return m_fully_relocated; }
     bool is_fully_initialized() const { return m_fully_initialized; }
 
@@ -124,7 +128,7 @@ private:
     void load_program_headers();
 
     // Stage 2
-    void do_main_relocations();
+    void do_main_relocations(unsigned flags);
 
     // Stage 3
     void do_lazy_relocations();
@@ -329,7 +329,8 @@ void Job::on_socket_connected()
                 // There's also the possibility that the server responds with 204 (No Content),
                 // and manages to set a Content-Length anyway, in such cases ignore Content-Length and quit early;
                 // As the HTTP spec explicitly prohibits presence of Content-Length when the response code is 204.
-                if (m_code == 204)
+                // Likewise, a 304 (Not Modified) response never has a body, whatever its Content-Length says.
+                if (m_code == 204 || m_code == 304)
                     return finish_up();
 
                 break;
@@ -16,15 +16,16 @@ Client::Client(NonnullOwnPtr<Core::LocalSocket> socket)
 
 void Client::die()
 {
+    auto pending_decodes = move(m_pending_decodes);
+    for (auto& it : pending_decodes)
+        it.value({});
+
     if (on_death)
         on_death();
 }
 
-Optional<DecodedImage> Client::decode_image(ReadonlyBytes encoded_data, Optional<DeprecatedString> mime_type)
+static Optional<Core::AnonymousBuffer> copy_to_anonymous_buffer(ReadonlyBytes encoded_data)
 {
-    if (encoded_data.is_empty())
-        return {};
-
     auto encoded_buffer_or_error = Core::AnonymousBuffer::create_with_size(encoded_data.size());
     if (encoded_buffer_or_error.is_error()) {
         dbgln("Could not allocate encoded buffer");
@@ -33,7 +34,33 @@ Optional<DecodedImage> Client::decode_image(ReadonlyBytes encoded_data, Optional
     auto encoded_buffer = encoded_buffer_or_error.release_value();
 
     memcpy(encoded_buffer.data<void>(), encoded_data.data(), encoded_data.size());
-    auto response_or_error = try_decode_image(move(encoded_buffer), mime_type);
+    return encoded_buffer;
+}
+
+static DecodedImage make_decoded_image(bool is_animated, u32 loop_count, Vector<Gfx::ShareableBitmap> bitmaps, Vector<u32> const& durations)
+{
+    DecodedImage image;
+    image.is_animated = is_animated;
+    image.loop_count = loop_count;
+    image.frames.resize(bitmaps.size());
+    for (size_t i = 0; i < image.frames.size(); ++i) {
+        auto& frame = image.frames[i];
+        frame.bitmap = bitmaps[i].bitmap();
+        frame.duration = durations[i];
+    }
+    return image;
+}
+
+Optional<DecodedImage> Client::decode_image(ReadonlyBytes encoded_data, Optional<DeprecatedString> mime_type)
+{
+    if (encoded_data.is_empty())
+        return {};
+
+    auto encoded_buffer = copy_to_anonymous_buffer(encoded_data);
+    if (!encoded_buffer.has_value())
+        return {};
+
+    auto response_or_error = try_decode_image(encoded_buffer.release_value(), mime_type);
 
     if (response_or_error.is_error()) {
         dbgln("ImageDecoder died heroically");
@@ -45,17 +72,36 @@ Optional<DecodedImage> Client::decode_image(ReadonlyBytes encoded_data, Optional
     if (response.bitmaps().is_empty())
         return {};
 
-    DecodedImage image;
-    image.is_animated = response.is_animated();
-    image.loop_count = response.loop_count();
-    image.frames.resize(response.bitmaps().size());
-    auto bitmaps = response.take_bitmaps();
-    for (size_t i = 0; i < image.frames.size(); ++i) {
-        auto& frame = image.frames[i];
-        frame.bitmap = bitmaps[i].bitmap();
-        frame.duration = response.durations()[i];
+    return make_decoded_image(response.is_animated(), response.loop_count(), response.take_bitmaps(), response.durations());
+}
+
+void Client::start_decoding_image(ReadonlyBytes encoded_data, Optional<Gfx::IntSize> ideal_size, Function<void(Optional<DecodedImage>)> on_complete, Optional<DeprecatedString> mime_type)
+{
+    auto encoded_buffer = encoded_data.is_empty() ? Optional<Core::AnonymousBuffer> {} : copy_to_anonymous_buffer(encoded_data);
+    if (!encoded_buffer.has_value()) {
+        on_complete({});
+        return;
     }
-    return image;
+
+    auto image_id = m_next_image_id++;
+    m_pending_decodes.set(image_id, move(on_complete));
+    async_start_decoding_image(image_id, encoded_buffer.release_value(), ideal_size, mime_type);
+}
+
+void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Vector<Gfx::ShareableBitmap> const& bitmaps, Vector<u32> const& durations)
+{
+    auto on_complete = m_pending_decodes.take(image_id);
+    if (!on_complete.has_value())
+        return;
+    on_complete.value()(make_decoded_image(is_animated, loop_count, bitmaps, durations));
+}
+
+void Client::did_fail_to_decode_image(i64 image_id)
+{
+    auto on_complete = m_pending_decodes.take(image_id);
+    if (!on_complete.has_value())
+        return;
+    on_complete.value()({});
 }
 
 }
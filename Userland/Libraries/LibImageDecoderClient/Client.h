@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Function.h>
 #include <AK/HashMap.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
@@ -32,12 +33,23 @@ class Client final
 public:
     Optional<DecodedImage> decode_image(ReadonlyBytes, Optional<DeprecatedString> mime_type = {});
 
+    // Like decode_image(), but this returns right away and calls on_complete once the image has been decoded.
+    // Frames larger than the ideal size are scaled down to it.
+    void start_decoding_image(ReadonlyBytes, Optional<Gfx::IntSize> ideal_size, Function<void(Optional<DecodedImage>)> on_complete, Optional<DeprecatedString> mime_type = {});
+    size_t pending_decode_count() const { return m_pending_decodes.size(); }
+
     Function<void()> on_death;
 
 private:
     Client(NonnullOwnPtr<Core::LocalSocket>);
 
     virtual void die() override;
+
+    virtual void did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Vector<Gfx::ShareableBitmap> const&, Vector<u32> const& durations) override;
+    virtual void did_fail_to_decode_image(i64 image_id) override;
+
+    HashMap<i64, Function<void(Optional<DecodedImage>)>> m_pending_decodes;
+    i64 m_next_image_id { 0 };
 };
 
 }
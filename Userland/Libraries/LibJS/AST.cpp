@@ -17,6 +17,7 @@
 #include <LibJS/AST.h>
 #include <LibJS/Heap/MarkedVector.h>
 #include <LibJS/Interpreter.h>
+#include <LibJS/Parser.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Accessor.h>
 #include <LibJS/Runtime/Array.h>
@@ -231,6 +232,19 @@ Completion FunctionBody::execute(Interpreter& interpreter) const
     return evaluate_statements(interpreter);
 }
 
+FunctionBody const& LazyFunctionBody::body() const
+{
+    if (!m_body)
+        m_body = Parser::parse_lazy_function_body(*this);
+    return *m_body;
+}
+
+Completion LazyFunctionBody::execute(Interpreter&) const
+{
+    // NOTE: ECMAScriptFunctionObject swaps in the parsed body before a function is evaluated.
+    VERIFY_NOT_REACHED();
+}
+
 // 14.2.2 Runtime Semantics: Evaluation, https://tc39.es/ecma262/#sec-block-runtime-semantics-evaluation
 Completion BlockStatement::execute(Interpreter& interpreter) const
 {
@@ -1865,6 +1879,13 @@ ThrowCompletionOr<ClassElement::ClassValue> StaticInitializer::class_element_eva
 
 // 15.7.16 Runtime Semantics: Evaluation, https://tc39.es/ecma262/#sec-class-definitions-runtime-semantics-evaluation
 // ClassExpression : class BindingIdentifier ClassTail
+DeprecatedString const& ClassExpression::source_text() const
+{
+    if (m_source_text.is_null())
+        m_source_text = DeprecatedString { source_code().code().bytes_as_string_view().substring_view(m_source_text_start_offset, m_source_text_end_offset - m_source_text_start_offset) };
+    return m_source_text;
+}
+
 Completion ClassExpression::execute(Interpreter& interpreter) const
 {
     InterpreterNodeScope node_scope { interpreter, *this };
@@ -1874,7 +1895,7 @@ Completion ClassExpression::execute(Interpreter& interpreter) const
     auto* value = TRY(class_definition_evaluation(interpreter, m_name, m_name.is_null() ? "" : m_name));
 
     // 3. Set value.[[SourceText]] to the source text matched by ClassExpression.
-    value->set_source_text(m_source_text);
+    value->set_source_text(source_text());
 
     // 4. Return value.
     return Value { value };
@@ -2491,6 +2512,13 @@ void BindingPattern::dump(int indent) const
     }
 }
 
+DeprecatedString const& FunctionNode::source_text() const
+{
+    if (m_source_text.is_null())
+        m_source_text = DeprecatedString { m_source_code->code().bytes_as_string_view().substring_view(m_source_text_start_offset, m_source_text_end_offset - m_source_text_start_offset) };
+    return m_source_text;
+}
+
 void FunctionNode::dump(int indent, DeprecatedString const& class_name) const
 {
     print_indent(indent);
@@ -2525,6 +2553,11 @@ void FunctionNode::dump(int indent, DeprecatedString const& class_name) const
     body().dump(indent + 2);
 }
 
+void LazyFunctionBody::dump(int indent) const
+{
+    body().dump(indent);
+}
+
 void FunctionDeclaration::dump(int indent) const
 {
     FunctionNode::dump(indent, class_name());
@@ -91,6 +91,7 @@ public:
     virtual bool is_labelled_statement() const { return false; }
     virtual bool is_iteration_statement() const { return false; }
     virtual bool is_class_method() const { return false; }
+    virtual bool is_lazy_function_body() const { return false; }
 
 protected:
     explicit ASTNode(SourceRange);
@@ -647,10 +648,53 @@ struct FunctionParameter {
     bool is_rest { false };
 };
 
+// The body of a function that was checked for early errors while parsing the script, but whose AST was not kept.
+// It is parsed again, in the same parser state, the first time the function is called.
+class LazyFunctionBody final : public Statement {
+public:
+    struct ParserState {
+        bool strict_mode : 1 { false };
+        bool allow_super_property_lookup : 1 { false };
+        bool allow_super_constructor_call : 1 { false };
+        bool in_eval_function_context : 1 { false };
+        bool in_formal_parameter_context : 1 { false };
+        bool in_arrow_function_context : 1 { false };
+        bool string_legacy_octal_escape_sequence_in_scope : 1 { false };
+    };
+
+    LazyFunctionBody(SourceRange source_range, Program::Type program_type, Vector<FunctionParameter> parameters, FunctionKind kind, ParserState parser_state)
+        : Statement(source_range)
+        , m_parameters(move(parameters))
+        , m_program_type(program_type)
+        , m_kind(kind)
+        , m_parser_state(parser_state)
+    {
+    }
+
+    FunctionBody const& body() const;
+
+    Program::Type program_type() const { return m_program_type; }
+    Vector<FunctionParameter> const& parameters() const { return m_parameters; }
+    FunctionKind kind() const { return m_kind; }
+    ParserState const& parser_state() const { return m_parser_state; }
+
+    Completion execute(Interpreter&) const override;
+    virtual void dump(int indent) const override;
+
+private:
+    virtual bool is_lazy_function_body() const override { return true; }
+
+    Vector<FunctionParameter> const m_parameters;
+    Program::Type m_program_type;
+    FunctionKind m_kind;
+    ParserState m_parser_state;
+    mutable RefPtr<FunctionBody const> m_body;
+};
+
 class FunctionNode {
 public:
     DeprecatedFlyString const& name() const { return m_name; }
-    DeprecatedString const& source_text() const { return m_source_text; }
+    DeprecatedString const& source_text() const;
     Statement const& body() const { return *m_body; }
     Vector<FunctionParameter> const& parameters() const { return m_parameters; };
     i32 function_length() const { return m_function_length; }
@@ -661,9 +705,11 @@ public:
     FunctionKind kind() const { return m_kind; }
 
 protected:
-    FunctionNode(DeprecatedFlyString name, DeprecatedString source_text, NonnullRefPtr<Statement const> body, Vector<FunctionParameter> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, bool might_need_arguments_object, bool contains_direct_call_to_eval, bool is_arrow_function)
+    FunctionNode(DeprecatedFlyString name, NonnullRefPtr<SourceCode const> source_code, u32 source_text_start_offset, u32 source_text_end_offset, NonnullRefPtr<Statement const> body, Vector<FunctionParameter> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, bool might_need_arguments_object, bool contains_direct_call_to_eval, bool is_arrow_function)
         : m_name(move(name))
-        , m_source_text(move(source_text))
+        , m_source_code(move(source_code))
+        , m_source_text_start_offset(source_text_start_offset)
+        , m_source_text_end_offset(source_text_end_offset)
         , m_body(move(body))
         , m_parameters(move(parameters))
         , m_function_length(function_length)
@@ -681,7 +727,14 @@ protected:
 
 private:
     DeprecatedFlyString m_name;
-    DeprecatedString m_source_text;
+
+    // Most functions in a large script are never instantiated, so their source text is only copied out of the
+    // source code once a function object needs it.
+    NonnullRefPtr<SourceCode const> m_source_code;
+    u32 m_source_text_start_offset { 0 };
+    u32 m_source_text_end_offset { 0 };
+    mutable DeprecatedString m_source_text;
+
     NonnullRefPtr<Statement const> m_body;
     Vector<FunctionParameter> const m_parameters;
     const i32 m_function_length;
@@ -698,9 +751,9 @@ class FunctionDeclaration final
 public:
     static bool must_have_name() { return true; }
 
-    FunctionDeclaration(SourceRange source_range, DeprecatedFlyString const& name, DeprecatedString source_text, NonnullRefPtr<Statement const> body, Vector<FunctionParameter> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, bool might_need_arguments_object, bool contains_direct_call_to_eval)
+    FunctionDeclaration(SourceRange source_range, DeprecatedFlyString const& name, u32 source_text_start_offset, u32 source_text_end_offset, NonnullRefPtr<Statement const> body, Vector<FunctionParameter> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, bool might_need_arguments_object, bool contains_direct_call_to_eval)
         : Declaration(source_range)
-        , FunctionNode(name, move(source_text), move(body), move(parameters), function_length, kind, is_strict_mode, might_need_arguments_object, contains_direct_call_to_eval, false)
+        , FunctionNode(name, source_range.code, source_text_start_offset, source_text_end_offset, move(body), move(parameters), function_length, kind, is_strict_mode, might_need_arguments_object, contains_direct_call_to_eval, false)
     {
     }
 
@@ -724,9 +777,9 @@ class FunctionExpression final
 public:
     static bool must_have_name() { return false; }
 
-    FunctionExpression(SourceRange source_range, DeprecatedFlyString const& name, DeprecatedString source_text, NonnullRefPtr<Statement const> body, Vector<FunctionParameter> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, bool might_need_arguments_object, bool contains_direct_call_to_eval, bool is_arrow_function = false)
+    FunctionExpression(SourceRange source_range, DeprecatedFlyString const& name, u32 source_text_start_offset, u32 source_text_end_offset, NonnullRefPtr<Statement const> body, Vector<FunctionParameter> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, bool might_need_arguments_object, bool contains_direct_call_to_eval, bool is_arrow_function = false)
         : Expression(source_range)
-        , FunctionNode(name, move(source_text), move(body), move(parameters), function_length, kind, is_strict_mode, might_need_arguments_object, contains_direct_call_to_eval, is_arrow_function)
+        , FunctionNode(name, source_range.code, source_text_start_offset, source_text_end_offset, move(body), move(parameters), function_length, kind, is_strict_mode, might_need_arguments_object, contains_direct_call_to_eval, is_arrow_function)
     {
     }
 
@@ -1397,10 +1450,11 @@ public:
 
 class ClassExpression final : public Expression {
 public:
-    ClassExpression(SourceRange source_range, DeprecatedString name, DeprecatedString source_text, RefPtr<FunctionExpression const> constructor, RefPtr<Expression const> super_class, Vector<NonnullRefPtr<ClassElement const>> elements)
+    ClassExpression(SourceRange source_range, DeprecatedString name, u32 source_text_start_offset, u32 source_text_end_offset, RefPtr<FunctionExpression const> constructor, RefPtr<Expression const> super_class, Vector<NonnullRefPtr<ClassElement const>> elements)
         : Expression(source_range)
         , m_name(move(name))
-        , m_source_text(move(source_text))
+        , m_source_text_start_offset(source_text_start_offset)
+        , m_source_text_end_offset(source_text_end_offset)
         , m_constructor(move(constructor))
         , m_super_class(move(super_class))
         , m_elements(move(elements))
@@ -1408,7 +1462,7 @@ public:
     }
 
     StringView name() const { return m_name; }
-    DeprecatedString const& source_text() const { return m_source_text; }
+    DeprecatedString const& source_text() const;
     RefPtr<FunctionExpression const> constructor() const { return m_constructor; }
 
     virtual Completion execute(Interpreter&) const override;
@@ -1423,7 +1477,9 @@ private:
     virtual bool is_class_expression() const override { return true; }
 
     DeprecatedString m_name;
-    DeprecatedString m_source_text;
+    u32 m_source_text_start_offset { 0 };
+    u32 m_source_text_end_offset { 0 };
+    mutable DeprecatedString m_source_text;
     RefPtr<FunctionExpression const> m_constructor;
     RefPtr<Expression const> m_super_class;
     Vector<NonnullRefPtr<ClassElement const>> m_elements;
@@ -2243,4 +2299,7 @@ inline bool ASTNode::fast_is<IterationStatement>() const { return is_iteration_s
 template<>
 inline bool ASTNode::fast_is<ClassMethod>() const { return is_class_method(); }
 
+template<>
+inline bool ASTNode::fast_is<LazyFunctionBody>() const { return is_lazy_function_body(); }
+
 }
@@ -1568,9 +1568,14 @@ Bytecode::CodeGenerationErrorOr<void> CallExpression::generate_bytecode(Bytecode
             if (member_expression.is_computed()) {
                 TRY(member_expression.property().generate_bytecode(generator));
                 generator.emit<Bytecode::Op::GetByValue>(this_reg);
-            } else {
+            } else if (member_expression.property().is_identifier()) {
                 auto identifier_table_ref = generator.intern_identifier(verify_cast<Identifier>(member_expression.property()).string());
                 generator.emit<Bytecode::Op::GetById>(identifier_table_ref);
+            } else {
+                return Bytecode::CodeGenerationError {
+                    &member_expression,
+                    "Unimplemented non-computed member expression"sv
+                };
             }
         }
 
@@ -64,4 +64,25 @@ void BasicBlock::grow(size_t additional_size)
     VERIFY(m_buffer_size <= m_buffer_capacity);
 }
 
+Vector<u8> BasicBlock::take_instructions()
+{
+    Vector<u8> instructions;
+    instructions.append(m_buffer, m_buffer_size);
+    m_buffer_size = 0;
+    m_terminator = nullptr;
+    return instructions;
+}
+
+void BasicBlock::append_instruction(Instruction const& instruction)
+{
+    // NOTE: Instructions are moved around bitwise, like the other passes already do.
+    auto length = instruction.length();
+    VERIFY(can_grow(length));
+    auto* slot = next_slot();
+    memcpy(slot, &instruction, length);
+    grow(length);
+    if (instruction.is_terminator())
+        m_terminator = static_cast<Instruction const*>(slot);
+}
+
 }
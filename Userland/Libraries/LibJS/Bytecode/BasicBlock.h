@@ -8,6 +8,7 @@
 
 #include <AK/Badge.h>
 #include <AK/DeprecatedString.h>
+#include <AK/Vector.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Handle.h>
 
@@ -39,6 +40,22 @@ public:
     bool can_grow(size_t additional_size) const { return m_buffer_size + additional_size <= m_buffer_capacity; }
     void grow(size_t additional_size);
 
+    // Lets an optimization pass rewrite the block in place: the instructions are moved out into the returned buffer,
+    // and the pass appends the ones it keeps (or their replacements) again. Instructions that aren't appended again
+    // have to be destroyed by the pass.
+    Vector<u8> take_instructions();
+    void append_instruction(Instruction const&);
+
+    template<typename OpType, typename... Args>
+    void append(Args&&... args)
+    {
+        VERIFY(can_grow(sizeof(OpType)));
+        auto* instruction = new (next_slot()) OpType(forward<Args>(args)...);
+        grow(sizeof(OpType));
+        if constexpr (OpType::IsTerminator)
+            m_terminator = instruction;
+    }
+
     void terminate(Badge<Generator>, Instruction const* terminator) { m_terminator = terminator; }
     bool is_terminated() const { return m_terminator != nullptr; }
     Instruction const* terminator() const { return m_terminator; }
@@ -5,12 +5,28 @@
  */
 
 #include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Op.h>
 
 namespace JS::Bytecode {
 
+size_t Executable::number_of_instructions() const
+{
+    size_t count = 0;
+    for (auto& block : basic_blocks) {
+        for (InstructionStreamIterator it { block->instruction_stream() }; !it.at_end(); ++it)
+            ++count;
+    }
+    return count;
+}
+
 void Executable::dump() const
 {
     dbgln("\033[33;1mJS::Bytecode::Executable\033[0m ({})", name);
+    if (optimization_statistics.has_value()) {
+        auto const& statistics = *optimization_statistics;
+        dbgln("Optimized from {} to {} instructions, and from {} to {} registers",
+            statistics.instructions_before, statistics.instructions_after, statistics.registers_before, statistics.registers_after);
+    }
     for (auto& block : basic_blocks)
         block->dump(*this);
     if (!string_table->is_empty()) {
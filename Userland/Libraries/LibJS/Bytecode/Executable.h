@@ -8,9 +8,11 @@
 
 #include <AK/DeprecatedFlyString.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/IdentifierTable.h>
 #include <LibJS/Bytecode/StringTable.h>
+#include <LibJS/JIT/NativeExecutable.h>
 
 namespace JS::Bytecode {
 
@@ -22,6 +24,23 @@ struct Executable {
     size_t number_of_registers { 0 };
     bool is_strict_mode { false };
 
+    // How often the executable has been entered and gone around a loop, for deciding when it's worth handing to the JIT.
+    mutable u32 call_count { 0 };
+    mutable u32 taken_jump_count { 0 };
+    mutable bool did_try_jit_compile { false };
+    mutable OwnPtr<JIT::NativeExecutable> native_executable {};
+
+    // What the optimization pipeline did to the executable, filled in once it has run.
+    struct OptimizationStatistics {
+        size_t instructions_before { 0 };
+        size_t instructions_after { 0 };
+        size_t registers_before { 0 };
+        size_t registers_after { 0 };
+    };
+    Optional<OptimizationStatistics> optimization_statistics {};
+
+    size_t number_of_instructions() const;
+
     DeprecatedString const& get_string(StringTableIndex index) const { return string_table->get(index); }
     DeprecatedFlyString const& get_identifier(IdentifierTableIndex index) const { return identifier_table->get(index); }
 
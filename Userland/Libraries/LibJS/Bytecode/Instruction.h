@@ -18,6 +18,7 @@
     O(BitwiseOr)                     \
     O(BitwiseXor)                    \
     O(Call)                          \
+    O(CompareAndJump)                \
     O(ConcatString)                  \
     O(ContinuePendingUnwind)         \
     O(CopyObjectExcludingProperties) \
@@ -58,6 +59,7 @@
     O(LessThan)                      \
     O(LessThanEquals)                \
     O(Load)                          \
+    O(LoadAndGetById)                \
     O(LoadImmediate)                 \
     O(LooselyEquals)                 \
     O(LooselyInequals)               \
@@ -97,6 +99,13 @@
 
 namespace JS::Bytecode {
 
+// How an instruction uses one of its register operands (the accumulator is always implied, and never visited).
+enum class RegisterAccess {
+    Read,
+    Write,
+    ReadWrite,
+};
+
 class alignas(void*) Instruction {
 public:
     constexpr static bool IsTerminator = false;
@@ -117,6 +126,13 @@ public:
     void replace_references(Register, Register);
     static void destroy(Instruction&);
 
+    // Calls the callback with (Register&, RegisterAccess) for every register operand; the callback may rename them.
+    template<typename Callback>
+    void visit_registers(Callback);
+
+    template<typename Callback>
+    void visit_registers_impl(Callback) { }
+
 protected:
     explicit Instruction(Type type)
         : m_type(type)
@@ -150,6 +166,11 @@ public:
         m_offset += dereference().length();
     }
 
+    ALWAYS_INLINE void skip(size_t length)
+    {
+        m_offset += length;
+    }
+
 private:
     Instruction const& dereference() const { return *reinterpret_cast<Instruction const*>(m_bytes.data() + offset()); }
 
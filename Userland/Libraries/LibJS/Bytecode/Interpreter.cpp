@@ -11,9 +11,11 @@
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Interpreter.h>
+#include <LibJS/JIT/Compiler.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Realm.h>
+#include <stdlib.h>
 
 namespace JS::Bytecode {
 
@@ -39,6 +41,94 @@ Interpreter::~Interpreter()
     s_current = nullptr;
 }
 
+// Jumps and register moves are simple enough to be handled right in the dispatch loop. A fused CompareAndJump only
+// needs to leave the result of its comparison in the accumulator first.
+template<typename OpType>
+static constexpr bool has_jump_fast_path = IsBaseOf<Op::Jump, OpType>;
+
+template<typename OpType>
+static constexpr bool has_inline_fast_path = IsOneOf<OpType, Op::Load, Op::LoadImmediate, Op::Store>;
+
+template<typename OpType>
+static ALWAYS_INLINE BasicBlock const& jump_target(OpType const& instruction, Value accumulator)
+{
+    static_assert(has_jump_fast_path<OpType>);
+    if constexpr (IsSame<OpType, Op::Jump>) {
+        return instruction.true_target()->block();
+    } else {
+        VERIFY(instruction.true_target().has_value());
+        VERIFY(instruction.false_target().has_value());
+        bool condition;
+        if constexpr (IsOneOf<OpType, Op::JumpConditional, Op::CompareAndJump>)
+            condition = accumulator.to_boolean();
+        else if constexpr (IsSame<OpType, Op::JumpNullish>)
+            condition = accumulator.is_nullish();
+        else
+            condition = accumulator.is_undefined();
+        return condition ? instruction.true_target()->block() : instruction.false_target()->block();
+    }
+}
+
+template<typename OpType>
+static ALWAYS_INLINE void execute_inline(Interpreter& interpreter, OpType const& instruction)
+{
+    static_assert(has_inline_fast_path<OpType>);
+    if constexpr (IsSame<OpType, Op::Load>)
+        interpreter.accumulator() = interpreter.reg(instruction.src());
+    else if constexpr (IsSame<OpType, Op::LoadImmediate>)
+        interpreter.accumulator() = instruction.value();
+    else
+        interpreter.reg(instruction.dst()) = interpreter.accumulator();
+}
+
+// Executables are handed to the JIT once they have been entered, or have gone around their loops, often enough.
+// Setting LIBJS_NO_JIT in the environment keeps everything in the interpreter.
+static bool const s_jit_enabled = !getenv("LIBJS_NO_JIT");
+static constexpr u32 jit_call_threshold = 16;
+static constexpr u32 jit_taken_jump_threshold = 1024;
+
+static JIT::NativeExecutable const* native_executable_if_hot(Executable const& executable, u32& counter, u32 threshold)
+{
+    if (!s_jit_enabled)
+        return nullptr;
+    if (executable.did_try_jit_compile)
+        return executable.native_executable.ptr();
+    if (++counter < threshold)
+        return nullptr;
+    executable.did_try_jit_compile = true;
+    executable.native_executable = JIT::Compiler::compile(executable);
+    return executable.native_executable.ptr();
+}
+
+static ALWAYS_INLINE JIT::NativeExecutable const* native_executable_on_entry(Executable const& executable)
+{
+    return native_executable_if_hot(executable, executable.call_count, jit_call_threshold);
+}
+
+static ALWAYS_INLINE JIT::NativeExecutable const* native_executable_on_jump(Executable const& executable)
+{
+    return native_executable_if_hot(executable, executable.taken_jump_count, jit_taken_jump_threshold);
+}
+
+template<typename OpType>
+static ALWAYS_INLINE size_t instruction_length(OpType const& instruction)
+{
+    if constexpr (requires { instruction.length_impl(); })
+        return round_up_to_power_of_two(instruction.length_impl(), alignof(void*));
+    else
+        return sizeof(OpType);
+}
+
+// Fused jumps compute their condition into the accumulator first.
+template<typename OpType>
+static ALWAYS_INLINE ThrowCompletionOr<void> prepare_jump(Interpreter& interpreter, OpType const& instruction)
+{
+    if constexpr (requires { instruction.compare(interpreter); })
+        return instruction.compare(interpreter);
+    else
+        return {};
+}
+
 Interpreter::ValueAndFrame Interpreter::run_and_return_frame(Executable const& executable, BasicBlock const* entry_point, RegisterWindow* in_frame)
 {
     dbgln_if(JS_BYTECODE_DEBUG, "Bytecode::Interpreter will run unit {:p}", &executable);
@@ -71,86 +161,155 @@ Interpreter::ValueAndFrame Interpreter::run_and_return_frame(Executable const& e
 
     registers().resize(executable.number_of_registers);
 
-    for (;;) {
-        Bytecode::InstructionStreamIterator pc(m_current_block->instruction_stream());
-        TemporaryChange temp_change { m_pc, &pc };
-
-        // FIXME: This is getting kinda spaghetti-y
-        bool will_jump = false;
-        bool will_return = false;
-        bool will_yield = false;
-        while (!pc.at_end()) {
-            auto& instruction = *pc;
-            auto ran_or_error = instruction.execute(*this);
-            if (ran_or_error.is_error()) {
-                auto exception_value = *ran_or_error.throw_completion().value();
-                m_saved_exception = make_handle(exception_value);
-                if (unwind_contexts().is_empty())
-                    break;
-                auto& unwind_context = unwind_contexts().last();
-                if (unwind_context.executable != m_current_executable)
-                    break;
-                if (unwind_context.handler) {
-                    vm().running_execution_context().lexical_environment = unwind_context.lexical_environment;
-                    vm().running_execution_context().variable_environment = unwind_context.variable_environment;
-                    m_current_block = unwind_context.handler;
-                    unwind_context.handler = nullptr;
-
-                    accumulator() = exception_value;
-                    m_saved_exception = {};
-                    will_jump = true;
-                    break;
-                }
-                if (unwind_context.finalizer) {
-                    m_current_block = unwind_context.finalizer;
-                    will_jump = true;
-                    break;
-                }
-                // An unwind context with no handler or finalizer? We have nowhere to jump, and continuing on will make us crash on the next `Call` to a non-native function if there's an exception! So let's crash here instead.
-                // If you run into this, you probably forgot to remove the current unwind_context somewhere.
-                VERIFY_NOT_REACHED();
-            }
-            if (m_pending_jump.has_value()) {
-                m_current_block = m_pending_jump.release_value();
-                will_jump = true;
-                break;
-            }
-            if (!m_return_value.is_empty()) {
-                will_return = true;
-                // Note: A `yield` statement will not go through a finally statement,
-                //       hence we need to set a flag to not do so,
-                //       but we generate a Yield Operation in the case of returns in
-                //       generators as well, so we need to check if it will actually
-                //       continue or is a `return` in disguise
-                will_yield = instruction.type() == Instruction::Type::Yield && static_cast<Op::Yield const&>(instruction).continuation().has_value();
-                break;
-            }
-            ++pc;
-        }
+    Bytecode::InstructionStreamIterator pc(m_current_block->instruction_stream());
+    TemporaryChange temp_change { m_pc, &pc };
+
+    // FIXME: This is getting kinda spaghetti-y
+    bool will_yield = false;
+    Value exception_value;
+
+    auto enter_block = [&](BasicBlock const& block) {
+        m_current_block = &block;
+        pc = Bytecode::InstructionStreamIterator(block.instruction_stream());
+    };
+
+    // Instructions are dispatched through a table of label addresses, so that every handler ends in its own indirect
+    // branch instead of all of them sharing the one behind a switch. Handlers for ops that can't change the control
+    // flow skip straight to the next instruction, and plain jumps switch to the target block without going through
+    // m_pending_jump.
+    static void* const dispatch_table[] = {
+#define __BYTECODE_OP(op) &&handle_##op,
+        ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    };
+
+#define DISPATCH_CURRENT_INSTRUCTION()                     \
+    do {                                                   \
+        if (pc.at_end()) [[unlikely]]                      \
+            goto leave_block;                              \
+        goto* dispatch_table[to_underlying((*pc).type())]; \
+    } while (0)
+
+#define DISPATCH_NEXT_INSTRUCTION(instruction)    \
+    do {                                          \
+        pc.skip(instruction_length(instruction)); \
+        DISPATCH_CURRENT_INSTRUCTION();           \
+    } while (0)
+
+    // Native code runs on the same register window, and hands control back only once the executable is done.
+#define RUN_NATIVE_CODE(native_executable, block)                                      \
+    do {                                                                               \
+        auto ran_or_error = (native_executable).run(*this, registers().data(), block); \
+        if (ran_or_error.is_error()) [[unlikely]] {                                    \
+            exception_value = *ran_or_error.throw_completion().value();                \
+            goto handle_exception;                                                     \
+        }                                                                              \
+        goto leave_block;                                                              \
+    } while (0)
+
+    // Generators resume in the middle of their executable, which the JIT doesn't support anyway.
+    if (!entry_point && !in_frame) {
+        if (auto const* native_executable = native_executable_on_entry(executable))
+            RUN_NATIVE_CODE(*native_executable, *m_current_block);
+    }
 
-        if (will_jump)
-            continue;
-
-        if (!unwind_contexts().is_empty() && !will_yield) {
-            auto& unwind_context = unwind_contexts().last();
-            if (unwind_context.executable == m_current_executable && unwind_context.finalizer) {
-                m_saved_return_value = make_handle(m_return_value);
-                m_return_value = {};
-                m_current_block = unwind_context.finalizer;
-                // the unwind_context will be pop'ed when entering the finally block
-                continue;
-            }
-        }
+    DISPATCH_CURRENT_INSTRUCTION();
+
+#define __BYTECODE_OP(op)                                                              \
+    handle_##op:                                                                       \
+    {                                                                                  \
+        auto const& instruction = static_cast<Op::op const&>(*pc);                     \
+        if constexpr (has_jump_fast_path<Op::op>) {                                    \
+            auto prepared_or_error = prepare_jump(*this, instruction);                 \
+            if (prepared_or_error.is_error()) [[unlikely]] {                           \
+                exception_value = *prepared_or_error.throw_completion().value();       \
+                goto handle_exception;                                                 \
+            }                                                                          \
+            auto const& target = jump_target(instruction, accumulator());              \
+            if (auto const* native_executable = native_executable_on_jump(executable)) \
+                RUN_NATIVE_CODE(*native_executable, target);                           \
+            enter_block(target);                                                       \
+            DISPATCH_CURRENT_INSTRUCTION();                                            \
+        } else if constexpr (has_inline_fast_path<Op::op>) {                           \
+            execute_inline(*this, instruction);                                        \
+            DISPATCH_NEXT_INSTRUCTION(instruction);                                    \
+        } else {                                                                       \
+            auto ran_or_error = instruction.execute_impl(*this);                       \
+            if (ran_or_error.is_error()) [[unlikely]] {                                \
+                exception_value = *ran_or_error.throw_completion().value();            \
+                goto handle_exception;                                                 \
+            }                                                                          \
+            if constexpr (Op::op::IsTerminator)                                        \
+                goto handle_control_flow_change;                                       \
+            DISPATCH_NEXT_INSTRUCTION(instruction);                                    \
+        }                                                                              \
+    }
 
-        if (pc.at_end())
-            break;
+    ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
 
-        if (!m_saved_exception.is_null())
-            break;
+handle_control_flow_change: {
+    if (m_pending_jump.has_value()) {
+        enter_block(*m_pending_jump.release_value());
+        DISPATCH_CURRENT_INSTRUCTION();
+    }
+    auto const& instruction = *pc;
+    if (!m_return_value.is_empty()) {
+        // Note: A `yield` statement will not go through a finally statement,
+        //       hence we need to set a flag to not do so,
+        //       but we generate a Yield Operation in the case of returns in
+        //       generators as well, so we need to check if it will actually
+        //       continue or is a `return` in disguise
+        will_yield = instruction.type() == Instruction::Type::Yield && static_cast<Op::Yield const&>(instruction).continuation().has_value();
+        goto leave_block;
+    }
+    pc.skip(instruction.length());
+    DISPATCH_CURRENT_INSTRUCTION();
+}
 
-        if (will_return)
-            break;
+handle_exception: {
+    m_saved_exception = make_handle(exception_value);
+    if (unwind_contexts().is_empty())
+        goto leave_block;
+    auto& unwind_context = unwind_contexts().last();
+    if (unwind_context.executable != m_current_executable)
+        goto leave_block;
+    if (unwind_context.handler) {
+        vm().running_execution_context().lexical_environment = unwind_context.lexical_environment;
+        vm().running_execution_context().variable_environment = unwind_context.variable_environment;
+        auto const& handler = *unwind_context.handler;
+        unwind_context.handler = nullptr;
+
+        accumulator() = exception_value;
+        m_saved_exception = {};
+        enter_block(handler);
+        DISPATCH_CURRENT_INSTRUCTION();
     }
+    if (unwind_context.finalizer) {
+        enter_block(*unwind_context.finalizer);
+        DISPATCH_CURRENT_INSTRUCTION();
+    }
+    // An unwind context with no handler or finalizer? We have nowhere to jump, and continuing on will make us crash on the next `Call` to a non-native function if there's an exception! So let's crash here instead.
+    // If you run into this, you probably forgot to remove the current unwind_context somewhere.
+    VERIFY_NOT_REACHED();
+}
+
+leave_block: {
+    if (!unwind_contexts().is_empty() && !will_yield) {
+        auto& unwind_context = unwind_contexts().last();
+        if (unwind_context.executable == m_current_executable && unwind_context.finalizer) {
+            m_saved_return_value = make_handle(m_return_value);
+            m_return_value = {};
+            // the unwind_context will be pop'ed when entering the finally block
+            enter_block(*unwind_context.finalizer);
+            DISPATCH_CURRENT_INSTRUCTION();
+        }
+    }
+}
+
+#undef DISPATCH_CURRENT_INSTRUCTION
+#undef DISPATCH_NEXT_INSTRUCTION
+#undef RUN_NATIVE_CODE
 
     dbgln_if(JS_BYTECODE_DEBUG, "Bytecode::Interpreter did run unit {:p}", &executable);
 
@@ -279,6 +438,14 @@ Bytecode::PassManager& Interpreter::optimization_pipeline(Interpreter::Optimizat
         pm->add<Passes::GenerateCFG>();
         pm->add<Passes::PlaceBlocks>();
         pm->add<Passes::EliminateLoads>();
+        pm->add<Passes::FoldConstants>();
+        pm->add<Passes::GenerateCFG>();
+        pm->add<Passes::AnalyzeRegisterLiveness>();
+        pm->add<Passes::EliminateDeadStores>();
+        pm->add<Passes::AnalyzeRegisterLiveness>();
+        pm->add<Passes::AllocateRegisters>();
+        // NOTE: The fused instructions aren't understood by the passes above, so this has to come last.
+        pm->add<Passes::FuseInstructions>();
     } else {
         VERIFY_NOT_REACHED();
     }
@@ -11,6 +11,7 @@
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Runtime/AbstractOperations.h>
+#include <LibJS/Runtime/Accessor.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/BigInt.h>
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
@@ -373,6 +374,21 @@ ThrowCompletionOr<void> GetVariable::execute_impl(Bytecode::Interpreter& interpr
 {
     auto& vm = interpreter.vm();
 
+    auto is_global_variable = [&] {
+        return m_cached_environment_coordinate.has_value() && m_cached_environment_coordinate->index == EnvironmentCoordinate::global_marker;
+    };
+
+    if (is_global_variable()) {
+        auto& global_environment = vm.current_realm()->global_environment();
+        if (!global_environment.is_permanently_screwed_by_eval()) {
+            if (auto value = TRY(m_global_variable_cache.get(vm, global_environment)); value.has_value()) {
+                ++g_property_lookup_cache_statistics.get_global_variable_hits;
+                interpreter.accumulator() = *value;
+                return {};
+            }
+        }
+    }
+
     auto get_reference = [&]() -> ThrowCompletionOr<Reference> {
         auto const& string = interpreter.current_executable().get_identifier(m_identifier);
         if (m_cached_environment_coordinate.has_value()) {
@@ -399,6 +415,11 @@ ThrowCompletionOr<void> GetVariable::execute_impl(Bytecode::Interpreter& interpr
     };
     auto reference = TRY(get_reference());
     interpreter.accumulator() = TRY(reference.get_value(vm));
+
+    if (is_global_variable()) {
+        ++g_property_lookup_cache_statistics.get_global_variable_misses;
+        m_global_variable_cache.update(vm.current_realm()->global_environment(), interpreter.current_executable().get_identifier(m_identifier));
+    }
     return {};
 }
 
@@ -489,11 +510,48 @@ ThrowCompletionOr<void> SetVariable::execute_impl(Bytecode::Interpreter& interpr
     return {};
 }
 
-ThrowCompletionOr<void> GetById::execute_impl(Bytecode::Interpreter& interpreter) const
+static ThrowCompletionOr<Value> get_by_id(Bytecode::Interpreter& interpreter, Value base_value, IdentifierTableIndex property, PropertyLookupCache& cache)
 {
     auto& vm = interpreter.vm();
-    auto object = TRY(interpreter.accumulator().to_object(vm));
-    interpreter.accumulator() = TRY(object->get(interpreter.current_executable().get_identifier(m_property)));
+
+    // OPTIMIZATION: Like the AST interpreter, read a primitive string's length without wrapping it in a String object.
+    if (base_value.is_string()) {
+        auto string_value = TRY(base_value.as_string().get(vm, interpreter.current_executable().get_identifier(property)));
+        if (string_value.has_value())
+            return *string_value;
+    }
+
+    auto object = TRY(base_value.to_object(vm));
+
+    u32 property_offset = 0;
+    if (auto* holder = cache.find(*object, property_offset)) {
+        auto value = holder->get_direct(property_offset);
+        if (!value.is_empty()) {
+            ++g_property_lookup_cache_statistics.get_by_id_hits;
+            if (value.is_accessor()) {
+                auto* getter = value.as_accessor().getter();
+                value = getter ? TRY(call(vm, *getter, object.ptr())) : js_undefined();
+            }
+            return value;
+        }
+    }
+
+    ++g_property_lookup_cache_statistics.get_by_id_misses;
+    PropertyKey name = interpreter.current_executable().get_identifier(property);
+    auto value = TRY(object->get(name));
+    cache.update_for_get(*object, name);
+    return value;
+}
+
+ThrowCompletionOr<void> GetById::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    interpreter.accumulator() = TRY(get_by_id(interpreter, interpreter.accumulator(), m_property, m_cache));
+    return {};
+}
+
+ThrowCompletionOr<void> LoadAndGetById::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    interpreter.accumulator() = TRY(get_by_id(interpreter, interpreter.reg(m_base), m_property, m_cache));
     return {};
 }
 
@@ -501,9 +559,25 @@ ThrowCompletionOr<void> PutById::execute_impl(Bytecode::Interpreter& interpreter
 {
     auto& vm = interpreter.vm();
     auto object = TRY(interpreter.reg(m_base).to_object(vm));
-    PropertyKey name = interpreter.current_executable().get_identifier(m_property);
     auto value = interpreter.accumulator();
-    return put_by_property_key(object, value, name, interpreter, m_kind);
+
+    if (m_kind == PropertyKind::KeyValue) {
+        u32 property_offset = 0;
+        if (m_cache.find(*object, property_offset)) {
+            if (auto old_value = object->get_direct(property_offset); !old_value.is_empty() && !old_value.is_accessor()) {
+                ++g_property_lookup_cache_statistics.put_by_id_hits;
+                object->put_direct(property_offset, value);
+                return {};
+            }
+        }
+        ++g_property_lookup_cache_statistics.put_by_id_misses;
+    }
+
+    PropertyKey name = interpreter.current_executable().get_identifier(m_property);
+    TRY(put_by_property_key(object, value, name, interpreter, m_kind));
+    if (m_kind == PropertyKind::KeyValue)
+        m_cache.update_for_put(*object, name);
+    return {};
 }
 
 ThrowCompletionOr<void> DeleteById::execute_impl(Bytecode::Interpreter& interpreter) const
@@ -600,6 +674,34 @@ ThrowCompletionOr<void> JumpUndefined::execute_impl(Bytecode::Interpreter& inter
     return {};
 }
 
+ThrowCompletionOr<void> CompareAndJump::compare(Bytecode::Interpreter& interpreter) const
+{
+    auto& vm = interpreter.vm();
+    auto lhs = interpreter.reg(m_lhs);
+    auto rhs = interpreter.accumulator();
+    switch (m_comparison) {
+#define __JS_FUSABLE_COMPARISON(OpTitleCase, op_snake_case)             \
+    case Comparison::OpTitleCase:                                       \
+        interpreter.accumulator() = TRY(op_snake_case(vm, lhs, rhs)); \
+        return {};
+        JS_ENUMERATE_FUSABLE_COMPARISON_OPS(__JS_FUSABLE_COMPARISON)
+#undef __JS_FUSABLE_COMPARISON
+    }
+    VERIFY_NOT_REACHED();
+}
+
+ThrowCompletionOr<void> CompareAndJump::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    VERIFY(m_true_target.has_value());
+    VERIFY(m_false_target.has_value());
+    TRY(compare(interpreter));
+    if (interpreter.accumulator().to_boolean())
+        interpreter.jump(m_true_target.value());
+    else
+        interpreter.jump(m_false_target.value());
+    return {};
+}
+
 // 13.3.8.1 https://tc39.es/ecma262/#sec-runtime-semantics-argumentlistevaluation
 static MarkedVector<Value> argument_list_evaluation(Bytecode::Interpreter& interpreter)
 {
@@ -874,6 +976,19 @@ void Yield::replace_references_impl(BasicBlock const& from, BasicBlock const& to
 ThrowCompletionOr<void> GetByValue::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
+
+    auto base_value = interpreter.reg(m_base);
+    auto property_key_value = interpreter.accumulator();
+    if (base_value.is_object() && property_key_value.is_int32() && property_key_value.as_i32() >= 0) {
+        auto& base_object = base_value.as_object();
+        if (is<Array>(base_object)) {
+            if (auto element = static_cast<Array const&>(base_object).get_own_element_fast(property_key_value.as_i32()); element.has_value()) {
+                interpreter.accumulator() = *element;
+                return {};
+            }
+        }
+    }
+
     auto object = TRY(interpreter.reg(m_base).to_object(vm));
 
     auto property_key = TRY(interpreter.accumulator().to_property_key(vm));
@@ -885,6 +1000,15 @@ ThrowCompletionOr<void> GetByValue::execute_impl(Bytecode::Interpreter& interpre
 ThrowCompletionOr<void> PutByValue::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
+
+    auto base_value = interpreter.reg(m_base);
+    auto property_key_value = interpreter.reg(m_property);
+    if (m_kind == PropertyKind::KeyValue && base_value.is_object() && property_key_value.is_int32() && property_key_value.as_i32() >= 0) {
+        auto& base_object = base_value.as_object();
+        if (is<Array>(base_object) && static_cast<Array&>(base_object).set_own_element_fast(property_key_value.as_i32(), interpreter.accumulator()))
+            return {};
+    }
+
     auto object = TRY(interpreter.reg(m_base).to_object(vm));
 
     auto property_key = TRY(interpreter.reg(m_property).to_property_key(vm));
@@ -1204,6 +1328,11 @@ DeprecatedString GetById::to_deprecated_string_impl(Bytecode::Executable const&
     return DeprecatedString::formatted("GetById {} ({})", m_property, executable.identifier_table->get(m_property));
 }
 
+DeprecatedString LoadAndGetById::to_deprecated_string_impl(Bytecode::Executable const& executable) const
+{
+    return DeprecatedString::formatted("LoadAndGetById base:{}, property:{} ({})", m_base, m_property, executable.identifier_table->get(m_property));
+}
+
 DeprecatedString DeleteById::to_deprecated_string_impl(Bytecode::Executable const& executable) const
 {
     return DeprecatedString::formatted("DeleteById {} ({})", m_property, executable.identifier_table->get(m_property));
@@ -1237,6 +1366,22 @@ DeprecatedString JumpUndefined::to_deprecated_string_impl(Bytecode::Executable c
     return DeprecatedString::formatted("JumpUndefined undefined:{} not undefined:{}", true_string, false_string);
 }
 
+DeprecatedString CompareAndJump::to_deprecated_string_impl(Bytecode::Executable const&) const
+{
+    StringView comparison_name;
+    switch (m_comparison) {
+#define __JS_FUSABLE_COMPARISON(OpTitleCase, op_snake_case) \
+    case Comparison::OpTitleCase:                           \
+        comparison_name = #OpTitleCase##sv;                 \
+        break;
+        JS_ENUMERATE_FUSABLE_COMPARISON_OPS(__JS_FUSABLE_COMPARISON)
+#undef __JS_FUSABLE_COMPARISON
+    }
+    auto true_string = m_true_target.has_value() ? DeprecatedString::formatted("{}", *m_true_target) : "<empty>";
+    auto false_string = m_false_target.has_value() ? DeprecatedString::formatted("{}", *m_false_target) : "<empty>";
+    return DeprecatedString::formatted("CompareAndJump {} {} true:{} false:{}", comparison_name, m_lhs, true_string, false_string);
+}
+
 DeprecatedString Call::to_deprecated_string_impl(Bytecode::Executable const& executable) const
 {
     if (m_expression_string.has_value())
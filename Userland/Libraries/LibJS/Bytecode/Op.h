@@ -13,6 +13,7 @@
 #include <LibJS/Bytecode/IdentifierTable.h>
 #include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/Label.h>
+#include <LibJS/Bytecode/PropertyLookupCache.h>
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/Bytecode/StringTable.h>
 #include <LibJS/Heap/Cell.h>
@@ -40,6 +41,11 @@ public:
             m_src = to;
     }
 
+    template<typename Callback>
+    void visit_registers_impl(Callback callback) { callback(m_src, RegisterAccess::Read); }
+
+    Register src() const { return m_src; }
+
 private:
     Register m_src;
 };
@@ -57,6 +63,8 @@ public:
     void replace_references_impl(BasicBlock const&, BasicBlock const&) { }
     void replace_references_impl(Register, Register) { }
 
+    Value value() const { return m_value; }
+
 private:
     Value m_value;
 };
@@ -74,6 +82,9 @@ public:
     void replace_references_impl(BasicBlock const&, BasicBlock const&) { }
     void replace_references_impl(Register, Register) { }
 
+    template<typename Callback>
+    void visit_registers_impl(Callback callback) { callback(m_dst, RegisterAccess::Write); }
+
     Register dst() const { return m_dst; }
 
 private:
@@ -124,6 +135,14 @@ private:
                 m_lhs_reg = to;                                                        \
         }                                                                              \
                                                                                        \
+        template<typename Callback>                                                    \
+        void visit_registers_impl(Callback callback)                                   \
+        {                                                                              \
+            callback(m_lhs_reg, RegisterAccess::Read);                                 \
+        }                                                                              \
+                                                                                       \
+        Register lhs() const { return m_lhs_reg; }                                     \
+                                                                                       \
     private:                                                                           \
         Register m_lhs_reg;                                                            \
     };
@@ -253,6 +272,14 @@ public:
     void replace_references_impl(BasicBlock const&, BasicBlock const&) { }
     void replace_references_impl(Register from, Register to);
 
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        callback(m_from_object, RegisterAccess::Read);
+        for (size_t i = 0; i < m_excluded_names_count; ++i)
+            callback(m_excluded_names[i], RegisterAccess::Read);
+    }
+
     size_t length_impl() const { return sizeof(*this) + sizeof(Register) * m_excluded_names_count; }
 
 private:
@@ -302,6 +329,24 @@ public:
     //       shifting it may be done in the future
     void replace_references_impl(Register from, Register) { VERIFY(!m_element_count || from.index() < start().index() || from.index() > end().index()); }
 
+    // Note: Every register of the range is visited, but the range may only be moved as a whole.
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        if (!m_element_count)
+            return;
+        auto first_element = m_elements[0].index();
+        for (size_t i = 0; i < m_element_count; ++i) {
+            Register element { static_cast<u32>(first_element + i) };
+            callback(element, RegisterAccess::Read);
+            if (i == 0)
+                m_elements[0] = element;
+            if (i == m_element_count - 1)
+                m_elements[1] = element;
+        }
+        VERIFY(m_elements[1].index() - m_elements[0].index() + 1 == m_element_count);
+    }
+
     size_t length_impl() const
     {
         return sizeof(*this) + sizeof(Register) * (m_element_count == 0 ? 0 : 2);
@@ -342,6 +387,9 @@ public:
     // Note: This should never do anything, the lhs should always be an array, that is currently being constructed
     void replace_references_impl(Register from, Register) { VERIFY(from != m_lhs); }
 
+    template<typename Callback>
+    void visit_registers_impl(Callback callback) { callback(m_lhs, RegisterAccess::Read); }
+
 private:
     Register m_lhs;
     bool m_is_spread = false;
@@ -374,6 +422,9 @@ public:
     // Note: lhs should always be a string in construction, so this should never do anything
     void replace_references_impl(Register from, Register) { VERIFY(from != m_lhs); }
 
+    template<typename Callback>
+    void visit_registers_impl(Callback callback) { callback(m_lhs, RegisterAccess::ReadWrite); }
+
 private:
     Register m_lhs;
 };
@@ -483,6 +534,7 @@ private:
     IdentifierTableIndex m_identifier;
 
     Optional<EnvironmentCoordinate> mutable m_cached_environment_coordinate;
+    GlobalVariableCache mutable m_global_variable_cache;
 };
 
 class DeleteVariable final : public Instruction {
@@ -517,8 +569,41 @@ public:
     void replace_references_impl(BasicBlock const&, BasicBlock const&) { }
     void replace_references_impl(Register, Register) { }
 
+    IdentifierTableIndex property() const { return m_property; }
+
+private:
+    IdentifierTableIndex m_property;
+
+    PropertyLookupCache mutable m_cache;
+};
+
+// A Load of the base object fused with the GetById that reads from it.
+class LoadAndGetById final : public Instruction {
+public:
+    LoadAndGetById(Register base, IdentifierTableIndex property)
+        : Instruction(Type::LoadAndGetById)
+        , m_base(base)
+        , m_property(property)
+    {
+    }
+
+    ThrowCompletionOr<void> execute_impl(Bytecode::Interpreter&) const;
+    DeprecatedString to_deprecated_string_impl(Bytecode::Executable const&) const;
+    void replace_references_impl(BasicBlock const&, BasicBlock const&) { }
+    void replace_references_impl(Register from, Register to)
+    {
+        if (m_base == from)
+            m_base = to;
+    }
+
+    template<typename Callback>
+    void visit_registers_impl(Callback callback) { callback(m_base, RegisterAccess::Read); }
+
 private:
+    Register m_base;
     IdentifierTableIndex m_property;
+
+    PropertyLookupCache mutable m_cache;
 };
 
 enum class PropertyKind {
@@ -548,10 +633,15 @@ public:
             m_base = to;
     }
 
+    template<typename Callback>
+    void visit_registers_impl(Callback callback) { callback(m_base, RegisterAccess::Read); }
+
 private:
     Register m_base;
     IdentifierTableIndex m_property;
     PropertyKind m_kind;
+
+    PropertyLookupCache mutable m_cache;
 };
 
 class DeleteById final : public Instruction {
@@ -588,6 +678,9 @@ public:
             m_base = to;
     }
 
+    template<typename Callback>
+    void visit_registers_impl(Callback callback) { callback(m_base, RegisterAccess::Read); }
+
 private:
     Register m_base;
 };
@@ -611,6 +704,13 @@ public:
             m_base = to;
     }
 
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        callback(m_base, RegisterAccess::Read);
+        callback(m_property, RegisterAccess::Read);
+    }
+
 private:
     Register m_base;
     Register m_property;
@@ -634,6 +734,9 @@ public:
             m_base = to;
     }
 
+    template<typename Callback>
+    void visit_registers_impl(Callback callback) { callback(m_base, RegisterAccess::Read); }
+
 private:
     Register m_base;
 };
@@ -708,6 +811,56 @@ public:
     DeprecatedString to_deprecated_string_impl(Bytecode::Executable const&) const;
 };
 
+#define JS_ENUMERATE_FUSABLE_COMPARISON_OPS(O) \
+    O(GreaterThan, greater_than)               \
+    O(GreaterThanEquals, greater_than_equals)  \
+    O(LessThan, less_than)                     \
+    O(LessThanEquals, less_than_equals)        \
+    O(LooselyInequals, abstract_inequals)      \
+    O(LooselyEquals, abstract_equals)          \
+    O(StrictlyInequals, typed_inequals)        \
+    O(StrictlyEquals, typed_equals)
+
+// A comparison fused with the JumpConditional that tests its result, so that the pair takes a single dispatch.
+// The result of the comparison is still left in the accumulator.
+class CompareAndJump final : public Jump {
+public:
+    enum class Comparison {
+#define __JS_FUSABLE_COMPARISON(OpTitleCase, op_snake_case) OpTitleCase,
+        JS_ENUMERATE_FUSABLE_COMPARISON_OPS(__JS_FUSABLE_COMPARISON)
+#undef __JS_FUSABLE_COMPARISON
+    };
+
+    CompareAndJump(Comparison comparison, Register lhs, Optional<Label> true_target, Optional<Label> false_target)
+        : Jump(Type::CompareAndJump, move(true_target), move(false_target))
+        , m_comparison(comparison)
+        , m_lhs(lhs)
+    {
+    }
+
+    ThrowCompletionOr<void> execute_impl(Bytecode::Interpreter&) const;
+    DeprecatedString to_deprecated_string_impl(Bytecode::Executable const&) const;
+    using Jump::replace_references_impl;
+    void replace_references_impl(Register from, Register to)
+    {
+        if (m_lhs == from)
+            m_lhs = to;
+    }
+
+    template<typename Callback>
+    void visit_registers_impl(Callback callback) { callback(m_lhs, RegisterAccess::Read); }
+
+    // Puts the result of the comparison into the accumulator, without jumping anywhere.
+    ThrowCompletionOr<void> compare(Bytecode::Interpreter&) const;
+
+    Comparison comparison() const { return m_comparison; }
+    Register lhs() const { return m_lhs; }
+
+private:
+    Comparison m_comparison;
+    Register m_lhs;
+};
+
 // NOTE: This instruction is variable-width depending on the number of arguments!
 class Call final : public Instruction {
 public:
@@ -730,6 +883,13 @@ public:
     void replace_references_impl(BasicBlock const&, BasicBlock const&) { }
     void replace_references_impl(Register, Register);
 
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        callback(m_callee, RegisterAccess::Read);
+        callback(m_this_value, RegisterAccess::Read);
+    }
+
     Completion throw_type_error_for_callee(Bytecode::Interpreter&, StringView callee_type) const;
 
 private:
@@ -1222,6 +1382,22 @@ ALWAYS_INLINE void Instruction::replace_references(Register from, Register to)
 #undef __BYTECODE_OP
 }
 
+template<typename Callback>
+ALWAYS_INLINE void Instruction::visit_registers(Callback callback)
+{
+#define __BYTECODE_OP(op)       \
+    case Instruction::Type::op: \
+        return static_cast<Bytecode::Op::op&>(*this).visit_registers_impl(callback);
+
+    switch (type()) {
+        ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+    default:
+        VERIFY_NOT_REACHED();
+    }
+
+#undef __BYTECODE_OP
+}
+
 ALWAYS_INLINE size_t Instruction::length() const
 {
     if (type() == Type::NewArray)
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
+
+namespace JS::Bytecode::Passes {
+
+// NOTE: Only operations that can be done without a VM (and without any observable effect) are folded here.
+static Optional<Value> fold_binary_operation(Instruction::Type type, Value lhs, Value rhs)
+{
+    using enum Instruction::Type;
+
+    if (lhs.is_int32() && rhs.is_int32()) {
+        auto left = lhs.as_i32();
+        auto right = rhs.as_i32();
+        auto shift = static_cast<u32>(right) & 31;
+        switch (type) {
+        case BitwiseAnd:
+            return Value(left & right);
+        case BitwiseOr:
+            return Value(left | right);
+        case BitwiseXor:
+            return Value(left ^ right);
+        case LeftShift:
+            return Value(static_cast<i32>(static_cast<u32>(left) << shift));
+        case RightShift:
+            return Value(left >> shift);
+        case UnsignedRightShift:
+            return Value(static_cast<u32>(left) >> shift);
+        default:
+            break;
+        }
+    }
+
+    if (lhs.is_number() && rhs.is_number()) {
+        auto left = lhs.as_double();
+        auto right = rhs.as_double();
+        switch (type) {
+        case Add:
+            return Value(left + right);
+        case Sub:
+            return Value(left - right);
+        case Mul:
+            return Value(left * right);
+        case Div:
+            return Value(left / right);
+        case Mod:
+            return Value(fmod(left, right));
+        case LessThan:
+            return Value(left < right);
+        case LessThanEquals:
+            return Value(left <= right);
+        case GreaterThan:
+            return Value(left > right);
+        case GreaterThanEquals:
+            return Value(left >= right);
+        case LooselyEquals:
+            return Value(left == right);
+        case LooselyInequals:
+            return Value(left != right);
+        default:
+            break;
+        }
+    }
+
+    if (lhs.is_boolean() && rhs.is_boolean()) {
+        switch (type) {
+        case LooselyEquals:
+            return Value(lhs.as_bool() == rhs.as_bool());
+        case LooselyInequals:
+            return Value(lhs.as_bool() != rhs.as_bool());
+        default:
+            break;
+        }
+    }
+
+    if (!lhs.is_cell() && !rhs.is_cell()) {
+        switch (type) {
+        case StrictlyEquals:
+            return Value(is_strictly_equal(lhs, rhs));
+        case StrictlyInequals:
+            return Value(!is_strictly_equal(lhs, rhs));
+        default:
+            break;
+        }
+    }
+
+    return {};
+}
+
+static Optional<Value> fold_unary_operation(Instruction::Type type, Value value)
+{
+    using enum Instruction::Type;
+
+    switch (type) {
+    case Not:
+        if (!value.is_cell())
+            return Value(!value.to_boolean());
+        break;
+    case UnaryMinus:
+        if (value.is_number())
+            return Value(-value.as_double());
+        break;
+    case UnaryPlus:
+        if (value.is_number())
+            return value;
+        break;
+    case BitwiseNot:
+        if (value.is_int32())
+            return Value(~value.as_i32());
+        break;
+    default:
+        break;
+    }
+    return {};
+}
+
+static bool is_foldable_binary_operation(Instruction::Type type)
+{
+    switch (type) {
+#define __JS_FOLDABLE_BINARY_OP(OpTitleCase, op_snake_case) \
+    case Instruction::Type::OpTitleCase:                    \
+        return true;
+        JS_ENUMERATE_COMMON_BINARY_OPS(__JS_FOLDABLE_BINARY_OP)
+#undef __JS_FOLDABLE_BINARY_OP
+    default:
+        return false;
+    }
+}
+
+static Register lhs_of_binary_operation(Instruction const& instruction)
+{
+    switch (instruction.type()) {
+#define __JS_FOLDABLE_BINARY_OP(OpTitleCase, op_snake_case) \
+    case Instruction::Type::OpTitleCase:                    \
+        return static_cast<Op::OpTitleCase const&>(instruction).lhs();
+        JS_ENUMERATE_COMMON_BINARY_OPS(__JS_FOLDABLE_BINARY_OP)
+#undef __JS_FOLDABLE_BINARY_OP
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
+static void fold_constants(BasicBlock& block)
+{
+    auto instructions = block.take_instructions();
+
+    // What we know about the accumulator and registers at the current point of the block.
+    Optional<Value> accumulator;
+    HashMap<u32, Value> registers;
+
+    // NOTE: Every instruction after the current one is appended again at most at its current size, so as long as
+    //       there is room for all of them, replacing the current one with a larger LoadImmediate is safe.
+    size_t bytes_still_to_append = instructions.size();
+
+    auto replace_with_constant = [&](Instruction& instruction, Value value) {
+        // LoadImmediate is larger than most of the instructions it replaces, so it might not fit.
+        if (!block.can_grow(sizeof(Op::LoadImmediate) + bytes_still_to_append))
+            return false;
+        Instruction::destroy(instruction);
+        block.append<Op::LoadImmediate>(value);
+        accumulator = value;
+        return true;
+    };
+
+    for (InstructionStreamIterator it { instructions.span() }; !it.at_end(); ++it) {
+        auto& instruction = const_cast<Instruction&>(*it);
+        auto type = instruction.type();
+        bytes_still_to_append -= instruction.length();
+
+        if (type == Instruction::Type::LoadImmediate) {
+            accumulator = static_cast<Op::LoadImmediate const&>(instruction).value();
+            block.append_instruction(instruction);
+            continue;
+        }
+
+        if (type == Instruction::Type::Store) {
+            auto dst = static_cast<Op::Store const&>(instruction).dst().index();
+            if (accumulator.has_value())
+                registers.set(dst, *accumulator);
+            else
+                registers.remove(dst);
+            block.append_instruction(instruction);
+            continue;
+        }
+
+        if (type == Instruction::Type::Load) {
+            auto src = static_cast<Op::Load const&>(instruction).src().index();
+            if (auto value = registers.get(src); value.has_value() && replace_with_constant(instruction, *value))
+                continue;
+        }
+
+        if (is_foldable_binary_operation(type) && accumulator.has_value()) {
+            if (auto lhs = registers.get(lhs_of_binary_operation(instruction).index()); lhs.has_value()) {
+                if (auto result = fold_binary_operation(type, *lhs, *accumulator); result.has_value() && replace_with_constant(instruction, *result))
+                    continue;
+            }
+        }
+
+        if (accumulator.has_value()) {
+            if (auto result = fold_unary_operation(type, *accumulator); result.has_value() && replace_with_constant(instruction, *result))
+                continue;
+        }
+
+        if (type == Instruction::Type::JumpConditional && accumulator.has_value() && !accumulator->is_cell()) {
+            auto const& jump = static_cast<Op::JumpConditional const&>(instruction);
+            auto target = accumulator->to_boolean() ? *jump.true_target() : *jump.false_target();
+            Instruction::destroy(instruction);
+            block.append<Op::Jump>(target);
+            continue;
+        }
+
+        instruction.visit_registers([&](Register& reg, RegisterAccess access) {
+            if (access != RegisterAccess::Read)
+                registers.remove(reg.index());
+        });
+        accumulator = {};
+        block.append_instruction(instruction);
+    }
+}
+
+void FoldConstants::perform(PassPipelineExecutable& executable)
+{
+    started();
+
+    for (auto& block : executable.executable.basic_blocks)
+        fold_constants(*block);
+
+    finished();
+}
+
+}
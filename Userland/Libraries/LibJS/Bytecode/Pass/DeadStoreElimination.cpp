@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
+
+namespace JS::Bytecode::Passes {
+
+static bool overwrites_accumulator_without_reading_it(Instruction const& instruction)
+{
+    switch (instruction.type()) {
+    case Instruction::Type::GetNewTarget:
+    case Instruction::Type::GetVariable:
+    case Instruction::Type::Load:
+    case Instruction::Type::LoadAndGetById:
+    case Instruction::Type::LoadImmediate:
+    case Instruction::Type::NewArray:
+    case Instruction::Type::NewBigInt:
+    case Instruction::Type::NewFunction:
+    case Instruction::Type::NewObject:
+    case Instruction::Type::NewRegExp:
+    case Instruction::Type::NewString:
+    case Instruction::Type::ResolveThisBinding:
+    case Instruction::Type::TypeofVariable:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// These can't have any effect other than on the accumulator.
+static bool only_writes_accumulator(Instruction const& instruction)
+{
+    switch (instruction.type()) {
+    case Instruction::Type::Load:
+    case Instruction::Type::LoadImmediate:
+    case Instruction::Type::NewBigInt:
+    case Instruction::Type::NewString:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static void eliminate_dead_stores(BasicBlock& block, HashTable<u32> live)
+{
+    auto instructions = block.take_instructions();
+
+    Vector<Instruction*> instructions_in_order;
+    for (InstructionStreamIterator it { instructions.span() }; !it.at_end(); ++it)
+        instructions_in_order.append(const_cast<Instruction*>(&*it));
+
+    // We don't know what the next block does with the accumulator, so it has to be assumed live when leaving.
+    bool accumulator_is_live = true;
+    Vector<bool> is_dead;
+    is_dead.resize(instructions_in_order.size());
+
+    for (size_t i = instructions_in_order.size(); i > 0; --i) {
+        auto& instruction = *instructions_in_order[i - 1];
+
+        if (instruction.type() == Instruction::Type::Store && !live.contains(static_cast<Op::Store const&>(instruction).dst().index())) {
+            is_dead[i - 1] = true;
+            continue;
+        }
+        if (!accumulator_is_live && only_writes_accumulator(instruction)) {
+            is_dead[i - 1] = true;
+            continue;
+        }
+
+        Vector<u32, 4> read_registers;
+        instruction.visit_registers([&](Register& reg, RegisterAccess access) {
+            if (access == RegisterAccess::Write)
+                live.remove(reg.index());
+            else
+                read_registers.append(reg.index());
+        });
+        for (auto index : read_registers)
+            live.set(index);
+
+        accumulator_is_live = !overwrites_accumulator_without_reading_it(instruction);
+    }
+
+    for (size_t i = 0; i < instructions_in_order.size(); ++i) {
+        if (is_dead[i])
+            Instruction::destroy(*instructions_in_order[i]);
+        else
+            block.append_instruction(*instructions_in_order[i]);
+    }
+}
+
+void EliminateDeadStores::perform(PassPipelineExecutable& executable)
+{
+    started();
+
+    VERIFY(executable.cfg.has_value());
+    if (!executable.live_registers_at_exit.has_value()) {
+        finished();
+        return;
+    }
+
+    for (auto& block : executable.executable.basic_blocks) {
+        HashTable<u32> live_at_exit;
+        if (auto entry = executable.live_registers_at_exit->find(block.ptr()); entry != executable.live_registers_at_exit->end()) {
+            for (auto index : entry->value)
+                live_at_exit.set(index);
+        }
+        eliminate_dead_stores(*block, move(live_at_exit));
+    }
+
+    finished();
+}
+
+}
@@ -23,7 +23,7 @@ static BasicBlock const* next_handler_or_finalizer()
     return unwind_frames.last()->handler ?: unwind_frames.last()->finalizer;
 }
 
-static void generate_cfg_for_block(BasicBlock const& current_block, PassPipelineExecutable executable)
+static void generate_cfg_for_block(BasicBlock const& current_block, PassPipelineExecutable& executable)
 {
     seen_blocks.set(&current_block);
 
@@ -65,7 +65,8 @@ static void generate_cfg_for_block(BasicBlock const& current_block, PassPipeline
         }
         case JumpConditional:
         case JumpNullish:
-        case JumpUndefined: {
+        case JumpUndefined:
+        case CompareAndJump: {
             // FIXME: It would be nice if we could avoid this copy, if we know that the unwind context stays the same in both paths
             //        Or with a COW capable Vector alternative
             // Note: We might partially unwind here, so we need to make a copy of
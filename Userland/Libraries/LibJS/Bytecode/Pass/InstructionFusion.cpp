@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
+
+namespace JS::Bytecode::Passes {
+
+static Optional<Op::CompareAndJump::Comparison> fusable_comparison(Instruction const& instruction)
+{
+    switch (instruction.type()) {
+#define __JS_FUSABLE_COMPARISON(OpTitleCase, op_snake_case) \
+    case Instruction::Type::OpTitleCase:                    \
+        return Op::CompareAndJump::Comparison::OpTitleCase;
+        JS_ENUMERATE_FUSABLE_COMPARISON_OPS(__JS_FUSABLE_COMPARISON)
+#undef __JS_FUSABLE_COMPARISON
+    default:
+        return {};
+    }
+}
+
+static Register lhs_of_comparison(Instruction const& instruction)
+{
+    switch (instruction.type()) {
+#define __JS_FUSABLE_COMPARISON(OpTitleCase, op_snake_case) \
+    case Instruction::Type::OpTitleCase:                    \
+        return static_cast<Op::OpTitleCase const&>(instruction).lhs();
+        JS_ENUMERATE_FUSABLE_COMPARISON_OPS(__JS_FUSABLE_COMPARISON)
+#undef __JS_FUSABLE_COMPARISON
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
+static_assert(sizeof(Op::CompareAndJump) <= sizeof(Op::LessThan) + sizeof(Op::JumpConditional));
+static_assert(sizeof(Op::LoadAndGetById) <= sizeof(Op::Load) + sizeof(Op::GetById));
+
+static void fuse_instructions(BasicBlock& block)
+{
+    auto instructions = block.take_instructions();
+
+    Vector<Instruction*> instructions_in_order;
+    for (InstructionStreamIterator it { instructions.span() }; !it.at_end(); ++it)
+        instructions_in_order.append(const_cast<Instruction*>(&*it));
+
+    // NOTE: Every fused instruction is at most as large as the pair it replaces (see above), so it always fits.
+    for (size_t i = 0; i < instructions_in_order.size(); ++i) {
+        auto& instruction = *instructions_in_order[i];
+        auto* next_instruction = i + 1 < instructions_in_order.size() ? instructions_in_order[i + 1] : nullptr;
+
+        if (next_instruction && next_instruction->type() == Instruction::Type::JumpConditional) {
+            if (auto comparison = fusable_comparison(instruction); comparison.has_value()) {
+                auto const& jump = static_cast<Op::JumpConditional const&>(*next_instruction);
+                block.append<Op::CompareAndJump>(*comparison, lhs_of_comparison(instruction), jump.true_target(), jump.false_target());
+                Instruction::destroy(instruction);
+                Instruction::destroy(*next_instruction);
+                ++i;
+                continue;
+            }
+        }
+
+        if (next_instruction && instruction.type() == Instruction::Type::Load && next_instruction->type() == Instruction::Type::GetById) {
+            auto base = static_cast<Op::Load const&>(instruction).src();
+            block.append<Op::LoadAndGetById>(base, static_cast<Op::GetById const&>(*next_instruction).property());
+            Instruction::destroy(instruction);
+            Instruction::destroy(*next_instruction);
+            ++i;
+            continue;
+        }
+
+        block.append_instruction(instruction);
+    }
+}
+
+void FuseInstructions::perform(PassPipelineExecutable& executable)
+{
+    started();
+
+    for (auto& block : executable.executable.basic_blocks)
+        fuse_instructions(*block);
+
+    finished();
+}
+
+}
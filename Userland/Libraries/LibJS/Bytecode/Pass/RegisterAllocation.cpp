@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
+
+namespace JS::Bytecode::Passes {
+
+// The generator never hands out the registers below this one, so we leave them where they are as well.
+static constexpr u32 first_allocatable_register = 2;
+
+struct RegisterOperand {
+    u32 index;
+    RegisterAccess access;
+};
+
+static Vector<RegisterOperand, 4> register_operands(Instruction const& instruction)
+{
+    Vector<RegisterOperand, 4> operands;
+    const_cast<Instruction&>(instruction).visit_registers([&](Register& reg, RegisterAccess access) {
+        operands.append({ reg.index(), access });
+    });
+    return operands;
+}
+
+// Drops the register moves that became no-ops once both sides ended up in the same register.
+static void remove_redundant_moves(BasicBlock& block)
+{
+    auto instructions = block.take_instructions();
+
+    Optional<u32> register_in_accumulator;
+    for (InstructionStreamIterator it { instructions.span() }; !it.at_end(); ++it) {
+        auto& instruction = const_cast<Instruction&>(*it);
+
+        Optional<u32> moved_register;
+        if (instruction.type() == Instruction::Type::Load)
+            moved_register = static_cast<Op::Load const&>(instruction).src().index();
+        else if (instruction.type() == Instruction::Type::Store)
+            moved_register = static_cast<Op::Store const&>(instruction).dst().index();
+
+        if (moved_register.has_value() && moved_register == register_in_accumulator) {
+            Instruction::destroy(instruction);
+            continue;
+        }
+
+        register_in_accumulator = moved_register;
+        block.append_instruction(instruction);
+    }
+}
+
+void AllocateRegisters::perform(PassPipelineExecutable& executable)
+{
+    started();
+
+    VERIFY(executable.cfg.has_value());
+    if (!executable.live_registers_at_exit.has_value()) {
+        finished();
+        return;
+    }
+
+    auto number_of_registers = executable.executable.number_of_registers;
+    if (number_of_registers <= first_allocatable_register) {
+        finished();
+        return;
+    }
+
+    Vector<HashTable<u32>> interferences;
+    interferences.resize(number_of_registers);
+    Vector<bool> is_used;
+    is_used.resize(number_of_registers);
+    // The element range of a NewArray has to stay contiguous, so those registers are never shared, and are moved as a whole.
+    Vector<bool> is_in_element_range;
+    is_in_element_range.resize(number_of_registers);
+    // A `Load $a, Store $b` pair copies $a into $b, if they end up in the same register the copy goes away.
+    HashMap<u32, Vector<u32, 1>> copy_partners;
+
+    for (auto& block : executable.executable.basic_blocks) {
+        HashTable<u32> live;
+        if (auto entry = executable.live_registers_at_exit->find(block.ptr()); entry != executable.live_registers_at_exit->end()) {
+            for (auto index : entry->value)
+                live.set(index);
+        }
+
+        Vector<Instruction const*> instructions;
+        for (InstructionStreamIterator it { block->instruction_stream() }; !it.at_end(); ++it)
+            instructions.append(&*it);
+
+        for (size_t i = instructions.size(); i > 0; --i) {
+            auto const& instruction = *instructions[i - 1];
+            auto operands = register_operands(instruction);
+
+            Optional<u32> copied_register;
+            if (instruction.type() == Instruction::Type::Store && i > 1 && instructions[i - 2]->type() == Instruction::Type::Load) {
+                auto source = static_cast<Op::Load const&>(*instructions[i - 2]).src().index();
+                auto destination = static_cast<Op::Store const&>(instruction).dst().index();
+                if (source != destination) {
+                    copied_register = source;
+                    copy_partners.ensure(source).append(destination);
+                    copy_partners.ensure(destination).append(source);
+                }
+            }
+
+            bool is_new_array = instruction.type() == Instruction::Type::NewArray;
+            for (auto const& operand : operands) {
+                is_used[operand.index] = true;
+                if (is_new_array)
+                    is_in_element_range[operand.index] = true;
+                if (operand.access == RegisterAccess::Read)
+                    continue;
+                for (auto live_index : live) {
+                    if (live_index == operand.index || live_index == copied_register)
+                        continue;
+                    interferences[operand.index].set(live_index);
+                    interferences[live_index].set(operand.index);
+                }
+            }
+            for (auto const& operand : operands) {
+                if (operand.access == RegisterAccess::Write)
+                    live.remove(operand.index);
+            }
+            for (auto const& operand : operands) {
+                if (operand.access != RegisterAccess::Write)
+                    live.set(operand.index);
+            }
+        }
+    }
+
+    Vector<Optional<u32>> new_index;
+    new_index.resize(number_of_registers);
+    for (u32 index = 0; index < first_allocatable_register; ++index)
+        new_index[index] = index;
+
+    // Element ranges go first, in their original order, which keeps each of them contiguous.
+    u32 next_index = first_allocatable_register;
+    for (u32 index = first_allocatable_register; index < number_of_registers; ++index) {
+        if (is_in_element_range[index])
+            new_index[index] = next_index++;
+    }
+
+    // Everything else greedily takes the lowest register that none of its already placed neighbors have, preferring
+    // the register of a copy partner.
+    u32 first_shared_index = next_index;
+    for (u32 index = first_allocatable_register; index < number_of_registers; ++index) {
+        if (!is_used[index] || is_in_element_range[index])
+            continue;
+
+        HashTable<u32> taken;
+        for (auto neighbor : interferences[index]) {
+            if (new_index[neighbor].has_value())
+                taken.set(*new_index[neighbor]);
+        }
+
+        Optional<u32> chosen_index;
+        if (auto partners = copy_partners.find(index); partners != copy_partners.end()) {
+            for (auto partner : partners->value) {
+                if (partner < first_allocatable_register || is_in_element_range[partner] || !new_index[partner].has_value() || taken.contains(*new_index[partner]))
+                    continue;
+                chosen_index = new_index[partner];
+                break;
+            }
+        }
+        if (!chosen_index.has_value()) {
+            u32 candidate = first_shared_index;
+            while (taken.contains(candidate))
+                ++candidate;
+            chosen_index = candidate;
+        }
+
+        new_index[index] = chosen_index;
+        next_index = max(next_index, *chosen_index + 1);
+    }
+
+    for (auto& block : executable.executable.basic_blocks) {
+        for (InstructionStreamIterator it { block->instruction_stream() }; !it.at_end(); ++it) {
+            const_cast<Instruction&>(*it).visit_registers([&](Register& reg, RegisterAccess) {
+                reg = Register { *new_index[reg.index()] };
+            });
+        }
+        remove_redundant_moves(*block);
+    }
+
+    executable.executable.number_of_registers = next_index;
+
+    // The registers have all been renamed, so the liveness information no longer applies.
+    executable.live_registers_at_exit = {};
+
+    finished();
+}
+
+}
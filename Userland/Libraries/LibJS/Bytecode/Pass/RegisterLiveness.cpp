@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
+
+namespace JS::Bytecode::Passes {
+
+struct RegisterUses {
+    // Registers whose incoming value the block reads.
+    HashTable<u32> read_before_written;
+    HashTable<u32> written;
+};
+
+static bool enters_unwind_context(Executable const& executable)
+{
+    for (auto const& block : executable.basic_blocks) {
+        for (InstructionStreamIterator it { block->instruction_stream() }; !it.at_end(); ++it) {
+            if ((*it).type() == Instruction::Type::EnterUnwindContext)
+                return true;
+        }
+    }
+    return false;
+}
+
+static RegisterUses register_uses_of_block(BasicBlock const& block)
+{
+    RegisterUses uses;
+    for (InstructionStreamIterator it { block.instruction_stream() }; !it.at_end(); ++it) {
+        const_cast<Instruction&>(*it).visit_registers([&](Register& reg, RegisterAccess access) {
+            if (access != RegisterAccess::Write && !uses.written.contains(reg.index()))
+                uses.read_before_written.set(reg.index());
+            if (access != RegisterAccess::Read)
+                uses.written.set(reg.index());
+        });
+    }
+    return uses;
+}
+
+void AnalyzeRegisterLiveness::perform(PassPipelineExecutable& executable)
+{
+    started();
+
+    VERIFY(executable.cfg.has_value());
+    executable.live_registers_at_exit = {};
+
+    // NOTE: Any instruction inside an unwind context may continue in its handler or finalizer, and the CFG only has
+    //       edges for that from the ends of blocks. So we don't know what is live in the middle of such blocks.
+    if (enters_unwind_context(executable.executable)) {
+        finished();
+        return;
+    }
+
+    auto const& basic_blocks = executable.executable.basic_blocks;
+
+    HashMap<BasicBlock const*, RegisterUses> uses_of_block;
+    for (auto const& block : basic_blocks)
+        uses_of_block.set(block.ptr(), register_uses_of_block(*block));
+
+    HashMap<BasicBlock const*, HashTable<u32>> live_at_entry;
+    HashMap<BasicBlock const*, HashTable<u32>> live_at_exit;
+
+    // Live sets only ever grow, so we're done once a round over all blocks doesn't add anything.
+    // Going backwards through the (mostly forward-flowing) blocks lets most of the information flow in one round.
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t i = basic_blocks.size(); i > 0; --i) {
+            auto const* block = basic_blocks[i - 1].ptr();
+
+            HashTable<u32> live;
+            if (auto successors = executable.cfg->find(block); successors != executable.cfg->end()) {
+                for (auto const* successor : successors->value) {
+                    if (auto entry = live_at_entry.find(successor); entry != live_at_entry.end()) {
+                        for (auto index : entry->value)
+                            live.set(index);
+                    }
+                }
+            }
+
+            auto const& uses = uses_of_block.find(block)->value;
+            HashTable<u32> live_in;
+            for (auto index : uses.read_before_written)
+                live_in.set(index);
+            for (auto index : live) {
+                if (!uses.written.contains(index))
+                    live_in.set(index);
+            }
+
+            auto& previous_live_in = live_at_entry.ensure(block);
+            if (live_in.size() != previous_live_in.size()) {
+                previous_live_in = move(live_in);
+                changed = true;
+            }
+            live_at_exit.set(block, move(live));
+        }
+    }
+
+    executable.live_registers_at_exit = move(live_at_exit);
+
+    finished();
+}
+
+}
@@ -17,6 +17,10 @@ struct PassPipelineExecutable {
     Optional<HashMap<BasicBlock const*, HashTable<BasicBlock const*>>> cfg {};
     Optional<HashMap<BasicBlock const*, HashTable<BasicBlock const*>>> inverted_cfg {};
     Optional<HashTable<BasicBlock const*>> exported_blocks {};
+
+    // The registers (by index) that are live when leaving each block. Exception edges aren't modeled precisely enough
+    // for this, so it is left empty for executables that enter unwind contexts.
+    Optional<HashMap<BasicBlock const*, HashTable<u32>>> live_registers_at_exit {};
 };
 
 class Pass {
@@ -53,8 +57,16 @@ public:
 
     void perform(Executable& executable)
     {
+        Executable::OptimizationStatistics statistics;
+        statistics.instructions_before = executable.number_of_instructions();
+        statistics.registers_before = executable.number_of_registers;
+
         PassPipelineExecutable pipeline_executable { executable };
         perform(pipeline_executable);
+
+        statistics.instructions_after = executable.number_of_instructions();
+        statistics.registers_after = executable.number_of_registers;
+        executable.optimization_statistics = statistics;
     }
 
     virtual void perform(PassPipelineExecutable& executable) override
@@ -131,6 +143,51 @@ private:
     virtual void perform(PassPipelineExecutable&) override;
 };
 
+class FoldConstants : public Pass {
+public:
+    FoldConstants() = default;
+    ~FoldConstants() override = default;
+
+private:
+    virtual void perform(PassPipelineExecutable&) override;
+};
+
+class AnalyzeRegisterLiveness : public Pass {
+public:
+    AnalyzeRegisterLiveness() = default;
+    ~AnalyzeRegisterLiveness() override = default;
+
+private:
+    virtual void perform(PassPipelineExecutable&) override;
+};
+
+class EliminateDeadStores : public Pass {
+public:
+    EliminateDeadStores() = default;
+    ~EliminateDeadStores() override = default;
+
+private:
+    virtual void perform(PassPipelineExecutable&) override;
+};
+
+class AllocateRegisters : public Pass {
+public:
+    AllocateRegisters() = default;
+    ~AllocateRegisters() override = default;
+
+private:
+    virtual void perform(PassPipelineExecutable&) override;
+};
+
+class FuseInstructions : public Pass {
+public:
+    FuseInstructions() = default;
+    ~FuseInstructions() override = default;
+
+private:
+    virtual void perform(PassPipelineExecutable&) override;
+};
+
 }
 
 }
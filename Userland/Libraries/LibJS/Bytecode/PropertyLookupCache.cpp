@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Format.h>
+#include <LibJS/Bytecode/PropertyLookupCache.h>
+#include <LibJS/Runtime/DeclarativeEnvironment.h>
+#include <LibJS/Runtime/GlobalEnvironment.h>
+#include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/ObjectEnvironment.h>
+#include <LibJS/Runtime/Shape.h>
+#include <LibJS/Runtime/VM.h>
+
+namespace JS::Bytecode {
+
+PropertyLookupCacheStatistics g_property_lookup_cache_statistics;
+
+static bool is_cacheable_property_key(Object& object, PropertyKey const& property_key)
+{
+    if (!property_key.is_string())
+        return false;
+    // Array keeps its "length" outside of its property storage, and shares shapes with ordinary objects.
+    return property_key.as_string() != object.vm().names.length.as_string();
+}
+
+Object* PropertyLookupCache::find(Object& receiver, u32& property_offset) const
+{
+    if (receiver.may_interfere_with_property_lookup_caches())
+        return nullptr;
+
+    auto shape_serial_number = receiver.shape().serial_number();
+    for (auto const& entry : m_entries) {
+        if (entry.shape_serial_number != shape_serial_number)
+            continue;
+
+        // The receiver's shape pins down its prototype, and each prototype's shape pins down the next one.
+        Object* holder = &receiver;
+        for (size_t i = 0; i < entry.prototype_chain_length; ++i) {
+            holder = holder->shape().prototype();
+            if (holder->shape().serial_number() != entry.prototype_shape_serial_numbers[i])
+                return nullptr;
+        }
+
+        property_offset = entry.property_offset;
+        return holder;
+    }
+    return nullptr;
+}
+
+void PropertyLookupCache::update_for_get(Object& receiver, PropertyKey const& property_key)
+{
+    if (!is_cacheable_property_key(receiver, property_key))
+        return;
+
+    auto key = property_key.to_string_or_symbol();
+    Entry entry;
+    entry.shape_serial_number = receiver.shape().serial_number();
+
+    Object* object = &receiver;
+    for (;;) {
+        if (object->may_interfere_with_property_lookup_caches())
+            return;
+        if (auto metadata = object->shape().lookup(key); metadata.has_value()) {
+            // An empty slot is an intrinsic accessor that hasn't been materialized yet.
+            if (object->get_direct(metadata->offset).is_empty())
+                return;
+            entry.property_offset = metadata->offset;
+            break;
+        }
+        object = object->shape().prototype();
+        if (!object || entry.prototype_chain_length == max_prototype_chain_length)
+            return;
+        entry.prototype_shape_serial_numbers[entry.prototype_chain_length++] = object->shape().serial_number();
+    }
+
+    insert(entry);
+}
+
+void PropertyLookupCache::update_for_put(Object& receiver, PropertyKey const& property_key)
+{
+    if (!is_cacheable_property_key(receiver, property_key) || receiver.may_interfere_with_property_lookup_caches())
+        return;
+
+    auto metadata = receiver.shape().lookup(property_key.to_string_or_symbol());
+    if (!metadata.has_value() || !metadata->attributes.is_writable())
+        return;
+    auto value = receiver.get_direct(metadata->offset);
+    if (value.is_empty() || value.is_accessor())
+        return;
+
+    Entry entry;
+    entry.shape_serial_number = receiver.shape().serial_number();
+    entry.property_offset = metadata->offset;
+    insert(entry);
+}
+
+void PropertyLookupCache::insert(Entry const& entry)
+{
+    for (auto& existing_entry : m_entries) {
+        if (existing_entry.shape_serial_number == entry.shape_serial_number) {
+            existing_entry = entry;
+            return;
+        }
+    }
+    m_entries[m_next_entry_to_replace] = entry;
+    m_next_entry_to_replace = (m_next_entry_to_replace + 1) % max_entries;
+}
+
+ThrowCompletionOr<Optional<Value>> GlobalVariableCache::get(VM& vm, GlobalEnvironment& global_environment) const
+{
+    auto& global_object = global_environment.object_record().binding_object();
+    if (m_kind == Kind::None || global_object.shape().serial_number() != m_shape_serial_number)
+        return Optional<Value> {};
+
+    auto& declarative_record = global_environment.declarative_record();
+    if (m_kind == Kind::LexicalBinding)
+        return TRY(declarative_record.get_binding_value_direct(vm, m_index, vm.in_strict_mode()));
+
+    // A lexical declaration in a later script would shadow the global object's property.
+    if (declarative_record.binding_count() != m_declarative_binding_count)
+        return Optional<Value> {};
+
+    auto value = global_object.get_direct(m_index);
+    if (value.is_empty() || value.is_accessor())
+        return Optional<Value> {};
+    return value;
+}
+
+void GlobalVariableCache::update(GlobalEnvironment& global_environment, DeprecatedFlyString const& name)
+{
+    m_kind = Kind::None;
+
+    auto& global_object = global_environment.object_record().binding_object();
+    if (global_object.may_interfere_with_property_lookup_caches())
+        return;
+    m_shape_serial_number = global_object.shape().serial_number();
+
+    auto& declarative_record = global_environment.declarative_record();
+    Optional<size_t> binding_index;
+    if (MUST(declarative_record.has_binding(name, &binding_index))) {
+        if (!binding_index.has_value())
+            return;
+        m_kind = Kind::LexicalBinding;
+        m_index = binding_index.value();
+        return;
+    }
+
+    auto metadata = global_object.shape().lookup(StringOrSymbol { name });
+    if (!metadata.has_value())
+        return;
+    m_kind = Kind::GlobalObjectProperty;
+    m_declarative_binding_count = declarative_record.binding_count();
+    m_index = metadata->offset;
+}
+
+void PropertyLookupCacheStatistics::dump() const
+{
+    auto dump_counters = [](StringView name, u64 hits, u64 misses) {
+        auto total = hits + misses;
+        warnln("{:>12}: {:>10} hits, {:>10} misses ({}% hit rate)", name, hits, misses, total ? hits * 100 / total : 0);
+    };
+    warnln("Property lookup cache statistics:");
+    dump_counters("GetById"sv, get_by_id_hits, get_by_id_misses);
+    dump_counters("PutById"sv, put_by_id_hits, put_by_id_misses);
+    dump_counters("GetVariable"sv, get_global_variable_hits, get_global_variable_misses);
+}
+
+}
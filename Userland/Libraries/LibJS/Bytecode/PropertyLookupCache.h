@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Types.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Runtime/Completion.h>
+
+namespace JS::Bytecode {
+
+// Remembers where an instruction found a named property on the last few shapes it has seen, so that the next lookup on
+// an object with one of those shapes can go straight to the property's storage slot.
+//
+// Entries are keyed on shape serial numbers rather than shape pointers, since a serial number also changes when a
+// unique shape is modified in place, and is never reused for another shape. A property found on a prototype is only
+// used while the receiver and every prototype up to the holder still have the shapes they had when it was cached.
+class PropertyLookupCache {
+public:
+    static constexpr size_t max_entries = 4;
+    static constexpr size_t max_prototype_chain_length = 4;
+
+    // Returns the object holding the property along with its offset in that object's storage, or nullptr if the lookup
+    // isn't covered by the cache.
+    Object* find(Object& receiver, u32& property_offset) const;
+
+    // Caches the result of looking up the given property on the receiver or its prototype chain, if possible.
+    void update_for_get(Object& receiver, PropertyKey const&);
+
+    // Caches the location of an existing, writable own data property of the receiver, if possible.
+    void update_for_put(Object& receiver, PropertyKey const&);
+
+private:
+    struct Entry {
+        u64 shape_serial_number { 0 };
+        AK::Array<u64, max_prototype_chain_length> prototype_shape_serial_numbers {};
+        u32 prototype_chain_length { 0 };
+        u32 property_offset { 0 };
+    };
+
+    void insert(Entry const&);
+
+    AK::Array<Entry, max_entries> m_entries {};
+    u32 m_next_entry_to_replace { 0 };
+};
+
+// Remembers where a variable that resolved to the global environment is stored: either as a lexical binding in its
+// declarative record, or as a property of the global object.
+class GlobalVariableCache {
+public:
+    // Returns the value of the variable, or nothing if the lookup isn't covered by the cache.
+    ThrowCompletionOr<Optional<Value>> get(VM&, GlobalEnvironment&) const;
+
+    void update(GlobalEnvironment&, DeprecatedFlyString const& name);
+
+private:
+    enum class Kind : u8 {
+        None,
+        LexicalBinding,
+        GlobalObjectProperty,
+    };
+
+    Kind m_kind { Kind::None };
+
+    // The global object's shape also identifies the realm, and with it the global environment.
+    u64 m_shape_serial_number { 0 };
+    size_t m_declarative_binding_count { 0 };
+    size_t m_index { 0 };
+};
+
+struct PropertyLookupCacheStatistics {
+    u64 get_by_id_hits { 0 };
+    u64 get_by_id_misses { 0 };
+    u64 put_by_id_hits { 0 };
+    u64 put_by_id_misses { 0 };
+    u64 get_global_variable_hits { 0 };
+    u64 get_global_variable_misses { 0 };
+
+    void dump() const;
+};
+
+extern PropertyLookupCacheStatistics g_property_lookup_cache_statistics;
+
+}
@@ -190,6 +190,7 @@ class NativeFunction;
 class ObjectEnvironment;
 class Parser;
 struct ParserError;
+struct PreParseData;
 class PrimitiveString;
 class Program;
 class PromiseCapability;
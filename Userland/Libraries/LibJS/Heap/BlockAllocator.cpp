@@ -10,6 +10,7 @@
 #include <LibJS/Heap/BlockAllocator.h>
 #include <LibJS/Heap/HeapBlock.h>
 #include <sys/mman.h>
+#include <unistd.h>
 
 #ifdef HAS_ADDRESS_SANITIZER
 #    include <sanitizer/asan_interface.h>
@@ -34,12 +35,21 @@ BlockAllocator::~BlockAllocator()
 
 void* BlockAllocator::allocate_block([[maybe_unused]] char const* name)
 {
-    if (!m_blocks.is_empty()) {
+    while (!m_blocks.is_empty()) {
         // To reduce predictability, take a random block from the cache.
         size_t random_index = get_random_uniform(m_blocks.size());
         auto* block = m_blocks.unstable_take(random_index);
         ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::block_size);
 #ifdef AK_OS_SERENITY
+        // NOTE: If the kernel purged the block while it was volatile, it now reads as zeroes. That's fine, since a
+        //       HeapBlock is constructed from scratch anyway. If the memory can't be committed again, drop the block.
+        if (madvise(block, HeapBlock::block_size, MADV_SET_NONVOLATILE) < 0) {
+            if (munmap(block, HeapBlock::block_size) < 0) {
+                perror("munmap");
+                VERIFY_NOT_REACHED();
+            }
+            continue;
+        }
         if (set_mmap_name(block, HeapBlock::block_size, name) < 0) {
             perror("set_mmap_name");
             VERIFY_NOT_REACHED();
@@ -49,7 +59,7 @@ void* BlockAllocator::allocate_block([[maybe_unused]] char const* name)
     }
 
 #ifdef AK_OS_SERENITY
-    auto* block = (HeapBlock*)serenity_mmap(nullptr, HeapBlock::block_size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_RANDOMIZED | MAP_PRIVATE, 0, 0, HeapBlock::block_size, name);
+    auto* block = (HeapBlock*)serenity_mmap(nullptr, HeapBlock::block_size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_RANDOMIZED | MAP_PRIVATE | MAP_PURGEABLE, 0, 0, HeapBlock::block_size, name);
     VERIFY(block != MAP_FAILED);
 #else
     auto* block = (HeapBlock*)aligned_alloc(HeapBlock::block_size, HeapBlock::block_size);
@@ -73,6 +83,18 @@ void BlockAllocator::deallocate_block(void* block)
         return;
     }
 
+    // Let the kernel reclaim the memory of cached blocks. Their contents don't matter, since a HeapBlock is constructed
+    // from scratch when the block is handed out again.
+#ifdef AK_OS_SERENITY
+    // NOTE: Blocks are mapped with MAP_PURGEABLE, but if this fails anyway, the block is simply kept as it is.
+    (void)madvise(block, HeapBlock::block_size, MADV_SET_VOLATILE);
+#elif defined(MADV_DONTNEED)
+    // NOTE: Blocks come from aligned_alloc() here, so only do this if the block doesn't share a page with anything else.
+    static long const page_size = sysconf(_SC_PAGESIZE);
+    if (page_size > 0 && HeapBlock::block_size % page_size == 0)
+        (void)madvise(block, HeapBlock::block_size, MADV_DONTNEED);
+#endif
+
     ASAN_POISON_MEMORY_REGION(block, HeapBlock::block_size);
     m_blocks.append(block);
 }
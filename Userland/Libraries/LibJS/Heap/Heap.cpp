@@ -97,21 +97,30 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
     perf_event(PERF_EVENT_SIGNPOST, gc_perf_string_id, global_gc_counter++);
 #endif
 
-    Core::ElapsedTimer collection_measurement_timer;
-    if (print_report)
-        collection_measurement_timer.start();
+    if (collection_type == CollectionType::CollectGarbage && m_gc_deferrals) {
+        m_should_gc_when_deferral_ends = true;
+        return;
+    }
+
+    auto collection_measurement_timer = Core::ElapsedTimer::start_new();
+
+    for_each_block([&](auto& block) {
+        block.reset_marked_cell_count();
+        return IterationDecision::Continue;
+    });
 
+    // FIXME: Every collection is still a full stop-the-world mark of the whole heap, followed by a sweep of every block.
+    //        Shortening pauses on large heaps needs a nursery for young cells and marking that is sliced across event
+    //        loop turns. Both depend on write barriers for GCPtr and Value stores into cells, which we don't have yet.
     if (collection_type == CollectionType::CollectGarbage) {
-        if (m_gc_deferrals) {
-            m_should_gc_when_deferral_ends = true;
-            return;
-        }
         HashTable<Cell*> roots;
         gather_roots(roots);
         mark_live_cells(roots);
     }
     finalize_unmarked_cells();
     sweep_dead_cells(print_report, collection_measurement_timer);
+
+    m_garbage_collection_statistics.record_pause(collection_measurement_timer.elapsed_time());
 }
 
 void Heap::gather_roots(HashTable<Cell*>& roots)
@@ -223,6 +232,7 @@ public:
         dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
 
         cell.set_marked(true);
+        HeapBlock::from_cell(&cell)->did_mark_cell();
         m_work_queue.append(cell);
     }
 
@@ -244,8 +254,12 @@ void Heap::mark_live_cells(HashTable<Cell*> const& roots)
     MarkingVisitor visitor(roots);
     visitor.mark_all_live_cells();
 
-    for (auto& inverse_root : m_uprooted_cells)
+    for (auto& inverse_root : m_uprooted_cells) {
+        if (!inverse_root->is_marked())
+            continue;
         inverse_root->set_marked(false);
+        HeapBlock::from_cell(inverse_root)->did_unmark_cell();
+    }
 
     m_uprooted_cells.clear();
 }
@@ -260,6 +274,8 @@ bool Heap::cell_must_survive_garbage_collection(Cell const& cell)
 void Heap::finalize_unmarked_cells()
 {
     for_each_block([&](auto& block) {
+        if (!block.has_unmarked_cells())
+            return IterationDecision::Continue;
         block.template for_each_cell_in_state<Cell::State::Live>([](Cell* cell) {
             if (!cell->is_marked() && !cell_must_survive_garbage_collection(*cell))
                 cell->finalize();
@@ -280,6 +296,15 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     size_t live_cell_bytes = 0;
 
     for_each_block([&](auto& block) {
+        if (!block.has_unmarked_cells() && block.live_cell_count()) {
+            block.template for_each_cell_in_state<Cell::State::Live>([](Cell* cell) {
+                cell->set_marked(false);
+            });
+            live_cells += block.live_cell_count();
+            live_cell_bytes += block.live_cell_count() * block.cell_size();
+            return IterationDecision::Continue;
+        }
+
         bool block_has_live_cells = false;
         bool block_was_full = block.is_full();
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
@@ -305,6 +330,8 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     for (auto& weak_container : m_weak_containers)
         weak_container.remove_dead_cells({});
 
+    m_max_allocations_between_gc = max(live_cells, min_allocations_between_gc);
+
     for (auto* block : empty_blocks) {
         dbgln_if(HEAP_DEBUG, " - HeapBlock empty @ {}: cell_size={}", block, block->cell_size());
         allocator_for_size(block->cell_size()).block_did_become_empty({}, *block);
@@ -341,6 +368,34 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     }
 }
 
+void Heap::GarbageCollectionStatistics::record_pause(Duration pause_time)
+{
+    ++collection_count;
+    total_pause_time += pause_time;
+    longest_pause_time = max(longest_pause_time, pause_time);
+
+    size_t bucket = 0;
+    while (bucket < pause_histogram_bucket_count - 1 && pause_time.to_milliseconds() >= (1 << bucket))
+        ++bucket;
+    ++pause_histogram[bucket];
+}
+
+void Heap::GarbageCollectionStatistics::dump() const
+{
+    dbgln("Garbage collection statistics");
+    dbgln("=============================================");
+    dbgln("    Collections: {}", collection_count);
+    dbgln("     Total time: {} ms", total_pause_time.to_milliseconds());
+    dbgln("  Longest pause: {} ms", longest_pause_time.to_milliseconds());
+    for (size_t i = 0; i < pause_histogram_bucket_count; ++i) {
+        if (i == pause_histogram_bucket_count - 1)
+            dbgln("    >= {:>5} ms: {}", 1 << (i - 1), pause_histogram[i]);
+        else
+            dbgln("     < {:>5} ms: {}", 1 << i, pause_histogram[i]);
+    }
+    dbgln("=============================================");
+}
+
 void Heap::did_create_handle(Badge<HandleImpl>, HandleImpl& impl)
 {
     VERIFY(!m_handles.contains(impl));
@@ -6,11 +6,13 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/Badge.h>
 #include <AK/HashTable.h>
 #include <AK/IntrusiveList.h>
 #include <AK/Noncopyable.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 #include <LibCore/Forward.h>
@@ -57,6 +59,21 @@ public:
 
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
 
+    struct GarbageCollectionStatistics {
+        // Bucket i counts pauses shorter than 2^i ms, the last bucket counts everything longer than that.
+        static constexpr size_t pause_histogram_bucket_count = 12;
+
+        size_t collection_count { 0 };
+        Duration total_pause_time;
+        Duration longest_pause_time;
+        AK::Array<size_t, pause_histogram_bucket_count> pause_histogram {};
+
+        void record_pause(Duration);
+        void dump() const;
+    };
+
+    GarbageCollectionStatistics const& garbage_collection_statistics() const { return m_garbage_collection_statistics; }
+
     VM& vm() { return m_vm; }
 
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
@@ -100,7 +117,11 @@ private:
         }
     }
 
-    size_t m_max_allocations_between_gc { 100000 };
+    static constexpr size_t min_allocations_between_gc = 100000;
+
+    // Scaled with the number of cells that survived the last collection, so that the time spent marking stays
+    // proportional to the amount of allocation rather than growing with the size of the heap.
+    size_t m_max_allocations_between_gc { min_allocations_between_gc };
     size_t m_allocations_since_last_gc { 0 };
 
     bool m_should_collect_on_every_allocation { false };
@@ -121,6 +142,8 @@ private:
     bool m_should_gc_when_deferral_ends { false };
 
     bool m_collecting_garbage { false };
+
+    GarbageCollectionStatistics m_garbage_collection_statistics;
 };
 
 }
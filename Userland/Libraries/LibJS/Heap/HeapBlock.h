@@ -43,12 +43,22 @@ public:
 
         if (allocated_cell) {
             ASAN_UNPOISON_MEMORY_REGION(allocated_cell, m_cell_size);
+            ++m_live_cell_count;
         }
         return allocated_cell;
     }
 
     void deallocate(Cell*);
 
+    size_t live_cell_count() const { return m_live_cell_count; }
+
+    // Counts the cells marked during the current collection, so that blocks without any garbage in them can be skipped
+    // when finalizing and sweeping.
+    void reset_marked_cell_count() { m_marked_cell_count = 0; }
+    void did_mark_cell() { ++m_marked_cell_count; }
+    void did_unmark_cell() { --m_marked_cell_count; }
+    bool has_unmarked_cells() const { return m_marked_cell_count < m_live_cell_count; }
+
     template<typename Callback>
     void for_each_cell(Callback callback)
     {
@@ -110,6 +120,8 @@ private:
     Heap& m_heap;
     size_t m_cell_size { 0 };
     size_t m_next_lazy_freelist_index { 0 };
+    size_t m_live_cell_count { 0 };
+    size_t m_marked_cell_count { 0 };
     GCPtr<FreelistEntry> m_freelist;
     alignas(Cell) u8 m_storage[];
 
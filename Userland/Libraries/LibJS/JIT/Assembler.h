@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Vector.h>
+
+namespace JS::JIT {
+
+// A minimal x86-64 encoder, covering just the instructions the baseline JIT emits.
+struct Assembler {
+    explicit Assembler(Vector<u8>& output)
+        : m_output(output)
+    {
+    }
+
+    enum class Reg {
+        RAX = 0,
+        RCX = 1,
+        RDX = 2,
+        RBX = 3,
+        RSP = 4,
+        RBP = 5,
+        RSI = 6,
+        RDI = 7,
+        R8 = 8,
+        R9 = 9,
+        R10 = 10,
+        R11 = 11,
+        R12 = 12,
+        R13 = 13,
+        R14 = 14,
+        R15 = 15,
+    };
+
+    enum class Condition {
+        Overflow = 0x0,
+        EqualTo = 0x4,
+        NotEqualTo = 0x5,
+        SignedLessThan = 0xC,
+        SignedGreaterThanOrEqualTo = 0xD,
+        SignedLessThanOrEqualTo = 0xE,
+        SignedGreaterThan = 0xF,
+    };
+
+    enum class ALU32Operation : u8 {
+        Add = 0x01,
+        Or = 0x09,
+        And = 0x21,
+        Sub = 0x29,
+        Xor = 0x31,
+        Compare = 0x39,
+    };
+
+    struct Label {
+        Optional<size_t> offset_in_output;
+        // The end of every rel32 displacement that is waiting for the label to be linked.
+        Vector<size_t> displacements_to_patch;
+
+        void link(Assembler& assembler)
+        {
+            VERIFY(!offset_in_output.has_value());
+            offset_in_output = assembler.m_output.size();
+            for (auto end_of_displacement : displacements_to_patch)
+                assembler.patch_rel32(end_of_displacement, *offset_in_output);
+            displacements_to_patch.clear();
+        }
+    };
+
+    void mov64(Reg dst, u64 imm)
+    {
+        emit_rex(true, 0, dst);
+        emit8(0xB8 | encode(dst));
+        emit64(imm);
+    }
+
+    void mov64(Reg dst, Reg src)
+    {
+        emit_rex(true, src, dst);
+        emit8(0x89);
+        emit_modrm_register(encode(src), dst);
+    }
+
+    void load64(Reg dst, Reg base, i32 offset)
+    {
+        emit_rex(true, dst, base);
+        emit8(0x8B);
+        emit_modrm_memory(encode(dst), base, offset);
+    }
+
+    void store64(Reg base, i32 offset, Reg src)
+    {
+        emit_rex(true, src, base);
+        emit8(0x89);
+        emit_modrm_memory(encode(src), base, offset);
+    }
+
+    void shift_right64(Reg reg, u8 amount)
+    {
+        emit_rex(true, 0, reg);
+        emit8(0xC1);
+        emit_modrm_register(5, reg);
+        emit8(amount);
+    }
+
+    void or64(Reg dst, Reg src)
+    {
+        emit_rex(true, src, dst);
+        emit8(0x09);
+        emit_modrm_register(encode(src), dst);
+    }
+
+    void alu32(ALU32Operation operation, Reg dst, Reg src)
+    {
+        emit_rex(false, src, dst);
+        emit8(to_underlying(operation));
+        emit_modrm_register(encode(src), dst);
+    }
+
+    void compare32(Reg reg, u32 imm)
+    {
+        emit_rex(false, 0, reg);
+        emit8(0x81);
+        emit_modrm_register(7, reg);
+        emit32(imm);
+    }
+
+    void and32(Reg reg, u32 imm)
+    {
+        emit_rex(false, 0, reg);
+        emit8(0x81);
+        emit_modrm_register(4, reg);
+        emit32(imm);
+    }
+
+    void add32(Reg reg, i8 imm)
+    {
+        emit_rex(false, 0, reg);
+        emit8(0x83);
+        emit_modrm_register(0, reg);
+        emit8(imm);
+    }
+
+    void sub32(Reg reg, i8 imm)
+    {
+        emit_rex(false, 0, reg);
+        emit8(0x83);
+        emit_modrm_register(5, reg);
+        emit8(imm);
+    }
+
+    void add64(Reg reg, i8 imm)
+    {
+        emit_rex(true, 0, reg);
+        emit8(0x83);
+        emit_modrm_register(0, reg);
+        emit8(imm);
+    }
+
+    void sub64(Reg reg, i8 imm)
+    {
+        emit_rex(true, 0, reg);
+        emit8(0x83);
+        emit_modrm_register(5, reg);
+        emit8(imm);
+    }
+
+    void multiply32(Reg dst, Reg src)
+    {
+        emit_rex(false, dst, src);
+        emit8(0x0F);
+        emit8(0xAF);
+        emit_modrm_register(encode(dst), src);
+    }
+
+    void test32(Reg lhs, Reg rhs)
+    {
+        emit_rex(false, rhs, lhs);
+        emit8(0x85);
+        emit_modrm_register(encode(rhs), lhs);
+    }
+
+    // Sets the low byte of dst to the condition, and clears the rest of it.
+    void set_if(Condition condition, Reg dst)
+    {
+        VERIFY(to_underlying(dst) < 4);
+        emit8(0x0F);
+        emit8(0x90 | to_underlying(condition));
+        emit_modrm_register(0, dst);
+        emit8(0x0F);
+        emit8(0xB6);
+        emit_modrm_register(encode(dst), dst);
+    }
+
+    void jump(Label& label)
+    {
+        emit8(0xE9);
+        emit_rel32_to(label);
+    }
+
+    void jump_if(Condition condition, Label& label)
+    {
+        emit8(0x0F);
+        emit8(0x80 | to_underlying(condition));
+        emit_rel32_to(label);
+    }
+
+    void jump(Reg target)
+    {
+        emit_rex(false, 0, target);
+        emit8(0xFF);
+        emit_modrm_register(4, target);
+    }
+
+    void call(Reg target)
+    {
+        emit_rex(false, 0, target);
+        emit8(0xFF);
+        emit_modrm_register(2, target);
+    }
+
+    void push(Reg reg)
+    {
+        emit_rex(false, 0, reg);
+        emit8(0x50 | encode(reg));
+    }
+
+    void pop(Reg reg)
+    {
+        emit_rex(false, 0, reg);
+        emit8(0x58 | encode(reg));
+    }
+
+    void ret()
+    {
+        emit8(0xC3);
+    }
+
+private:
+    static u8 encode(Reg reg) { return to_underlying(reg) & 7; }
+    static bool is_extended(Reg reg) { return to_underlying(reg) >= 8; }
+
+    void emit8(u8 value) { m_output.append(value); }
+
+    void emit32(u32 value)
+    {
+        for (size_t i = 0; i < 4; ++i)
+            emit8(value >> (i * 8));
+    }
+
+    void emit64(u64 value)
+    {
+        for (size_t i = 0; i < 8; ++i)
+            emit8(value >> (i * 8));
+    }
+
+    void emit_rex(bool wide, u8 reg_field, Reg rm)
+    {
+        u8 rex = 0x40 | (wide ? 0x08 : 0) | (reg_field >= 8 ? 0x04 : 0) | (is_extended(rm) ? 0x01 : 0);
+        if (rex != 0x40)
+            emit8(rex);
+    }
+
+    void emit_rex(bool wide, Reg reg, Reg rm) { emit_rex(wide, to_underlying(reg), rm); }
+
+    void emit_modrm_register(u8 reg_field, Reg rm)
+    {
+        emit8(0xC0 | ((reg_field & 7) << 3) | encode(rm));
+    }
+
+    void emit_modrm_memory(u8 reg_field, Reg base, i32 offset)
+    {
+        emit8(0x80 | ((reg_field & 7) << 3) | encode(base));
+        // RSP and R12 can only be used as a base through a SIB byte.
+        if (encode(base) == encode(Reg::RSP))
+            emit8(0x24);
+        emit32(offset);
+    }
+
+    void emit_rel32_to(Label& label)
+    {
+        emit32(0);
+        if (label.offset_in_output.has_value())
+            patch_rel32(m_output.size(), *label.offset_in_output);
+        else
+            label.displacements_to_patch.append(m_output.size());
+    }
+
+    void patch_rel32(size_t end_of_displacement, size_t target)
+    {
+        auto displacement = static_cast<i32>(static_cast<i64>(target) - static_cast<i64>(end_of_displacement));
+        for (size_t i = 0; i < 4; ++i)
+            m_output[end_of_displacement - 4 + i] = static_cast<u8>(static_cast<u32>(displacement) >> (i * 8));
+    }
+
+    Vector<u8>& m_output;
+};
+
+}
@@ -0,0 +1,540 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <AK/Platform.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/JIT/Compiler.h>
+
+namespace JS::JIT {
+
+using Reg = Assembler::Reg;
+
+// The generated code keeps its state in callee-saved registers, so that it survives the calls into C++.
+static constexpr auto REGISTER_FILE = Reg::RBX;
+static constexpr auto INTERPRETER = Reg::R12;
+static constexpr auto EXCEPTION_SLOT = Reg::R13;
+
+static constexpr u64 SHIFTED_BOOLEAN_TAG = BOOLEAN_TAG << TAG_SHIFT;
+
+template<typename OpType>
+static u64 cxx_execute(Bytecode::Interpreter& interpreter, OpType const& instruction, Value& exception)
+{
+    auto result = instruction.execute_impl(interpreter);
+    if (result.is_error()) [[unlikely]] {
+        exception = *result.throw_completion().value();
+        return 1;
+    }
+    return 0;
+}
+
+// Leaves the jumping to the generated code, which looks at the boolean left in the accumulator.
+static u64 cxx_compare(Bytecode::Interpreter& interpreter, Bytecode::Op::CompareAndJump const& instruction, Value& exception)
+{
+    auto result = instruction.compare(interpreter);
+    if (result.is_error()) [[unlikely]] {
+        exception = *result.throw_completion().value();
+        return 1;
+    }
+    return 0;
+}
+
+static u64 cxx_to_boolean(Value const& value)
+{
+    return value.to_boolean();
+}
+
+OwnPtr<NativeExecutable> Compiler::compile(Bytecode::Executable const& bytecode_executable)
+{
+#if ARCH(X86_64)
+    Compiler compiler(bytecode_executable);
+    if (!compiler.can_compile())
+        return nullptr;
+    return compiler.compile_executable();
+#else
+    (void)bytecode_executable;
+    return nullptr;
+#endif
+}
+
+Compiler::Compiler(Bytecode::Executable const& bytecode_executable)
+    : m_bytecode_executable(bytecode_executable)
+    , m_assembler(m_output)
+{
+}
+
+bool Compiler::can_compile() const
+{
+    for (auto const& block : m_bytecode_executable.basic_blocks) {
+        for (Bytecode::InstructionStreamIterator it(block->instruction_stream()); !it.at_end(); ++it) {
+            switch ((*it).type()) {
+            // FIXME: Unwind contexts and generators need the interpreter's help to resume in the right place.
+            case Bytecode::Instruction::Type::EnterUnwindContext:
+            case Bytecode::Instruction::Type::LeaveUnwindContext:
+            case Bytecode::Instruction::Type::ContinuePendingUnwind:
+            case Bytecode::Instruction::Type::ScheduleJump:
+            case Bytecode::Instruction::Type::Yield:
+                return false;
+            default:
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+OwnPtr<NativeExecutable> Compiler::compile_executable()
+{
+    auto const& basic_blocks = m_bytecode_executable.basic_blocks;
+    m_block_labels.resize(basic_blocks.size());
+    for (size_t i = 0; i < basic_blocks.size(); ++i)
+        m_block_indices.set(basic_blocks[i].ptr(), i);
+
+    compile_prologue();
+
+    HashMap<Bytecode::BasicBlock const*, size_t> block_offsets;
+    for (size_t i = 0; i < basic_blocks.size(); ++i) {
+        m_block_labels[i].link(m_assembler);
+        block_offsets.set(basic_blocks[i].ptr(), *m_block_labels[i].offset_in_output);
+
+        bool has_terminator = false;
+        for (Bytecode::InstructionStreamIterator it(basic_blocks[i]->instruction_stream()); !it.at_end(); ++it) {
+            compile_instruction(*it);
+            if ((*it).is_terminator()) {
+                has_terminator = true;
+                break;
+            }
+        }
+        // Like in the interpreter, running off the end of a block leaves the executable.
+        if (!has_terminator)
+            m_assembler.jump(m_exit);
+    }
+
+    compile_epilogue();
+
+    auto native_executable = NativeExecutable::create(m_output, move(block_offsets));
+    if (native_executable.is_error()) {
+        dbgln_if(JS_BYTECODE_DEBUG, "JIT: Failed to create native executable for {}: {}", m_bytecode_executable.name, native_executable.error());
+        return nullptr;
+    }
+    dbgln_if(JS_BYTECODE_DEBUG, "JIT: Compiled {} to {} bytes of native code", m_bytecode_executable.name, m_output.size());
+    return native_executable.release_value();
+}
+
+void Compiler::compile_prologue()
+{
+    // The entry point is called as (Interpreter*, Value* registers, Value* exception, void const* block_entry).
+    m_assembler.push(Reg::RBP);
+    m_assembler.mov64(Reg::RBP, Reg::RSP);
+    m_assembler.push(REGISTER_FILE);
+    m_assembler.push(INTERPRETER);
+    m_assembler.push(EXCEPTION_SLOT);
+    // Keep the stack 16-byte aligned for the calls into C++.
+    m_assembler.sub64(Reg::RSP, 8);
+
+    m_assembler.mov64(INTERPRETER, Reg::RDI);
+    m_assembler.mov64(REGISTER_FILE, Reg::RSI);
+    m_assembler.mov64(EXCEPTION_SLOT, Reg::RDX);
+    m_assembler.jump(Reg::RCX);
+}
+
+void Compiler::compile_epilogue()
+{
+    Assembler::Label return_to_caller;
+
+    // The exception itself has already been stored into the exception slot.
+    m_exit_with_exception.link(m_assembler);
+    m_assembler.mov64(Reg::RAX, 1);
+    m_assembler.jump(return_to_caller);
+
+    m_exit.link(m_assembler);
+    m_assembler.alu32(Assembler::ALU32Operation::Xor, Reg::RAX, Reg::RAX);
+
+    return_to_caller.link(m_assembler);
+    m_assembler.add64(Reg::RSP, 8);
+    m_assembler.pop(EXCEPTION_SLOT);
+    m_assembler.pop(INTERPRETER);
+    m_assembler.pop(REGISTER_FILE);
+    m_assembler.pop(Reg::RBP);
+    m_assembler.ret();
+}
+
+void Compiler::compile_instruction(Bytecode::Instruction const& instruction)
+{
+    using Type = Bytecode::Instruction::Type;
+
+#define COMPILE_INT32_BINARY_OP(OpTitleCase, operation)                                             \
+    case Type::OpTitleCase:                                                                         \
+        compile_int32_binary_op<Bytecode::Op::OpTitleCase>(instruction, Int32Operation::operation); \
+        return;
+
+    switch (instruction.type()) {
+    case Type::Load:
+        compile_load(static_cast<Bytecode::Op::Load const&>(instruction));
+        return;
+    case Type::LoadImmediate:
+        compile_load_immediate(static_cast<Bytecode::Op::LoadImmediate const&>(instruction));
+        return;
+    case Type::Store:
+        compile_store(static_cast<Bytecode::Op::Store const&>(instruction));
+        return;
+    case Type::Jump:
+        compile_jump(static_cast<Bytecode::Op::Jump const&>(instruction));
+        return;
+    case Type::JumpConditional:
+        compile_jump_conditional(static_cast<Bytecode::Op::JumpConditional const&>(instruction));
+        return;
+    case Type::JumpNullish:
+        compile_jump_nullish(static_cast<Bytecode::Op::JumpNullish const&>(instruction));
+        return;
+    case Type::JumpUndefined:
+        compile_jump_undefined(static_cast<Bytecode::Op::JumpUndefined const&>(instruction));
+        return;
+    case Type::CompareAndJump:
+        compile_compare_and_jump(static_cast<Bytecode::Op::CompareAndJump const&>(instruction));
+        return;
+    case Type::Increment:
+        compile_increment(static_cast<Bytecode::Op::Increment const&>(instruction));
+        return;
+    case Type::Decrement:
+        compile_decrement(static_cast<Bytecode::Op::Decrement const&>(instruction));
+        return;
+    case Type::Return:
+        compile_return(static_cast<Bytecode::Op::Return const&>(instruction));
+        return;
+    case Type::Throw:
+        compile_throw(static_cast<Bytecode::Op::Throw const&>(instruction));
+        return;
+        COMPILE_INT32_BINARY_OP(Add, Add)
+        COMPILE_INT32_BINARY_OP(Sub, Sub)
+        COMPILE_INT32_BINARY_OP(Mul, Mul)
+        COMPILE_INT32_BINARY_OP(BitwiseAnd, BitwiseAnd)
+        COMPILE_INT32_BINARY_OP(BitwiseOr, BitwiseOr)
+        COMPILE_INT32_BINARY_OP(BitwiseXor, BitwiseXor)
+        COMPILE_INT32_BINARY_OP(LessThan, LessThan)
+        COMPILE_INT32_BINARY_OP(LessThanEquals, LessThanEquals)
+        COMPILE_INT32_BINARY_OP(GreaterThan, GreaterThan)
+        COMPILE_INT32_BINARY_OP(GreaterThanEquals, GreaterThanEquals)
+        COMPILE_INT32_BINARY_OP(StrictlyEquals, Equals)
+        COMPILE_INT32_BINARY_OP(LooselyEquals, Equals)
+        COMPILE_INT32_BINARY_OP(StrictlyInequals, Inequals)
+        COMPILE_INT32_BINARY_OP(LooselyInequals, Inequals)
+    default:
+        call_cxx_slow_path(instruction);
+        return;
+    }
+
+#undef COMPILE_INT32_BINARY_OP
+}
+
+void Compiler::load_register(Reg dst, Bytecode::Register reg)
+{
+    m_assembler.load64(dst, REGISTER_FILE, reg.index() * sizeof(Value));
+}
+
+void Compiler::store_register(Bytecode::Register reg, Reg src)
+{
+    m_assembler.store64(REGISTER_FILE, reg.index() * sizeof(Value), src);
+}
+
+void Compiler::branch_if_not_int32(Reg value, Assembler::Label& not_int32)
+{
+    m_assembler.mov64(Reg::RCX, value);
+    m_assembler.shift_right64(Reg::RCX, TAG_SHIFT);
+    m_assembler.compare32(Reg::RCX, INT32_TAG);
+    m_assembler.jump_if(Assembler::Condition::NotEqualTo, not_int32);
+}
+
+// The value has to be zero-extended from 32 bits, which every 32-bit operation takes care of.
+void Compiler::box_and_store_accumulator(Reg value, u64 shifted_tag)
+{
+    m_assembler.mov64(Reg::RCX, shifted_tag);
+    m_assembler.or64(value, Reg::RCX);
+    store_register(Bytecode::Register::accumulator(), value);
+}
+
+void Compiler::call_cxx(void const* function)
+{
+    m_assembler.mov64(Reg::RAX, reinterpret_cast<FlatPtr>(function));
+    m_assembler.call(Reg::RAX);
+}
+
+void Compiler::call_cxx_slow_path(Bytecode::Instruction const& instruction)
+{
+    void const* function = nullptr;
+    switch (instruction.type()) {
+#define __BYTECODE_OP(op)                                                         \
+    case Bytecode::Instruction::Type::op:                                         \
+        function = reinterpret_cast<void const*>(&cxx_execute<Bytecode::Op::op>); \
+        break;
+        ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    }
+
+    m_assembler.mov64(Reg::RDI, INTERPRETER);
+    m_assembler.mov64(Reg::RSI, reinterpret_cast<FlatPtr>(&instruction));
+    m_assembler.mov64(Reg::RDX, EXCEPTION_SLOT);
+    call_cxx(function);
+    m_assembler.test32(Reg::RAX, Reg::RAX);
+    m_assembler.jump_if(Assembler::Condition::NotEqualTo, m_exit_with_exception);
+}
+
+Assembler::Label& Compiler::label_for(Bytecode::Label const& label)
+{
+    return m_block_labels[*m_block_indices.get(&label.block())];
+}
+
+void Compiler::compile_load(Bytecode::Op::Load const& instruction)
+{
+    load_register(Reg::RAX, instruction.src());
+    store_register(Bytecode::Register::accumulator(), Reg::RAX);
+}
+
+void Compiler::compile_load_immediate(Bytecode::Op::LoadImmediate const& instruction)
+{
+    m_assembler.mov64(Reg::RAX, instruction.value().encoded());
+    store_register(Bytecode::Register::accumulator(), Reg::RAX);
+}
+
+void Compiler::compile_store(Bytecode::Op::Store const& instruction)
+{
+    load_register(Reg::RAX, Bytecode::Register::accumulator());
+    store_register(instruction.dst(), Reg::RAX);
+}
+
+void Compiler::compile_jump(Bytecode::Op::Jump const& instruction)
+{
+    m_assembler.jump(label_for(*instruction.true_target()));
+}
+
+void Compiler::compile_jump_conditional(Bytecode::Op::JumpConditional const& instruction)
+{
+    auto& true_target = label_for(*instruction.true_target());
+    auto& false_target = label_for(*instruction.false_target());
+    Assembler::Label test_payload;
+    Assembler::Label slow_case;
+
+    // Booleans and int32s are truthy exactly when their payload is non-zero.
+    load_register(Reg::RAX, Bytecode::Register::accumulator());
+    m_assembler.mov64(Reg::RCX, Reg::RAX);
+    m_assembler.shift_right64(Reg::RCX, TAG_SHIFT);
+    m_assembler.compare32(Reg::RCX, BOOLEAN_TAG);
+    m_assembler.jump_if(Assembler::Condition::EqualTo, test_payload);
+    m_assembler.compare32(Reg::RCX, INT32_TAG);
+    m_assembler.jump_if(Assembler::Condition::NotEqualTo, slow_case);
+
+    test_payload.link(m_assembler);
+    m_assembler.test32(Reg::RAX, Reg::RAX);
+    m_assembler.jump_if(Assembler::Condition::NotEqualTo, true_target);
+    m_assembler.jump(false_target);
+
+    slow_case.link(m_assembler);
+    m_assembler.mov64(Reg::RDI, REGISTER_FILE);
+    call_cxx(reinterpret_cast<void const*>(&cxx_to_boolean));
+    m_assembler.test32(Reg::RAX, Reg::RAX);
+    m_assembler.jump_if(Assembler::Condition::NotEqualTo, true_target);
+    m_assembler.jump(false_target);
+}
+
+void Compiler::compile_jump_nullish(Bytecode::Op::JumpNullish const& instruction)
+{
+    load_register(Reg::RAX, Bytecode::Register::accumulator());
+    m_assembler.shift_right64(Reg::RAX, TAG_SHIFT);
+    m_assembler.and32(Reg::RAX, IS_NULLISH_EXTRACT_PATTERN);
+    m_assembler.compare32(Reg::RAX, IS_NULLISH_PATTERN);
+    m_assembler.jump_if(Assembler::Condition::EqualTo, label_for(*instruction.true_target()));
+    m_assembler.jump(label_for(*instruction.false_target()));
+}
+
+void Compiler::compile_jump_undefined(Bytecode::Op::JumpUndefined const& instruction)
+{
+    load_register(Reg::RAX, Bytecode::Register::accumulator());
+    m_assembler.shift_right64(Reg::RAX, TAG_SHIFT);
+    m_assembler.compare32(Reg::RAX, UNDEFINED_TAG);
+    m_assembler.jump_if(Assembler::Condition::EqualTo, label_for(*instruction.true_target()));
+    m_assembler.jump(label_for(*instruction.false_target()));
+}
+
+void Compiler::compile_compare_and_jump(Bytecode::Op::CompareAndJump const& instruction)
+{
+    using Comparison = Bytecode::Op::CompareAndJump::Comparison;
+    using Condition = Assembler::Condition;
+
+    auto& true_target = label_for(*instruction.true_target());
+    auto& false_target = label_for(*instruction.false_target());
+    Assembler::Label slow_case;
+    Assembler::Label test_result;
+
+    auto condition = [&] {
+        switch (instruction.comparison()) {
+        case Comparison::LessThan:
+            return Condition::SignedLessThan;
+        case Comparison::LessThanEquals:
+            return Condition::SignedLessThanOrEqualTo;
+        case Comparison::GreaterThan:
+            return Condition::SignedGreaterThan;
+        case Comparison::GreaterThanEquals:
+            return Condition::SignedGreaterThanOrEqualTo;
+        case Comparison::StrictlyEquals:
+        case Comparison::LooselyEquals:
+            return Condition::EqualTo;
+        case Comparison::StrictlyInequals:
+        case Comparison::LooselyInequals:
+            return Condition::NotEqualTo;
+        }
+        VERIFY_NOT_REACHED();
+    }();
+
+    load_register(Reg::RAX, instruction.lhs());
+    load_register(Reg::RDX, Bytecode::Register::accumulator());
+    branch_if_not_int32(Reg::RAX, slow_case);
+    branch_if_not_int32(Reg::RDX, slow_case);
+    m_assembler.alu32(Assembler::ALU32Operation::Compare, Reg::RAX, Reg::RDX);
+    m_assembler.set_if(condition, Reg::RAX);
+    box_and_store_accumulator(Reg::RAX, SHIFTED_BOOLEAN_TAG);
+    m_assembler.jump(test_result);
+
+    slow_case.link(m_assembler);
+    m_assembler.mov64(Reg::RDI, INTERPRETER);
+    m_assembler.mov64(Reg::RSI, reinterpret_cast<FlatPtr>(&instruction));
+    m_assembler.mov64(Reg::RDX, EXCEPTION_SLOT);
+    call_cxx(reinterpret_cast<void const*>(&cxx_compare));
+    m_assembler.test32(Reg::RAX, Reg::RAX);
+    m_assembler.jump_if(Condition::NotEqualTo, m_exit_with_exception);
+    load_register(Reg::RAX, Bytecode::Register::accumulator());
+
+    // Either way, the accumulator now holds a boolean, which is true exactly when its payload is non-zero.
+    test_result.link(m_assembler);
+    m_assembler.test32(Reg::RAX, Reg::RAX);
+    m_assembler.jump_if(Condition::NotEqualTo, true_target);
+    m_assembler.jump(false_target);
+}
+
+template<typename OpType>
+void Compiler::compile_int32_binary_op(Bytecode::Instruction const& instruction, Int32Operation operation)
+{
+    using ALU32Operation = Assembler::ALU32Operation;
+    using Condition = Assembler::Condition;
+
+    Assembler::Label slow_case;
+    Assembler::Label done;
+
+    load_register(Reg::RAX, static_cast<OpType const&>(instruction).lhs());
+    load_register(Reg::RDX, Bytecode::Register::accumulator());
+    branch_if_not_int32(Reg::RAX, slow_case);
+    branch_if_not_int32(Reg::RDX, slow_case);
+
+    auto compare = [&](Condition condition) {
+        m_assembler.alu32(ALU32Operation::Compare, Reg::RAX, Reg::RDX);
+        m_assembler.set_if(condition, Reg::RAX);
+        box_and_store_accumulator(Reg::RAX, SHIFTED_BOOLEAN_TAG);
+    };
+
+    switch (operation) {
+    case Int32Operation::Add:
+        m_assembler.alu32(ALU32Operation::Add, Reg::RAX, Reg::RDX);
+        m_assembler.jump_if(Condition::Overflow, slow_case);
+        box_and_store_accumulator(Reg::RAX, SHIFTED_INT32_TAG);
+        break;
+    case Int32Operation::Sub:
+        m_assembler.alu32(ALU32Operation::Sub, Reg::RAX, Reg::RDX);
+        m_assembler.jump_if(Condition::Overflow, slow_case);
+        box_and_store_accumulator(Reg::RAX, SHIFTED_INT32_TAG);
+        break;
+    case Int32Operation::Mul:
+        m_assembler.multiply32(Reg::RAX, Reg::RDX);
+        m_assembler.jump_if(Condition::Overflow, slow_case);
+        // A zero product might have to be -0, which isn't an int32.
+        m_assembler.test32(Reg::RAX, Reg::RAX);
+        m_assembler.jump_if(Condition::EqualTo, slow_case);
+        box_and_store_accumulator(Reg::RAX, SHIFTED_INT32_TAG);
+        break;
+    case Int32Operation::BitwiseAnd:
+        m_assembler.alu32(ALU32Operation::And, Reg::RAX, Reg::RDX);
+        box_and_store_accumulator(Reg::RAX, SHIFTED_INT32_TAG);
+        break;
+    case Int32Operation::BitwiseOr:
+        m_assembler.alu32(ALU32Operation::Or, Reg::RAX, Reg::RDX);
+        box_and_store_accumulator(Reg::RAX, SHIFTED_INT32_TAG);
+        break;
+    case Int32Operation::BitwiseXor:
+        m_assembler.alu32(ALU32Operation::Xor, Reg::RAX, Reg::RDX);
+        box_and_store_accumulator(Reg::RAX, SHIFTED_INT32_TAG);
+        break;
+    case Int32Operation::LessThan:
+        compare(Condition::SignedLessThan);
+        break;
+    case Int32Operation::LessThanEquals:
+        compare(Condition::SignedLessThanOrEqualTo);
+        break;
+    case Int32Operation::GreaterThan:
+        compare(Condition::SignedGreaterThan);
+        break;
+    case Int32Operation::GreaterThanEquals:
+        compare(Condition::SignedGreaterThanOrEqualTo);
+        break;
+    case Int32Operation::Equals:
+        compare(Condition::EqualTo);
+        break;
+    case Int32Operation::Inequals:
+        compare(Condition::NotEqualTo);
+        break;
+    }
+    m_assembler.jump(done);
+
+    slow_case.link(m_assembler);
+    call_cxx_slow_path(instruction);
+    done.link(m_assembler);
+}
+
+void Compiler::compile_increment(Bytecode::Op::Increment const& instruction)
+{
+    Assembler::Label slow_case;
+    Assembler::Label done;
+
+    load_register(Reg::RAX, Bytecode::Register::accumulator());
+    branch_if_not_int32(Reg::RAX, slow_case);
+    m_assembler.add32(Reg::RAX, 1);
+    m_assembler.jump_if(Assembler::Condition::Overflow, slow_case);
+    box_and_store_accumulator(Reg::RAX, SHIFTED_INT32_TAG);
+    m_assembler.jump(done);
+
+    slow_case.link(m_assembler);
+    call_cxx_slow_path(instruction);
+    done.link(m_assembler);
+}
+
+void Compiler::compile_decrement(Bytecode::Op::Decrement const& instruction)
+{
+    Assembler::Label slow_case;
+    Assembler::Label done;
+
+    load_register(Reg::RAX, Bytecode::Register::accumulator());
+    branch_if_not_int32(Reg::RAX, slow_case);
+    m_assembler.sub32(Reg::RAX, 1);
+    m_assembler.jump_if(Assembler::Condition::Overflow, slow_case);
+    box_and_store_accumulator(Reg::RAX, SHIFTED_INT32_TAG);
+    m_assembler.jump(done);
+
+    slow_case.link(m_assembler);
+    call_cxx_slow_path(instruction);
+    done.link(m_assembler);
+}
+
+void Compiler::compile_return(Bytecode::Op::Return const& instruction)
+{
+    call_cxx_slow_path(instruction);
+    m_assembler.jump(m_exit);
+}
+
+void Compiler::compile_throw(Bytecode::Op::Throw const& instruction)
+{
+    call_cxx_slow_path(instruction);
+    m_assembler.jump(m_exit_with_exception);
+}
+
+}
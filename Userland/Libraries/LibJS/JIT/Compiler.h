@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/OwnPtr.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/JIT/Assembler.h>
+#include <LibJS/JIT/NativeExecutable.h>
+
+namespace JS::JIT {
+
+// A baseline compiler from bytecode to x86-64 machine code. Loads, stores, jumps and arithmetic on int32 values are
+// emitted inline, everything else (and the slow paths of the former) calls into the same code the interpreter runs.
+class Compiler {
+public:
+    // Returns null if the executable uses something the JIT can't handle, or if this platform isn't supported.
+    static OwnPtr<NativeExecutable> compile(Bytecode::Executable const&);
+
+private:
+    explicit Compiler(Bytecode::Executable const&);
+
+    bool can_compile() const;
+    OwnPtr<NativeExecutable> compile_executable();
+
+    void compile_prologue();
+    void compile_epilogue();
+    void compile_instruction(Bytecode::Instruction const&);
+
+    void compile_load(Bytecode::Op::Load const&);
+    void compile_load_immediate(Bytecode::Op::LoadImmediate const&);
+    void compile_store(Bytecode::Op::Store const&);
+    void compile_jump(Bytecode::Op::Jump const&);
+    void compile_jump_conditional(Bytecode::Op::JumpConditional const&);
+    void compile_jump_nullish(Bytecode::Op::JumpNullish const&);
+    void compile_jump_undefined(Bytecode::Op::JumpUndefined const&);
+    void compile_compare_and_jump(Bytecode::Op::CompareAndJump const&);
+    void compile_increment(Bytecode::Op::Increment const&);
+    void compile_decrement(Bytecode::Op::Decrement const&);
+    void compile_return(Bytecode::Op::Return const&);
+    void compile_throw(Bytecode::Op::Throw const&);
+
+    enum class Int32Operation {
+        Add,
+        Sub,
+        Mul,
+        BitwiseAnd,
+        BitwiseOr,
+        BitwiseXor,
+        LessThan,
+        LessThanEquals,
+        GreaterThan,
+        GreaterThanEquals,
+        Equals,
+        Inequals,
+    };
+    template<typename OpType>
+    void compile_int32_binary_op(Bytecode::Instruction const&, Int32Operation);
+
+    void load_register(Assembler::Reg dst, Bytecode::Register);
+    void store_register(Bytecode::Register, Assembler::Reg src);
+    void branch_if_not_int32(Assembler::Reg value, Assembler::Label& not_int32);
+    void box_and_store_accumulator(Assembler::Reg value, u64 shifted_tag);
+    void call_cxx_slow_path(Bytecode::Instruction const&);
+    void call_cxx(void const* function);
+    Assembler::Label& label_for(Bytecode::Label const&);
+
+    Bytecode::Executable const& m_bytecode_executable;
+    Vector<u8> m_output;
+    Assembler m_assembler;
+
+    Vector<Assembler::Label> m_block_labels;
+    HashMap<Bytecode::BasicBlock const*, size_t> m_block_indices;
+    Assembler::Label m_exit;
+    Assembler::Label m_exit_with_exception;
+};
+
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/JIT/NativeExecutable.h>
+#include <sys/mman.h>
+
+namespace JS::JIT {
+
+ErrorOr<NonnullOwnPtr<NativeExecutable>> NativeExecutable::create(ReadonlyBytes code, HashMap<Bytecode::BasicBlock const*, size_t> block_offsets)
+{
+    auto* memory = mmap(nullptr, code.size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED)
+        return AK::Error::from_syscall("mmap"sv, -errno);
+    code.copy_to({ static_cast<u8*>(memory), code.size() });
+
+    // The code is never written to again after this, so the memory doesn't have to be writable and executable at once.
+    if (mprotect(memory, code.size(), PROT_READ | PROT_EXEC) < 0) {
+        auto error = AK::Error::from_syscall("mprotect"sv, -errno);
+        munmap(memory, code.size());
+        return error;
+    }
+
+    return adopt_nonnull_own_or_enomem(new (nothrow) NativeExecutable(memory, code.size(), move(block_offsets)));
+}
+
+NativeExecutable::NativeExecutable(void* code, size_t size, HashMap<Bytecode::BasicBlock const*, size_t> block_offsets)
+    : m_code(code)
+    , m_size(size)
+    , m_block_offsets(move(block_offsets))
+{
+}
+
+NativeExecutable::~NativeExecutable()
+{
+    munmap(m_code, m_size);
+}
+
+ThrowCompletionOr<void> NativeExecutable::run(Bytecode::Interpreter& interpreter, Value* registers, Bytecode::BasicBlock const& entry_block) const
+{
+    using EntryPoint = u64 (*)(Bytecode::Interpreter*, Value* registers, Value* exception, void const* block_entry);
+    auto entry_point = reinterpret_cast<EntryPoint>(m_code);
+    auto block_offset = m_block_offsets.get(&entry_block);
+    VERIFY(block_offset.has_value());
+
+    Value exception;
+    if (entry_point(&interpreter, registers, &exception, static_cast<u8 const*>(m_code) + *block_offset))
+        return throw_completion(exception);
+    return {};
+}
+
+}
@@ -868,6 +868,15 @@ Token Lexer::next()
     return m_current_token;
 }
 
+void Lexer::skip_to(size_t offset, size_t line_number, size_t line_column)
+{
+    VERIFY(offset < m_source.length());
+    m_position = offset + 1;
+    m_current_char = m_source[offset];
+    m_line_number = line_number;
+    m_line_column = line_column;
+}
+
 Token Lexer::force_slash_as_regex()
 {
     VERIFY(m_current_token.type() == TokenType::Slash || m_current_token.type() == TokenType::SlashEquals);
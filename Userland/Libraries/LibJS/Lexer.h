@@ -28,6 +28,9 @@ public:
 
     Token force_slash_as_regex();
 
+    // Continues lexing at the given offset into the source, which has to be the start of a token.
+    void skip_to(size_t offset, size_t line_number, size_t line_column);
+
 private:
     void consume();
     bool consume_exponent();
@@ -16,6 +16,7 @@
 #include <AK/ScopeGuard.h>
 #include <AK/StdLibExtras.h>
 #include <AK/TemporaryChange.h>
+#include <LibJS/PreParser.h>
 #include <LibJS/Runtime/RegExpObject.h>
 #include <LibRegex/Regex.h>
 
@@ -428,6 +429,19 @@ Parser::Parser(Lexer lexer, Program::Type program_type, Optional<EvalInitialStat
     }
 }
 
+Parser::Parser(Lexer lexer, NonnullRefPtr<SourceCode const> source_code, size_t source_offset, Program::Type program_type)
+    : m_source_code(move(source_code))
+    , m_source_offset(source_offset)
+    , m_state(move(lexer), program_type)
+    , m_program_type(program_type)
+{
+}
+
+int Parser::operator_precedence(TokenType type)
+{
+    return g_operator_precedence.get(type);
+}
+
 Associativity Parser::operator_associativity(TokenType type) const
 {
     switch (type) {
@@ -875,9 +889,8 @@ RefPtr<FunctionExpression const> Parser::try_parse_arrow_function_expression(boo
 
     auto function_start_offset = rule_start.position().offset;
     auto function_end_offset = position().offset - m_state.current_token.trivia().length();
-    auto source_text = DeprecatedString { m_state.lexer.source().substring_view(function_start_offset, function_end_offset - function_start_offset) };
     return create_ast_node<FunctionExpression>(
-        { m_source_code, rule_start.position(), position() }, "", move(source_text),
+        { m_source_code, rule_start.position(), position() }, "", function_start_offset, function_end_offset,
         move(body), move(parameters), function_length, function_kind, body->in_strict_mode(),
         /* might_need_arguments_object */ false, contains_direct_call_to_eval, /* is_arrow_function */ true);
 }
@@ -1364,12 +1377,12 @@ NonnullRefPtr<ClassExpression const> Parser::parse_class_expression(bool expect_
             constructor_body->append(create_ast_node<ReturnStatement>({ m_source_code, rule_start.position(), position() }, move(super_call)));
 
             constructor = create_ast_node<FunctionExpression>(
-                { m_source_code, rule_start.position(), position() }, class_name, "",
+                { m_source_code, rule_start.position(), position() }, class_name, 0, 0,
                 move(constructor_body), Vector { FunctionParameter { move(argument_name), nullptr, true } }, 0, FunctionKind::Normal,
                 /* is_strict_mode */ true, /* might_need_arguments_object */ false, /* contains_direct_call_to_eval */ false);
         } else {
             constructor = create_ast_node<FunctionExpression>(
-                { m_source_code, rule_start.position(), position() }, class_name, "",
+                { m_source_code, rule_start.position(), position() }, class_name, 0, 0,
                 move(constructor_body), Vector<FunctionParameter> {}, 0, FunctionKind::Normal,
                 /* is_strict_mode */ true, /* might_need_arguments_object */ false, /* contains_direct_call_to_eval */ false);
         }
@@ -1387,9 +1400,8 @@ NonnullRefPtr<ClassExpression const> Parser::parse_class_expression(bool expect_
 
     auto function_start_offset = rule_start.position().offset;
     auto function_end_offset = position().offset - m_state.current_token.trivia().length();
-    auto source_text = DeprecatedString { m_state.lexer.source().substring_view(function_start_offset, function_end_offset - function_start_offset) };
 
-    return create_ast_node<ClassExpression>({ m_source_code, rule_start.position(), position() }, move(class_name), move(source_text), move(constructor), move(super_class), move(elements));
+    return create_ast_node<ClassExpression>({ m_source_code, rule_start.position(), position() }, move(class_name), function_start_offset, function_end_offset, move(constructor), move(super_class), move(elements));
 }
 
 Parser::PrimaryExpressionParseResult Parser::parse_primary_expression()
@@ -1417,6 +1429,7 @@ Parser::PrimaryExpressionParseResult Parser::parse_primary_expression()
             if (auto arrow_function_result = try_arrow_function_parse_or_fail(paren_position, true))
                 return { arrow_function_result.release_nonnull(), false };
         }
+        m_state.next_function_is_parenthesized = match(TokenType::Function);
         auto expression = parse_expression(0);
         consume(TokenType::ParenClose);
         if (is<FunctionExpression>(*expression)) {
@@ -1908,6 +1921,9 @@ NonnullRefPtr<TemplateLiteral const> Parser::parse_template_literal(bool is_tagg
     auto rule_start = push_start();
     consume(TokenType::TemplateLiteralStart);
 
+    if (is_tagged)
+        m_has_parsed_tagged_template_literals = true;
+
     Vector<NonnullRefPtr<Expression const>> expressions;
     Vector<NonnullRefPtr<Expression const>> raw_strings;
 
@@ -2261,7 +2277,7 @@ RefPtr<BindingPattern const> Parser::synthesize_binding_pattern(Expression const
     // This means that `source` will contain the subsequent token's trivia, if any (which is fine).
     auto source_start_offset = expression.source_range().start.offset;
     auto source_end_offset = expression.source_range().end.offset;
-    auto source = m_state.lexer.source().substring_view(source_start_offset, source_end_offset - source_start_offset);
+    auto source = m_state.lexer.source().substring_view(source_start_offset - m_source_offset, source_end_offset - source_start_offset);
     Lexer lexer { source, m_state.lexer.filename(), expression.source_range().start.line, expression.source_range().start.column };
     Parser parser { lexer };
 
@@ -2586,6 +2602,11 @@ NonnullRefPtr<FunctionNodeType> Parser::parse_function_node(u16 parse_options, O
         : push_start();
     VERIFY(!(parse_options & FunctionNodeParseOptions::IsGetterFunction && parse_options & FunctionNodeParseOptions::IsSetterFunction));
 
+    // Most inner functions of a large script are never called, so we only keep their body's AST once they are.
+    // Parenthesized functions are usually called right away, so they would only end up being parsed twice.
+    auto is_parenthesized = exchange(m_state.next_function_is_parenthesized, false);
+    auto should_parse_body_lazily = m_state.current_scope_pusher != nullptr && !is_parenthesized;
+
     TemporaryChange super_property_access_rollback(m_state.allow_super_property_lookup, !!(parse_options & FunctionNodeParseOptions::AllowSuperPropertyLookup));
     TemporaryChange super_constructor_call_rollback(m_state.allow_super_constructor_call, !!(parse_options & FunctionNodeParseOptions::AllowSuperConstructorCall));
     TemporaryChange break_context_rollback(m_state.in_break_context, false);
@@ -2651,26 +2672,117 @@ NonnullRefPtr<FunctionNodeType> Parser::parse_function_node(u16 parse_options, O
         m_state.labels_in_scope = move(old_labels_in_scope);
     });
 
-    consume(TokenType::CurlyOpen);
+    LazyFunctionBody::ParserState lazy_body_parser_state {
+        .strict_mode = m_state.strict_mode,
+        .allow_super_property_lookup = m_state.allow_super_property_lookup,
+        .allow_super_constructor_call = m_state.allow_super_constructor_call,
+        .in_eval_function_context = m_state.in_eval_function_context,
+        .in_formal_parameter_context = m_state.in_formal_parameter_context,
+        .in_arrow_function_context = m_state.in_arrow_function_context,
+        .string_legacy_octal_escape_sequence_in_scope = m_state.string_legacy_octal_escape_sequence_in_scope,
+    };
+    auto body_start = position();
+
+    // NOTE: Bodies are only looked up and recorded outside of speculative parsing, so a parse of the same source text
+    //       takes the same path through it every time.
+    auto can_use_preparse_data = should_parse_body_lazily && m_preparse_data && m_saved_state.is_empty();
+    Optional<PreParseData::FunctionBody> known_body;
+    if (can_use_preparse_data && !has_errors())
+        known_body = m_preparse_data->function_bodies.get(body_start.offset);
+
+    bool was_preparsed = false;
     bool contains_direct_call_to_eval = false;
-    auto body = parse_function_body(parameters, function_kind, contains_direct_call_to_eval);
+    RefPtr<FunctionBody const> body;
+    if (known_body.has_value()) {
+        // The opening curly brace has already been lexed, and the lexer continues right at the closing one.
+        m_state.lexer.skip_to(known_body->end.offset - m_source_offset, known_body->end.line, known_body->end.column);
+        m_state.current_token = m_state.lexer.next();
+        m_state.function_might_need_arguments_object = known_body->might_need_arguments_object;
+        m_state.string_legacy_octal_escape_sequence_in_scope = false;
+        contains_direct_call_to_eval = known_body->contains_direct_call_to_eval;
+        was_preparsed = true;
+    } else {
+        consume(TokenType::CurlyOpen);
+
+        // Any early errors in the body have to be reported now, so it is at least pre-parsed, or parsed in full if
+        // the pre-parser doesn't understand it.
+        was_preparsed = should_parse_body_lazily && !has_errors() && PreParser { *this }.preparse_function_body(parameters, function_kind);
+        if (!was_preparsed)
+            body = parse_function_body(parameters, function_kind, contains_direct_call_to_eval);
+    }
+    auto body_end = position();
     consume(TokenType::CurlyClose);
 
-    auto has_strict_directive = body->in_strict_mode();
+    // NOTE: The pre-parser gives up on directive prologues, so a pre-parsed body is only strict if its function is.
+    bool has_strict_directive;
+    if (known_body.has_value())
+        has_strict_directive = known_body->is_strict_mode;
+    else
+        has_strict_directive = body ? body->in_strict_mode() : m_state.strict_mode;
 
     if (has_strict_directive)
         check_identifier_name_for_assignment_validity(name, true);
 
+    RefPtr<Statement const> function_body = body;
+    if (was_preparsed || (should_parse_body_lazily && !has_errors())) {
+        if (can_use_preparse_data && !known_body.has_value() && !has_errors()) {
+            m_preparse_data->function_bodies.set(body_start.offset, {
+                                                                        .end = body_end,
+                                                                        .is_strict_mode = has_strict_directive,
+                                                                        .might_need_arguments_object = m_state.function_might_need_arguments_object,
+                                                                        .contains_direct_call_to_eval = contains_direct_call_to_eval,
+                                                                    });
+        }
+        body_end.offset += 1;
+        function_body = create_ast_node<LazyFunctionBody>(
+            { m_source_code, body_start, body_end },
+            m_program_type, parameters, function_kind, lazy_body_parser_state);
+    }
+
     auto function_start_offset = rule_start.position().offset;
     auto function_end_offset = position().offset - m_state.current_token.trivia().length();
-    auto source_text = DeprecatedString { m_state.lexer.source().substring_view(function_start_offset, function_end_offset - function_start_offset) };
     return create_ast_node<FunctionNodeType>(
         { m_source_code, rule_start.position(), position() },
-        name, move(source_text), move(body), move(parameters), function_length,
+        name, function_start_offset, function_end_offset, function_body.release_nonnull(), move(parameters), function_length,
         function_kind, has_strict_directive, m_state.function_might_need_arguments_object,
         contains_direct_call_to_eval);
 }
 
+NonnullRefPtr<FunctionBody const> Parser::parse_lazy_function_body(LazyFunctionBody const& lazy_body)
+{
+    auto& source_code = lazy_body.source_code();
+    auto source_range = lazy_body.source_range();
+    auto source = source_code.code().bytes_as_string_view().substring_view(lazy_body.start_offset(), lazy_body.end_offset() - lazy_body.start_offset());
+    Lexer lexer { source, source_code.filename(), source_range.start.line, source_range.start.column - 1 };
+    Parser parser { move(lexer), source_code, lazy_body.start_offset(), lazy_body.program_type() };
+
+    auto const& state = lazy_body.parser_state();
+    parser.m_state.strict_mode = state.strict_mode;
+    parser.m_state.allow_super_property_lookup = state.allow_super_property_lookup;
+    parser.m_state.allow_super_constructor_call = state.allow_super_constructor_call;
+    parser.m_state.in_function_context = true;
+    parser.m_state.in_eval_function_context = state.in_eval_function_context;
+    parser.m_state.in_formal_parameter_context = state.in_formal_parameter_context;
+    parser.m_state.in_generator_function_context = lazy_body.kind() == FunctionKind::Generator || lazy_body.kind() == FunctionKind::AsyncGenerator;
+    parser.m_state.await_expression_is_valid = lazy_body.kind() == FunctionKind::Async || lazy_body.kind() == FunctionKind::AsyncGenerator;
+    parser.m_state.in_arrow_function_context = state.in_arrow_function_context;
+    parser.m_state.string_legacy_octal_escape_sequence_in_scope = state.string_legacy_octal_escape_sequence_in_scope;
+
+    // Private names used in the body were already checked against the enclosing classes.
+    HashTable<StringView> referenced_private_names;
+    parser.m_state.referenced_private_names = &referenced_private_names;
+
+    parser.consume(TokenType::CurlyOpen);
+    bool contains_direct_call_to_eval = false;
+    auto body = parser.parse_function_body(lazy_body.parameters(), lazy_body.kind(), contains_direct_call_to_eval);
+    parser.consume(TokenType::CurlyClose);
+
+    // The body parsed without errors the first time around, and we're parsing it again in the same state.
+    VERIFY(!parser.has_errors());
+    VERIFY(parser.match(TokenType::Eof));
+    return body;
+}
+
 Vector<FunctionParameter> Parser::parse_formal_parameters(int& function_length, u16 parse_options)
 {
     auto rule_start = push_start();
@@ -4173,7 +4285,7 @@ Position Parser::position() const
     return {
         m_state.current_token.line_number(),
         m_state.current_token.line_column(),
-        m_state.current_token.offset(),
+        m_source_offset + m_state.current_token.offset(),
     };
 }
 
@@ -57,6 +57,8 @@ public:
 
     NonnullRefPtr<Program> parse_program(bool starts_in_strict_mode = false);
 
+    static NonnullRefPtr<FunctionBody const> parse_lazy_function_body(LazyFunctionBody const&);
+
     template<typename FunctionNodeType>
     NonnullRefPtr<FunctionNodeType> parse_function_node(u16 parse_options = FunctionNodeParseOptions::CheckForFunctionAndName, Optional<Position> const& function_start = {});
     Vector<FunctionParameter> parse_formal_parameters(int& function_length, u16 parse_options = 0);
@@ -191,6 +193,12 @@ public:
     Vector<CallExpression::Argument> parse_arguments();
 
     bool has_errors() const { return m_state.errors.size(); }
+
+    // Lazily parsed function bodies that are in here are skipped over, and those that aren't are added to it.
+    void set_preparse_data(PreParseData& preparse_data) { m_preparse_data = &preparse_data; }
+
+    // Tagged templates cache their template objects on the parse node, so the AST holds on to values from the heap.
+    bool has_parsed_tagged_template_literals() const { return m_has_parsed_tagged_template_literals; }
     Vector<ParserError> const& errors() const { return m_state.errors; }
     void print_errors(bool print_hint = true) const
     {
@@ -213,10 +221,14 @@ public:
 
 private:
     friend class ScopePusher;
+    friend class PreParser;
+
+    Parser(Lexer lexer, NonnullRefPtr<SourceCode const> source_code, size_t source_offset, Program::Type program_type);
 
     void parse_script(Program& program, bool starts_in_strict_mode);
     void parse_module(Program& program);
 
+    static int operator_precedence(TokenType);
     Associativity operator_associativity(TokenType) const;
     bool match_expression() const;
     bool match_unary_prefixed_expression() const;
@@ -325,6 +337,7 @@ private:
         bool in_class_field_initializer { false };
         bool in_class_static_init_block { false };
         bool function_might_need_arguments_object { false };
+        bool next_function_is_parenthesized { false };
 
         ParserState(Lexer, Program::Type);
     };
@@ -343,11 +356,18 @@ private:
     };
 
     NonnullRefPtr<SourceCode const> m_source_code;
+    // Where the lexer's source starts in m_source_code, when parsing a lazy function body.
+    size_t m_source_offset { 0 };
     Vector<Position> m_rule_starts;
     ParserState m_state;
     DeprecatedFlyString m_filename;
     Vector<ParserState> m_saved_state;
     HashMap<Position, TokenMemoization, PositionKeyTraits> m_token_memoizations;
     Program::Type m_program_type;
+
+    // NOTE: This is not part of the parser state, since it only has to be conservative when backtracking.
+    bool m_has_parsed_tagged_template_literals { false };
+
+    PreParseData* m_preparse_data { nullptr };
 };
 }
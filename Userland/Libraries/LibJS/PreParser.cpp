@@ -0,0 +1,1226 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <AK/Endian.h>
+#include <AK/MemoryStream.h>
+#include <AK/ScopeGuard.h>
+#include <AK/TemporaryChange.h>
+#include <LibJS/PreParser.h>
+
+namespace JS {
+
+static constexpr u32 preparse_data_magic = 0x4450534a; // "JSPD"
+static constexpr u32 preparse_data_version = 1;
+
+enum PreParseDataFlags : u8 {
+    IsStrictMode = 1 << 0,
+    MightNeedArgumentsObject = 1 << 1,
+    ContainsDirectCallToEval = 1 << 2,
+};
+
+ErrorOr<ByteBuffer> PreParseData::serialize() const
+{
+    AllocatingMemoryStream stream;
+    TRY(stream.write_value<LittleEndian<u32>>(preparse_data_magic));
+    TRY(stream.write_value<LittleEndian<u32>>(preparse_data_version));
+    TRY(stream.write_value<LittleEndian<u32>>(function_bodies.size()));
+
+    for (auto const& [start_offset, function_body] : function_bodies) {
+        TRY(stream.write_value<LittleEndian<u32>>(start_offset));
+        TRY(stream.write_value<LittleEndian<u32>>(function_body.end.offset));
+        TRY(stream.write_value<LittleEndian<u32>>(function_body.end.line));
+        TRY(stream.write_value<LittleEndian<u32>>(function_body.end.column));
+
+        u8 flags = 0;
+        if (function_body.is_strict_mode)
+            flags |= PreParseDataFlags::IsStrictMode;
+        if (function_body.might_need_arguments_object)
+            flags |= PreParseDataFlags::MightNeedArgumentsObject;
+        if (function_body.contains_direct_call_to_eval)
+            flags |= PreParseDataFlags::ContainsDirectCallToEval;
+        TRY(stream.write_value(flags));
+    }
+
+    return stream.read_until_eof();
+}
+
+ErrorOr<PreParseData> PreParseData::deserialize(ReadonlyBytes bytes, StringView source_text)
+{
+    FixedMemoryStream stream { bytes };
+    if (TRY(stream.read_value<LittleEndian<u32>>()) != preparse_data_magic)
+        return AK::Error::from_string_literal("Not pre-parse data");
+    if (TRY(stream.read_value<LittleEndian<u32>>()) != preparse_data_version)
+        return AK::Error::from_string_literal("Unsupported pre-parse data version");
+
+    PreParseData preparse_data;
+    auto function_body_count = TRY(stream.read_value<LittleEndian<u32>>());
+    for (u32 i = 0; i < function_body_count; ++i) {
+        size_t start_offset = TRY(stream.read_value<LittleEndian<u32>>());
+        FunctionBody function_body;
+        function_body.end.offset = TRY(stream.read_value<LittleEndian<u32>>());
+        function_body.end.line = TRY(stream.read_value<LittleEndian<u32>>());
+        function_body.end.column = TRY(stream.read_value<LittleEndian<u32>>());
+
+        auto flags = TRY(stream.read_value<u8>());
+        function_body.is_strict_mode = flags & PreParseDataFlags::IsStrictMode;
+        function_body.might_need_arguments_object = flags & PreParseDataFlags::MightNeedArgumentsObject;
+        function_body.contains_direct_call_to_eval = flags & PreParseDataFlags::ContainsDirectCallToEval;
+
+        if (start_offset >= function_body.end.offset || function_body.end.offset >= source_text.length()
+            || source_text[start_offset] != '{' || source_text[function_body.end.offset] != '}')
+            return AK::Error::from_string_literal("Function body doesn't match the source text");
+        preparse_data.function_bodies.set(start_offset, function_body);
+    }
+
+    if (!stream.is_eof())
+        return AK::Error::from_string_literal("Trailing data after pre-parse data");
+    return preparse_data;
+}
+
+// NOTE: This mirrors the parser function by function, down to which variant of consume() it uses for each token, as
+//       that decides whether a slash after it starts a regular expression, and whether the function might need an
+//       arguments object. Anything the parser would report an error for must make the pre-parser fail, and anything
+//       that would need information from the AST makes it fail as well, so the parser can have a go at it instead.
+bool PreParser::preparse_function_body(Vector<FunctionParameter> const& parameters, FunctionKind function_kind)
+{
+    // Generators and async functions come with too many rules of their own, and are rare enough in large scripts.
+    if (function_kind != FunctionKind::Normal)
+        return false;
+
+    push_scope(true);
+    for (auto& parameter : parameters) {
+        parameter.binding.visit(
+            [&](DeprecatedFlyString const& name) {
+                declare_parameter(name);
+            },
+            [&](NonnullRefPtr<BindingPattern const> const& binding_pattern) {
+                // NOTE: Nothing in the callback throws an exception.
+                MUST(binding_pattern->for_each_bound_name([&](auto const& name) {
+                    declare_parameter(name);
+                }));
+            });
+    }
+
+    // Duplicate parameters are only an error in strict mode, which parse_function_body() checks for.
+    if (m_failed && m_parser.m_state.strict_mode) {
+        pop_scope();
+        return false;
+    }
+    m_failed = false;
+
+    m_parser.save_state();
+    scan_function_body();
+    pop_scope();
+
+    if (failed() || !m_parser.match(TokenType::CurlyClose)) {
+        m_parser.load_state();
+        return false;
+    }
+
+    if constexpr (JS_PREPARSER_DEBUG) {
+        // Parse the body again in full, which must end in the same place without any errors.
+        auto end_offset = m_parser.position().offset;
+        auto might_need_arguments_object = m_parser.m_state.function_might_need_arguments_object;
+        m_parser.load_state();
+
+        bool contains_direct_call_to_eval = false;
+        (void)m_parser.parse_function_body(parameters, function_kind, contains_direct_call_to_eval);
+        VERIFY(!m_parser.has_errors());
+        VERIFY(m_parser.position().offset == end_offset);
+        VERIFY(might_need_arguments_object || !m_parser.m_state.function_might_need_arguments_object);
+        VERIFY(!contains_direct_call_to_eval);
+
+        m_parser.m_state.function_might_need_arguments_object = might_need_arguments_object;
+        return true;
+    }
+
+    m_parser.discard_saved_state();
+
+    // The parser clears this at the end of every directive prologue, and the body would have had one.
+    m_parser.m_state.string_legacy_octal_escape_sequence_in_scope = false;
+    return true;
+}
+
+void PreParser::scan_function_body()
+{
+    // A directive prologue could make the rest of the body strict.
+    if (m_parser.match(TokenType::StringLiteral)) {
+        fail();
+        return;
+    }
+
+    TemporaryChange<size_t> break_depth(m_break_depth, 0);
+    TemporaryChange<size_t> continue_depth(m_continue_depth, 0);
+    scan_statement_list();
+}
+
+void PreParser::scan_statement_list()
+{
+    while (!failed() && !m_parser.done() && !m_parser.match(TokenType::CurlyClose) && !m_parser.match(TokenType::Case) && !m_parser.match(TokenType::Default))
+        scan_statement_list_item();
+}
+
+void PreParser::scan_statement_list_item()
+{
+    auto const& token = m_parser.m_state.current_token;
+    switch (token.type()) {
+    case TokenType::Function:
+        scan_function_declaration();
+        return;
+    case TokenType::Let:
+    case TokenType::Const:
+        scan_variable_declaration();
+        return;
+    case TokenType::Class:
+    case TokenType::Async:
+        fail();
+        return;
+    case TokenType::Identifier:
+        if (token.original_value() == "using"sv) {
+            fail();
+            return;
+        }
+        break;
+    default:
+        break;
+    }
+    scan_statement();
+}
+
+void PreParser::scan_statement()
+{
+    switch (m_parser.m_state.current_token.type()) {
+    case TokenType::CurlyOpen:
+        scan_block_statement();
+        return;
+    case TokenType::Return:
+        scan_return_statement();
+        return;
+    case TokenType::Var:
+        scan_variable_declaration();
+        return;
+    case TokenType::For:
+        scan_for_statement();
+        return;
+    case TokenType::If:
+        scan_if_statement();
+        return;
+    case TokenType::Throw:
+        scan_throw_statement();
+        return;
+    case TokenType::Try:
+        scan_try_statement();
+        return;
+    case TokenType::Break:
+        scan_break_statement();
+        return;
+    case TokenType::Continue:
+        scan_continue_statement();
+        return;
+    case TokenType::Switch:
+        scan_switch_statement();
+        return;
+    case TokenType::Do:
+        scan_do_while_statement();
+        return;
+    case TokenType::While:
+        scan_while_statement();
+        return;
+    case TokenType::Debugger:
+        m_parser.consume();
+        m_parser.consume_or_insert_semicolon();
+        return;
+    case TokenType::Semicolon:
+        m_parser.consume();
+        return;
+    case TokenType::Slash:
+    case TokenType::SlashEquals:
+        m_parser.m_state.current_token = m_parser.m_state.lexer.force_slash_as_regex();
+        break;
+    default:
+        break;
+    }
+
+    // NOTE: A label ends up here as well, and fails when the colon after it doesn't end the expression statement.
+    if (!m_parser.match_expression() || m_parser.match(TokenType::Function) || m_parser.match(TokenType::Class) || m_parser.match(TokenType::Async) || m_parser.match(TokenType::Let)) {
+        fail();
+        return;
+    }
+    scan_expression(0);
+    m_parser.consume_or_insert_semicolon();
+}
+
+void PreParser::scan_block_statement(Optional<DeprecatedFlyString> const& catch_parameter)
+{
+    expect(TokenType::CurlyOpen);
+    push_scope(false);
+    if (catch_parameter.has_value())
+        m_scopes.last().forbidden_lexical_names.set(*catch_parameter);
+    scan_statement_list();
+    pop_scope();
+    expect(TokenType::CurlyClose);
+}
+
+void PreParser::scan_variable_declaration(bool is_for_loop_variable_declaration, size_t* declaration_count, size_t* initializer_count)
+{
+    auto declaration_kind = m_parser.match(TokenType::Var) ? DeclarationKind::Var : DeclarationKind::Lexical;
+    auto is_const = m_parser.match(TokenType::Const);
+    m_parser.consume();
+
+    size_t declarations = 0;
+    size_t initializers = 0;
+    while (!failed()) {
+        auto name = consume_binding_identifier();
+        if (!name.has_value())
+            return;
+
+        if (m_parser.match(TokenType::Equals)) {
+            m_parser.consume();
+            if (is_for_loop_variable_declaration)
+                scan_expression(2, Associativity::Right, { TokenType::In });
+            else
+                scan_expression(2);
+            ++initializers;
+        } else if (!is_for_loop_variable_declaration && is_const) {
+            fail();
+            return;
+        }
+
+        declare(*name, declaration_kind);
+        if (is_for_loop_variable_declaration && declaration_kind == DeclarationKind::Lexical)
+            m_scopes.last().forbidden_var_names.set(*name);
+        ++declarations;
+
+        if (!m_parser.match(TokenType::Comma))
+            break;
+        m_parser.consume();
+    }
+    if (!is_for_loop_variable_declaration)
+        m_parser.consume_or_insert_semicolon();
+
+    if (declaration_count)
+        *declaration_count = declarations;
+    if (initializer_count)
+        *initializer_count = initializers;
+}
+
+void PreParser::scan_function_declaration()
+{
+    m_parser.consume(TokenType::Function);
+    if (m_parser.match(TokenType::Asterisk)) {
+        fail();
+        return;
+    }
+
+    auto name = consume_binding_identifier();
+    if (!name.has_value())
+        return;
+
+    // Function declarations in blocks are treated as lexical ones, which is stricter than Annex B.
+    declare(*name, m_scopes.last().is_function_scope ? DeclarationKind::Var : DeclarationKind::Lexical);
+    scan_function();
+}
+
+void PreParser::scan_function(u16 parse_options)
+{
+    TemporaryChange might_need_arguments_object(m_parser.m_state.function_might_need_arguments_object, false);
+
+    push_scope(true);
+    expect(TokenType::ParenOpen);
+    scan_formal_parameters(parse_options);
+    expect(TokenType::ParenClose);
+    expect(TokenType::CurlyOpen);
+    scan_function_body();
+    expect(TokenType::CurlyClose);
+    pop_scope();
+}
+
+void PreParser::scan_formal_parameters(u16 parse_options)
+{
+    TemporaryChange formal_parameter_context(m_parser.m_state.in_formal_parameter_context, true);
+
+    size_t parameter_count = 0;
+    while (!failed() && (m_parser.match(TokenType::Identifier) || m_parser.match(TokenType::TripleDot))) {
+        if ((parse_options & FunctionNodeParseOptions::IsGetterFunction)
+            || ((parse_options & FunctionNodeParseOptions::IsSetterFunction) && (parameter_count >= 1 || m_parser.match(TokenType::TripleDot)))) {
+            fail();
+            return;
+        }
+
+        auto is_rest = false;
+        if (m_parser.match(TokenType::TripleDot)) {
+            m_parser.consume();
+            is_rest = true;
+        }
+
+        auto name = consume_binding_identifier();
+        if (!name.has_value())
+            return;
+        declare_parameter(*name);
+
+        if (m_parser.match(TokenType::Equals)) {
+            if (is_rest) {
+                fail();
+                return;
+            }
+            m_parser.consume();
+            TemporaryChange function_context(m_parser.m_state.in_function_context, true);
+            scan_expression(2);
+        }
+        ++parameter_count;
+
+        if (!m_parser.match(TokenType::Comma) || is_rest)
+            break;
+        m_parser.consume();
+    }
+
+    if ((parse_options & FunctionNodeParseOptions::IsSetterFunction) && parameter_count == 0)
+        fail();
+}
+
+void PreParser::scan_return_statement()
+{
+    m_parser.consume(TokenType::Return);
+
+    // Automatic semicolon insertion: terminate statement when return is followed by newline
+    if (m_parser.m_state.current_token.trivia_contains_line_terminator())
+        return;
+
+    if (m_parser.match_expression())
+        scan_expression(0);
+    m_parser.consume_or_insert_semicolon();
+}
+
+void PreParser::scan_if_statement()
+{
+    m_parser.consume(TokenType::If);
+    expect(TokenType::ParenOpen);
+    scan_expression(0);
+    expect(TokenType::ParenClose);
+
+    // NOTE: This fails on function declarations, so their Annex B treatment as blocks is left to the parser.
+    scan_statement();
+    if (m_parser.match(TokenType::Else)) {
+        m_parser.consume();
+        scan_statement();
+    }
+}
+
+void PreParser::scan_for_statement()
+{
+    m_parser.consume(TokenType::For);
+    if (m_parser.match(TokenType::Await)) {
+        fail();
+        return;
+    }
+    expect(TokenType::ParenOpen);
+
+    push_scope(false);
+    ScopeGuard scope_guard([&] {
+        pop_scope();
+    });
+
+    auto scan_body = [&] {
+        TemporaryChange break_depth(m_break_depth, m_break_depth + 1);
+        TemporaryChange continue_depth(m_continue_depth, m_continue_depth + 1);
+        scan_statement();
+    };
+
+    auto match_of = [&] {
+        return m_parser.match(TokenType::Identifier) && m_parser.m_state.current_token.original_value() == "of"sv;
+    };
+
+    if (!m_parser.match(TokenType::Semicolon)) {
+        if (m_parser.match(TokenType::Var) || m_parser.match(TokenType::Let) || m_parser.match(TokenType::Const)) {
+            auto is_const = m_parser.match(TokenType::Const);
+            size_t declaration_count = 0;
+            size_t initializer_count = 0;
+            scan_variable_declaration(true, &declaration_count, &initializer_count);
+            if (failed())
+                return;
+
+            if (m_parser.match(TokenType::In) || match_of()) {
+                // NOTE: This includes the Annex B initializers in for-in heads.
+                if (declaration_count != 1 || initializer_count != 0) {
+                    fail();
+                    return;
+                }
+
+                auto is_in = m_parser.consume().type() == TokenType::In;
+                scan_expression(is_in ? 0 : 2);
+                expect(TokenType::ParenClose);
+                scan_body();
+                return;
+            }
+
+            if (is_const && initializer_count != declaration_count) {
+                fail();
+                return;
+            }
+        } else if (m_parser.match_expression()) {
+            // Assignment targets in for-in and for-of heads are left to the parser.
+            scan_expression(0, Associativity::Right, { TokenType::In });
+            if (m_parser.match(TokenType::In) || match_of()) {
+                fail();
+                return;
+            }
+        } else {
+            fail();
+            return;
+        }
+    }
+    expect(TokenType::Semicolon);
+
+    if (!m_parser.match(TokenType::Semicolon))
+        scan_expression(0);
+    expect(TokenType::Semicolon);
+
+    if (!m_parser.match(TokenType::ParenClose))
+        scan_expression(0);
+    expect(TokenType::ParenClose);
+
+    scan_body();
+}
+
+void PreParser::scan_while_statement()
+{
+    m_parser.consume(TokenType::While);
+    expect(TokenType::ParenOpen);
+    scan_expression(0);
+    expect(TokenType::ParenClose);
+
+    TemporaryChange break_depth(m_break_depth, m_break_depth + 1);
+    TemporaryChange continue_depth(m_continue_depth, m_continue_depth + 1);
+    scan_statement();
+}
+
+void PreParser::scan_do_while_statement()
+{
+    m_parser.consume(TokenType::Do);
+    {
+        TemporaryChange break_depth(m_break_depth, m_break_depth + 1);
+        TemporaryChange continue_depth(m_continue_depth, m_continue_depth + 1);
+        scan_statement();
+    }
+
+    expect(TokenType::While);
+    expect(TokenType::ParenOpen);
+    scan_expression(0);
+    expect(TokenType::ParenClose);
+
+    // Since ES 2015 a missing semicolon is inserted here, despite the regular ASI rules not applying
+    if (m_parser.match(TokenType::Semicolon))
+        m_parser.consume();
+}
+
+void PreParser::scan_switch_statement()
+{
+    m_parser.consume(TokenType::Switch);
+    expect(TokenType::ParenOpen);
+    scan_expression(0);
+    expect(TokenType::ParenClose);
+    expect(TokenType::CurlyOpen);
+
+    push_scope(false);
+    TemporaryChange break_depth(m_break_depth, m_break_depth + 1);
+
+    auto has_default = false;
+    while (!failed() && (m_parser.match(TokenType::Case) || m_parser.match(TokenType::Default))) {
+        if (m_parser.match(TokenType::Default)) {
+            if (has_default) {
+                fail();
+                break;
+            }
+            has_default = true;
+        }
+
+        if (m_parser.consume().type() == TokenType::Case)
+            scan_expression(0);
+        expect(TokenType::Colon);
+        scan_statement_list();
+    }
+
+    pop_scope();
+    expect(TokenType::CurlyClose);
+}
+
+void PreParser::scan_try_statement()
+{
+    m_parser.consume(TokenType::Try);
+    scan_block_statement();
+
+    auto has_handler = false;
+    if (m_parser.match(TokenType::Catch)) {
+        m_parser.consume();
+        has_handler = true;
+
+        // NOTE: Binding patterns fail here, and are left to the parser.
+        Optional<DeprecatedFlyString> parameter;
+        if (m_parser.match(TokenType::ParenOpen)) {
+            m_parser.consume();
+            parameter = consume_binding_identifier();
+            if (!parameter.has_value())
+                return;
+            expect(TokenType::ParenClose);
+        }
+        scan_block_statement(parameter);
+    }
+
+    auto has_finalizer = false;
+    if (m_parser.match(TokenType::Finally)) {
+        m_parser.consume();
+        has_finalizer = true;
+        scan_block_statement();
+    }
+
+    if (!has_handler && !has_finalizer)
+        fail();
+}
+
+void PreParser::scan_throw_statement()
+{
+    m_parser.consume(TokenType::Throw);
+
+    if (m_parser.m_state.current_token.trivia_contains_line_terminator()) {
+        fail();
+        return;
+    }
+
+    scan_expression(0);
+    m_parser.consume_or_insert_semicolon();
+}
+
+void PreParser::scan_break_statement()
+{
+    m_parser.consume(TokenType::Break);
+    if (m_parser.match(TokenType::Semicolon)) {
+        m_parser.consume();
+    } else {
+        // NOTE: Labels are left to the parser.
+        if (!m_parser.m_state.current_token.trivia_contains_line_terminator() && m_parser.match_identifier()) {
+            fail();
+            return;
+        }
+        m_parser.consume_or_insert_semicolon();
+    }
+
+    if (m_break_depth == 0)
+        fail();
+}
+
+void PreParser::scan_continue_statement()
+{
+    if (m_continue_depth == 0) {
+        fail();
+        return;
+    }
+
+    m_parser.consume(TokenType::Continue);
+    if (m_parser.match(TokenType::Semicolon)) {
+        m_parser.consume();
+        return;
+    }
+    if (!m_parser.m_state.current_token.trivia_contains_line_terminator() && m_parser.match_identifier()) {
+        fail();
+        return;
+    }
+    m_parser.consume_or_insert_semicolon();
+}
+
+PreParser::Expression PreParser::scan_expression(int min_precedence, Associativity associativity, Parser::ForbiddenTokens forbidden)
+{
+    auto [expression, should_continue_parsing] = scan_primary_expression();
+
+    // NOTE: Tagged templates cache their template objects on the AST node, which the parser has to know about.
+    if (m_parser.match(TokenType::TemplateLiteralStart)) {
+        fail();
+        return expression;
+    }
+
+    if (should_continue_parsing) {
+        auto original_forbidden = forbidden;
+        while (!failed() && m_parser.match_secondary_expression(forbidden)) {
+            auto type = m_parser.m_state.current_token.type();
+            int new_precedence = Parser::operator_precedence(type);
+            if (new_precedence < min_precedence)
+                break;
+            if (new_precedence == min_precedence && associativity == Associativity::Left)
+                break;
+
+            Associativity new_associativity = m_parser.operator_associativity(type);
+            auto result = scan_secondary_expression(expression, new_precedence, new_associativity, original_forbidden);
+            expression = result.expression;
+            forbidden = forbidden.merge(result.forbidden);
+            if (m_parser.match(TokenType::TemplateLiteralStart)) {
+                fail();
+                return expression;
+            }
+        }
+    }
+
+    if (m_parser.match(TokenType::Comma) && min_precedence <= 1) {
+        while (!failed() && m_parser.match(TokenType::Comma)) {
+            m_parser.consume();
+            scan_expression(2);
+        }
+        expression = {};
+    }
+    return expression;
+}
+
+PreParser::PrimaryExpressionResult PreParser::scan_primary_expression()
+{
+    if (m_parser.match_unary_prefixed_expression())
+        return { scan_unary_prefixed_expression() };
+
+    switch (m_parser.m_state.current_token.type()) {
+    case TokenType::ParenOpen:
+        return scan_parenthesized_expression_or_arrow_function();
+    case TokenType::This:
+        m_parser.consume();
+        return {};
+    case TokenType::Identifier: {
+        auto token = m_parser.consume(TokenType::Identifier);
+        // NOTE: A direct call to eval needs the whole function to be set up for it.
+        if (token.value() == "eval"sv) {
+            fail();
+            return {};
+        }
+        if (m_parser.match(TokenType::Arrow) && !m_parser.m_state.current_token.trivia_contains_line_terminator())
+            return scan_arrow_function({ token.DeprecatedFlyString_value() });
+        return { { ExpressionKind::Identifier, token.value() } };
+    }
+    case TokenType::NumericLiteral:
+        m_parser.consume_and_validate_numeric_literal();
+        return {};
+    case TokenType::BigIntLiteral:
+        m_parser.consume();
+        return {};
+    case TokenType::BoolLiteral:
+    case TokenType::NullLiteral:
+        m_parser.consume_and_allow_division();
+        return {};
+    case TokenType::StringLiteral:
+        scan_string_literal();
+        return {};
+    case TokenType::CurlyOpen:
+        scan_object_expression();
+        return { { ExpressionKind::Object } };
+    case TokenType::BracketOpen:
+        scan_array_expression();
+        return { { ExpressionKind::Array } };
+    case TokenType::Function:
+        m_parser.consume();
+        if (m_parser.match(TokenType::Asterisk)) {
+            fail();
+            return {};
+        }
+        if (m_parser.match_identifier() && !consume_binding_identifier().has_value())
+            return {};
+        scan_function();
+        return { { ExpressionKind::Function } };
+    case TokenType::RegexLiteral:
+        (void)m_parser.parse_regexp_literal();
+        return {};
+    case TokenType::TemplateLiteralStart:
+        scan_template_literal();
+        return {};
+    case TokenType::New:
+        scan_new_expression();
+        return { { ExpressionKind::New } };
+    default:
+        // NOTE: This includes classes, super, import, yield, await, async and private names, along with anything
+        //       that is an identifier in some contexts but a keyword in others.
+        fail();
+        return {};
+    }
+}
+
+PreParser::PrimaryExpressionResult PreParser::scan_parenthesized_expression_or_arrow_function()
+{
+    m_parser.consume(TokenType::ParenOpen);
+
+    if (m_parser.match(TokenType::ParenClose)) {
+        m_parser.consume();
+        if (m_parser.m_state.current_token.trivia_contains_line_terminator() || !m_parser.match(TokenType::Arrow)) {
+            fail();
+            return {};
+        }
+        return scan_arrow_function({});
+    }
+
+    // Like the parser, look for the parameters of an arrow function first, and go back if they aren't followed by one.
+    // Anything but a plain list of identifiers is scanned as an expression, and fails when an arrow follows it.
+    if (m_parser.match(TokenType::Identifier)) {
+        m_parser.save_state();
+        Vector<DeprecatedFlyString> parameter_names;
+        while (m_parser.match(TokenType::Identifier)) {
+            parameter_names.append(m_parser.consume(TokenType::Identifier).DeprecatedFlyString_value());
+            if (!m_parser.match(TokenType::Comma))
+                break;
+            m_parser.consume();
+        }
+        if (m_parser.match(TokenType::ParenClose)) {
+            m_parser.consume();
+            if (!m_parser.m_state.current_token.trivia_contains_line_terminator() && m_parser.match(TokenType::Arrow)) {
+                m_parser.discard_saved_state();
+                return scan_arrow_function(parameter_names);
+            }
+        }
+        m_parser.load_state();
+    }
+
+    auto expression = scan_expression(0);
+    expect(TokenType::ParenClose);
+    return { expression };
+}
+
+PreParser::PrimaryExpressionResult PreParser::scan_arrow_function(Vector<DeprecatedFlyString> const& parameter_names)
+{
+    TemporaryChange<size_t> break_depth(m_break_depth, 0);
+    TemporaryChange<size_t> continue_depth(m_continue_depth, 0);
+
+    push_scope(true);
+    for (auto& name : parameter_names) {
+        if (name == "eval"sv || (m_parser.m_state.strict_mode && name == "arguments"sv)) {
+            fail();
+            break;
+        }
+        declare_parameter(name);
+    }
+
+    m_parser.consume(TokenType::Arrow);
+    if (m_parser.match(TokenType::CurlyOpen)) {
+        m_parser.consume();
+        scan_function_body();
+        expect(TokenType::CurlyClose);
+    } else if (m_parser.match_expression()) {
+        scan_expression(2);
+    } else {
+        fail();
+    }
+    pop_scope();
+
+    return { { ExpressionKind::Function }, false };
+}
+
+PreParser::Expression PreParser::scan_unary_prefixed_expression()
+{
+    auto type = m_parser.m_state.current_token.type();
+    auto precedence = Parser::operator_precedence(type);
+    auto associativity = m_parser.operator_associativity(type);
+    m_parser.consume();
+
+    auto rhs = scan_expression(precedence, associativity);
+    if (type == TokenType::PlusPlus || type == TokenType::MinusMinus)
+        check_assignment_target(rhs);
+    else if (type == TokenType::Delete && rhs.kind == ExpressionKind::Identifier && m_parser.m_state.strict_mode)
+        fail();
+    return {};
+}
+
+PreParser::SecondaryExpressionResult PreParser::scan_secondary_expression(Expression lhs, int min_precedence, Associativity associativity, Parser::ForbiddenTokens forbidden)
+{
+    auto type = m_parser.m_state.current_token.type();
+    switch (type) {
+    case TokenType::Equals:
+    case TokenType::PlusEquals:
+    case TokenType::MinusEquals:
+    case TokenType::AsteriskEquals:
+    case TokenType::SlashEquals:
+    case TokenType::PercentEquals:
+    case TokenType::DoubleAsteriskEquals:
+    case TokenType::AmpersandEquals:
+    case TokenType::PipeEquals:
+    case TokenType::CaretEquals:
+    case TokenType::ShiftLeftEquals:
+    case TokenType::ShiftRightEquals:
+    case TokenType::UnsignedShiftRightEquals:
+    case TokenType::DoubleAmpersandEquals:
+    case TokenType::DoublePipeEquals:
+    case TokenType::DoubleQuestionMarkEquals:
+        return { scan_assignment_expression(type, lhs, min_precedence, associativity, forbidden) };
+    case TokenType::In:
+        m_parser.consume();
+        scan_expression(min_precedence, associativity);
+        return {};
+    case TokenType::ParenOpen:
+        scan_arguments();
+        return { { ExpressionKind::Call } };
+    case TokenType::Period:
+        m_parser.consume();
+        if (m_parser.match(TokenType::PrivateIdentifier) || !m_parser.match_identifier_name()) {
+            fail();
+            return {};
+        }
+        m_parser.consume_and_allow_division();
+        return { { ExpressionKind::Member } };
+    case TokenType::BracketOpen:
+        m_parser.consume();
+        scan_expression(0);
+        expect(TokenType::BracketClose);
+        return { { ExpressionKind::Member } };
+    case TokenType::PlusPlus:
+    case TokenType::MinusMinus:
+        check_assignment_target(lhs);
+        m_parser.consume();
+        return {};
+    case TokenType::DoubleAmpersand:
+    case TokenType::DoublePipe:
+        m_parser.consume();
+        scan_expression(min_precedence, associativity, forbidden.forbid({ TokenType::DoubleQuestionMark }));
+        return { {}, { TokenType::DoubleQuestionMark } };
+    case TokenType::DoubleQuestionMark:
+        m_parser.consume();
+        scan_expression(min_precedence, associativity, forbidden.forbid({ TokenType::DoubleAmpersand, TokenType::DoublePipe }));
+        return { {}, { TokenType::DoubleAmpersand, TokenType::DoublePipe } };
+    case TokenType::QuestionMark:
+        scan_conditional_expression(forbidden);
+        return {};
+    case TokenType::QuestionMarkPeriod:
+        if (lhs.kind == ExpressionKind::New) {
+            fail();
+            return {};
+        }
+        scan_optional_chain();
+        return {};
+    default:
+        // NOTE: Everything else that matches a secondary expression is a binary operator.
+        m_parser.consume();
+        scan_expression(min_precedence, associativity, forbidden);
+        return {};
+    }
+}
+
+PreParser::Expression PreParser::scan_assignment_expression(TokenType type, Expression lhs, int min_precedence, Associativity associativity, Parser::ForbiddenTokens forbidden)
+{
+    m_parser.consume();
+
+    // NOTE: This fails on destructuring assignments, as their target has to be parsed again as a binding pattern.
+    auto is_logical_assignment = type == TokenType::DoubleAmpersandEquals || type == TokenType::DoublePipeEquals || type == TokenType::DoubleQuestionMarkEquals;
+    check_assignment_target(lhs, !is_logical_assignment);
+    scan_expression(min_precedence, associativity, forbidden);
+    return {};
+}
+
+void PreParser::scan_conditional_expression(Parser::ForbiddenTokens forbidden)
+{
+    m_parser.consume(TokenType::QuestionMark);
+    scan_expression(2);
+    expect(TokenType::Colon);
+    scan_expression(2, Associativity::Right, forbidden);
+}
+
+void PreParser::scan_optional_chain()
+{
+    do {
+        if (m_parser.match(TokenType::QuestionMarkPeriod)) {
+            m_parser.consume();
+            switch (m_parser.m_state.current_token.type()) {
+            case TokenType::ParenOpen:
+                scan_arguments();
+                break;
+            case TokenType::BracketOpen:
+                m_parser.consume();
+                scan_expression(0);
+                expect(TokenType::BracketClose);
+                break;
+            default:
+                if (m_parser.match(TokenType::PrivateIdentifier) || !m_parser.match_identifier_name()) {
+                    fail();
+                    return;
+                }
+                m_parser.consume();
+                break;
+            }
+        } else if (m_parser.match(TokenType::ParenOpen)) {
+            scan_arguments();
+        } else if (m_parser.match(TokenType::Period)) {
+            m_parser.consume();
+            if (m_parser.match(TokenType::PrivateIdentifier) || !m_parser.match_identifier_name()) {
+                fail();
+                return;
+            }
+            m_parser.consume();
+        } else if (m_parser.match(TokenType::TemplateLiteralStart)) {
+            fail();
+            return;
+        } else if (m_parser.match(TokenType::BracketOpen)) {
+            m_parser.consume();
+            scan_expression(2);
+            expect(TokenType::BracketClose);
+        } else {
+            break;
+        }
+    } while (!failed() && !m_parser.done());
+}
+
+void PreParser::scan_new_expression()
+{
+    m_parser.consume(TokenType::New);
+    // new.target
+    if (m_parser.match(TokenType::Period)) {
+        fail();
+        return;
+    }
+
+    scan_expression(Parser::operator_precedence(TokenType::New), Associativity::Right, { TokenType::ParenOpen, TokenType::QuestionMarkPeriod });
+    if (m_parser.match(TokenType::ParenOpen))
+        scan_arguments();
+}
+
+void PreParser::scan_object_expression()
+{
+    m_parser.consume(TokenType::CurlyOpen);
+
+    while (!failed() && !m_parser.done() && !m_parser.match(TokenType::CurlyClose)) {
+        if (m_parser.match(TokenType::TripleDot)) {
+            m_parser.consume();
+            scan_expression(4);
+        } else {
+            scan_property_definition();
+        }
+
+        if (!m_parser.match(TokenType::Comma))
+            break;
+        m_parser.consume();
+    }
+
+    expect(TokenType::CurlyClose);
+}
+
+void PreParser::scan_property_definition()
+{
+    auto const& token = m_parser.m_state.current_token;
+
+    // NOTE: Async and generator methods fail here, and so does __proto__, as only one of it may set the prototype.
+    if (token.type() == TokenType::Async || token.type() == TokenType::Asterisk
+        || ((token.type() == TokenType::Identifier || token.type() == TokenType::StringLiteral) && token.original_value().contains("__proto__"sv))) {
+        fail();
+        return;
+    }
+
+    if (token.type() == TokenType::Identifier) {
+        auto identifier = m_parser.consume();
+        if (identifier.original_value().is_one_of("get"sv, "set"sv) && m_parser.match_property_key()) {
+            scan_property_key();
+            if (!m_parser.match(TokenType::ParenOpen)) {
+                fail();
+                return;
+            }
+            auto is_getter = identifier.original_value() == "get"sv;
+            scan_function(FunctionNodeParseOptions::AllowSuperPropertyLookup | (is_getter ? FunctionNodeParseOptions::IsGetterFunction : FunctionNodeParseOptions::IsSetterFunction));
+            return;
+        }
+
+        if (!m_parser.match(TokenType::Colon) && !m_parser.match(TokenType::ParenOpen)) {
+            // Shorthand properties are references to the variable. A following '=' makes this an assignment pattern.
+            auto name = identifier.value();
+            if (m_parser.match(TokenType::Equals) || name == "eval"sv) {
+                fail();
+                return;
+            }
+            if (name == "arguments"sv)
+                m_parser.m_state.function_might_need_arguments_object = true;
+            if (m_parser.m_state.strict_mode)
+                m_parser.check_identifier_name_for_assignment_validity(identifier.DeprecatedFlyString_value());
+            return;
+        }
+    } else {
+        scan_property_key();
+    }
+
+    if (m_parser.match(TokenType::ParenOpen)) {
+        scan_function(FunctionNodeParseOptions::AllowSuperPropertyLookup);
+    } else if (m_parser.match(TokenType::Colon)) {
+        m_parser.consume();
+        scan_expression(2);
+    } else {
+        fail();
+    }
+}
+
+void PreParser::scan_property_key()
+{
+    if (m_parser.match(TokenType::StringLiteral)) {
+        scan_string_literal();
+    } else if (m_parser.match(TokenType::NumericLiteral) || m_parser.match(TokenType::BigIntLiteral)) {
+        m_parser.consume();
+    } else if (m_parser.match(TokenType::BracketOpen)) {
+        m_parser.consume();
+        scan_expression(2);
+        expect(TokenType::BracketClose);
+    } else if (m_parser.match_identifier_name()) {
+        m_parser.consume();
+    } else {
+        fail();
+    }
+}
+
+void PreParser::scan_array_expression()
+{
+    m_parser.consume(TokenType::BracketOpen);
+
+    while (!failed() && (m_parser.match_expression() || m_parser.match(TokenType::TripleDot) || m_parser.match(TokenType::Comma))) {
+        if (m_parser.match(TokenType::TripleDot)) {
+            m_parser.consume();
+            scan_expression(2);
+        } else if (m_parser.match_expression()) {
+            scan_expression(2);
+        }
+
+        if (!m_parser.match(TokenType::Comma))
+            break;
+        m_parser.consume();
+    }
+
+    expect(TokenType::BracketClose);
+}
+
+void PreParser::scan_template_literal()
+{
+    m_parser.consume(TokenType::TemplateLiteralStart);
+
+    while (!failed() && !m_parser.done() && !m_parser.match(TokenType::TemplateLiteralEnd) && !m_parser.match(TokenType::UnterminatedTemplateLiteral)) {
+        if (m_parser.match(TokenType::TemplateLiteralString)) {
+            check_escape_sequences(m_parser.consume());
+        } else if (m_parser.match(TokenType::TemplateLiteralExprStart)) {
+            m_parser.consume();
+            if (m_parser.match(TokenType::TemplateLiteralExprEnd)) {
+                fail();
+                return;
+            }
+            scan_expression(0);
+            expect(TokenType::TemplateLiteralExprEnd);
+        } else {
+            fail();
+        }
+    }
+
+    expect(TokenType::TemplateLiteralEnd);
+}
+
+void PreParser::scan_arguments()
+{
+    m_parser.consume(TokenType::ParenOpen);
+
+    while (!failed() && (m_parser.match_expression() || m_parser.match(TokenType::TripleDot))) {
+        if (m_parser.match(TokenType::TripleDot))
+            m_parser.consume();
+        scan_expression(2);
+
+        if (!m_parser.match(TokenType::Comma))
+            break;
+        m_parser.consume();
+    }
+
+    expect(TokenType::ParenClose);
+}
+
+void PreParser::scan_string_literal()
+{
+    check_escape_sequences(m_parser.consume());
+}
+
+void PreParser::check_escape_sequences(Token const& token)
+{
+    if (!token.original_value().contains('\\'))
+        return;
+
+    // NOTE: This includes legacy octal escapes, which would become an error if a 'use strict' directive followed them.
+    auto status = Token::StringValueStatus::Ok;
+    (void)token.string_value(status);
+    if (status != Token::StringValueStatus::Ok)
+        fail();
+}
+
+Optional<DeprecatedFlyString> PreParser::consume_binding_identifier()
+{
+    if (!m_parser.match(TokenType::Identifier)) {
+        fail();
+        return {};
+    }
+
+    auto name = m_parser.consume(TokenType::Identifier).DeprecatedFlyString_value();
+    if (name == "eval"sv || (m_parser.m_state.strict_mode && name == "arguments"sv)) {
+        fail();
+        return {};
+    }
+    return name;
+}
+
+void PreParser::check_assignment_target(Expression const& expression, bool allow_call_expression)
+{
+    switch (expression.kind) {
+    case ExpressionKind::Identifier:
+        if (m_parser.m_state.strict_mode && expression.identifier_name == "arguments"sv)
+            fail();
+        return;
+    case ExpressionKind::Member:
+        return;
+    case ExpressionKind::Call:
+        if (!allow_call_expression)
+            fail();
+        return;
+    default:
+        fail();
+        return;
+    }
+}
+
+void PreParser::push_scope(bool is_function_scope)
+{
+    Scope scope;
+    scope.is_function_scope = is_function_scope;
+    m_scopes.append(move(scope));
+}
+
+void PreParser::pop_scope()
+{
+    m_scopes.take_last();
+}
+
+// NOTE: This is a stricter version of what ScopePusher checks.
+void PreParser::declare(DeprecatedFlyString const& name, DeclarationKind declaration_kind)
+{
+    if (declaration_kind == DeclarationKind::Lexical) {
+        auto& scope = m_scopes.last();
+        if (scope.var_names.contains(name) || scope.forbidden_lexical_names.contains(name) || scope.lexical_names.set(name) != AK::HashSetResult::InsertedNewEntry)
+            fail();
+        return;
+    }
+
+    for (size_t i = m_scopes.size(); i > 0; --i) {
+        auto& scope = m_scopes[i - 1];
+        if (scope.lexical_names.contains(name) || scope.forbidden_var_names.contains(name)) {
+            fail();
+            return;
+        }
+        scope.var_names.set(name);
+        if (scope.is_function_scope)
+            return;
+    }
+}
+
+void PreParser::declare_parameter(DeprecatedFlyString const& name)
+{
+    if (m_scopes.last().forbidden_lexical_names.set(name) != AK::HashSetResult::InsertedNewEntry)
+        fail();
+}
+
+void PreParser::expect(TokenType type)
+{
+    if (failed())
+        return;
+    if (!m_parser.match(type)) {
+        fail();
+        return;
+    }
+    m_parser.consume(type);
+}
+
+}
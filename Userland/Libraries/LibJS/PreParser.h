@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/DeprecatedFlyString.h>
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/Vector.h>
+#include <LibJS/Parser.h>
+
+namespace JS {
+
+// Where the lazily parsed function bodies of a script end, by the offset of their opening curly brace. Parsing the same
+// source text again with this at hand skips over those bodies without even pre-parsing them, which is what lets a new
+// process pick up large scripts where a previous one left off.
+struct PreParseData {
+    struct FunctionBody {
+        Position end;
+        bool is_strict_mode { false };
+        bool might_need_arguments_object { false };
+        bool contains_direct_call_to_eval { false };
+    };
+
+    ErrorOr<ByteBuffer> serialize() const;
+
+    // Checks that the function bodies could have come from the given source text, but nothing more than that.
+    static ErrorOr<PreParseData> deserialize(ReadonlyBytes, StringView source_text);
+
+    HashMap<size_t, FunctionBody> function_bodies;
+};
+
+// Scans the body of a function whose AST isn't needed until it is first called, checking it for early errors
+// without building any nodes. It only understands the common subset of the grammar, and gives up as soon as it
+// sees anything else, in which case the body has to be parsed in full instead.
+class PreParser {
+public:
+    explicit PreParser(Parser& parser)
+        : m_parser(parser)
+    {
+    }
+
+    // Expects the parser to be just after the opening curly brace. If this returns true, the parser is left at
+    // the closing curly brace, otherwise it is left where it was.
+    bool preparse_function_body(Vector<FunctionParameter> const& parameters, FunctionKind);
+
+private:
+    enum class ExpressionKind {
+        Identifier,
+        Member,
+        Call,
+        New,
+        Object,
+        Array,
+        Function,
+        Other,
+    };
+
+    struct Expression {
+        ExpressionKind kind { ExpressionKind::Other };
+        StringView identifier_name {};
+    };
+
+    struct PrimaryExpressionResult {
+        Expression expression;
+        bool should_continue_parsing_as_expression { true };
+    };
+
+    struct SecondaryExpressionResult {
+        Expression expression;
+        Parser::ForbiddenTokens forbidden {};
+    };
+
+    enum class DeclarationKind {
+        Var,
+        Lexical,
+    };
+
+    struct Scope {
+        bool is_function_scope { false };
+        HashTable<DeprecatedFlyString> lexical_names;
+        HashTable<DeprecatedFlyString> var_names;
+        HashTable<DeprecatedFlyString> forbidden_lexical_names;
+        HashTable<DeprecatedFlyString> forbidden_var_names;
+    };
+
+    void scan_function_body();
+    void scan_statement_list();
+    void scan_statement_list_item();
+    void scan_statement();
+    void scan_block_statement(Optional<DeprecatedFlyString> const& catch_parameter = {});
+    void scan_variable_declaration(bool is_for_loop_variable_declaration = false, size_t* declaration_count = nullptr, size_t* initializer_count = nullptr);
+    void scan_function_declaration();
+    void scan_function(u16 parse_options = 0);
+    void scan_formal_parameters(u16 parse_options);
+    void scan_return_statement();
+    void scan_if_statement();
+    void scan_for_statement();
+    void scan_while_statement();
+    void scan_do_while_statement();
+    void scan_switch_statement();
+    void scan_try_statement();
+    void scan_throw_statement();
+    void scan_break_statement();
+    void scan_continue_statement();
+
+    Expression scan_expression(int min_precedence, Associativity = Associativity::Right, Parser::ForbiddenTokens forbidden = {});
+    PrimaryExpressionResult scan_primary_expression();
+    PrimaryExpressionResult scan_parenthesized_expression_or_arrow_function();
+    PrimaryExpressionResult scan_arrow_function(Vector<DeprecatedFlyString> const& parameter_names);
+    Expression scan_unary_prefixed_expression();
+    SecondaryExpressionResult scan_secondary_expression(Expression lhs, int min_precedence, Associativity, Parser::ForbiddenTokens forbidden);
+    Expression scan_assignment_expression(TokenType, Expression lhs, int min_precedence, Associativity, Parser::ForbiddenTokens forbidden);
+    void scan_conditional_expression(Parser::ForbiddenTokens forbidden);
+    void scan_optional_chain();
+    void scan_new_expression();
+    void scan_object_expression();
+    void scan_property_definition();
+    void scan_property_key();
+    void scan_array_expression();
+    void scan_template_literal();
+    void scan_arguments();
+    void scan_string_literal();
+    void check_escape_sequences(Token const&);
+
+    Optional<DeprecatedFlyString> consume_binding_identifier();
+    void check_assignment_target(Expression const&, bool allow_call_expression = true);
+
+    void push_scope(bool is_function_scope);
+    void pop_scope();
+    void declare(DeprecatedFlyString const& name, DeclarationKind);
+    void declare_parameter(DeprecatedFlyString const& name);
+
+    void expect(TokenType);
+    void fail() { m_failed = true; }
+    bool failed() const { return m_failed || m_parser.has_errors(); }
+
+    Parser& m_parser;
+    Vector<Scope> m_scopes;
+    size_t m_break_depth { 0 };
+    size_t m_continue_depth { 0 };
+    bool m_failed { false };
+};
+
+}
@@ -14,6 +14,7 @@ ArgumentsObject::ArgumentsObject(Realm& realm, Environment& environment)
     : Object(ConstructWithPrototypeTag::Tag, realm.intrinsics().object_prototype())
     , m_environment(environment)
 {
+    m_may_interfere_with_property_lookup_caches = true;
 }
 
 ThrowCompletionOr<void> ArgumentsObject::initialize(Realm& realm)
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/Function.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
@@ -156,15 +157,75 @@ ThrowCompletionOr<bool> Array::set_length(PropertyDescriptor const& property_des
     return true;
 }
 
+Optional<Value> Array::get_own_element_fast(u32 index) const
+{
+    auto const* storage = indexed_properties().simple_storage();
+    if (!storage || index >= storage->array_like_size())
+        return {};
+    auto value = storage->elements()[index];
+    if (value.is_empty())
+        return {};
+    return value;
+}
+
+bool Array::set_own_element_fast(u32 index, Value value)
+{
+    auto* storage = indexed_properties().simple_storage();
+    if (!storage || !storage->has_index(index))
+        return false;
+    storage->put(index, value);
+    return true;
+}
+
+bool Array::prototype_chain_has_no_indexed_properties() const
+{
+    for (auto const* prototype = shape().prototype(); prototype; prototype = prototype->shape().prototype()) {
+        // Proxies, typed arrays and string objects (among others) have indexed properties that aren't in their storage.
+        if (prototype->may_interfere_with_property_lookup_caches() || prototype->is_string_object())
+            return false;
+        if (!prototype->indexed_properties().is_empty())
+            return false;
+    }
+    return true;
+}
+
+SimpleIndexedPropertyStorage const* Array::simple_storage_for_fast_element_access() const
+{
+    auto const* storage = indexed_properties().simple_storage();
+    if (!storage || !prototype_chain_has_no_indexed_properties())
+        return nullptr;
+    return storage;
+}
+
+SimpleIndexedPropertyStorage* Array::simple_storage_for_fast_element_access()
+{
+    auto* storage = indexed_properties().simple_storage();
+    if (!storage || !prototype_chain_has_no_indexed_properties())
+        return nullptr;
+    return storage;
+}
+
 // 23.1.3.30.1 SortIndexedProperties ( obj, len, SortCompare, holes ), https://tc39.es/ecma262/#sec-sortindexedproperties
 ThrowCompletionOr<MarkedVector<Value>> sort_indexed_properties(VM& vm, Object const& object, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes)
 {
     // 1. Let items be a new empty List.
     auto items = MarkedVector<Value> { vm.heap() };
 
+    // OPTIMIZATION: Reading the elements of a plain array can't run any user code, so we can go straight to its storage.
+    auto const* storage = is<Array>(object) ? static_cast<Array const&>(object).simple_storage_for_fast_element_access() : nullptr;
+
     // 2. Let k be 0.
     // 3. Repeat, while k < len,
     for (size_t k = 0; k < length; ++k) {
+        if (storage) {
+            auto value = k < storage->array_like_size() ? storage->elements()[k] : Value {};
+            if (!value.is_empty())
+                items.append(value);
+            else if (holes == Holes::ReadThroughHoles)
+                items.append(js_undefined());
+            continue;
+        }
+
         // a. Let Pk be ! ToString(𝔽(k)).
         auto property_key = PropertyKey { k };
 
@@ -209,6 +270,20 @@ ThrowCompletionOr<MarkedVector<Value>> sort_indexed_properties(VM& vm, Object co
     return items;
 }
 
+// Writes the decimal digits of value to the end of buffer, which is large enough for any i32, and returns them.
+static StringView int32_to_string_view(i32 value, AK::Array<char, 11>& buffer)
+{
+    auto magnitude = value < 0 ? -static_cast<u32>(value) : static_cast<u32>(value);
+    size_t start = buffer.size();
+    do {
+        buffer[--start] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0)
+        buffer[--start] = '-';
+    return { buffer.data() + start, buffer.size() - start };
+}
+
 // 23.1.3.30.2 CompareArrayElements ( x, y, comparefn ), https://tc39.es/ecma262/#sec-comparearrayelements
 ThrowCompletionOr<double> compare_array_elements(VM& vm, Value x, Value y, FunctionObject* comparefn)
 {
@@ -238,6 +313,13 @@ ThrowCompletionOr<double> compare_array_elements(VM& vm, Value x, Value y, Funct
         return value_number.as_double();
     }
 
+    // OPTIMIZATION: Arrays of Int32s are common, and their string forms can be compared without creating any strings.
+    if (x.is_int32() && y.is_int32()) {
+        AK::Array<char, 11> x_buffer;
+        AK::Array<char, 11> y_buffer;
+        return int32_to_string_view(x.as_i32(), x_buffer).compare(int32_to_string_view(y.as_i32(), y_buffer));
+    }
+
     // 5. Let xString be ? ToString(x).
     auto x_string = PrimitiveString::create(vm, TRY(x.to_deprecated_string(vm)));
 
@@ -60,11 +60,25 @@ public:
 
     [[nodiscard]] bool length_is_writable() const { return m_length_writable; };
 
+    // Fast paths for arrays that keep their elements in simple storage, where every element is a plain, writable data
+    // property, so looking one up or overwriting it can't run any user code. These return nothing or false whenever the
+    // generic steps have to be taken instead.
+    Optional<Value> get_own_element_fast(u32 index) const;
+    bool set_own_element_fast(u32 index, Value);
+
+    // Returns the simple storage if, in addition, no prototype can have indexed properties of its own. HasProperty() for
+    // an index is then the same as looking for the element in this storage, and adding elements can't hit a setter.
+    SimpleIndexedPropertyStorage const* simple_storage_for_fast_element_access() const;
+    SimpleIndexedPropertyStorage* simple_storage_for_fast_element_access();
+
 protected:
     explicit Array(Object& prototype);
 
 private:
+    virtual bool is_array_object() const final { return true; }
+
     ThrowCompletionOr<bool> set_length(PropertyDescriptor const&);
+    bool prototype_chain_has_no_indexed_properties() const;
 
     bool m_length_writable { true };
 };
@@ -74,6 +88,9 @@ enum class Holes {
     ReadThroughHoles,
 };
 
+template<>
+inline bool Object::fast_is<Array>() const { return is_array_object(); }
+
 ThrowCompletionOr<MarkedVector<Value>> sort_indexed_properties(VM&, Object const&, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes);
 ThrowCompletionOr<double> compare_array_elements(VM&, Value x, Value y, FunctionObject* comparefn);
 
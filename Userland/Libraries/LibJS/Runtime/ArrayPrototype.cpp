@@ -149,6 +149,69 @@ static ThrowCompletionOr<Object*> array_species_create(VM& vm, Object& original_
     return TRY(construct(vm, constructor.as_function(), Value(length))).ptr();
 }
 
+// Performs the HasProperty/Get pair used by the callback-taking array methods, returning nothing if the element isn't present.
+static ThrowCompletionOr<Optional<Value>> get_element_if_present(Object& object, PropertyKey const& property_key)
+{
+    // OPTIMIZATION: Reading an element of a plain array can't run any user code, so we can go straight to its storage.
+    //               The callbacks may have changed the array since the last element was read, so this is checked for
+    //               every element.
+    if (is<Array>(object) && property_key.is_number()) {
+        if (auto const* storage = static_cast<Array&>(object).simple_storage_for_fast_element_access()) {
+            auto index = property_key.as_number();
+            if (index >= storage->array_like_size() || storage->elements()[index].is_empty())
+                return Optional<Value> {};
+            return storage->elements()[index];
+        }
+    }
+
+    if (!TRY(object.has_property(property_key)))
+        return Optional<Value> {};
+    return TRY(object.get(property_key));
+}
+
+enum class SearchDirection {
+    Forwards,
+    Backwards,
+};
+
+// Searches the storage of a plain array for an element that is equal to search_element, as used by indexOf, lastIndexOf
+// and includes. Going forwards, indices from k up to (but not including) end are searched, going backwards, indices
+// from k down to 0. Holes are skipped. The element kind of the storage tells us when the search can be skipped, or when
+// the elements can be compared as Int32s.
+static Optional<size_t> find_element_in_storage(SimpleIndexedPropertyStorage const& storage, Value search_element, size_t k, size_t end, SearchDirection direction, bool (*is_equal)(Value, Value))
+{
+    // Nothing but a number can be equal to one of the elements of an array that only holds numbers.
+    if (storage.has_only_number_elements() && !search_element.is_number())
+        return {};
+
+    auto const& elements = storage.elements();
+    auto find = [&](auto matches) -> Optional<size_t> {
+        if (direction == SearchDirection::Forwards) {
+            for (; k < end; ++k) {
+                if (!elements[k].is_empty() && matches(elements[k]))
+                    return k;
+            }
+        } else {
+            for (auto i = k + 1; i > 0; --i) {
+                if (!elements[i - 1].is_empty() && matches(elements[i - 1]))
+                    return i - 1;
+            }
+        }
+        return {};
+    };
+
+    if (storage.has_only_int32_elements()) {
+        // Numbers are stored as Int32s whenever they can be, so only Int32s and -0 (which is equal to +0) can be equal
+        // to an Int32. Not even NaN, which SameValueZero considers equal to itself.
+        if (!search_element.is_int32() && !search_element.is_negative_zero())
+            return {};
+        auto search_int32 = search_element.is_int32() ? search_element.as_i32() : 0;
+        return find([&](Value element) { return element.as_i32() == search_int32; });
+    }
+
+    return find([&](Value element) { return is_equal(search_element, element); });
+}
+
 // 23.1.3.1 Array.prototype.at ( index ), https://tc39.es/ecma262/#sec-array.prototype.at
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::at)
 {
@@ -903,6 +966,26 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+
+    // OPTIMIZATION: Looking at the elements of a plain array can't run any user code, so we can search its storage directly.
+    if (is<Array>(*this_object)) {
+        if (auto const* storage = static_cast<Array const&>(*this_object).simple_storage_for_fast_element_access()) {
+            auto end = min(length, storage->array_like_size());
+            // NOTE: Nothing on the prototype chain has indexed properties, so holes (and indices past the end, if the
+            //       array was shrunk by fromIndex's valueOf()) read as undefined.
+            if (value_to_find.is_undefined()) {
+                if (end < length)
+                    return Value(true);
+                for (auto i = from_index; i < end; ++i) {
+                    if (storage->elements()[i].is_empty() || storage->elements()[i].is_undefined())
+                        return Value(true);
+                }
+                return Value(false);
+            }
+            return Value(find_element_in_storage(*storage, value_to_find, from_index, end, SearchDirection::Forwards, same_value_zero).has_value());
+        }
+    }
+
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -956,6 +1039,14 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    // OPTIMIZATION: Looking at the elements of a plain array can't run any user code, so we can search its storage directly.
+    if (is<Array>(*object)) {
+        if (auto const* storage = static_cast<Array const&>(*object).simple_storage_for_fast_element_access()) {
+            auto index = find_element_in_storage(*storage, search_element, k, min(length, storage->array_like_size()), SearchDirection::Forwards, is_strictly_equal);
+            return index.has_value() ? Value(*index) : Value(-1);
+        }
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -1067,6 +1158,18 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::last_index_of)
         k = (double)length + n;
     }
 
+    // OPTIMIZATION: Looking at the elements of a plain array can't run any user code, so we can search its storage directly.
+    if (is<Array>(*object)) {
+        if (auto const* storage = static_cast<Array const&>(*object).simple_storage_for_fast_element_access()) {
+            // NOTE: fromIndex's valueOf() may have shrunk the array, and there are no elements past its end.
+            k = min(k, static_cast<ssize_t>(storage->array_like_size()) - 1);
+            if (k < 0)
+                return Value(-1);
+            auto index = find_element_in_storage(*storage, search_element, k, 0, SearchDirection::Backwards, is_strictly_equal);
+            return index.has_value() ? Value(*index) : Value(-1);
+        }
+    }
+
     // 8. Repeat, while k ≥ 0,
     for (; k >= 0; --k) {
         auto property_key = PropertyKey { k };
@@ -1120,15 +1223,12 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::map)
         auto property_key = PropertyKey { k };
 
         // b. Let kPresent be ? HasProperty(O, Pk).
-        auto k_present = TRY(object->has_property(property_key));
-
         // c. If kPresent is true, then
-        if (k_present) {
-            // i. Let kValue be ? Get(O, Pk).
-            auto k_value = TRY(object->get(property_key));
-
+        //    i. Let kValue be ? Get(O, Pk).
+        auto k_value = TRY(get_element_if_present(*object, property_key));
+        if (k_value.has_value()) {
             // ii. Let mappedValue be ? Call(callbackfn, thisArg, « kValue, 𝔽(k), O »).
-            auto mapped_value = TRY(call(vm, callback_function.as_function(), this_arg, k_value, Value(k), object));
+            auto mapped_value = TRY(call(vm, callback_function.as_function(), this_arg, *k_value, Value(k), object));
 
             // iii. Perform ? CreateDataPropertyOrThrow(A, Pk, mappedValue).
             TRY(array->create_data_property_or_throw(property_key, mapped_value));
@@ -1145,6 +1245,15 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::map)
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::pop)
 {
     auto this_object = TRY(vm.this_value().to_object(vm));
+
+    // OPTIMIZATION: Taking the last element of a plain array can't run any user code.
+    if (is<Array>(*this_object)) {
+        auto& array = static_cast<Array&>(*this_object);
+        auto* storage = array.indexed_properties().simple_storage();
+        if (storage && array.length_is_writable() && storage->has_index(storage->array_like_size() - 1))
+            return storage->take_last().value;
+    }
+
     auto length = TRY(length_of_array_like(vm, this_object));
     if (length == 0) {
         TRY(this_object->set(vm.names.length, Value(0), Object::ShouldThrowExceptions::Yes));
@@ -1161,6 +1270,20 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::pop)
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::push)
 {
     auto this_object = TRY(vm.this_value().to_object(vm));
+
+    // OPTIMIZATION: Appending to a plain array can't run any user code, as long as there are no indexed setters on its
+    //               prototype chain.
+    if (is<Array>(*this_object)) {
+        auto& array = static_cast<Array&>(*this_object);
+        auto* storage = array.simple_storage_for_fast_element_access();
+        if (storage && array.length_is_writable() && MUST(array.is_extensible())
+            && storage->array_like_size() + vm.argument_count() <= NumericLimits<i32>::max()) {
+            for (size_t i = 0; i < vm.argument_count(); ++i)
+                storage->put(storage->array_like_size(), vm.argument(i));
+            return Value(storage->array_like_size());
+        }
+    }
+
     auto length = TRY(length_of_array_like(vm, this_object));
     auto argument_count = vm.argument_count();
     auto new_length = length + argument_count;
@@ -55,6 +55,9 @@ public:
         return names;
     }
 
+    // Bindings are never removed, so this only ever grows.
+    size_t binding_count() const { return m_bindings.size(); }
+
     ThrowCompletionOr<void> set_mutable_binding_direct(VM&, size_t index, Value, bool strict);
     ThrowCompletionOr<Value> get_binding_value_direct(VM&, size_t index, bool strict);
 
@@ -818,6 +818,10 @@ Completion ECMAScriptFunctionObject::ordinary_call_evaluate_body()
     if (m_kind == FunctionKind::AsyncGenerator)
         return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "Async Generator function execution");
 
+    // Inner function bodies are only parsed again once the function is actually called.
+    if (is<LazyFunctionBody>(*m_ecmascript_code))
+        m_ecmascript_code = static_cast<LazyFunctionBody const&>(*m_ecmascript_code).body();
+
     auto* bytecode_interpreter = Bytecode::Interpreter::current();
 
     // The bytecode interpreter can execute generator functions while the AST interpreter cannot.
@@ -17,6 +17,35 @@ SimpleIndexedPropertyStorage::SimpleIndexedPropertyStorage(Vector<Value>&& initi
     : m_array_size(initial_values.size())
     , m_packed_elements(move(initial_values))
 {
+    for (auto value : m_packed_elements)
+        did_store_element(value);
+}
+
+void SimpleIndexedPropertyStorage::did_store_element(Value value)
+{
+    if (value.is_empty()) {
+        did_create_hole();
+        return;
+    }
+
+    // Packed and holey kinds both come in the order Int32, Double, Any, so only the element type has to be compared.
+    auto const holey_offset = to_underlying(ElementKind::HoleyInt32);
+    auto kind = to_underlying(m_element_kind);
+    auto current_type = kind % holey_offset;
+    auto value_type = to_underlying(ElementKind::PackedAny);
+    if (value.is_int32())
+        value_type = to_underlying(ElementKind::PackedInt32);
+    else if (value.is_number())
+        value_type = to_underlying(ElementKind::PackedDouble);
+
+    if (value_type > current_type)
+        m_element_kind = static_cast<ElementKind>(kind - current_type + value_type);
+}
+
+void SimpleIndexedPropertyStorage::did_create_hole()
+{
+    if (is_packed())
+        m_element_kind = static_cast<ElementKind>(to_underlying(m_element_kind) + to_underlying(ElementKind::HoleyInt32));
 }
 
 bool SimpleIndexedPropertyStorage::has_index(u32 index) const
@@ -49,16 +78,20 @@ void SimpleIndexedPropertyStorage::put(u32 index, Value value, PropertyAttribute
     VERIFY(attributes == default_attributes);
 
     if (index >= m_array_size) {
+        if (index > m_array_size)
+            did_create_hole();
         m_array_size = index + 1;
         grow_storage_if_needed();
     }
     m_packed_elements[index] = value;
+    did_store_element(value);
 }
 
 void SimpleIndexedPropertyStorage::remove(u32 index)
 {
     VERIFY(index < m_array_size);
     m_packed_elements[index] = {};
+    did_create_hole();
 }
 
 ValueAndAttributes SimpleIndexedPropertyStorage::take_first()
@@ -77,6 +110,8 @@ ValueAndAttributes SimpleIndexedPropertyStorage::take_last()
 
 bool SimpleIndexedPropertyStorage::set_array_like_size(size_t new_size)
 {
+    if (new_size > m_array_size)
+        did_create_hole();
     m_array_size = new_size;
     m_packed_elements.resize_and_keep_capacity(new_size);
     return true;
@@ -42,6 +42,17 @@ public:
 
 class SimpleIndexedPropertyStorage final : public IndexedPropertyStorage {
 public:
+    // Like V8's elements kinds, this describes what all the elements have in common, and whether there are holes between
+    // them. It only ever moves towards a more general kind, so a kind never has to be recomputed from the elements.
+    enum class ElementKind : u8 {
+        PackedInt32,
+        PackedDouble,
+        PackedAny,
+        HoleyInt32,
+        HoleyDouble,
+        HoleyAny,
+    };
+
     SimpleIndexedPropertyStorage() = default;
     explicit SimpleIndexedPropertyStorage(Vector<Value>&& initial_values);
 
@@ -60,13 +71,22 @@ public:
     virtual bool is_simple_storage() const override { return true; }
     Vector<Value> const& elements() const { return m_packed_elements; }
 
+    ElementKind element_kind() const { return m_element_kind; }
+    bool is_packed() const { return m_element_kind <= ElementKind::PackedAny; }
+    bool has_only_int32_elements() const { return m_element_kind == ElementKind::PackedInt32 || m_element_kind == ElementKind::HoleyInt32; }
+    bool has_only_number_elements() const { return m_element_kind != ElementKind::PackedAny && m_element_kind != ElementKind::HoleyAny; }
+
 private:
     friend GenericIndexedPropertyStorage;
 
     void grow_storage_if_needed();
 
+    void did_store_element(Value);
+    void did_create_hole();
+
     size_t m_array_size { 0 };
     Vector<Value> m_packed_elements;
+    ElementKind m_element_kind { ElementKind::PackedInt32 };
 };
 
 class GenericIndexedPropertyStorage final : public IndexedPropertyStorage {
@@ -123,6 +143,10 @@ public:
     }
 
     bool has_index(u32 index) const { return m_storage ? m_storage->has_index(index) : false; }
+
+    // Returns nothing if there is no storage yet, or if it has switched to generic storage.
+    SimpleIndexedPropertyStorage const* simple_storage() const { return m_storage && m_storage->is_simple_storage() ? static_cast<SimpleIndexedPropertyStorage const*>(m_storage.ptr()) : nullptr; }
+    SimpleIndexedPropertyStorage* simple_storage() { return m_storage && m_storage->is_simple_storage() ? static_cast<SimpleIndexedPropertyStorage*>(m_storage.ptr()) : nullptr; }
     Optional<ValueAndAttributes> get(u32 index) const;
     void put(u32 index, Value value, PropertyAttributes attributes = default_attributes);
     void remove(u32 index);
@@ -5,22 +5,71 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
 #include <AK/CharacterTypes.h>
 #include <AK/FlyString.h>
+#include <AK/RefCounted.h>
+#include <AK/UnicodeUtils.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf8View.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/PrimitiveString.h>
 #include <LibJS/Runtime/PropertyKey.h>
-#include <LibJS/Runtime/ThrowableStringBuilder.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Runtime/Value.h>
 
 namespace JS {
 
+// Resolved ropes keep their UTF-8 in one of these. A buffer never reallocates, so every string that uses a prefix of it
+// stays valid while later ropes are resolved by appending to it (see resolve_rope_if_needed()).
+class PrimitiveString::RopeBuffer : public RefCounted<RopeBuffer> {
+public:
+    static ErrorOr<NonnullRefPtr<RopeBuffer>> create(size_t capacity)
+    {
+        auto buffer = TRY(adopt_nonnull_ref_or_enomem(new (nothrow) RopeBuffer));
+        TRY(buffer->m_bytes.try_ensure_capacity(capacity));
+        return buffer;
+    }
+
+    size_t size() const { return m_bytes.size(); }
+    size_t capacity() const { return m_bytes.capacity(); }
+    StringView view(size_t length) const { return StringView { m_bytes.span().trim(length) }; }
+    bool is_ascii(size_t length) const { return length <= m_ascii_prefix_length; }
+
+    void append(StringView string)
+    {
+        bool is_ascii_so_far = m_ascii_prefix_length == size();
+        m_bytes.unchecked_append(string.bytes().data(), string.length());
+        if (is_ascii_so_far) {
+            while (m_ascii_prefix_length < size() && is_ascii_byte(m_bytes[m_ascii_prefix_length]))
+                ++m_ascii_prefix_length;
+        }
+    }
+
+    void append_code_point(u32 code_point)
+    {
+        (void)AK::UnicodeUtils::code_point_to_utf8(code_point, [&](u8 byte) { m_bytes.unchecked_append(byte); });
+    }
+
+    void trim(size_t length)
+    {
+        m_bytes.shrink(size() - length, true);
+        m_ascii_prefix_length = min(m_ascii_prefix_length, size());
+    }
+
+private:
+    RopeBuffer() = default;
+
+    static bool is_ascii_byte(u8 byte) { return byte < 0x80; }
+
+    Vector<u8> m_bytes;
+    size_t m_ascii_prefix_length { 0 };
+};
+
 PrimitiveString::PrimitiveString(PrimitiveString& lhs, PrimitiveString& rhs)
     : m_is_rope(true)
+    , m_rope_depth(max(lhs.m_rope_depth, rhs.m_rope_depth) + 1)
     , m_lhs(&lhs)
     , m_rhs(&rhs)
 {
@@ -71,6 +120,8 @@ bool PrimitiveString::is_empty() const
         return m_utf8_string->is_empty();
     if (has_deprecated_string())
         return m_deprecated_string->is_empty();
+    if (m_rope_buffer)
+        return m_rope_buffer_length == 0;
     VERIFY_NOT_REACHED();
 }
 
@@ -80,7 +131,9 @@ ThrowCompletionOr<String> PrimitiveString::utf8_string() const
     TRY(resolve_rope_if_needed());
 
     if (!has_utf8_string()) {
-        if (has_deprecated_string())
+        if (m_rope_buffer)
+            m_utf8_string = TRY_OR_THROW_OOM(vm, String::from_utf8(m_rope_buffer->view(m_rope_buffer_length)));
+        else if (has_deprecated_string())
             m_utf8_string = TRY_OR_THROW_OOM(vm, String::from_utf8(*m_deprecated_string));
         else if (has_utf16_string())
             m_utf8_string = TRY(m_utf16_string->to_utf8(vm));
@@ -93,6 +146,12 @@ ThrowCompletionOr<String> PrimitiveString::utf8_string() const
 
 ThrowCompletionOr<StringView> PrimitiveString::utf8_string_view() const
 {
+    TRY(resolve_rope_if_needed());
+
+    // OPTIMIZATION: A resolved rope can be viewed without copying it out of its buffer.
+    if (!has_utf8_string() && m_rope_buffer)
+        return m_rope_buffer->view(m_rope_buffer_length);
+
     (void)TRY(utf8_string());
     return m_utf8_string->bytes_as_string_view();
 }
@@ -104,6 +163,8 @@ ThrowCompletionOr<DeprecatedString> PrimitiveString::deprecated_string() const
     if (!has_deprecated_string()) {
         if (has_utf8_string())
             m_deprecated_string = m_utf8_string->to_deprecated_string();
+        else if (m_rope_buffer)
+            m_deprecated_string = m_rope_buffer->view(m_rope_buffer_length);
         else if (has_utf16_string())
             m_deprecated_string = TRY(m_utf16_string->to_deprecated_string(vm()));
         else
@@ -120,6 +181,8 @@ ThrowCompletionOr<Utf16String> PrimitiveString::utf16_string() const
     if (!has_utf16_string()) {
         if (has_utf8_string()) {
             m_utf16_string = TRY(Utf16String::create(vm(), m_utf8_string->bytes_as_string_view()));
+        } else if (m_rope_buffer) {
+            m_utf16_string = TRY(Utf16String::create(vm(), m_rope_buffer->view(m_rope_buffer_length)));
         } else {
             VERIFY(has_deprecated_string());
             m_utf16_string = TRY(Utf16String::create(vm(), *m_deprecated_string));
@@ -135,13 +198,24 @@ ThrowCompletionOr<Utf16View> PrimitiveString::utf16_string_view() const
     return m_utf16_string->view();
 }
 
+ThrowCompletionOr<size_t> PrimitiveString::length_in_utf16_code_units() const
+{
+    TRY(resolve_rope_if_needed());
+
+    // OPTIMIZATION: An ASCII string is as long in UTF-16 code units as it is in bytes, so it doesn't have to be converted.
+    if (!has_utf16_string() && m_rope_buffer && m_rope_buffer->is_ascii(m_rope_buffer_length))
+        return m_rope_buffer_length;
+
+    return TRY(utf16_string_view()).length_in_code_units();
+}
+
 ThrowCompletionOr<Optional<Value>> PrimitiveString::get(VM& vm, PropertyKey const& property_key) const
 {
     if (property_key.is_symbol())
         return Optional<Value> {};
     if (property_key.is_string()) {
         if (property_key.as_string() == vm.names.length.as_string()) {
-            auto length = TRY(utf16_string()).length_in_code_units();
+            auto length = TRY(length_in_utf16_code_units());
             return Value(static_cast<double>(length));
         }
     }
@@ -242,33 +316,48 @@ NonnullGCPtr<PrimitiveString> PrimitiveString::create(VM& vm, PrimitiveString& l
     if (rhs_empty)
         return lhs;
 
+    // Rather than letting a chain of concatenations like `s += x` grow without bound, resolve the deep side once it gets
+    // too deep. Since that side's leftmost piece is usually the last resolved rope, this only appends to its buffer.
+    // NOTE: If resolving fails, we carry on with the deep rope, and the error resurfaces whenever it is resolved.
+    static constexpr u32 max_rope_depth = 1024;
+    if (lhs.m_rope_depth >= max_rope_depth)
+        (void)lhs.resolve_rope_if_needed();
+    if (rhs.m_rope_depth >= max_rope_depth)
+        (void)rhs.resolve_rope_if_needed();
+
     return vm.heap().allocate_without_realm<PrimitiveString>(lhs, rhs);
 }
 
-ThrowCompletionOr<void> PrimitiveString::resolve_rope_if_needed() const
+// Returns the code point that a UTF-8 encoded high surrogate at the end of `previous` and a low surrogate at the start
+// of `current` make up, if any.
+static Optional<u32> surrogate_pair_spanning(StringView previous, StringView current)
 {
-    if (!m_is_rope)
+    // Surrogates encoded as UTF-8 are 3 bytes.
+    if ((previous.length() < 3) || (current.length() < 3))
         return {};
 
-    auto& vm = this->vm();
+    // Might the previous string end with a UTF-8 encoded surrogate?
+    if ((static_cast<u8>(previous[previous.length() - 3]) & 0xf0) != 0xe0)
+        return {};
 
-    // NOTE: Special case for two concatenated UTF-16 strings.
-    //       This is here as an optimization, although I'm unsure how valuable it is.
-    if (m_lhs->has_utf16_string() && m_rhs->has_utf16_string()) {
-        auto const& lhs_string = m_lhs->m_utf16_string.value();
-        auto const& rhs_string = m_rhs->m_utf16_string.value();
+    // Might the current string begin with a UTF-8 encoded surrogate?
+    if ((static_cast<u8>(current[0]) & 0xf0) != 0xe0)
+        return {};
 
-        Utf16Data combined;
-        TRY_OR_THROW_OOM(vm, combined.try_ensure_capacity(lhs_string.length_in_code_units() + rhs_string.length_in_code_units()));
-        combined.extend(lhs_string.string());
-        combined.extend(rhs_string.string());
+    auto high_surrogate = *Utf8View(previous.substring_view(previous.length() - 3)).begin();
+    auto low_surrogate = *Utf8View(current).begin();
 
-        m_utf16_string = TRY(Utf16String::create(vm, move(combined)));
-        m_is_rope = false;
-        m_lhs = nullptr;
-        m_rhs = nullptr;
+    if (!Utf16View::is_high_surrogate(high_surrogate) || !Utf16View::is_low_surrogate(low_surrogate))
         return {};
-    }
+    return Utf16View::decode_surrogate_pair(high_surrogate, low_surrogate);
+}
+
+ThrowCompletionOr<void> PrimitiveString::resolve_rope_if_needed() const
+{
+    if (!m_is_rope)
+        return {};
+
+    auto& vm = this->vm();
 
     // This vector will hold all the pieces of the rope that need to be assembled
     // into the resolved string.
@@ -289,71 +378,77 @@ ThrowCompletionOr<void> PrimitiveString::resolve_rope_if_needed() const
         TRY_OR_THROW_OOM(vm, pieces.try_append(current));
     }
 
-    // Now that we have all the pieces, we can concatenate them using a StringBuilder.
-    ThrowableStringBuilder builder(vm);
-
-    // We keep track of the previous piece in order to handle surrogate pairs spread across two pieces.
-    PrimitiveString const* previous = nullptr;
-    for (auto const* current : pieces) {
-        if (!previous) {
-            // This is the very first piece, just append it and continue.
-            TRY(builder.append(TRY(current->utf8_string())));
-            previous = current;
-            continue;
-        }
-
-        // Get the UTF-8 representations for both strings.
-        auto current_string_as_utf8 = TRY(current->utf8_string_view());
-        auto previous_string_as_utf8 = TRY(previous->utf8_string_view());
-
-        // NOTE: Now we need to look at the end of the previous string and the start
-        //       of the current string, to see if they should be combined into a surrogate.
+    auto finish_resolving = [&] {
+        m_is_rope = false;
+        m_rope_depth = 0;
+        m_lhs = nullptr;
+        m_rhs = nullptr;
+    };
+
+    // If the leftmost piece has been used as UTF-16 (or every piece already is UTF-16), the result is likely to be used
+    // as UTF-16 as well. Concatenating the cached UTF-16 of the pieces then saves converting all of it once more.
+    // Surrogate pairs spread across two pieces join up on their own this way.
+    // NOTE: The conversions of the other pieces are cached on them, like any other.
+    auto const& first_piece = *pieces.first();
+    if (first_piece.has_utf16_string() || all_of(pieces, [](auto const* piece) { return piece->has_utf16_string(); })) {
+        size_t length = 0;
+        for (auto const* piece : pieces)
+            length += TRY(piece->utf16_string_view()).length_in_code_units();
 
-        // Surrogates encoded as UTF-8 are 3 bytes.
-        if ((previous_string_as_utf8.length() < 3) || (current_string_as_utf8.length() < 3)) {
-            TRY(builder.append(current_string_as_utf8));
-            previous = current;
-            continue;
-        }
+        Utf16Data combined;
+        TRY_OR_THROW_OOM(vm, combined.try_ensure_capacity(length));
+        for (auto const* piece : pieces)
+            combined.extend(piece->m_utf16_string->string());
 
-        // Might the previous string end with a UTF-8 encoded surrogate?
-        if ((static_cast<u8>(previous_string_as_utf8[previous_string_as_utf8.length() - 3]) & 0xf0) != 0xe0) {
-            // If not, just append the current string and continue.
-            TRY(builder.append(current_string_as_utf8));
-            previous = current;
-            continue;
-        }
+        m_utf16_string = TRY(Utf16String::create(vm, move(combined)));
+        finish_resolving();
+        return {};
+    }
 
-        // Might the current string begin with a UTF-8 encoded surrogate?
-        if ((static_cast<u8>(current_string_as_utf8[0]) & 0xf0) != 0xe0) {
-            // If not, just append the current string and continue.
-            TRY(builder.append(current_string_as_utf8));
-            previous = current;
-            continue;
-        }
+    Vector<StringView> views;
+    TRY_OR_THROW_OOM(vm, views.try_ensure_capacity(pieces.size()));
+    size_t length = 0;
+    for (auto const* piece : pieces) {
+        auto view = TRY(piece->utf8_string_view());
+        length += view.length();
+        views.unchecked_append(view);
+    }
 
-        auto high_surrogate = *Utf8View(previous_string_as_utf8.substring_view(previous_string_as_utf8.length() - 3)).begin();
-        auto low_surrogate = *Utf8View(current_string_as_utf8).begin();
+    // If the leftmost piece ends its buffer, and there's room for the rest, we can append the other pieces to that buffer
+    // in place. This is what makes `s += x` in a loop linear, even when `s` is looked at in between.
+    RefPtr<RopeBuffer> buffer;
+    size_t first_piece_to_append = 0;
+    if (first_piece.m_rope_buffer
+        && first_piece.m_rope_buffer_length == first_piece.m_rope_buffer->size()
+        && length <= first_piece.m_rope_buffer->capacity()
+        && !surrogate_pair_spanning(views[0], views[1]).has_value()) {
+        buffer = first_piece.m_rope_buffer;
+        first_piece_to_append = 1;
+    } else {
+        // Most ropes are only ever resolved once, so only a rope that builds on an earlier one gets room to grow.
+        auto capacity = first_piece.m_rope_buffer ? length * 2 : length;
+        buffer = TRY_OR_THROW_OOM(vm, RopeBuffer::create(capacity));
+    }
 
-        if (!Utf16View::is_high_surrogate(high_surrogate) || !Utf16View::is_low_surrogate(low_surrogate)) {
-            TRY(builder.append(current_string_as_utf8));
-            previous = current;
-            continue;
+    // We keep track of the previous piece in order to handle surrogate pairs spread across two pieces.
+    StringView previous = first_piece_to_append > 0 ? views[0] : StringView {};
+    for (size_t i = first_piece_to_append; i < views.size(); ++i) {
+        auto current = views[i];
+        if (auto code_point = surrogate_pair_spanning(previous, current); code_point.has_value()) {
+            // Remove 3 bytes from the buffer and replace them with the UTF-8 encoded code point.
+            buffer->trim(3);
+            buffer->append_code_point(*code_point);
+            // Append the remaining part of the current string.
+            buffer->append(current.substring_view(3));
+        } else {
+            buffer->append(current);
         }
-
-        // Remove 3 bytes from the builder and replace them with the UTF-8 encoded code point.
-        builder.trim(3);
-        TRY(builder.append_code_point(Utf16View::decode_surrogate_pair(high_surrogate, low_surrogate)));
-
-        // Append the remaining part of the current string.
-        TRY(builder.append(current_string_as_utf8.substring_view(3)));
         previous = current;
     }
 
-    m_utf8_string = TRY(builder.to_string());
-    m_is_rope = false;
-    m_lhs = nullptr;
-    m_rhs = nullptr;
+    m_rope_buffer = move(buffer);
+    m_rope_buffer_length = m_rope_buffer->size();
+    finish_resolving();
     return {};
 }
 
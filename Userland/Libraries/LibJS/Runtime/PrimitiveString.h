@@ -9,6 +9,7 @@
 
 #include <AK/DeprecatedString.h>
 #include <AK/Optional.h>
+#include <AK/RefPtr.h>
 #include <AK/String.h>
 #include <AK/StringView.h>
 #include <LibJS/Forward.h>
@@ -49,9 +50,13 @@ public:
     ThrowCompletionOr<Utf16View> utf16_string_view() const;
     bool has_utf16_string() const { return m_utf16_string.has_value(); }
 
+    ThrowCompletionOr<size_t> length_in_utf16_code_units() const;
+
     ThrowCompletionOr<Optional<Value>> get(VM&, PropertyKey const&) const;
 
 private:
+    class RopeBuffer;
+
     explicit PrimitiveString(PrimitiveString&, PrimitiveString&);
     explicit PrimitiveString(String);
     explicit PrimitiveString(DeprecatedString);
@@ -62,10 +67,15 @@ private:
     ThrowCompletionOr<void> resolve_rope_if_needed() const;
 
     mutable bool m_is_rope { false };
+    mutable u32 m_rope_depth { 0 };
 
     mutable GCPtr<PrimitiveString> m_lhs;
     mutable GCPtr<PrimitiveString> m_rhs;
 
+    // A resolved rope's UTF-8 lives in a prefix of this buffer, which ropes built on top of it may append to later.
+    mutable RefPtr<RopeBuffer> m_rope_buffer;
+    mutable size_t m_rope_buffer_length { 0 };
+
     mutable Optional<String> m_utf8_string;
     mutable Optional<DeprecatedString> m_deprecated_string;
     mutable Optional<Utf16String> m_utf16_string;
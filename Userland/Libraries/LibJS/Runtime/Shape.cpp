@@ -10,6 +10,8 @@
 
 namespace JS {
 
+static u64 s_next_serial_number = 1;
+
 Shape* Shape::create_unique_clone() const
 {
     auto new_shape = heap().allocate_without_realm<Shape>(m_realm);
@@ -89,6 +91,7 @@ Shape* Shape::create_prototype_transition(Object* new_prototype)
 
 Shape::Shape(Realm& realm)
     : m_realm(realm)
+    , m_serial_number(s_next_serial_number++)
 {
 }
 
@@ -98,6 +101,7 @@ Shape::Shape(Shape& previous_shape, StringOrSymbol const& property_key, Property
     , m_property_key(property_key)
     , m_prototype(previous_shape.m_prototype)
     , m_property_count(transition_type == TransitionType::Put ? previous_shape.m_property_count + 1 : previous_shape.m_property_count)
+    , m_serial_number(s_next_serial_number++)
     , m_attributes(attributes)
     , m_transition_type(transition_type)
 {
@@ -108,6 +112,7 @@ Shape::Shape(Shape& previous_shape, Object* new_prototype)
     , m_previous(&previous_shape)
     , m_prototype(new_prototype)
     , m_property_count(previous_shape.m_property_count)
+    , m_serial_number(s_next_serial_number++)
     , m_transition_type(TransitionType::Prototype)
 {
 }
@@ -188,6 +193,17 @@ void Shape::ensure_property_table() const
     }
 }
 
+void Shape::invalidate_serial_number()
+{
+    m_serial_number = s_next_serial_number++;
+}
+
+void Shape::set_prototype_without_transition(Object* new_prototype)
+{
+    m_prototype = new_prototype;
+    invalidate_serial_number();
+}
+
 void Shape::add_property_to_unique_shape(StringOrSymbol const& property_key, PropertyAttributes attributes)
 {
     VERIFY(is_unique());
@@ -197,6 +213,7 @@ void Shape::add_property_to_unique_shape(StringOrSymbol const& property_key, Pro
 
     VERIFY(m_property_count < NumericLimits<u32>::max());
     ++m_property_count;
+    invalidate_serial_number();
 }
 
 void Shape::reconfigure_property_in_unique_shape(StringOrSymbol const& property_key, PropertyAttributes attributes)
@@ -207,6 +224,7 @@ void Shape::reconfigure_property_in_unique_shape(StringOrSymbol const& property_
     VERIFY(it != m_property_table->end());
     it->value.attributes = attributes;
     m_property_table->set(property_key, it->value);
+    invalidate_serial_number();
 }
 
 void Shape::remove_property_from_unique_shape(StringOrSymbol const& property_key, size_t offset)
@@ -220,6 +238,7 @@ void Shape::remove_property_from_unique_shape(StringOrSymbol const& property_key
         if (it.value.offset > offset)
             --it.value.offset;
     }
+    invalidate_serial_number();
 }
 
 void Shape::add_property_without_transition(StringOrSymbol const& property_key, PropertyAttributes attributes)
@@ -230,6 +249,7 @@ void Shape::add_property_without_transition(StringOrSymbol const& property_key,
         VERIFY(m_property_count < NumericLimits<u32>::max());
         ++m_property_count;
     }
+    invalidate_serial_number();
 }
 
 FLATTEN void Shape::add_property_without_transition(PropertyKey const& property_key, PropertyAttributes attributes)
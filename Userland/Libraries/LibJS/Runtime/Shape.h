@@ -68,6 +68,11 @@ public:
     HashMap<StringOrSymbol, PropertyMetadata> const& property_table() const;
     u32 property_count() const { return m_property_count; }
 
+    // Identifies this shape, including its current properties and prototype. No two shapes share a serial number, and
+    // shapes that are modified in place get a new one, so comparing serial numbers is enough to tell whether a property
+    // lookup made against some shape still holds.
+    u64 serial_number() const { return m_serial_number; }
+
     struct Property {
         StringOrSymbol key;
         PropertyMetadata value;
@@ -75,7 +80,7 @@ public:
 
     Vector<Property> property_table_ordered() const;
 
-    void set_prototype_without_transition(Object* new_prototype) { m_prototype = new_prototype; }
+    void set_prototype_without_transition(Object* new_prototype);
 
     void remove_property_from_unique_shape(StringOrSymbol const&, size_t offset);
     void add_property_to_unique_shape(StringOrSymbol const&, PropertyAttributes attributes);
@@ -92,6 +97,7 @@ private:
     Shape* get_or_prune_cached_prototype_transition(Object* prototype);
 
     void ensure_property_table() const;
+    void invalidate_serial_number();
 
     NonnullGCPtr<Realm> m_realm;
 
@@ -103,6 +109,7 @@ private:
     StringOrSymbol m_property_key;
     GCPtr<Object> m_prototype;
     u32 m_property_count { 0 };
+    u64 m_serial_number { 0 };
 
     PropertyAttributes m_attributes { 0 };
     TransitionType m_transition_type : 6 { TransitionType::Invalid };
@@ -4,25 +4,217 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
+#include <AK/Hex.h>
+#include <AK/WeakPtr.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibCrypto/Hash/SHA2.h>
 #include <LibJS/AST.h>
 #include <LibJS/Lexer.h>
 #include <LibJS/Parser.h>
+#include <LibJS/PreParser.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Script.h>
 
 namespace JS {
 
+// Parsing makes up most of the cost of loading a large script, and pages keep loading the same library scripts over
+// and over. Parse nodes aren't tied to a realm, so the programs of recently parsed large scripts are kept around and
+// handed out again when the exact same source text is parsed for another realm.
+//
+// A realm never gets the same program twice, since per-realm state like template objects is keyed on parse nodes, and
+// two scripts with the same source text must not share it.
+class ParsedProgramCache {
+public:
+    static constexpr size_t min_source_length = 4 * KiB;
+    static constexpr size_t max_total_source_length = 8 * MiB;
+    static constexpr size_t max_entry_count = 128;
+
+    RefPtr<Program> take(StringView source_text, StringView filename, size_t line_number_offset, Realm const& realm)
+    {
+        // Don't bother hashing the source text of scripts that would never have been added.
+        if (source_text.length() < min_source_length || source_text.length() > max_total_source_length)
+            return nullptr;
+
+        auto index = find(source_text, filename, line_number_offset);
+        if (!index.has_value() || m_entries[*index].was_given_to(realm))
+            return nullptr;
+
+        // Keep the entries ordered from least to most recently used.
+        auto entry = m_entries.take(*index);
+        entry.realms.append(realm.make_weak_ptr<Realm>());
+        auto program = entry.program;
+        m_entries.append(move(entry));
+        return program;
+    }
+
+    void add(NonnullRefPtr<Program> program, size_t line_number_offset, Realm const& realm)
+    {
+        auto source_text = program->source_code().code().bytes_as_string_view();
+        if (source_text.length() < min_source_length || source_text.length() > max_total_source_length)
+            return;
+
+        // Functions hoisted by Annex B are marked while instantiating the global declarations, depending on what
+        // the global environment of the realm looks like at that time.
+        bool has_functions_hoistable_with_annexB_extension = false;
+        MUST(program->for_each_function_hoistable_with_annexB_extension([&](auto&) -> ThrowCompletionOr<void> {
+            has_functions_hoistable_with_annexB_extension = true;
+            return {};
+        }));
+        if (has_functions_hoistable_with_annexB_extension)
+            return;
+
+        // A realm that parses a script for the second time gets a new program, which replaces the one it already has.
+        auto filename = program->source_code().filename().bytes_as_string_view();
+        if (auto index = find(source_text, filename, line_number_offset); index.has_value()) {
+            m_total_source_length -= source_text.length();
+            m_entries.remove(*index);
+        }
+
+        while (!m_entries.is_empty() && (m_total_source_length + source_text.length() > max_total_source_length || m_entries.size() >= max_entry_count))
+            m_total_source_length -= m_entries.take_first().program->source_code().code().bytes().size();
+
+        Vector<WeakPtr<Realm>> realms;
+        realms.append(realm.make_weak_ptr<Realm>());
+        m_total_source_length += source_text.length();
+        m_entries.append({ source_text.hash(), line_number_offset, move(program), move(realms) });
+    }
+
+private:
+    Optional<size_t> find(StringView source_text, StringView filename, size_t line_number_offset) const
+    {
+        auto hash = source_text.hash();
+        for (size_t i = 0; i < m_entries.size(); ++i) {
+            auto const& entry = m_entries[i];
+            if (entry.source_hash != hash || entry.line_number_offset != line_number_offset)
+                continue;
+            auto const& source_code = entry.program->source_code();
+            if (source_code.code().bytes_as_string_view() != source_text)
+                continue;
+            // NOTE: A null StringView doesn't compare equal to an empty one, which scripts without a filename may have.
+            auto entry_filename = source_code.filename().bytes_as_string_view();
+            if (entry_filename == filename || (entry_filename.is_empty() && filename.is_empty()))
+                return i;
+        }
+        return {};
+    }
+
+    struct Entry {
+        u32 source_hash { 0 };
+        size_t line_number_offset { 0 };
+        NonnullRefPtr<Program> program;
+
+        // Forgets about the realms that have been garbage collected since, and returns whether the given realm is one
+        // of those that have been given this program.
+        bool was_given_to(Realm const& realm)
+        {
+            realms.remove_all_matching([](auto const& given_realm) { return !given_realm; });
+            return any_of(realms, [&](auto const& given_realm) { return given_realm.ptr() == &realm; });
+        }
+
+        // The realms that have been given this program.
+        Vector<WeakPtr<Realm>> realms;
+    };
+
+    Vector<Entry> m_entries;
+    size_t m_total_source_length { 0 };
+};
+
+static ParsedProgramCache s_parsed_program_cache;
+
+// The parsed program cache doesn't outlive the process, so the pre-parse data of large scripts is kept on disk as well.
+// With it, a new process parsing the same source text skips over the bodies of functions that aren't called right
+// away. The AST itself (and the bytecode generated from it) can't be stored, since it is made of pointers all the way
+// down.
+class PreParseDataCache {
+public:
+    void set_directory(DeprecatedString directory) { m_directory = move(directory); }
+
+    // Returns the path the pre-parse data of the given source text is kept at, if it is worth keeping any.
+    Optional<DeprecatedString> path_for(StringView source_text, size_t line_number_offset) const
+    {
+        if (m_directory.is_null() || source_text.length() < ParsedProgramCache::min_source_length)
+            return {};
+
+        // Line numbers end up in the pre-parse data, filenames don't.
+        Crypto::Hash::SHA256 hash;
+        hash.update(source_text.bytes().data(), source_text.length());
+        u64 line_number_offset_value = line_number_offset;
+        hash.update(reinterpret_cast<u8 const*>(&line_number_offset_value), sizeof(line_number_offset_value));
+        auto digest = hash.digest();
+        return DeprecatedString::formatted("{}/{}.jspd", m_directory, encode_hex(digest.bytes()));
+    }
+
+    ErrorOr<PreParseData> load(StringView path, StringView source_text) const
+    {
+        auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
+        auto bytes = TRY(file->read_until_eof());
+        return PreParseData::deserialize(bytes, source_text);
+    }
+
+    ErrorOr<void> store(StringView path, PreParseData const& preparse_data) const
+    {
+        auto bytes = TRY(preparse_data.serialize());
+
+        // Other processes may be reading the same file, so it is only replaced once it has been written in full.
+        auto temporary_path = DeprecatedString::formatted("{}.{}", path, getpid());
+        {
+            auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+            TRY(file->write_until_depleted(bytes));
+        }
+        TRY(Core::System::rename(temporary_path, path));
+        return {};
+    }
+
+private:
+    DeprecatedString m_directory;
+};
+
+static PreParseDataCache s_preparse_data_cache;
+
+void Script::set_preparse_data_cache_directory(DeprecatedString directory)
+{
+    s_preparse_data_cache.set_directory(move(directory));
+}
+
 // 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
 Result<NonnullGCPtr<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
 {
+    // OPTIMIZATION: Reuse the program that was produced for the same source text in another realm, if we still have it.
+    if (auto program = s_parsed_program_cache.take(source_text, filename, line_number_offset, realm))
+        return realm.heap().allocate_without_realm<Script>(realm, filename, program.release_nonnull(), host_defined);
+
+    // OPTIMIZATION: Skip over the function bodies that a previous parse of the same source text has already checked.
+    PreParseData preparse_data;
+    auto preparse_data_path = s_preparse_data_cache.path_for(source_text, line_number_offset);
+    auto has_stored_preparse_data = false;
+    if (preparse_data_path.has_value()) {
+        if (auto stored_preparse_data = s_preparse_data_cache.load(*preparse_data_path, source_text); !stored_preparse_data.is_error()) {
+            preparse_data = stored_preparse_data.release_value();
+            has_stored_preparse_data = true;
+        }
+    }
+
     // 1. Let script be ParseText(sourceText, Script).
     auto parser = Parser(Lexer(source_text, filename, line_number_offset));
+    parser.set_preparse_data(preparse_data);
     auto script = parser.parse_program();
 
     // 2. If script is a List of errors, return body.
     if (parser.has_errors())
         return parser.errors();
 
+    // NOTE: Bodies with tagged templates in them must not be skipped, since that is how we find out about those.
+    if (preparse_data_path.has_value() && !has_stored_preparse_data && !parser.has_parsed_tagged_template_literals()) {
+        if (auto result = s_preparse_data_cache.store(*preparse_data_path, preparse_data); result.is_error())
+            dbgln("Failed to store pre-parse data for {}: {}", filename, result.error());
+    }
+
+    // Template objects are kept alive by the parse nodes of tagged templates, and would keep the realm alive with them.
+    if (!parser.has_parsed_tagged_template_literals())
+        s_parsed_program_cache.add(script, line_number_offset, realm);
+
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
     return realm.heap().allocate_without_realm<Script>(realm, filename, move(script), host_defined);
 }
@@ -28,6 +28,9 @@ public:
     virtual ~Script() override;
     static Result<NonnullGCPtr<Script>, Vector<ParserError>> parse(StringView source_text, Realm&, StringView filename = {}, HostDefined* = nullptr, size_t line_number_offset = 1);
 
+    // Where to keep what was learned from parsing large scripts, for other processes parsing them again.
+    static void set_preparse_data_cache_directory(DeprecatedString);
+
     Realm& realm() { return *m_realm; }
     Program const& parse_node() const { return *m_parse_node; }
 
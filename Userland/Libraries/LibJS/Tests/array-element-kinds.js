@@ -0,0 +1,147 @@
+test("holes read through to the prototype chain", () => {
+    const array = [1, , 3];
+    expect(array[1]).toBeUndefined();
+    expect(array.indexOf(undefined)).toBe(-1);
+
+    Array.prototype[1] = "prototype";
+    try {
+        expect(array[1]).toBe("prototype");
+        expect(array.indexOf("prototype")).toBe(1);
+        expect(array.map(x => x)).toEqual([1, "prototype", 3]);
+    } finally {
+        delete Array.prototype[1];
+    }
+    expect(array[1]).toBeUndefined();
+});
+
+test("indexed setters on the prototype chain are not bypassed", () => {
+    let value;
+    const prototype = Object.create(Array.prototype);
+    Object.defineProperty(prototype, 2, {
+        set(v) {
+            value = v;
+        },
+    });
+    const array = [0, 1];
+    Object.setPrototypeOf(array, prototype);
+    array.push("pushed");
+    expect(value).toBe("pushed");
+    expect(array).toHaveLength(3);
+    expect(Object.hasOwn(array, 2)).toBeFalse();
+});
+
+test("proxies on the prototype chain are not bypassed", () => {
+    const array = [1, , 3];
+    const handler = {
+        has: (target, key) => key === "1" || key in target,
+        get: (target, key) => (key === "1" ? "trapped" : target[key]),
+    };
+    Object.setPrototypeOf(array, new Proxy(Array.prototype, handler));
+    expect(array[1]).toBe("trapped");
+    expect(array.map(x => x)).toEqual([1, "trapped", 3]);
+});
+
+test("frozen arrays and non-writable lengths", () => {
+    const frozen = Object.freeze([1, 2, 3]);
+    expect(() => frozen.push(4)).toThrow(TypeError);
+    expect(() => frozen.pop()).toThrow(TypeError);
+    expect(frozen).toEqual([1, 2, 3]);
+
+    const fixedLength = [1, 2, 3];
+    Object.defineProperty(fixedLength, "length", { writable: false });
+    expect(() => fixedLength.push(4)).toThrow(TypeError);
+    expect(() => fixedLength.pop()).toThrow(TypeError);
+
+    const nonExtensible = Object.preventExtensions([1, 2]);
+    expect(() => nonExtensible.push(3)).toThrow(TypeError);
+    expect(nonExtensible.pop()).toBe(2);
+});
+
+test("element kinds generalize as values are stored", () => {
+    const array = [1, 2, 3];
+    expect(array.indexOf("1")).toBe(-1);
+    array[1] = 1.5;
+    expect(array.indexOf(1.5)).toBe(1);
+    array[2] = "three";
+    expect(array.indexOf("three")).toBe(2);
+    array.length = 5;
+    array[4] = 5;
+    expect(array.indexOf(undefined)).toBe(-1);
+    expect(array.pop()).toBe(5);
+    expect(array.pop()).toBeUndefined();
+    expect(array).toHaveLength(3);
+});
+
+test("callbacks that modify the array", () => {
+    const array = [1, 2, 3, 4];
+    const result = array.map((x, i) => {
+        if (i === 0) array.length = 2;
+        return x * 2;
+    });
+    expect(result).toHaveLength(4);
+    expect(result[0]).toBe(2);
+    expect(result[1]).toBe(4);
+    expect(Object.hasOwn(result, 2)).toBeFalse();
+});
+
+test("searching arrays of Int32s", () => {
+    const array = [3, -1, 0, 3, 7];
+    expect(array.indexOf(3)).toBe(0);
+    expect(array.lastIndexOf(3)).toBe(3);
+    expect(array.lastIndexOf(3, 2)).toBe(0);
+    expect(array.lastIndexOf(3, -3)).toBe(0);
+    expect(array.indexOf(-0)).toBe(2);
+    expect(array.lastIndexOf(-0)).toBe(2);
+    expect(array.includes(-0)).toBeTrue();
+    expect(array.includes(7)).toBeTrue();
+    expect(array.includes(7, -1)).toBeTrue();
+    expect(array.includes(3, 4)).toBeFalse();
+    expect(array.indexOf(3.5)).toBe(-1);
+    expect(array.includes(NaN)).toBeFalse();
+    expect(array.includes("3")).toBeFalse();
+    expect(array.lastIndexOf("3")).toBe(-1);
+});
+
+test("searching arrays of numbers", () => {
+    const array = [1.5, NaN, 2];
+    expect(array.includes(NaN)).toBeTrue();
+    expect(array.indexOf(NaN)).toBe(-1);
+    expect(array.lastIndexOf(NaN)).toBe(-1);
+    expect(array.lastIndexOf(1.5)).toBe(0);
+    expect(array.includes(undefined)).toBeFalse();
+});
+
+test("includes finds holes when looking for undefined", () => {
+    const array = [1, , 3];
+    expect(array.includes(undefined)).toBeTrue();
+    expect(array.includes(undefined, 2)).toBeFalse();
+    expect(array.lastIndexOf(undefined)).toBe(-1);
+
+    const shrunk = [1, 2, 3];
+    const fromIndex = {
+        valueOf() {
+            shrunk.length = 1;
+            return 0;
+        },
+    };
+    expect(shrunk.includes(undefined, fromIndex)).toBeTrue();
+});
+
+test("lastIndexOf after fromIndex shrinks the array", () => {
+    const array = [1, 2, 3];
+    const fromIndex = {
+        valueOf() {
+            array.length = 1;
+            return 2;
+        },
+    };
+    expect(array.lastIndexOf(3, fromIndex)).toBe(-1);
+    expect(array.lastIndexOf(1)).toBe(0);
+});
+
+test("sorting Int32s by their string forms", () => {
+    expect([10, 9, -1, 1, -10, 0, 100, -2147483648, 2147483647].sort()).toEqual([
+        -1, -10, -2147483648, 0, 1, 10, 100, 2147483647, 9,
+    ]);
+    expect([3, , 1, undefined, 2].toSorted()).toEqual([1, 2, 3, undefined, undefined]);
+});
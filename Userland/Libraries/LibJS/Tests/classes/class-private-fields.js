@@ -108,6 +108,18 @@ test("private identifier not followed by 'in' throws", () => {
     expect(`class A { #field = 2; method() { return #field in 1; }}`).toEval();
 });
 
+test("static private methods called from methods", () => {
+    class A {
+        static #twice(value) {
+            return value * 2;
+        }
+        twice(value) {
+            return A.#twice(value);
+        }
+    }
+    expect(new A().twice(22)).toBe(44);
+});
+
 test("cannot have static and non static field with the same description", () => {
     expect("class A { static #simple; #simple; }").not.toEval();
 });
@@ -0,0 +1,157 @@
+// Inner function bodies are parsed again the first time the function is called.
+
+test("syntax errors in functions that are never called are still reported", () => {
+    expect("function f() { return 1 +; }").not.toEval();
+    expect("function f() { function g() { let a; let a; } }").not.toEval();
+    expect("function f() { 'use strict'; with ({}) {} }").not.toEval();
+    expect("'use strict'; function f() { var eval; }").not.toEval();
+    expect("class A { f() { return this.#x; } }").not.toEval();
+    expect("function f() { let a; var a; }").not.toEval();
+    expect("function f() { for (;;) {} break; }").not.toEval();
+    expect("function f() { const a; }").not.toEval();
+    expect("function f() { ({ a: 1 } = 2); }").not.toEval();
+    expect("function f() { return 1; }").toEval();
+});
+
+test("nested functions", () => {
+    function outer(a) {
+        function middle(b) {
+            function inner(c) {
+                return a + b + c;
+            }
+            return inner(3);
+        }
+        return middle(2);
+    }
+    expect(outer(1)).toBe(6);
+    expect(outer(10)).toBe(15);
+});
+
+test("strict mode is inherited from the enclosing code", () => {
+    function strictOuter() {
+        "use strict";
+        function inner() {
+            return isStrictMode();
+        }
+        return inner();
+    }
+    function sloppyOuter() {
+        function inner() {
+            return isStrictMode();
+        }
+        return inner();
+    }
+    expect(strictOuter()).toBeTrue();
+    expect(sloppyOuter()).toBeFalse();
+});
+
+test("source text is unaffected", () => {
+    function f(a, b) {
+        // comment
+        return a + b;
+    }
+    expect(f.toString()).toBe("function f(a, b) {\n        // comment\n        return a + b;\n    }");
+    expect(f(1, 2)).toBe(3);
+    expect(f.toString()).toBe("function f(a, b) {\n        // comment\n        return a + b;\n    }");
+});
+
+test("super in methods", () => {
+    class A {
+        constructor() {
+            this.base = 20;
+        }
+        value() {
+            return this.base;
+        }
+    }
+    class B extends A {
+        constructor() {
+            super();
+            this.extra = 2;
+        }
+        value() {
+            return super.value() + this.extra;
+        }
+    }
+    expect(new B().value()).toBe(22);
+});
+
+test("generator and async functions", () => {
+    function* generator() {
+        function* inner() {
+            yield 2;
+        }
+        yield 1;
+        yield* inner();
+    }
+    expect([...generator()]).toEqual([1, 2]);
+
+    let result = null;
+    async function asyncFunction() {
+        await null;
+        return 3;
+    }
+    asyncFunction().then(value => {
+        result = value;
+    });
+    runQueuedPromiseJobs();
+    expect(result).toBe(3);
+});
+
+test("arguments object", () => {
+    function f() {
+        function g() {
+            return arguments.length + arguments[0];
+        }
+        return g(5, 6, 7);
+    }
+    expect(f()).toBe(8);
+});
+
+test("arguments object in arrow functions", () => {
+    function f() {
+        const g = () => arguments[1];
+        return g();
+    }
+    expect(f(1, 2)).toBe(2);
+});
+
+test("regular expressions and division", () => {
+    function f(a) {
+        const b = a / 2 / 1;
+        const re = /a/g;
+        return b + "a".replace(re, "b");
+    }
+    expect(f(4)).toBe("2b");
+});
+
+test("functions in default parameter values", () => {
+    function f(
+        g = function () {
+            return 4;
+        }
+    ) {
+        return g();
+    }
+    expect(f()).toBe(4);
+});
+
+test("functions in template literal substitutions", () => {
+    function f() {
+        return `a${(() => {
+            function g() {
+                return "b";
+            }
+            return g();
+        })()}c`;
+    }
+    expect(f()).toBe("abc");
+});
+
+test("errors created in lazily parsed functions have the right location", () => {
+    function thrower() {
+        return new Error();
+    }
+    const stackFrames = thrower().stack.trim().split("\n");
+    expect(!!stackFrames[2].match(/^    at thrower \(.+\/function-lazy-body\.js:153:20\)$/)).toBeTrue();
+});
@@ -0,0 +1,88 @@
+// Functions are handed to the JIT once they have been called often enough, so all of these run each case repeatedly.
+const calls = 100;
+
+test("int32 arithmetic overflows into doubles", () => {
+    const add = (a, b) => a + b;
+    const sub = (a, b) => a - b;
+    const mul = (a, b) => a * b;
+    for (let i = 0; i < calls; ++i) {
+        expect(add(1, 2)).toBe(3);
+        expect(add(2147483647, 1)).toBe(2147483648);
+        expect(add(0.5, 1)).toBe(1.5);
+        expect(add("a", 1)).toBe("a1");
+        expect(sub(-2147483648, 1)).toBe(-2147483649);
+        expect(mul(65536, 65536)).toBe(4294967296);
+        expect(mul(-3, 7)).toBe(-21);
+        expect(Object.is(mul(0, -1), -0)).toBeTrue();
+        expect(Object.is(mul(-1, 0), -0)).toBeTrue();
+        expect(Object.is(mul(0, 1), 0)).toBeTrue();
+    }
+});
+
+test("bitwise operations and comparisons", () => {
+    const ops = (a, b) => [a & b, a | b, a ^ b, a < b, a <= b, a > b, a >= b, a === b, a !== b, a == b, a != b];
+    for (let i = 0; i < calls; ++i) {
+        expect(ops(6, 3)).toEqual([2, 7, 5, false, false, true, true, false, true, false, true]);
+        expect(ops(-1, -1)).toEqual([-1, -1, 0, false, true, false, true, true, false, true, false]);
+        expect(ops(1, "1")).toEqual([1, 1, 0, false, true, false, true, false, true, true, false]);
+        expect(ops(1.5, 1)).toEqual([1, 1, 0, false, false, true, true, false, true, false, true]);
+    }
+});
+
+test("increment and decrement", () => {
+    let value = 2147483640;
+    for (let i = 0; i < 20; ++i) value++;
+    expect(value).toBe(2147483660);
+    for (let i = 0; i < 40; ++i) value--;
+    expect(value).toBe(2147483620);
+
+    let big = 0n;
+    for (let i = 0; i < 2000; ++i) big++;
+    expect(big).toBe(2000n);
+});
+
+test("conditional jumps", () => {
+    const truthiness = value => (value ? 1 : 0);
+    const nullish = value => value ?? "default";
+    const withDefault = (value = "default") => value;
+    for (let i = 0; i < calls; ++i) {
+        expect([true, false, 0, 1, -1, "", "a", null, undefined, NaN, 0.5, {}].map(truthiness)).toEqual([
+            1, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 1,
+        ]);
+        expect([null, undefined, 0, false].map(nullish)).toEqual(["default", "default", 0, false]);
+        expect(withDefault(undefined)).toBe("default");
+        expect(withDefault(null)).toBeNull();
+    }
+});
+
+test("hot loops", () => {
+    let sum = 0;
+    for (let i = 0; i < 100000; ++i) sum += i;
+    expect(sum).toBe(4999950000);
+
+    let count = 0;
+    let i = 0;
+    while (true) {
+        if (++i > 5000) break;
+        if (i % 2) continue;
+        count++;
+    }
+    expect(count).toBe(2500);
+});
+
+test("exceptions from compiled code", () => {
+    const thrower = value => {
+        if (value > 10) throw new Error(`too big: ${value}`);
+        return value;
+    };
+    for (let i = 0; i < calls; ++i) {
+        expect(thrower(1)).toBe(1);
+        expect(() => thrower(11)).toThrowWithMessage(Error, "too big: 11");
+        expect(() => undefinedVariable + 1).toThrow(ReferenceError);
+    }
+});
+
+test("recursion", () => {
+    const fib = n => (n < 2 ? n : fib(n - 1) + fib(n - 2));
+    expect(fib(20)).toBe(6765);
+});
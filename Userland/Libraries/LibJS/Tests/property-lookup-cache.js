@@ -0,0 +1,132 @@
+const getFoo = o => o.foo;
+const setFoo = (o, value) => {
+    o.foo = value;
+};
+
+test("polymorphic lookups", () => {
+    const objects = [{ foo: 1 }, { bar: 0, foo: 2 }, { baz: 0, bar: 0, foo: 3 }, { foo: 4, x: 0 }, { y: 0, foo: 5 }];
+    for (let i = 0; i < 3; ++i) {
+        for (let j = 0; j < objects.length; ++j) expect(getFoo(objects[j])).toBe(j + 1);
+    }
+});
+
+test("properties on the prototype chain", () => {
+    const grandparent = { foo: "grandparent" };
+    const parent = Object.create(grandparent);
+    const child = Object.create(parent);
+    expect(getFoo(child)).toBe("grandparent");
+    expect(getFoo(child)).toBe("grandparent");
+
+    parent.foo = "parent";
+    expect(getFoo(child)).toBe("parent");
+
+    delete parent.foo;
+    expect(getFoo(child)).toBe("grandparent");
+
+    Object.setPrototypeOf(parent, { foo: "new grandparent" });
+    expect(getFoo(child)).toBe("new grandparent");
+
+    child.foo = "child";
+    expect(getFoo(child)).toBe("child");
+});
+
+test("objects with unique shapes", () => {
+    const o = {};
+    for (let i = 0; i < 200; ++i) o["p" + i] = i;
+    o.foo = "a";
+    expect(getFoo(o)).toBe("a");
+    expect(getFoo(o)).toBe("a");
+
+    delete o.p0;
+    expect(getFoo(o)).toBe("a");
+    setFoo(o, "b");
+    expect(getFoo(o)).toBe("b");
+    expect(o.p1).toBe(1);
+});
+
+test("getters", () => {
+    let calls = 0;
+    const prototype = {
+        get foo() {
+            ++calls;
+            return this.value;
+        },
+    };
+    const a = Object.create(prototype);
+    a.value = 1;
+    const b = Object.create(prototype);
+    b.value = 2;
+    expect(getFoo(a)).toBe(1);
+    expect(getFoo(b)).toBe(2);
+    expect(calls).toBe(2);
+});
+
+test("writes to non-writable properties", () => {
+    const strictSetFoo = (o, value) => {
+        "use strict";
+        o.foo = value;
+    };
+    const o = { foo: 1 };
+    strictSetFoo(o, 2);
+    strictSetFoo(o, 3);
+    expect(o.foo).toBe(3);
+
+    Object.freeze(o);
+    expect(() => {
+        strictSetFoo(o, 4);
+    }).toThrow(TypeError);
+    expect(o.foo).toBe(3);
+});
+
+test("setters on the prototype chain are not bypassed", () => {
+    let value;
+    const o = Object.create({
+        set foo(v) {
+            value = v;
+        },
+    });
+    setFoo(o, 1);
+    setFoo(o, 2);
+    expect(value).toBe(2);
+    expect(Object.hasOwn(o, "foo")).toBeFalse();
+});
+
+test("proxies sharing a shape with a cached object", () => {
+    const target = {};
+    const ordinary = Object.create(Object.prototype);
+    expect(getFoo(Object.assign(ordinary, { foo: 1 }))).toBe(1);
+
+    const proxy = new Proxy(target, { get: () => "trapped" });
+    expect(getFoo(proxy)).toBe("trapped");
+    expect(proxy.toString).toBe("trapped");
+    expect(proxy.toString).toBe("trapped");
+});
+
+test("length is never cached", () => {
+    const getLength = o => o.length;
+    const prototype = { length: "prototype" };
+    const object = Object.create(prototype);
+    const array = [];
+    Object.setPrototypeOf(array, prototype);
+    expect(getLength(object)).toBe("prototype");
+    expect(getLength(array)).toBe(0);
+    Array.prototype.push.call(array, 1, 2);
+    expect(getLength(array)).toBe(2);
+});
+
+var globalVariable = 1;
+globalThis.globalProperty = 1;
+
+test("global variables", () => {
+    const readVariable = () => globalVariable;
+    expect(readVariable()).toBe(1);
+    globalVariable = 2;
+    expect(readVariable()).toBe(2);
+    globalThis.globalVariable = 3;
+    expect(readVariable()).toBe(3);
+
+    const readProperty = () => globalProperty;
+    expect(readProperty()).toBe(1);
+    Object.defineProperty(globalThis, "globalProperty", { get: () => 2, configurable: true });
+    expect(readProperty()).toBe(2);
+});
@@ -28,3 +28,60 @@ test("adding strings with dangling surrogates", () => {
     expect("\ud834a" + "\udf06").toBe("\ud834a\udf06");
     expect("\ud834" + "a\udf06").toBe("\ud834a\udf06");
 });
+
+test("appending to a string that is looked at in between", () => {
+    let string = "";
+    let expected = [];
+    for (let i = 0; i < 3000; ++i) {
+        string += `<${i}>`;
+        expected.push(`<${i}>`);
+        expect(string.length).toBe(expected.join("").length);
+    }
+    expect(string).toBe(expected.join(""));
+});
+
+test("appending different strings to the same string", () => {
+    let base = "a";
+    for (let i = 0; i < 10; ++i) {
+        base += "b";
+        expect(base.length).toBe(i + 2);
+    }
+    const first = base + "first";
+    const second = base + "second";
+    expect(first.length).toBe(16);
+    expect(second.length).toBe(17);
+    expect(first).toBe("abbbbbbbbbbfirst");
+    expect(second).toBe("abbbbbbbbbbsecond");
+    expect(base).toBe("abbbbbbbbbb");
+});
+
+test("appending non-ASCII strings", () => {
+    let string = "";
+    for (let i = 0; i < 1000; ++i) {
+        string += "ü" + i;
+        expect(string.charCodeAt(string.length - String(i).length - 1)).toBe(0xfc);
+    }
+    expect(string.startsWith("ü0ü1ü2")).toBeTrue();
+    expect(string.endsWith("ü999")).toBeTrue();
+
+    let mixed = "";
+    for (let i = 0; i < 100; ++i) {
+        mixed += "a";
+        expect(mixed.length).toBe(3 * i + 1);
+        mixed += "\ud834";
+        mixed += "\udf06";
+        expect(mixed.length).toBe(3 * i + 3);
+        expect(mixed.codePointAt(mixed.length - 2)).toBe(0x1d306);
+    }
+});
+
+test("very long chains of concatenations", () => {
+    let string = "";
+    for (let i = 0; i < 50000; ++i) string += "x";
+    expect(string.length).toBe(50000);
+
+    let prepended = "";
+    for (let i = 0; i < 50000; ++i) prepended = "y" + prepended;
+    expect(prepended.length).toBe(50000);
+    expect(prepended + string).toBe("y".repeat(50000) + "x".repeat(50000));
+});
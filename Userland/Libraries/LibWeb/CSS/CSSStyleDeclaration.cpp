@@ -18,6 +18,7 @@ namespace Web::CSS {
 CSSStyleDeclaration::CSSStyleDeclaration(JS::Realm& realm)
     : PlatformObject(realm)
 {
+    m_may_interfere_with_property_lookup_caches = true;
 }
 
 JS::ThrowCompletionOr<void> CSSStyleDeclaration::initialize(JS::Realm& realm)
@@ -23,6 +23,82 @@ Selector::Selector(Vector<CompoundSelector>&& compound_selectors)
             }
         }
     }
+
+    collect_ancestor_hashes();
+    m_depends_on_element_state = compute_depends_on_element_state();
+}
+
+bool Selector::compute_depends_on_element_state() const
+{
+    for (auto const& compound_selector : m_compound_selectors) {
+        if (compound_selector.combinator == Combinator::NextSibling || compound_selector.combinator == Combinator::SubsequentSibling || compound_selector.combinator == Combinator::Column)
+            return true;
+        for (auto const& simple_selector : compound_selector.simple_selectors) {
+            if (simple_selector.type != SimpleSelector::Type::PseudoClass)
+                continue;
+            auto const& pseudo_class = simple_selector.pseudo_class();
+            switch (pseudo_class.type) {
+            case SimpleSelector::PseudoClass::Type::Link:
+            case SimpleSelector::PseudoClass::Type::Visited:
+            case SimpleSelector::PseudoClass::Type::Root:
+            case SimpleSelector::PseudoClass::Type::Lang:
+            case SimpleSelector::PseudoClass::Type::Is:
+            case SimpleSelector::PseudoClass::Type::Not:
+            case SimpleSelector::PseudoClass::Type::Where:
+                for (auto const& argument_selector : pseudo_class.argument_selector_list) {
+                    if (argument_selector->depends_on_element_state())
+                        return true;
+                }
+                break;
+            default:
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void Selector::collect_ancestor_hashes()
+{
+    if (m_compound_selectors.is_empty())
+        return;
+
+    size_t hash_count = 0;
+    auto add_hash = [&](AncestorFilterHashType type, FlyString const& name) {
+        if (hash_count == max_ancestor_hashes)
+            return false;
+        m_ancestor_hashes[hash_count++] = ancestor_filter_hash(type, name);
+        return true;
+    };
+
+    // Walk from the subject towards the left. A compound selector before a descendant or child combinator has to
+    // match an ancestor. One before a sibling combinator matches a sibling instead, but the compound selectors to
+    // its left can still only match ancestors.
+    for (size_t i = m_compound_selectors.size() - 1; i > 0; --i) {
+        auto combinator = m_compound_selectors[i].combinator;
+        if (combinator == Combinator::NextSibling || combinator == Combinator::SubsequentSibling)
+            continue;
+        if (combinator != Combinator::Descendant && combinator != Combinator::ImmediateChild)
+            break;
+        for (auto const& simple_selector : m_compound_selectors[i - 1].simple_selectors) {
+            bool added = true;
+            switch (simple_selector.type) {
+            case SimpleSelector::Type::TagName:
+                added = add_hash(AncestorFilterHashType::TagName, simple_selector.name());
+                break;
+            case SimpleSelector::Type::Id:
+                added = add_hash(AncestorFilterHashType::Id, simple_selector.name());
+                break;
+            case SimpleSelector::Type::Class:
+                added = add_hash(AncestorFilterHashType::Class, simple_selector.name());
+                break;
+            default:
+                break;
+            }
+            if (!added)
+                return;
+        }
+    }
 }
 
 // https://www.w3.org/TR/selectors-4/#specificity-rules
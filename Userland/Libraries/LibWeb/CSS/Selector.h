@@ -7,15 +7,34 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/FlyString.h>
+#include <AK/HashFunctions.h>
 #include <AK/RefCounted.h>
 #include <AK/String.h>
+#include <AK/StringHash.h>
 #include <AK/Vector.h>
 
 namespace Web::CSS {
 
 using SelectorList = Vector<NonnullRefPtr<class Selector>>;
 
+// Hashes of the tag names, ids and classes of elements, as stored in the ancestor filter of the StyleComputer.
+// NOTE: These are case-insensitive, as tag names are matched case-insensitively outside of HTML documents,
+//       and classes and ids are in quirks mode.
+enum class AncestorFilterHashType : u8 {
+    TagName = 1,
+    Id,
+    Class,
+};
+
+inline u32 ancestor_filter_hash(AncestorFilterHashType type, StringView name)
+{
+    auto hash = pair_int_hash(AK::case_insensitive_string_hash(name.characters_without_null_termination(), name.length()), to_underlying(type));
+    // NOTE: Zero terminates the list of ancestor hashes of a selector.
+    return hash ? hash : 1;
+}
+
 // This is a <complex-selector> in the spec. https://www.w3.org/TR/selectors-4/#complex
 class Selector : public RefCounted<Selector> {
 public:
@@ -204,12 +223,26 @@ public:
     u32 specificity() const;
     ErrorOr<String> serialize() const;
 
+    // Ancestor filter hashes of tag names, ids and classes that an element matching this selector must have among
+    // its ancestors. If there are fewer than the maximum, the list is terminated by a zero.
+    static constexpr size_t max_ancestor_hashes = 8;
+    Array<u32, max_ancestor_hashes> const& ancestor_hashes() const { return m_ancestor_hashes; }
+
+    // Whether matching this selector can depend on more than the tag names and attributes of an element and its
+    // ancestors: its siblings, its children, or dynamic state like :hover.
+    bool depends_on_element_state() const { return m_depends_on_element_state; }
+
 private:
     explicit Selector(Vector<CompoundSelector>&&);
 
+    void collect_ancestor_hashes();
+    bool compute_depends_on_element_state() const;
+
     Vector<CompoundSelector> m_compound_selectors;
     mutable Optional<u32> m_specificity;
     Optional<Selector::PseudoElement> m_pseudo_element;
+    Array<u32, max_ancestor_hashes> m_ancestor_hashes {};
+    bool m_depends_on_element_state { false };
 };
 
 constexpr StringView pseudo_element_name(Selector::PseudoElement pseudo_element)
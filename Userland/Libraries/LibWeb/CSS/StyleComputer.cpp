@@ -59,12 +59,19 @@
 #include <LibWeb/CSS/StyleValues/TimeStyleValue.h>
 #include <LibWeb/CSS/StyleValues/TransformationStyleValue.h>
 #include <LibWeb/CSS/StyleValues/UnresolvedStyleValue.h>
+#include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/FontCache.h>
 #include <LibWeb/HTML/HTMLHtmlElement.h>
+#include <LibWeb/HTML/HTMLInputElement.h>
+#include <LibWeb/HTML/HTMLOptionElement.h>
+#include <LibWeb/HTML/HTMLSelectElement.h>
+#include <LibWeb/HTML/HTMLTextAreaElement.h>
 #include <LibWeb/Layout/Node.h>
 #include <LibWeb/Loader/ResourceLoader.h>
+#include <LibWeb/Namespace.h>
 #include <LibWeb/Platform/FontPlugin.h>
 #include <stdio.h>
 
@@ -242,16 +249,75 @@ Vector<MatchingRule> StyleComputer::collect_matching_rules(DOM::Element const& e
         add_rules_to_run(it->value);
     add_rules_to_run(rule_cache.other_rules);
 
+    bool const can_use_ancestor_filter = can_use_ancestor_filter_for(element);
+
     Vector<MatchingRule> matching_rules;
     matching_rules.ensure_capacity(rules_to_run.size());
     for (auto const& rule_to_run : rules_to_run) {
         auto const& selector = rule_to_run.rule->selectors()[rule_to_run.selector_index];
-        if (SelectorEngine::matches(selector, element, pseudo_element))
+        ++m_selector_matching_statistics.rules_tried;
+        if (can_use_ancestor_filter && should_reject_with_ancestor_filter(*selector)) {
+            ++m_selector_matching_statistics.rules_rejected_by_ancestor_filter;
+            continue;
+        }
+        if (selector->depends_on_element_state())
+            m_style_depends_on_element_state = true;
+        if (SelectorEngine::matches(selector, element, pseudo_element)) {
+            ++m_selector_matching_statistics.rules_matched;
             matching_rules.append(rule_to_run);
+        }
     }
     return matching_rules;
 }
 
+void StyleComputer::push_ancestor(DOM::Element const& element)
+{
+    size_t hash_count = 0;
+    auto add_hash = [&](AncestorFilterHashType type, StringView name) {
+        auto hash = ancestor_filter_hash(type, name);
+        m_ancestor_filter.add(hash);
+        m_ancestor_filter_hashes.append(hash);
+        ++hash_count;
+    };
+
+    add_hash(AncestorFilterHashType::TagName, element.local_name());
+    if (auto id = element.get_attribute(HTML::AttributeNames::id); !id.is_null())
+        add_hash(AncestorFilterHashType::Id, id);
+    for (auto const& class_name : element.class_names())
+        add_hash(AncestorFilterHashType::Class, class_name);
+
+    m_ancestor_filter_entries.append({ &element, hash_count });
+}
+
+void StyleComputer::pop_ancestor(DOM::Element const& element)
+{
+    auto entry = m_ancestor_filter_entries.take_last();
+    VERIFY(entry.element == &element);
+    for (size_t i = 0; i < entry.hash_count; ++i)
+        m_ancestor_filter.remove(m_ancestor_filter_hashes.take_last());
+}
+
+bool StyleComputer::can_use_ancestor_filter_for(DOM::Element const& element) const
+{
+    // NOTE: The filter must contain (at least) all the ancestors of the element, which is the case if its parent was
+    //       the last one pushed. Outside of a style update, it can only be used for elements without ancestors.
+    auto const* parent = element.parent_element();
+    if (m_ancestor_filter_entries.is_empty())
+        return !parent;
+    return m_ancestor_filter_entries.last().element == parent;
+}
+
+bool StyleComputer::should_reject_with_ancestor_filter(Selector const& selector) const
+{
+    for (auto hash : selector.ancestor_hashes()) {
+        if (!hash)
+            break;
+        if (!m_ancestor_filter.may_contain(hash))
+            return true;
+    }
+    return false;
+}
+
 static void sort_matching_rules(Vector<MatchingRule>& matching_rules)
 {
     quick_sort(matching_rules, [&](MatchingRule& a, MatchingRule& b) {
@@ -2182,6 +2248,70 @@ ErrorOr<NonnullRefPtr<StyleProperties>> StyleComputer::compute_style(DOM::Elemen
     return style.release_nonnull();
 }
 
+bool StyleComputer::can_share_style(DOM::Element const& element)
+{
+    // NOTE: Form controls have state that their style depends on outside of their attributes, and may modify their
+    //       own style when creating their layout node.
+    if (element.namespace_() != Namespace::HTML || element.shadow_root_internal() || element.inline_style()
+        || is<HTML::HTMLInputElement>(element) || is<HTML::HTMLSelectElement>(element) || is<HTML::HTMLTextAreaElement>(element) || is<HTML::HTMLOptionElement>(element))
+        return false;
+    auto const* parent = element.parent_element();
+    return parent && parent->computed_css_values();
+}
+
+bool StyleComputer::can_share_style_with(DOM::Element const& element, DOM::Element const& candidate)
+{
+    // NOTE: Elements whose parents have the same style object either are siblings, or got their style from each other,
+    //       in which case their own parents had the same style object, and so on. In both cases they have the same
+    //       inherited values, and equivalent ancestors for selector matching.
+    if (element.parent_element()->computed_css_values() != candidate.parent_element()->computed_css_values())
+        return false;
+    if (element.local_name() != candidate.local_name())
+        return false;
+
+    auto const& attributes = *element.attributes();
+    auto const& candidate_attributes = *candidate.attributes();
+    if (attributes.length() != candidate_attributes.length())
+        return false;
+    for (u32 i = 0; i < attributes.length(); ++i) {
+        auto const* attribute = attributes.item(i);
+        auto const* candidate_attribute = candidate_attributes.item(i);
+        if (attribute->name() != candidate_attribute->name() || attribute->namespace_uri() != candidate_attribute->namespace_uri() || attribute->value() != candidate_attribute->value())
+            return false;
+    }
+    return true;
+}
+
+ErrorOr<NonnullRefPtr<StyleProperties>> StyleComputer::compute_style_with_sharing(DOM::Element& element)
+{
+    bool const can_share = can_share_style(element);
+    if (can_share) {
+        ++m_style_sharing_statistics.lookups;
+        for (auto const* candidate : m_style_sharing_candidates.in_reverse()) {
+            if (!can_share_style_with(element, *candidate))
+                continue;
+            ++m_style_sharing_statistics.hits;
+            m_style_sharing_statistics.bytes_saved += sizeof(StyleProperties);
+            element.set_custom_properties({}, candidate->custom_properties({}));
+            return *candidate->computed_css_values();
+        }
+    }
+
+    m_style_depends_on_element_state = false;
+    auto style = TRY(compute_style(element));
+    if (!can_share || m_style_depends_on_element_state)
+        return style;
+
+    // NOTE: Running animations are tracked per element.
+    if (auto animation_name = style->maybe_null_property(PropertyID::AnimationName); animation_name && !(animation_name->is_identifier() && animation_name->to_identifier() == ValueID::None))
+        return style;
+
+    if (m_style_sharing_candidates.size() == max_style_sharing_candidates)
+        m_style_sharing_candidates.remove(0);
+    m_style_sharing_candidates.append(&element);
+    return style;
+}
+
 ErrorOr<RefPtr<StyleProperties>> StyleComputer::compute_pseudo_element_style_if_needed(DOM::Element& element, Optional<CSS::Selector::PseudoElement> pseudo_element) const
 {
     return compute_style_impl(element, move(pseudo_element), ComputeStyleMode::CreatePseudoElementStyleIfNeeded);
@@ -2307,6 +2437,8 @@ NonnullOwnPtr<StyleComputer::RuleCache> StyleComputer::make_rule_cache_for_casca
                 if (!added_to_bucket)
                     rule_cache->other_rules.append(move(matching_rule));
 
+                collect_invalidation_sets(*rule_cache, selector, StyleInvalidationScope::Self);
+
                 ++selector_index;
             }
             ++rule_index;
@@ -2413,6 +2545,123 @@ NonnullOwnPtr<StyleComputer::RuleCache> StyleComputer::make_rule_cache_for_casca
     return rule_cache;
 }
 
+static StyleInvalidationScope invalidation_scope_for_combinator(Selector::Combinator combinator)
+{
+    switch (combinator) {
+    case Selector::Combinator::None:
+        return StyleInvalidationScope::Self;
+    case Selector::Combinator::ImmediateChild:
+    case Selector::Combinator::Descendant:
+        return StyleInvalidationScope::Subtree;
+    case Selector::Combinator::NextSibling:
+    case Selector::Combinator::SubsequentSibling:
+        return StyleInvalidationScope::Siblings;
+    case Selector::Combinator::Column:
+        return StyleInvalidationScope::Document;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static void add_to_invalidation_set(HashMap<FlyString, StyleInvalidationScope>& invalidation_set, FlyString const& name, StyleInvalidationScope scope)
+{
+    auto& existing_scope = invalidation_set.ensure(name, [] { return StyleInvalidationScope::None; });
+    existing_scope = max(existing_scope, scope);
+}
+
+static void add_to_invalidation_set(HashMap<FlyString, StyleInvalidationScope>& invalidation_set, StringView name, StyleInvalidationScope scope)
+{
+    add_to_invalidation_set(invalidation_set, MUST(FlyString::from_utf8(name)), scope);
+}
+
+void StyleComputer::collect_invalidation_sets(RuleCache& rule_cache, Selector const& selector, StyleInvalidationScope subject_scope)
+{
+    auto const& compound_selectors = selector.compound_selectors();
+    for (size_t i = 0; i < compound_selectors.size(); ++i) {
+        // A compound selector that is not the subject affects the elements reachable through the combinator to its right.
+        auto scope = subject_scope;
+        if (i + 1 < compound_selectors.size())
+            scope = max(scope, invalidation_scope_for_combinator(compound_selectors[i + 1].combinator));
+
+        for (auto const& simple_selector : compound_selectors[i].simple_selectors) {
+            switch (simple_selector.type) {
+            case Selector::SimpleSelector::Type::Class:
+                add_to_invalidation_set(rule_cache.invalidation_scopes_by_class, simple_selector.name(), scope);
+                break;
+            case Selector::SimpleSelector::Type::Id:
+                add_to_invalidation_set(rule_cache.invalidation_scopes_by_id, simple_selector.name(), scope);
+                break;
+            case Selector::SimpleSelector::Type::Attribute:
+                add_to_invalidation_set(rule_cache.invalidation_scopes_by_attribute, FlyString { simple_selector.attribute().name.to_string().to_lowercase().release_value_but_fixme_should_propagate_errors() }, scope);
+                break;
+            case Selector::SimpleSelector::Type::PseudoClass: {
+                // Some pseudo-classes depend on attributes, and some of those are inherited by descendants.
+                auto const& pseudo_class = simple_selector.pseudo_class();
+                auto argument_scope = scope;
+                switch (pseudo_class.type) {
+                case Selector::SimpleSelector::PseudoClass::Type::Link:
+                    add_to_invalidation_set(rule_cache.invalidation_scopes_by_attribute, "href"sv, scope);
+                    break;
+                case Selector::SimpleSelector::PseudoClass::Type::Checked:
+                case Selector::SimpleSelector::PseudoClass::Type::Indeterminate:
+                    add_to_invalidation_set(rule_cache.invalidation_scopes_by_attribute, "checked"sv, scope);
+                    add_to_invalidation_set(rule_cache.invalidation_scopes_by_attribute, "selected"sv, scope);
+                    add_to_invalidation_set(rule_cache.invalidation_scopes_by_attribute, "type"sv, scope);
+                    break;
+                case Selector::SimpleSelector::PseudoClass::Type::Disabled:
+                case Selector::SimpleSelector::PseudoClass::Type::Enabled:
+                    add_to_invalidation_set(rule_cache.invalidation_scopes_by_attribute, "disabled"sv, max(scope, StyleInvalidationScope::Subtree));
+                    break;
+                case Selector::SimpleSelector::PseudoClass::Type::Lang:
+                    add_to_invalidation_set(rule_cache.invalidation_scopes_by_attribute, "lang"sv, max(scope, StyleInvalidationScope::Subtree));
+                    break;
+                case Selector::SimpleSelector::PseudoClass::Type::NthChild:
+                    // :nth-child(An+B of S) counts the preceding siblings matching S.
+                    argument_scope = max(scope, StyleInvalidationScope::Siblings);
+                    break;
+                case Selector::SimpleSelector::PseudoClass::Type::NthLastChild:
+                    // :nth-last-child(An+B of S) counts the following siblings matching S, so preceding siblings are affected too.
+                    argument_scope = StyleInvalidationScope::Document;
+                    break;
+                default:
+                    break;
+                }
+                for (auto const& argument_selector : pseudo_class.argument_selector_list)
+                    collect_invalidation_sets(rule_cache, argument_selector, argument_scope);
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+}
+
+static StyleInvalidationScope invalidation_scope_in_set(HashMap<FlyString, StyleInvalidationScope> const& invalidation_set, FlyString const& name)
+{
+    return invalidation_set.get(name).value_or(StyleInvalidationScope::None);
+}
+
+StyleInvalidationScope StyleComputer::invalidation_scope_for_class(FlyString const& class_name) const
+{
+    build_rule_cache_if_needed();
+    return max(invalidation_scope_in_set(m_author_rule_cache->invalidation_scopes_by_class, class_name),
+        invalidation_scope_in_set(m_user_agent_rule_cache->invalidation_scopes_by_class, class_name));
+}
+
+StyleInvalidationScope StyleComputer::invalidation_scope_for_id(FlyString const& id) const
+{
+    build_rule_cache_if_needed();
+    return max(invalidation_scope_in_set(m_author_rule_cache->invalidation_scopes_by_id, id),
+        invalidation_scope_in_set(m_user_agent_rule_cache->invalidation_scopes_by_id, id));
+}
+
+StyleInvalidationScope StyleComputer::invalidation_scope_for_attribute(FlyString const& lowercase_name) const
+{
+    build_rule_cache_if_needed();
+    return max(invalidation_scope_in_set(m_author_rule_cache->invalidation_scopes_by_attribute, lowercase_name),
+        invalidation_scope_in_set(m_user_agent_rule_cache->invalidation_scopes_by_attribute, lowercase_name));
+}
+
 void StyleComputer::build_rule_cache()
 {
     m_author_rule_cache = make_rule_cache_for_cascade_origin(CascadeOrigin::Author);
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/CountingBloomFilter.h>
 #include <AK/HashMap.h>
 #include <AK/Optional.h>
 #include <AK/OwnPtr.h>
@@ -31,6 +32,21 @@ struct MatchingRule {
     bool contains_pseudo_element { false };
 };
 
+// Which elements may need their style recomputed when a class, id or attribute of an element changes, as far as the
+// selectors that mention it are concerned. Each scope includes all the ones before it.
+enum class StyleInvalidationScope : u8 {
+    // No selector mentions it.
+    None,
+    // The element itself.
+    Self,
+    // The element and its descendants.
+    Subtree,
+    // The element, its following siblings, and their descendants.
+    Siblings,
+    // Anything in the document.
+    Document,
+};
+
 class PropertyDependencyNode : public RefCounted<PropertyDependencyNode> {
 public:
     static NonnullRefPtr<PropertyDependencyNode> create(String name)
@@ -71,6 +87,12 @@ public:
     ErrorOr<NonnullRefPtr<StyleProperties>> compute_style(DOM::Element&, Optional<CSS::Selector::PseudoElement> = {}) const;
     ErrorOr<RefPtr<StyleProperties>> compute_pseudo_element_style_if_needed(DOM::Element&, Optional<CSS::Selector::PseudoElement>) const;
 
+    // Like compute_style(), but reuses the computed style of a recently styled sibling or cousin if it is guaranteed
+    // to be identical: same tag name and attributes, same parent style, and no matched rule depends on anything else.
+    // NOTE: The candidates for sharing are only kept while styling elements in tree order, see Document::update_style().
+    ErrorOr<NonnullRefPtr<StyleProperties>> compute_style_with_sharing(DOM::Element&);
+    void clear_style_sharing_candidates() { m_style_sharing_candidates.clear(); }
+
     // https://www.w3.org/TR/css-cascade/#origin
     enum class CascadeOrigin {
         Author,
@@ -84,6 +106,36 @@ public:
 
     void invalidate_rule_cache();
 
+    // The ancestor filter holds the tag names, ids and classes of the ancestors of the element being styled, so most
+    // rules with descendant and child combinators can be rejected without walking up the tree.
+    // NOTE: It is filled in while styling elements in tree order, see Document::update_style().
+    void push_ancestor(DOM::Element const&);
+    void pop_ancestor(DOM::Element const&);
+
+    struct SelectorMatchingStatistics {
+        size_t rules_tried { 0 };
+        size_t rules_rejected_by_ancestor_filter { 0 };
+        size_t rules_matched { 0 };
+    };
+    SelectorMatchingStatistics const& selector_matching_statistics() const { return m_selector_matching_statistics; }
+
+    struct StyleSharingStatistics {
+        size_t lookups { 0 };
+        size_t hits { 0 };
+        size_t bytes_saved { 0 };
+    };
+    StyleSharingStatistics const& style_sharing_statistics() const { return m_style_sharing_statistics; }
+
+    void reset_statistics()
+    {
+        m_selector_matching_statistics = {};
+        m_style_sharing_statistics = {};
+    }
+
+    StyleInvalidationScope invalidation_scope_for_class(FlyString const&) const;
+    StyleInvalidationScope invalidation_scope_for_id(FlyString const&) const;
+    StyleInvalidationScope invalidation_scope_for_attribute(FlyString const& lowercase_name) const;
+
     Gfx::Font const& initial_font() const;
 
     void did_load_font(FlyString const& family_name);
@@ -157,9 +209,16 @@ private:
         Vector<MatchingRule> other_rules;
 
         HashMap<FlyString, NonnullOwnPtr<AnimationKeyFrameSet>> rules_by_animation_keyframes;
+
+        // Invalidation sets: how far a change to each class, id or attribute used by a selector can reach.
+        // NOTE: Attribute names are stored in lowercase.
+        HashMap<FlyString, StyleInvalidationScope> invalidation_scopes_by_class;
+        HashMap<FlyString, StyleInvalidationScope> invalidation_scopes_by_id;
+        HashMap<FlyString, StyleInvalidationScope> invalidation_scopes_by_attribute;
     };
 
     NonnullOwnPtr<RuleCache> make_rule_cache_for_cascade_origin(CascadeOrigin);
+    static void collect_invalidation_sets(RuleCache&, Selector const&, StyleInvalidationScope subject_scope);
 
     RuleCache const& rule_cache_for_cascade_origin(CascadeOrigin) const;
 
@@ -168,6 +227,28 @@ private:
     OwnPtr<RuleCache> m_author_rule_cache;
     OwnPtr<RuleCache> m_user_agent_rule_cache;
 
+    bool can_use_ancestor_filter_for(DOM::Element const&) const;
+    bool should_reject_with_ancestor_filter(Selector const&) const;
+
+    struct AncestorFilterEntry {
+        DOM::Element const* element { nullptr };
+        size_t hash_count { 0 };
+    };
+    CountingBloomFilter<> m_ancestor_filter;
+    Vector<AncestorFilterEntry> m_ancestor_filter_entries;
+    Vector<u32> m_ancestor_filter_hashes;
+
+    mutable SelectorMatchingStatistics m_selector_matching_statistics;
+
+    static bool can_share_style(DOM::Element const&);
+    static bool can_share_style_with(DOM::Element const&, DOM::Element const& candidate);
+
+    static constexpr size_t max_style_sharing_candidates = 16;
+    Vector<DOM::Element*> m_style_sharing_candidates;
+    // Set when collect_matching_rules() tries a rule that depends on more than the tag name and attributes of an element.
+    mutable bool m_style_depends_on_element_state { false };
+    StyleSharingStatistics m_style_sharing_statistics;
+
     HashMap<FontFaceKey, NonnullOwnPtr<FontLoader>> m_loaded_fonts;
 
     Length::FontMetrics m_default_font_metrics;
@@ -8,6 +8,7 @@
  */
 
 #include "ConicGradientStyleValue.h"
+#include <LibWeb/Painting/PaintContext.h>
 
 namespace Web::CSS {
 
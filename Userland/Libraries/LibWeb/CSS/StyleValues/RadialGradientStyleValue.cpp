@@ -8,6 +8,7 @@
  */
 
 #include "RadialGradientStyleValue.h"
+#include <LibWeb/Painting/PaintContext.h>
 
 namespace Web::CSS {
 
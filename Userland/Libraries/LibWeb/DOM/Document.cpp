@@ -11,6 +11,7 @@
 #include <AK/Debug.h>
 #include <AK/StringBuilder.h>
 #include <AK/Utf8View.h>
+#include <LibCore/ElapsedTimer.h>
 #include <LibJS/Interpreter.h>
 #include <LibJS/Runtime/FunctionObject.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -799,6 +800,8 @@ void Document::tear_down_layout_tree()
     }
 
     m_layout_root = nullptr;
+    m_retained_layout_state = nullptr;
+    m_needs_full_layout = true;
 }
 
 Color Document::background_color() const
@@ -888,6 +891,15 @@ AK::URL Document::parse_url(StringView url) const
 }
 
 void Document::set_needs_layout()
+{
+    m_needs_full_layout = true;
+    if (m_needs_layout)
+        return;
+    m_needs_layout = true;
+    schedule_layout_update();
+}
+
+void Document::set_needs_layout(Badge<Layout::Node>)
 {
     if (m_needs_layout)
         return;
@@ -933,19 +945,23 @@ void Document::update_layout()
         m_layout_root = verify_cast<Layout::Viewport>(*tree_builder.build(*this));
     }
 
-    Layout::LayoutState layout_state;
+    auto layout_timer = Core::ElapsedTimer::start_new();
+
+    auto layout_state = make<Layout::LayoutState>();
+    if (!m_needs_full_layout)
+        layout_state->previous_layout = m_retained_layout_state.ptr();
 
     {
-        Layout::BlockFormattingContext root_formatting_context(layout_state, *m_layout_root, nullptr);
+        Layout::BlockFormattingContext root_formatting_context(*layout_state, *m_layout_root, nullptr);
 
         auto& viewport = static_cast<Layout::Viewport&>(*m_layout_root);
-        auto& viewport_state = layout_state.get_mutable(viewport);
+        auto& viewport_state = layout_state->get_mutable(viewport);
         viewport_state.set_content_width(viewport_rect.width());
         viewport_state.set_content_height(viewport_rect.height());
 
         if (auto* document_element = this->document_element()) {
             VERIFY(document_element->layout_node());
-            auto& icb_state = layout_state.get_mutable(verify_cast<Layout::NodeWithStyleAndBoxModelMetrics>(*document_element->layout_node()));
+            auto& icb_state = layout_state->get_mutable(verify_cast<Layout::NodeWithStyleAndBoxModelMetrics>(*document_element->layout_node()));
             icb_state.set_content_width(viewport_rect.width());
             icb_state.set_content_height(viewport_rect.height());
         }
@@ -958,7 +974,18 @@ void Document::update_layout()
                 Layout::AvailableSize::make_definite(viewport_rect.height())));
     }
 
-    layout_state.commit();
+    layout_state->commit();
+
+    m_layout_statistics.layout_count++;
+    m_layout_statistics.last_layout_was_incremental = layout_state->previous_layout != nullptr;
+    m_layout_statistics.last_layout_time_in_microseconds = layout_timer.elapsed_time().to_microseconds();
+    m_layout_statistics.last_reused_node_count = layout_state->reused_used_values_count;
+    m_layout_statistics.last_laid_out_node_count = layout_state->used_values_per_layout_node.size() - layout_state->reused_used_values_count;
+
+    layout_state->take_over_unchanged_results_from_previous_layout();
+    m_retained_layout_state = move(layout_state);
+    m_layout_root->clear_needs_layout_update_in_subtree();
+    m_needs_full_layout = false;
 
     // Broadcast the current viewport rect to any new paintables, so they know whether they're visible or not.
     browsing_context()->inform_all_viewport_clients_about_the_current_viewport_rect();
@@ -976,28 +1003,40 @@ void Document::update_layout()
     m_layout_update_timer->stop();
 }
 
-[[nodiscard]] static Element::RequiredInvalidationAfterStyleChange update_style_recursively(DOM::Node& node)
+[[nodiscard]] static Element::RequiredInvalidationAfterStyleChange update_style_recursively(DOM::Node& node, bool parent_style_changed = false)
 {
     bool const needs_full_style_update = node.document().needs_full_style_update();
     Element::RequiredInvalidationAfterStyleChange invalidation;
 
+    // NOTE: Style is inherited, so if the style of an element changed, its children have to be updated as well,
+    //       even if nothing invalidated their style directly.
+    bool style_changed = parent_style_changed;
     if (is<Element>(node)) {
-        invalidation |= static_cast<Element&>(node).recompute_style();
+        auto element_invalidation = static_cast<Element&>(node).recompute_style();
+        style_changed = !element_invalidation.is_none();
+        invalidation |= element_invalidation;
     }
     node.set_needs_style_update(false);
 
-    if (needs_full_style_update || node.child_needs_style_update()) {
+    if (needs_full_style_update || style_changed || node.child_needs_style_update()) {
+        auto& style_computer = node.document().style_computer();
+        if (node.is_element())
+            style_computer.push_ancestor(static_cast<DOM::Element&>(node));
+
         if (node.is_element()) {
             if (auto* shadow_root = static_cast<DOM::Element&>(node).shadow_root_internal()) {
-                if (needs_full_style_update || shadow_root->needs_style_update() || shadow_root->child_needs_style_update())
-                    invalidation |= update_style_recursively(*shadow_root);
+                if (needs_full_style_update || style_changed || shadow_root->needs_style_update() || shadow_root->child_needs_style_update())
+                    invalidation |= update_style_recursively(*shadow_root, style_changed);
             }
         }
         node.for_each_child([&](auto& child) {
-            if (needs_full_style_update || child.needs_style_update() || child.child_needs_style_update())
-                invalidation |= update_style_recursively(child);
+            if (needs_full_style_update || style_changed || child.needs_style_update() || child.child_needs_style_update())
+                invalidation |= update_style_recursively(child, style_changed);
             return IterationDecision::Continue;
         });
+
+        if (node.is_element())
+            style_computer.pop_ancestor(static_cast<DOM::Element&>(node));
     }
 
     node.set_child_needs_style_update(false);
@@ -1017,12 +1056,14 @@ void Document::update_style()
 
     evaluate_media_rules();
 
+    style_computer().reset_statistics();
+    style_computer().clear_style_sharing_candidates();
     auto invalidation = update_style_recursively(*this);
+    style_computer().clear_style_sharing_candidates();
     if (invalidation.rebuild_layout_tree) {
         invalidate_layout();
     } else {
-        if (invalidation.relayout)
-            set_needs_layout();
+        // NOTE: Elements that need to be laid out again have already marked their layout nodes.
         if (invalidation.rebuild_stacking_context_tree)
             invalidate_stacking_context_tree();
     }
@@ -1779,6 +1820,25 @@ DeprecatedString Document::dump_dom_tree_as_json() const
     auto json = MUST(JsonObjectSerializer<>::try_create(builder));
     serialize_tree_as_json(json);
 
+    auto layout_statistics = MUST(json.add_object("layout_statistics"sv));
+    MUST(layout_statistics.add("layout_count"sv, m_layout_statistics.layout_count));
+    MUST(layout_statistics.add("last_layout_was_incremental"sv, m_layout_statistics.last_layout_was_incremental));
+    MUST(layout_statistics.add("last_layout_time_in_microseconds"sv, m_layout_statistics.last_layout_time_in_microseconds));
+    MUST(layout_statistics.add("last_laid_out_node_count"sv, m_layout_statistics.last_laid_out_node_count));
+    MUST(layout_statistics.add("last_reused_node_count"sv, m_layout_statistics.last_reused_node_count));
+    MUST(layout_statistics.finish());
+
+    auto const& selector_matching_statistics = style_computer().selector_matching_statistics();
+    auto style_statistics = MUST(json.add_object("style_statistics"sv));
+    MUST(style_statistics.add("last_rules_tried"sv, selector_matching_statistics.rules_tried));
+    MUST(style_statistics.add("last_rules_rejected_by_ancestor_filter"sv, selector_matching_statistics.rules_rejected_by_ancestor_filter));
+    MUST(style_statistics.add("last_rules_matched"sv, selector_matching_statistics.rules_matched));
+    auto const& style_sharing_statistics = style_computer().style_sharing_statistics();
+    MUST(style_statistics.add("last_style_sharing_lookups"sv, style_sharing_statistics.lookups));
+    MUST(style_statistics.add("last_style_sharing_hits"sv, style_sharing_statistics.hits));
+    MUST(style_statistics.add("last_style_sharing_bytes_saved"sv, style_sharing_statistics.bytes_saved));
+    MUST(style_statistics.finish());
+
     MUST(json.finish());
     return builder.to_deprecated_string();
 }
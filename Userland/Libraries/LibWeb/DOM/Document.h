@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/Badge.h>
 #include <AK/DeprecatedFlyString.h>
 #include <AK/DeprecatedString.h>
 #include <AK/Function.h>
@@ -200,7 +201,19 @@ public:
     void update_style();
     void update_layout();
 
+    // Relayouts the whole document on the next layout update.
     void set_needs_layout();
+    // Relayouts only what's affected by the layout nodes marked with Layout::Node::set_needs_layout_update().
+    void set_needs_layout(Badge<Layout::Node>);
+
+    struct LayoutStatistics {
+        u64 layout_count { 0 };
+        bool last_layout_was_incremental { false };
+        i64 last_layout_time_in_microseconds { 0 };
+        size_t last_laid_out_node_count { 0 };
+        size_t last_reused_node_count { 0 };
+    };
+    LayoutStatistics const& layout_statistics() const { return m_layout_statistics; }
 
     void invalidate_layout();
     void invalidate_stacking_context_tree();
@@ -593,6 +606,14 @@ private:
 
     bool m_needs_layout { false };
 
+    // Set when something changed that isn't marked on the layout tree, which rules out reusing the previous layout.
+    bool m_needs_full_layout { true };
+
+    // The committed state of the previous layout, which subtrees that didn't change since can take their results from.
+    OwnPtr<Layout::LayoutState> m_retained_layout_state;
+
+    LayoutStatistics m_layout_statistics;
+
     bool m_needs_full_style_update { false };
 
     HashTable<JS::GCPtr<NodeIterator>> m_node_iterators;
@@ -148,7 +148,7 @@ WebIDL::ExceptionOr<void> Element::set_attribute(DeprecatedFlyString const& name
     parse_attribute(attribute->local_name(), value);
 
     if (value != old_value) {
-        invalidate_style_after_attribute_change(name);
+        invalidate_style_after_attribute_change(name, old_value, value);
     }
 
     return {};
@@ -226,11 +226,13 @@ WebIDL::ExceptionOr<JS::GCPtr<Attr>> Element::set_attribute_node_ns(Attr& attr)
 // https://dom.spec.whatwg.org/#dom-element-removeattribute
 void Element::remove_attribute(DeprecatedFlyString const& name)
 {
+    auto old_value = get_attribute(name);
+
     m_attributes->remove_attribute(name);
 
     did_remove_attribute(name);
 
-    invalidate_style_after_attribute_change(name);
+    invalidate_style_after_attribute_change(name, old_value, {});
 }
 
 // https://dom.spec.whatwg.org/#dom-element-hasattribute
@@ -263,7 +265,7 @@ WebIDL::ExceptionOr<bool> Element::toggle_attribute(DeprecatedFlyString const& n
 
             parse_attribute(new_attribute->local_name(), "");
 
-            invalidate_style_after_attribute_change(name);
+            invalidate_style_after_attribute_change(name, {}, "");
 
             return true;
         }
@@ -274,11 +276,13 @@ WebIDL::ExceptionOr<bool> Element::toggle_attribute(DeprecatedFlyString const& n
 
     // 5. Otherwise, if force is not given or is false, remove an attribute given qualifiedName and this, and then return false.
     if (!force.has_value() || !force.value()) {
+        auto old_value = attribute->value();
+
         m_attributes->remove_attribute(name);
 
         did_remove_attribute(name);
 
-        invalidate_style_after_attribute_change(name);
+        invalidate_style_after_attribute_change(name, old_value, {});
     }
 
     // 6. Return true.
@@ -432,13 +436,38 @@ static Element::RequiredInvalidationAfterStyleChange compute_required_invalidati
     return invalidation;
 }
 
+static bool custom_properties_are_equal(HashMap<DeprecatedFlyString, CSS::StyleProperty> const& a, HashMap<DeprecatedFlyString, CSS::StyleProperty> const& b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (auto const& it : a) {
+        auto other = b.get(it.key);
+        if (!other.has_value() || other->important != it.value.important || *other->value != *it.value.value)
+            return false;
+    }
+    return true;
+}
+
 Element::RequiredInvalidationAfterStyleChange Element::recompute_style()
 {
     set_needs_style_update(false);
     VERIFY(parent());
 
+    auto old_custom_properties = move(m_custom_properties);
+
     // FIXME propagate errors
-    auto new_computed_css_values = MUST(document().style_computer().compute_style(*this));
+    auto new_computed_css_values = MUST(document().style_computer().compute_style_with_sharing(*this));
+
+    // NOTE: var() looks up custom properties through the ancestors of an element, so descendants may be affected by
+    //       a change to them even if none of the computed values of this element changed.
+    if (!custom_properties_are_equal(old_custom_properties, m_custom_properties)) {
+        if (auto* shadow_root = shadow_root_internal())
+            shadow_root->invalidate_style();
+        for_each_child([](Node& child) {
+            child.invalidate_style();
+            return IterationDecision::Continue;
+        });
+    }
 
     RequiredInvalidationAfterStyleChange invalidation;
     if (m_computed_css_values)
@@ -446,14 +475,18 @@ Element::RequiredInvalidationAfterStyleChange Element::recompute_style()
     else
         invalidation = RequiredInvalidationAfterStyleChange::full();
 
+    // NOTE: The new style object is kept even if nothing changed, as the style sharing cache relies on elements with
+    //       the same style object having been styled with the same inputs.
+    m_computed_css_values = move(new_computed_css_values);
+
     if (invalidation.is_none())
         return invalidation;
 
-    m_computed_css_values = move(new_computed_css_values);
-
     if (!invalidation.rebuild_layout_tree && layout_node()) {
         // If we're keeping the layout tree, we can just apply the new style to the existing layout tree.
         layout_node()->apply_style(*m_computed_css_values);
+        if (invalidation.relayout)
+            layout_node()->set_needs_layout_update();
         if (invalidation.repaint)
             layout_node()->set_needs_display();
     }
@@ -1435,13 +1468,58 @@ ErrorOr<void> Element::scroll_into_view(Optional<Variant<bool, ScrollIntoViewOpt
     // FIXME: 8. Optionally perform some other action that brings the element to the user’s attention.
 }
 
-void Element::invalidate_style_after_attribute_change(DeprecatedFlyString const& attribute_name)
+void Element::invalidate_style_after_attribute_change(DeprecatedFlyString const& attribute_name, DeprecatedString const& old_value, DeprecatedString const& new_value)
 {
-    // FIXME: Only invalidate if the attribute can actually affect style.
-    (void)attribute_name;
+    // NOTE: Elements that are not in a document have no style yet, and inserting them invalidates their style anyway.
+    if (!is_connected())
+        return;
 
+    // Find out which elements could match different rules now, using the invalidation sets of the StyleComputer.
     // FIXME: This will need to become smarter when we implement the :has() selector.
-    invalidate_style();
+    auto const& style_computer = document().style_computer();
+    auto scope = CSS::StyleInvalidationScope::None;
+
+    if (attribute_name == HTML::AttributeNames::class_) {
+        // Only the classes that were added or removed matter.
+        auto old_classes = old_value.split_view(Infra::is_ascii_whitespace);
+        auto new_classes = new_value.split_view(Infra::is_ascii_whitespace);
+        auto include_classes_missing_from = [&](Vector<StringView> const& classes, Vector<StringView> const& other_classes) {
+            for (auto class_name : classes) {
+                if (!other_classes.contains_slow(class_name))
+                    scope = max(scope, style_computer.invalidation_scope_for_class(FlyString::from_utf8(class_name).release_value_but_fixme_should_propagate_errors()));
+            }
+        };
+        include_classes_missing_from(old_classes, new_classes);
+        include_classes_missing_from(new_classes, old_classes);
+    } else if (attribute_name == HTML::AttributeNames::id) {
+        if (!old_value.is_null())
+            scope = max(scope, style_computer.invalidation_scope_for_id(FlyString::from_utf8(old_value).release_value_but_fixme_should_propagate_errors()));
+        if (!new_value.is_null())
+            scope = max(scope, style_computer.invalidation_scope_for_id(FlyString::from_utf8(new_value).release_value_but_fixme_should_propagate_errors()));
+    } else {
+        // Any other attribute may be mapped to style of this element through presentational hints.
+        scope = CSS::StyleInvalidationScope::Self;
+    }
+    scope = max(scope, style_computer.invalidation_scope_for_attribute(FlyString::from_deprecated_fly_string(attribute_name.to_lowercase()).release_value_but_fixme_should_propagate_errors()));
+
+    switch (scope) {
+    case CSS::StyleInvalidationScope::None:
+        break;
+    case CSS::StyleInvalidationScope::Self:
+        // NOTE: If the style of this element changes, its descendants will be updated to inherit from it.
+        set_needs_style_update(true);
+        break;
+    case CSS::StyleInvalidationScope::Subtree:
+        invalidate_style();
+        break;
+    case CSS::StyleInvalidationScope::Siblings:
+        for (Node* node = this; node; node = node->next_sibling())
+            node->invalidate_style();
+        break;
+    case CSS::StyleInvalidationScope::Document:
+        document().invalidate_style();
+        break;
+    }
 }
 
 // https://www.w3.org/TR/wai-aria-1.2/#tree_exclusion
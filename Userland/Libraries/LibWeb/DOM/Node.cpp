@@ -907,6 +907,14 @@ void Node::set_needs_style_update(bool value)
     }
 }
 
+void Node::set_needs_layout_update()
+{
+    if (auto* layout_node = this->layout_node())
+        layout_node->set_needs_layout_update();
+    else
+        document().set_needs_layout();
+}
+
 void Node::inserted()
 {
     set_needs_style_update(true);
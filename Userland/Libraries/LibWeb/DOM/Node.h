@@ -195,6 +195,9 @@ public:
 
     void invalidate_style();
 
+    // Lays out the parts of the document that depend on this node again, or the whole document if this node isn't laid out.
+    void set_needs_layout_update();
+
     void set_document(Badge<Document>, Document&);
 
     virtual EventTarget* get_parent(Event const&) override;
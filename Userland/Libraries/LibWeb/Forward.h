@@ -401,6 +401,7 @@ class Path2D;
 class Plugin;
 class PluginArray;
 class PromiseRejectionEvent;
+class SpeculativeHTMLParser;
 class Storage;
 class SubmitEvent;
 class TextMetrics;
@@ -484,12 +485,15 @@ class PerformanceTiming;
 namespace Web::Painting {
 class ButtonPaintable;
 class CheckBoxPaintable;
+class DisplayList;
 class LabelablePaintable;
 class Paintable;
 class PaintableBox;
 class PaintableWithLines;
+class RecordingPainter;
 class StackingContext;
 class TextPaintable;
+class TileCache;
 class VideoPaintable;
 
 enum class PaintPhase;
@@ -6,30 +6,153 @@
 
 #include <LibGfx/Bitmap.h>
 #include <LibWeb/HTML/AnimatedBitmapDecodedImageData.h>
+#include <LibWeb/HTML/DecodedImageCache.h>
+#include <LibWeb/Platform/ImageCodecPlugin.h>
 
 namespace Web::HTML {
 
-ErrorOr<NonnullRefPtr<AnimatedBitmapDecodedImageData>> AnimatedBitmapDecodedImageData::create(Vector<Frame>&& frames, size_t loop_count, bool animated)
+ErrorOr<NonnullRefPtr<AnimatedBitmapDecodedImageData>> AnimatedBitmapDecodedImageData::create(Vector<Frame>&& frames, size_t loop_count, bool animated, ByteBuffer encoded_data)
 {
-    return adopt_nonnull_ref_or_enomem(new (nothrow) AnimatedBitmapDecodedImageData(move(frames), loop_count, animated));
+    auto image = TRY(adopt_nonnull_ref_or_enomem(new (nothrow) AnimatedBitmapDecodedImageData(move(frames), loop_count, animated, move(encoded_data))));
+    if (!image->m_encoded_data.is_empty())
+        DecodedImageCache::the().did_decode(*image);
+    return image;
 }
 
-AnimatedBitmapDecodedImageData::AnimatedBitmapDecodedImageData(Vector<Frame>&& frames, size_t loop_count, bool animated)
+AnimatedBitmapDecodedImageData::AnimatedBitmapDecodedImageData(Vector<Frame>&& frames, size_t loop_count, bool animated, ByteBuffer encoded_data)
     : m_frames(move(frames))
     , m_loop_count(loop_count)
     , m_animated(animated)
+    , m_intrinsic_size(m_frames.first().bitmap->size())
+    , m_decoded_display_size(m_intrinsic_size)
+    , m_encoded_data(move(encoded_data))
 {
 }
 
-AnimatedBitmapDecodedImageData::~AnimatedBitmapDecodedImageData() = default;
+AnimatedBitmapDecodedImageData::~AnimatedBitmapDecodedImageData()
+{
+    DecodedImageCache::the().remove(*this);
+}
+
+RefPtr<Gfx::Bitmap const> AnimatedBitmapDecodedImageData::bitmap(size_t frame_index, Gfx::IntSize size) const
+{
+    // NOTE: Getting a bitmap counts as using the image, which may mean decoding it (again).
+    return const_cast<AnimatedBitmapDecodedImageData&>(*this).bitmap_for_use(frame_index, size);
+}
 
-RefPtr<Gfx::Bitmap const> AnimatedBitmapDecodedImageData::bitmap(size_t frame_index, Gfx::IntSize) const
+RefPtr<Gfx::Bitmap const> AnimatedBitmapDecodedImageData::bitmap_for_use(size_t frame_index, Gfx::IntSize size)
 {
     if (frame_index >= m_frames.size())
         return nullptr;
+
+    if (m_encoded_data.is_empty())
+        return m_frames[frame_index].bitmap;
+
+    DecodedImageCache::the().did_use(*this);
+
+    if (size.is_empty()) {
+        // Without a size, the caller wants the image at its full size, right now.
+        if (!is_decoded() || m_decoded_display_size != m_intrinsic_size)
+            decode_at_full_size();
+        return m_frames[frame_index].bitmap;
+    }
+
+    // There is no point in decoding more pixels than can be shown. But an image that is painted at several sizes has to
+    // be decoded for the largest of them, or it would be decoded again for each of them, over and over.
+    auto display_size = largest_recent_display_size(size);
+    if (display_size.width() >= m_intrinsic_size.width() || display_size.height() >= m_intrinsic_size.height())
+        display_size = m_intrinsic_size;
+
+    // Decode again if the frames have been dropped, are too small to be shown at this size, or are much larger than they
+    // need to be. Any frames that are there get painted until that is done.
+    if (!is_decoded() || display_size.width() > m_decoded_display_size.width() || display_size.height() > m_decoded_display_size.height()
+        || m_decoded_display_size.area() >= display_size.area() * 4)
+        start_decoding(display_size);
+    else
+        m_size_being_decoded.clear();
     return m_frames[frame_index].bitmap;
 }
 
+Gfx::IntSize AnimatedBitmapDecodedImageData::largest_recent_display_size(Gfx::IntSize size)
+{
+    // NOTE: The sizes from the previous paint are taken into account as well, since the image may not have been painted
+    //       at all of its sizes yet in this one.
+    auto paint_generation = DecodedImageCache::the().paint_generation();
+    if (m_largest_display_size_paint_generation != paint_generation) {
+        m_largest_display_size_in_previous_paint = m_largest_display_size_paint_generation + 1 == paint_generation ? m_largest_display_size : Gfx::IntSize {};
+        m_largest_display_size = {};
+        m_largest_display_size_paint_generation = paint_generation;
+    }
+
+    m_largest_display_size = { max(m_largest_display_size.width(), size.width()), max(m_largest_display_size.height(), size.height()) };
+    return { max(m_largest_display_size.width(), m_largest_display_size_in_previous_paint.width()), max(m_largest_display_size.height(), m_largest_display_size_in_previous_paint.height()) };
+}
+
+void AnimatedBitmapDecodedImageData::decode_at_full_size()
+{
+    m_size_being_decoded.clear();
+    auto image = Platform::ImageCodecPlugin::the().decode_image(m_encoded_data);
+    if (!image.has_value())
+        return;
+
+    Vector<Frame> frames;
+    for (auto& frame : image->frames)
+        frames.append({ move(frame.bitmap), static_cast<int>(frame.duration) });
+    set_decoded_frames(move(frames), m_intrinsic_size);
+}
+
+void AnimatedBitmapDecodedImageData::start_decoding(Gfx::IntSize size)
+{
+    if (m_size_being_decoded == size)
+        return;
+    m_size_being_decoded = size;
+
+    Platform::ImageCodecPlugin::the().start_decoding_image(m_encoded_data, size, [this, protect = NonnullRefPtr { *this }, size](auto image) {
+        // NOTE: Only the most recently started decode counts.
+        if (m_size_being_decoded != size)
+            return;
+        m_size_being_decoded.clear();
+        if (!image.has_value())
+            return;
+
+        Vector<Frame> frames;
+        for (auto& frame : image->frames)
+            frames.append({ move(frame.bitmap), static_cast<int>(frame.duration) });
+        if (set_decoded_frames(move(frames), size) && m_on_redecode)
+            m_on_redecode();
+    });
+}
+
+bool AnimatedBitmapDecodedImageData::set_decoded_frames(Vector<Frame>&& frames, Gfx::IntSize display_size)
+{
+    // The image should not be any different the next time around, but if it is, we keep what we have.
+    if (frames.size() != m_frames.size() || any_of(frames, [](auto const& frame) { return !frame.bitmap; })) {
+        dbgln("AnimatedBitmapDecodedImageData: Decoding again resulted in {} frames instead of {}", frames.size(), m_frames.size());
+        return false;
+    }
+
+    m_frames = move(frames);
+    m_decoded_display_size = display_size;
+    DecodedImageCache::the().did_decode(*this);
+    return true;
+}
+
+void AnimatedBitmapDecodedImageData::drop_decoded_frames()
+{
+    for (auto& frame : m_frames)
+        frame.bitmap = nullptr;
+}
+
+size_t AnimatedBitmapDecodedImageData::decoded_size_in_bytes() const
+{
+    size_t size = 0;
+    for (auto const& frame : m_frames) {
+        if (frame.bitmap)
+            size += frame.bitmap->size_in_bytes();
+    }
+    return size;
+}
+
 int AnimatedBitmapDecodedImageData::frame_duration(size_t frame_index) const
 {
     if (frame_index >= m_frames.size())
@@ -39,17 +162,17 @@ int AnimatedBitmapDecodedImageData::frame_duration(size_t frame_index) const
 
 Optional<CSSPixels> AnimatedBitmapDecodedImageData::intrinsic_width() const
 {
-    return m_frames.first().bitmap->width();
+    return m_intrinsic_size.width();
 }
 
 Optional<CSSPixels> AnimatedBitmapDecodedImageData::intrinsic_height() const
 {
-    return m_frames.first().bitmap->height();
+    return m_intrinsic_size.height();
 }
 
 Optional<float> AnimatedBitmapDecodedImageData::intrinsic_aspect_ratio() const
 {
-    return static_cast<float>(m_frames.first().bitmap->width()) / static_cast<float>(m_frames.first().bitmap->height());
+    return static_cast<float>(m_intrinsic_size.width()) / static_cast<float>(m_intrinsic_size.height());
 }
 
 }
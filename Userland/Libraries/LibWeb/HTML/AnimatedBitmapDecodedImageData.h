@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
+#include <AK/Function.h>
+#include <AK/IntrusiveList.h>
 #include <LibWeb/HTML/DecodedImageData.h>
 
 namespace Web::HTML {
@@ -17,9 +20,14 @@ public:
         int duration { 0 };
     };
 
-    static ErrorOr<NonnullRefPtr<AnimatedBitmapDecodedImageData>> create(Vector<Frame>&&, size_t loop_count, bool animated);
+    // If the encoded data is given, the frames are kept in the DecodedImageCache, which may drop them while they are
+    // not being painted. They are decoded again from the encoded data when they are needed.
+    static ErrorOr<NonnullRefPtr<AnimatedBitmapDecodedImageData>> create(Vector<Frame>&&, size_t loop_count, bool animated, ByteBuffer encoded_data = {});
     virtual ~AnimatedBitmapDecodedImageData() override;
 
+    // NOTE: If the frames have been dropped, asking for a bitmap with a size starts decoding them again at that size in
+    //       the background, and returns null until that is done. Without a size, they are decoded at their full size
+    //       before this returns.
     virtual RefPtr<Gfx::Bitmap const> bitmap(size_t frame_index, Gfx::IntSize = {}) const override;
     virtual int frame_duration(size_t frame_index) const override;
 
@@ -31,12 +39,48 @@ public:
     virtual Optional<CSSPixels> intrinsic_height() const override;
     virtual Optional<float> intrinsic_aspect_ratio() const override;
 
+    // Called when the frames have been decoded again in the background, and are ready to be painted.
+    void set_on_redecode(Function<void()> on_redecode) { m_on_redecode = move(on_redecode); }
+
+    bool is_decoded() const { return !m_frames.is_empty() && m_frames.first().bitmap; }
+    size_t decoded_size_in_bytes() const;
+
 private:
-    AnimatedBitmapDecodedImageData(Vector<Frame>&&, size_t loop_count, bool animated);
+    friend class DecodedImageCache;
+
+    AnimatedBitmapDecodedImageData(Vector<Frame>&&, size_t loop_count, bool animated, ByteBuffer encoded_data);
+
+    RefPtr<Gfx::Bitmap const> bitmap_for_use(size_t frame_index, Gfx::IntSize);
+    Gfx::IntSize largest_recent_display_size(Gfx::IntSize);
+    void decode_at_full_size();
+    void start_decoding(Gfx::IntSize);
+    bool set_decoded_frames(Vector<Frame>&&, Gfx::IntSize display_size);
+    void drop_decoded_frames();
 
     Vector<Frame> m_frames;
     size_t m_loop_count { 0 };
     bool m_animated { false };
+
+    Gfx::IntSize m_intrinsic_size;
+    // The size the frames have been decoded for, which is the intrinsic size unless they have been scaled down.
+    Gfx::IntSize m_decoded_display_size;
+    ByteBuffer m_encoded_data;
+    Optional<Gfx::IntSize> m_size_being_decoded;
+
+    // The largest sizes the frames have been painted at in the current and the previous paint.
+    Gfx::IntSize m_largest_display_size;
+    Gfx::IntSize m_largest_display_size_in_previous_paint;
+    u64 m_largest_display_size_paint_generation { 0 };
+
+    Function<void()> m_on_redecode;
+
+    // Used by the DecodedImageCache.
+    IntrusiveListNode<AnimatedBitmapDecodedImageData> m_decoded_image_cache_list_node;
+    size_t m_size_in_decoded_image_cache { 0 };
+    u64 m_last_used_paint_generation { 0 };
+
+public:
+    using DecodedImageCacheList = IntrusiveList<&AnimatedBitmapDecodedImageData::m_decoded_image_cache_list_node>;
 };
 
 }
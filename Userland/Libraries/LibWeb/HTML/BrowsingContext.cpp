@@ -594,20 +594,29 @@ void BrowsingContext::set_size(CSSPixelSize size)
 
 void BrowsingContext::set_needs_display()
 {
+    // NOTE: Anything the page client painted outside the viewport is stale as well, so let it drop all of it.
+    if (is_top_level()) {
+        if (m_page)
+            m_page->client().page_did_invalidate_all();
+        return;
+    }
+
     set_needs_display(viewport_rect());
 }
 
 void BrowsingContext::set_needs_display(CSSPixelRect const& rect)
 {
-    if (!viewport_rect().intersects(rect))
-        return;
-
     if (is_top_level()) {
+        // NOTE: The page client may have painted more than the viewport (to reuse it when scrolling),
+        //       so it needs to hear about invalidations outside the viewport as well.
         if (m_page)
             m_page->client().page_did_invalidate(to_top_level_rect(rect));
         return;
     }
 
+    if (!viewport_rect().intersects(rect))
+        return;
+
     if (container() && container()->layout_node())
         container()->layout_node()->set_needs_display();
 }
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <LibWeb/HTML/DecodedImageCache.h>
+
+namespace Web::HTML {
+
+DecodedImageCache& DecodedImageCache::the()
+{
+    static DecodedImageCache cache;
+    return cache;
+}
+
+void DecodedImageCache::set_budget(size_t budget)
+{
+    m_budget = budget;
+    drop_images_until_within_budget();
+}
+
+void DecodedImageCache::did_start_painting()
+{
+    ++m_paint_generation;
+    drop_images_until_within_budget();
+}
+
+void DecodedImageCache::did_decode(AnimatedBitmapDecodedImageData& image)
+{
+    remove(image);
+    if (!image.is_decoded())
+        return;
+
+    image.m_size_in_decoded_image_cache = image.decoded_size_in_bytes();
+    image.m_last_used_paint_generation = m_paint_generation;
+    m_size_in_bytes += image.m_size_in_decoded_image_cache;
+    m_images.append(image);
+
+    drop_images_until_within_budget();
+}
+
+void DecodedImageCache::did_use(AnimatedBitmapDecodedImageData& image)
+{
+    if (!m_images.contains(image))
+        return;
+
+    image.m_last_used_paint_generation = m_paint_generation;
+    m_images.remove(image);
+    m_images.append(image);
+}
+
+void DecodedImageCache::remove(AnimatedBitmapDecodedImageData& image)
+{
+    if (!m_images.contains(image))
+        return;
+
+    m_size_in_bytes -= image.m_size_in_decoded_image_cache;
+    image.m_size_in_decoded_image_cache = 0;
+    m_images.remove(image);
+}
+
+void DecodedImageCache::drop_images_until_within_budget()
+{
+    while (m_size_in_bytes > m_budget && !m_images.is_empty()) {
+        auto& image = *m_images.first();
+
+        // NOTE: The images used since the previous paint started may still be on screen.
+        if (image.m_last_used_paint_generation + 1 >= m_paint_generation)
+            break;
+
+        dbgln_if(IMAGE_DECODER_DEBUG, "DecodedImageCache: Dropping {} bytes of decoded frames, {} of {} bytes in use", image.m_size_in_decoded_image_cache, m_size_in_bytes, m_budget);
+        remove(image);
+        image.drop_decoded_frames();
+    }
+}
+
+}
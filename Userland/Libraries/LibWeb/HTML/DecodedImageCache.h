@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <LibWeb/HTML/AnimatedBitmapDecodedImageData.h>
+
+namespace Web::HTML {
+
+// Keeps the memory used by decoded images within a budget, by dropping the frames of the images that have been used
+// least recently. Images that have been painted in the current or the previous paint are never dropped, so the budget
+// is exceeded when that is what it takes to show everything that is on screen.
+class DecodedImageCache {
+    AK_MAKE_NONCOPYABLE(DecodedImageCache);
+    AK_MAKE_NONMOVABLE(DecodedImageCache);
+
+public:
+    static DecodedImageCache& the();
+
+    static constexpr size_t default_budget = 256 * MiB;
+
+    size_t budget() const { return m_budget; }
+    void set_budget(size_t);
+
+    size_t size_in_bytes() const { return m_size_in_bytes; }
+    size_t image_count() const { return m_images.size_slow(); }
+
+    // Should be called before each paint, so that images that are not painted anymore can be told apart from those
+    // that are.
+    void did_start_painting();
+    u64 paint_generation() const { return m_paint_generation; }
+
+    void did_decode(AnimatedBitmapDecodedImageData&);
+    void did_use(AnimatedBitmapDecodedImageData&);
+    void remove(AnimatedBitmapDecodedImageData&);
+
+private:
+    DecodedImageCache() = default;
+
+    void drop_images_until_within_budget();
+
+    // Least recently used first.
+    AnimatedBitmapDecodedImageData::DecodedImageCacheList m_images;
+    size_t m_size_in_bytes { 0 };
+    size_t m_budget { default_budget };
+    u64 m_paint_generation { 0 };
+};
+
+}
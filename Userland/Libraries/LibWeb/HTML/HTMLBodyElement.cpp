@@ -53,21 +53,28 @@ void HTMLBodyElement::apply_presentational_hints(CSS::StyleProperties& style) co
 void HTMLBodyElement::parse_attribute(DeprecatedFlyString const& name, DeprecatedString const& value)
 {
     HTMLElement::parse_attribute(name, value);
+    // NOTE: The link colors are used by all links in the body, not only by this element, so they invalidate its whole subtree.
     if (name.equals_ignoring_ascii_case("link"sv)) {
         // https://html.spec.whatwg.org/multipage/rendering.html#the-page:rules-for-parsing-a-legacy-colour-value-3
         auto color = parse_legacy_color_value(value);
-        if (color.has_value())
+        if (color.has_value()) {
             document().set_link_color(color.value());
+            invalidate_style();
+        }
     } else if (name.equals_ignoring_ascii_case("alink"sv)) {
         // https://html.spec.whatwg.org/multipage/rendering.html#the-page:rules-for-parsing-a-legacy-colour-value-5
         auto color = parse_legacy_color_value(value);
-        if (color.has_value())
+        if (color.has_value()) {
             document().set_active_link_color(color.value());
+            invalidate_style();
+        }
     } else if (name.equals_ignoring_ascii_case("vlink"sv)) {
         // https://html.spec.whatwg.org/multipage/rendering.html#the-page:rules-for-parsing-a-legacy-colour-value-4
         auto color = parse_legacy_color_value(value);
-        if (color.has_value())
+        if (color.has_value()) {
             document().set_visited_link_color(color.value());
+            invalidate_style();
+        }
     } else if (name.equals_ignoring_ascii_case("background"sv)) {
         m_background_style_value = CSS::ImageStyleValue::create(document().parse_url(value)).release_value_but_fixme_should_propagate_errors();
         m_background_style_value->on_animate = [this] {
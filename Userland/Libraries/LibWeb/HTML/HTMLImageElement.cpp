@@ -161,8 +161,8 @@ unsigned HTMLImageElement::width() const
 
     // ...or else the density-corrected intrinsic width and height of the image, in CSS pixels,
     // if the image has intrinsic dimensions and is available but not being rendered.
-    if (auto bitmap = current_image_bitmap())
-        return bitmap->width();
+    if (auto intrinsic_width = this->intrinsic_width(); intrinsic_width.has_value())
+        return intrinsic_width->value();
 
     // ...or else 0, if the image is not available or does not have intrinsic dimensions.
     return 0;
@@ -189,8 +189,8 @@ unsigned HTMLImageElement::height() const
 
     // ...or else the density-corrected intrinsic height and height of the image, in CSS pixels,
     // if the image has intrinsic dimensions and is available but not being rendered.
-    if (auto bitmap = current_image_bitmap())
-        return bitmap->height();
+    if (auto intrinsic_height = this->intrinsic_height(); intrinsic_height.has_value())
+        return intrinsic_height->value();
 
     // ...or else 0, if the image is not available or does not have intrinsic dimensions.
     return 0;
@@ -206,8 +206,8 @@ unsigned HTMLImageElement::natural_width() const
 {
     // Return the density-corrected intrinsic width of the image, in CSS pixels,
     // if the image has intrinsic dimensions and is available.
-    if (auto bitmap = current_image_bitmap())
-        return bitmap->width();
+    if (auto intrinsic_width = this->intrinsic_width(); intrinsic_width.has_value())
+        return intrinsic_width->value();
 
     // ...or else 0.
     return 0;
@@ -218,8 +218,8 @@ unsigned HTMLImageElement::natural_height() const
 {
     // Return the density-corrected intrinsic height of the image, in CSS pixels,
     // if the image has intrinsic dimensions and is available.
-    if (auto bitmap = current_image_bitmap())
-        return bitmap->height();
+    if (auto intrinsic_height = this->intrinsic_height(); intrinsic_height.has_value())
+        return intrinsic_height->value();
 
     // ...or else 0.
     return 0;
@@ -241,7 +241,7 @@ bool HTMLImageElement::complete() const
     // - The img element's current request's state is completely available and its pending request is null.
     // - The img element's current request's state is broken and its pending request is null.
     // FIXME: This is ad-hoc and should be updated once we are loading images via the Fetch mechanism.
-    if (auto bitmap = current_image_bitmap())
+    if (m_current_request->image_data())
         return true;
 
     return false;
@@ -500,7 +500,7 @@ after_step_7:
                     dispatch_event(DOM::Event::create(realm(), HTML::EventNames::load).release_value_but_fixme_should_propagate_errors());
 
                 set_needs_style_update(true);
-                document().set_needs_layout();
+                set_needs_layout_update();
 
                 if (image_data->is_animated() && image_data->frame_count() > 1) {
                     m_current_frame_index = 0;
@@ -10,10 +10,14 @@
 #include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
 #include <LibWeb/Fetch/Infrastructure/FetchController.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/HTML/AnimatedBitmapDecodedImageData.h>
+#include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/DecodedImageData.h>
 #include <LibWeb/HTML/ImageRequest.h>
 #include <LibWeb/HTML/ListOfAvailableImages.h>
+#include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Platform/ImageCodecPlugin.h>
 #include <LibWeb/SVG/SVGDecodedImageData.h>
 
@@ -200,23 +204,18 @@ void ImageRequest::handle_successful_fetch(AK::URL const& url_string, StringView
 
     bool const is_svg_image = mime_type == "image/svg+xml"sv || url_string.basename().ends_with(".svg"sv);
 
-    RefPtr<DecodedImageData> image_data;
-
-    auto handle_failed_decode = [&] {
-        for (auto& callback : m_callbacks) {
-            if (callback.on_fail)
-                callback.on_fail();
-        }
-    };
-
     if (is_svg_image) {
         auto result = SVG::SVGDecodedImageData::create(m_page, url_string, data);
         if (result.is_error())
             return handle_failed_decode();
 
-        image_data = result.release_value();
-    } else {
-        auto result = Web::Platform::ImageCodecPlugin::the().decode_image(data.bytes());
+        return handle_successful_decode(result.release_value());
+    }
+
+    // NOTE: Images are decoded in the background, so that several of them can be decoded at once.
+    auto encoded_data = make<ByteBuffer>(move(data));
+    auto encoded_bytes = encoded_data->bytes();
+    Web::Platform::ImageCodecPlugin::the().start_decoding_image(encoded_bytes, {}, [this, protect = NonnullRefPtr { *this }, encoded_data = move(encoded_data)](auto result) {
         if (!result.has_value())
             return handle_failed_decode();
 
@@ -227,10 +226,30 @@ void ImageRequest::handle_successful_fetch(AK::URL const& url_string, StringView
                 .duration = static_cast<int>(frame.duration),
             });
         }
-        image_data = AnimatedBitmapDecodedImageData::create(move(frames), result.value().loop_count, result.value().is_animated).release_value_but_fixme_should_propagate_errors();
+
+        // The encoded data is kept around, so the frames can be dropped while the image is off screen.
+        auto image_data = AnimatedBitmapDecodedImageData::create(move(frames), result.value().loop_count, result.value().is_animated, move(*encoded_data)).release_value_but_fixme_should_propagate_errors();
+        image_data->set_on_redecode([&page = m_page] {
+            // NOTE: The image may be painted anywhere on the page, not just in the viewport, as painting can cover more than that.
+            auto& browsing_context = page.top_level_browsing_context();
+            if (auto* document = browsing_context.active_document(); document && document->paintable_box())
+                browsing_context.set_needs_display(document->paintable_box()->absolute_rect());
+        });
+        handle_successful_decode(move(image_data));
+    });
+}
+
+void ImageRequest::handle_failed_decode()
+{
+    for (auto& callback : m_callbacks) {
+        if (callback.on_fail)
+            callback.on_fail();
     }
+}
 
-    set_image_data(image_data);
+void ImageRequest::handle_successful_decode(NonnullRefPtr<DecodedImageData> image_data)
+{
+    set_image_data(move(image_data));
 
     // 2. Set image request to the completely available state.
     set_state(ImageRequest::State::CompletelyAvailable);
@@ -61,6 +61,8 @@ private:
     explicit ImageRequest(Page&);
 
     void handle_successful_fetch(AK::URL const&, StringView mime_type, ByteBuffer data);
+    void handle_successful_decode(NonnullRefPtr<DecodedImageData>);
+    void handle_failed_decode();
     void handle_failed_fetch();
 
     Page& m_page;
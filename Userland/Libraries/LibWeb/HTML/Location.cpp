@@ -25,6 +25,7 @@ namespace Web::HTML {
 Location::Location(JS::Realm& realm)
     : PlatformObject(realm)
 {
+    m_may_interfere_with_property_lookup_caches = true;
 }
 
 Location::~Location() = default;
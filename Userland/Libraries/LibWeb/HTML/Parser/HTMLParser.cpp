@@ -246,7 +246,9 @@ void HTMLParser::the_end()
     if (m_parsing_fragment)
         return;
 
-    // FIXME: 1. If the active speculative HTML parser is not null, then stop the speculative HTML parser and return.
+    // 1. If the active speculative HTML parser is not null, then stop the speculative HTML parser and return.
+    // NOTE: Our speculative HTML parser never runs "the end" itself, and we only stop it after step 8 below: the elements
+    //       that use its fetches may only start fetching once the event loop has been spun.
 
     // 2. Set the insertion point to undefined.
     m_tokenizer.undefine_insertion_point();
@@ -303,6 +305,9 @@ void HTMLParser::the_end()
         return m_document->number_of_things_delaying_the_load_event() == 0;
     });
 
+    // AD-HOC: Drop the speculative fetches nothing has used by now.
+    m_speculative_html_parser.stop();
+
     // 9. Queue a global task on the DOM manipulation task source given the Document's relevant global object to run the following steps:
     old_queue_global_task_with_document(HTML::Task::Source::DOMManipulation, *m_document, [document = m_document] {
         // 1. Update the current document readiness to "complete".
@@ -2388,7 +2393,10 @@ void HTMLParser::handle_text(HTMLToken& token)
                     // 2. Set the pending parsing-blocking script to null.
                     auto the_script = document().take_pending_parsing_blocking_script({});
 
-                    // FIXME: 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    // 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    // NOTE: The speculative HTML parser only scans the input once, since it is given all of the remaining
+                    //       input when it starts.
+                    m_speculative_html_parser.run(*m_document, m_tokenizer.unconsumed_input());
 
                     // 4. Block the tokenizer for this instance of the HTML parser, such that the event loop will not run tasks that invoke the tokenizer.
                     m_tokenizer.set_blocked(true);
@@ -2407,7 +2415,9 @@ void HTMLParser::handle_text(HTMLToken& token)
                     if (m_aborted)
                         return;
 
-                    // FIXME: 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // NOTE: There is nothing left to stop here, the speculative HTML parser has already scanned all of its input.
+                    //       Its fetches are kept around until the end, for the elements that are still to be inserted.
 
                     // 8. Unblock the tokenizer for this instance of the HTML parser, such that tasks that invoke the tokenizer can again be run.
                     m_tokenizer.set_blocked(false);
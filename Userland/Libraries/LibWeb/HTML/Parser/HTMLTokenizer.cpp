@@ -5,9 +5,11 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BuiltinWrappers.h>
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
 #include <AK/GenericShorthands.h>
+#include <AK/SIMDExtras.h>
 #include <AK/SourceLocation.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibWeb/HTML/Parser/Entities.h>
@@ -156,6 +158,23 @@ namespace Web::HTML {
 #define EMIT_CURRENT_CHARACTER \
     EMIT_CHARACTER(current_input_character.value());
 
+// Emits the current input character, followed by the characters after it up to the next of the given bytes.
+#define EMIT_CURRENT_CHARACTER_AND_RUN_WITHOUT(...)                                                   \
+    do {                                                                                              \
+        create_new_token(HTMLToken::Type::Character);                                                 \
+        m_current_token.set_code_point(current_input_character.value());                              \
+        m_queued_tokens.enqueue(move(m_current_token));                                               \
+        enqueue_character_tokens_for_run(consume_run_without<__VA_ARGS__>(max_character_run_length)); \
+        return m_queued_tokens.dequeue();                                                             \
+    } while (0)
+
+// Appends the current input character to the current builder, followed by the input after it up to the next of the given bytes.
+#define APPEND_CURRENT_CHARACTER_AND_RUN_WITHOUT(...)                         \
+    do {                                                                      \
+        m_current_builder.append_code_point(current_input_character.value()); \
+        m_current_builder.append(consume_run_without<__VA_ARGS__>());         \
+    } while (0)
+
 #define SWITCH_TO_AND_EMIT_CHARACTER(code_point, new_state) \
     do {                                                    \
         will_switch_to(State::new_state);                   \
@@ -184,6 +203,41 @@ static inline void log_parse_error(SourceLocation const& location = SourceLocati
     dbgln_if(TOKENIZER_TRACE_DEBUG, "Parse error (tokenization) {}", location);
 }
 
+// Character tokens are queued up to this many bytes of input at a time, to keep the token queue small.
+static constexpr size_t max_character_run_length = 256;
+
+// Returns the length of the longest prefix of the bytes that contains none of the stop bytes, looking at 16 bytes at once.
+// This is what lets the tokenizer skip over runs of text and attribute values that need no special handling.
+template<u8... stop_bytes>
+static size_t length_of_run_without(ReadonlyBytes bytes)
+{
+    using AK::SIMD::u8x16;
+
+    size_t offset = 0;
+    for (; offset + sizeof(u8x16) <= bytes.size(); offset += sizeof(u8x16)) {
+        u8x16 chunk;
+        __builtin_memcpy(&chunk, bytes.offset_pointer(offset), sizeof(chunk));
+        auto matches = ((chunk == stop_bytes) | ...);
+        if (auto mask = AK::SIMD::maskbits(matches); mask != 0)
+            return offset + count_trailing_zeroes(mask);
+    }
+    for (; offset < bytes.size(); ++offset) {
+        if (((bytes[offset] == stop_bytes) || ...))
+            return offset;
+    }
+    return offset;
+}
+
+static void advance_position(HTMLToken::Position& position, u32 code_point)
+{
+    if (code_point == '\n') {
+        position.column = 0;
+        position.line++;
+    } else {
+        position.column++;
+    }
+}
+
 Optional<u32> HTMLTokenizer::next_code_point()
 {
     if (m_utf8_iterator == m_utf8_view.end())
@@ -215,19 +269,66 @@ void HTMLTokenizer::skip(size_t count)
         m_source_positions.append(m_source_positions.last());
     for (size_t i = 0; i < count; ++i) {
         m_prev_utf8_iterator = m_utf8_iterator;
-        auto code_point = *m_utf8_iterator;
-        if (!m_source_positions.is_empty()) {
-            if (code_point == '\n') {
-                m_source_positions.last().column = 0;
-                m_source_positions.last().line++;
-            } else {
-                m_source_positions.last().column++;
-            }
-        }
+        if (!m_source_positions.is_empty())
+            advance_position(m_source_positions.last(), *m_utf8_iterator);
         ++m_utf8_iterator;
     }
 }
 
+// Consumes the input up to the next of the given bytes (which must all be ASCII) in one go.
+// It must only be used where none of the code points in between need special handling.
+template<u8... stop_bytes>
+StringView HTMLTokenizer::consume_run_without(size_t max_length)
+{
+    auto bytes = m_decoded_input.bytes();
+    auto offset = m_utf8_view.byte_offset_of(m_utf8_iterator);
+    auto end = offset + min(max_length, bytes.size() - offset);
+    // NOTE: The run stops short of the insertion point, so that the parser does not see it reached while there are still
+    //       queued tokens from before it.
+    if (m_insertion_point.defined)
+        end = min(end, m_insertion_point.position > offset ? m_insertion_point.position - 1 : offset);
+
+    auto length = length_of_run_without<stop_bytes...>(bytes.slice(offset, end - offset));
+    // NOTE: If the run was cut short, it must not end in the middle of a code point.
+    while (length > 0 && offset + length < bytes.size() && (bytes[offset + length] & 0xC0) == 0x80)
+        --length;
+    if (length == 0)
+        return {};
+
+    auto run = m_decoded_input.substring_view(offset, length);
+    if (!m_source_positions.is_empty()) {
+        auto position = m_source_positions.last();
+        for (auto byte : run.bytes()) {
+            // Continuation bytes are not code points of their own.
+            if ((byte & 0xC0) != 0x80)
+                advance_position(position, byte);
+        }
+        m_source_positions.append(position);
+    }
+
+    auto last_code_point_offset = length - 1;
+    while (last_code_point_offset > 0 && (bytes[offset + last_code_point_offset] & 0xC0) == 0x80)
+        --last_code_point_offset;
+    m_prev_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(offset + last_code_point_offset);
+    m_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(offset + length);
+    return run;
+}
+
+void HTMLTokenizer::enqueue_character_tokens_for_run(StringView run)
+{
+    if (run.is_empty())
+        return;
+
+    // Each character token starts where its code point has been consumed, just like with create_new_token().
+    auto position = m_source_positions.size() >= 2 ? nth_last_position(1) : HTMLToken::Position {};
+    for (auto code_point : Utf8View { run }) {
+        advance_position(position, code_point);
+        auto token = HTMLToken::make_character(code_point);
+        token.set_start_position({}, position);
+        m_queued_tokens.enqueue(move(token));
+    }
+}
+
 Optional<u32> HTMLTokenizer::peek_code_point(size_t offset) const
 {
     auto it = m_utf8_iterator;
@@ -287,7 +388,7 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    EMIT_CURRENT_CHARACTER;
+                    EMIT_CURRENT_CHARACTER_AND_RUN_WITHOUT('&', '<', '\r', 0);
                 }
             }
             END_STATE
@@ -1258,7 +1359,7 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    m_current_builder.append_code_point(current_input_character.value());
+                    APPEND_CURRENT_CHARACTER_AND_RUN_WITHOUT('"', '&', '\r', 0);
                     continue;
                 }
             }
@@ -1290,7 +1391,7 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    m_current_builder.append_code_point(current_input_character.value());
+                    APPEND_CURRENT_CHARACTER_AND_RUN_WITHOUT('\'', '&', '\r', 0);
                     continue;
                 }
             }
@@ -1460,7 +1561,7 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    m_current_builder.append_code_point(current_input_character.value());
+                    APPEND_CURRENT_CHARACTER_AND_RUN_WITHOUT('<', '-', '\r', 0);
                     continue;
                 }
             }
@@ -1897,7 +1998,7 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    EMIT_CURRENT_CHARACTER;
+                    EMIT_CURRENT_CHARACTER_AND_RUN_WITHOUT('&', '<', '\r', 0);
                 }
             }
             END_STATE
@@ -2016,7 +2117,7 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    EMIT_CURRENT_CHARACTER;
+                    EMIT_CURRENT_CHARACTER_AND_RUN_WITHOUT('<', '\r', 0);
                 }
             }
             END_STATE
@@ -2135,7 +2236,7 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    EMIT_CURRENT_CHARACTER;
+                    EMIT_CURRENT_CHARACTER_AND_RUN_WITHOUT('<', '\r', 0);
                 }
             }
             END_STATE
@@ -2154,7 +2255,7 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    EMIT_CURRENT_CHARACTER;
+                    EMIT_CURRENT_CHARACTER_AND_RUN_WITHOUT('\r', 0);
                 }
             }
             END_STATE
@@ -126,6 +126,9 @@ public:
 
     DeprecatedString source() const { return m_decoded_input; }
 
+    // The input that has not been consumed yet.
+    StringView unconsumed_input() const { return m_decoded_input.substring_view(m_utf8_view.byte_offset_of(m_utf8_iterator)); }
+
     void insert_input_at_insertion_point(DeprecatedString const& input);
     void insert_eof();
     bool is_eof_inserted();
@@ -149,6 +152,9 @@ public:
 
 private:
     void skip(size_t count);
+    template<u8... stop_bytes>
+    StringView consume_run_without(size_t max_length = NumericLimits<size_t>::max());
+    void enqueue_character_tokens_for_run(StringView);
     Optional<u32> next_code_point();
     Optional<u32> peek_code_point(size_t offset) const;
     bool consume_next_if_match(StringView, CaseSensitivity = CaseSensitivity::CaseSensitive);
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+#include <LibWeb/HTML/Parser/SpeculativeHTMLParser.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/Infra/CharacterTypes.h>
+#include <LibWeb/Infra/Strings.h>
+#include <LibWeb/Loader/LoadRequest.h>
+#include <LibWeb/Loader/ResourceLoader.h>
+#include <LibWeb/MimeSniff/MimeType.h>
+#include <LibWeb/SVG/TagNames.h>
+
+namespace Web::HTML {
+
+SpeculativeHTMLParser::~SpeculativeHTMLParser()
+{
+    stop();
+}
+
+static bool is_fetched_script(HTMLToken& token, bool scripting_enabled)
+{
+    if (!scripting_enabled || token.attribute(AttributeNames::src).is_empty())
+        return false;
+
+    // See HTMLScriptElement::prepare_script() for how the type of a script is determined.
+    auto type = token.attribute(AttributeNames::type);
+    auto language = token.attribute(AttributeNames::language);
+    DeprecatedString script_block_type;
+    if (!type.is_empty())
+        script_block_type = type.trim(Infra::ASCII_WHITESPACE);
+    else if (type.is_null() && !language.is_empty())
+        script_block_type = DeprecatedString::formatted("text/{}", language);
+    else
+        script_block_type = "text/javascript";
+
+    if (MimeSniff::is_javascript_mime_type_essence_match(script_block_type.trim(Infra::ASCII_WHITESPACE)))
+        return !token.has_attribute(AttributeNames::nomodule);
+    return Infra::is_ascii_case_insensitive_match(script_block_type, "module"sv);
+}
+
+static bool is_fetched_stylesheet(HTMLToken& token)
+{
+    if (token.attribute(AttributeNames::href).is_empty())
+        return false;
+
+    bool is_stylesheet = false;
+    for (auto relationship : token.attribute(AttributeNames::rel).split_view_if(Infra::is_ascii_whitespace)) {
+        if (relationship.equals_ignoring_ascii_case("stylesheet"sv))
+            is_stylesheet = true;
+        else if (relationship.equals_ignoring_ascii_case("alternate"sv))
+            return false;
+    }
+    return is_stylesheet;
+}
+
+Vector<SpeculativeHTMLParser::SpeculativeFetch> SpeculativeHTMLParser::find_speculative_fetches(StringView input, AK::URL const& base_url, bool base_url_is_final, bool scripting_enabled)
+{
+    Vector<SpeculativeFetch> fetches;
+    HTMLTokenizer tokenizer { input, "utf-8" };
+    auto current_base_url = base_url;
+
+    // Tags inside these are not going to fetch anything, or are not HTML at all, so they are skipped.
+    size_t template_depth = 0;
+    size_t foreign_content_depth = 0;
+    size_t picture_depth = 0;
+
+    auto add_fetch = [&](StringView url_string, Priority priority) {
+        auto url = current_base_url.complete_url(url_string);
+        if (!url.is_valid())
+            return;
+        for (auto const& fetch : fetches) {
+            if (fetch.url == url)
+                return;
+        }
+        fetches.append({ move(url), priority });
+    };
+
+    for (;;) {
+        auto token = tokenizer.next_token();
+        if (!token.has_value() || token->is_end_of_file())
+            break;
+
+        if (token->is_end_tag()) {
+            auto const& tag_name = token->tag_name();
+            if (tag_name == TagNames::template_ && template_depth > 0)
+                --template_depth;
+            else if (tag_name.is_one_of(SVG::TagNames::svg, "math"sv) && foreign_content_depth > 0)
+                --foreign_content_depth;
+            else if (tag_name == TagNames::picture && picture_depth > 0)
+                --picture_depth;
+            continue;
+        }
+
+        if (!token->is_start_tag())
+            continue;
+
+        auto const& tag_name = token->tag_name();
+        if (foreign_content_depth > 0) {
+            if (tag_name.is_one_of(SVG::TagNames::svg, "math"sv) && !token->is_self_closing())
+                ++foreign_content_depth;
+            continue;
+        }
+
+        // The tree builder switches the tokenizer into these states after these start tags, so we have to as well.
+        if (tag_name == TagNames::script)
+            tokenizer.switch_to(HTMLTokenizer::State::ScriptData);
+        else if (tag_name.is_one_of(TagNames::style, TagNames::xmp, TagNames::iframe, TagNames::noembed, TagNames::noframes)
+            || (tag_name == TagNames::noscript && scripting_enabled))
+            tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+        else if (tag_name.is_one_of(TagNames::textarea, TagNames::title))
+            tokenizer.switch_to(HTMLTokenizer::State::RCDATA);
+        else if (tag_name == TagNames::plaintext)
+            tokenizer.switch_to(HTMLTokenizer::State::PLAINTEXT);
+
+        if (tag_name.is_one_of(SVG::TagNames::svg, "math"sv)) {
+            if (!token->is_self_closing())
+                ++foreign_content_depth;
+            continue;
+        }
+        if (tag_name == TagNames::template_) {
+            ++template_depth;
+            continue;
+        }
+        if (tag_name == TagNames::picture) {
+            ++picture_depth;
+            continue;
+        }
+        if (template_depth > 0)
+            continue;
+
+        if (tag_name == TagNames::base) {
+            // Only the first base element with an href attribute is used for the document base URL.
+            auto href = token->attribute(AttributeNames::href);
+            if (!base_url_is_final && !href.is_null()) {
+                auto new_base_url = base_url.complete_url(href);
+                if (new_base_url.is_valid())
+                    current_base_url = move(new_base_url);
+                base_url_is_final = true;
+            }
+        } else if (tag_name == TagNames::script) {
+            if (is_fetched_script(*token, scripting_enabled))
+                add_fetch(token->attribute(AttributeNames::src), Priority::High);
+        } else if (tag_name == TagNames::link) {
+            if (is_fetched_stylesheet(*token))
+                add_fetch(token->attribute(AttributeNames::href), Priority::High);
+        } else if (tag_name == TagNames::img) {
+            // NOTE: Images with a srcset, or in a picture element, pick the image they load depending on the viewport,
+            //       so we leave those alone.
+            if (picture_depth == 0 && !token->has_attribute(AttributeNames::srcset) && !token->attribute(AttributeNames::src).is_empty())
+                add_fetch(token->attribute(AttributeNames::src), Priority::Low);
+        }
+    }
+
+    Vector<SpeculativeFetch> fetches_by_priority;
+    fetches_by_priority.ensure_capacity(fetches.size());
+    for (auto priority : { Priority::High, Priority::Low }) {
+        for (auto& fetch : fetches) {
+            if (fetch.priority == priority)
+                fetches_by_priority.unchecked_append(move(fetch));
+        }
+    }
+    return fetches_by_priority;
+}
+
+void SpeculativeHTMLParser::run(DOM::Document& document, StringView input)
+{
+    if (m_has_run)
+        return;
+    m_has_run = true;
+
+    auto fetches = find_speculative_fetches(input, document.base_url(), document.first_base_element_with_href_in_tree_order() != nullptr, document.is_scripting_enabled());
+    dbgln_if(HTML_PARSER_DEBUG, "SpeculativeHTMLParser: Starting {} speculative fetches", fetches.size());
+
+    for (auto& fetch : fetches) {
+        auto request = LoadRequest::create_for_url_on_page(fetch.url, document.page());
+        ResourceLoader::the().load_speculatively(request);
+        m_fetched_urls.append(move(fetch.url));
+    }
+}
+
+void SpeculativeHTMLParser::stop()
+{
+    for (auto const& url : m_fetched_urls)
+        ResourceLoader::the().cancel_speculative_load(url);
+    m_fetched_urls.clear();
+}
+
+}
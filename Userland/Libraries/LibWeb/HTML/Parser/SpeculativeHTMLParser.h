@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/StringView.h>
+#include <AK/URL.h>
+#include <AK/Vector.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/parsing.html#speculative-html-parsing
+// While the HTML parser is blocked on a script, this tokenizes the rest of the input ahead of it and starts loading
+// the stylesheets, scripts and images it finds, so they are (hopefully) there once tree construction gets to them.
+//
+// Unlike what the specification describes, this never builds a tree: it only looks at start tags, which means it
+// can be wrong about things like the current base URL or whether a tag ends up in a <template>. That is fine, as
+// every element still fetches its resources itself, and only takes over a speculative fetch of the same URL.
+class SpeculativeHTMLParser {
+    AK_MAKE_NONCOPYABLE(SpeculativeHTMLParser);
+    AK_MAKE_NONMOVABLE(SpeculativeHTMLParser);
+
+public:
+    SpeculativeHTMLParser() = default;
+    ~SpeculativeHTMLParser();
+
+    enum class Priority {
+        // Resources that block parsing or rendering: scripts and stylesheets.
+        High,
+        Low,
+    };
+
+    struct SpeculativeFetch {
+        AK::URL url;
+        Priority priority { Priority::Low };
+    };
+
+    // Returns what the input is going to fetch, high priority fetches first.
+    static Vector<SpeculativeFetch> find_speculative_fetches(StringView input, AK::URL const& base_url, bool base_url_is_final, bool scripting_enabled);
+
+    // Scans the input once and starts the fetches it finds. Later calls do nothing.
+    void run(DOM::Document&, StringView input);
+
+    // Drops the results of the speculative fetches that were not used by now.
+    void stop();
+
+    bool has_run() const { return m_has_run; }
+
+private:
+    Vector<AK::URL> m_fetched_urls;
+    bool m_has_run { false };
+};
+
+}
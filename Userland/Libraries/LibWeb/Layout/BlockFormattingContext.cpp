@@ -630,7 +630,9 @@ void BlockFormattingContext::layout_block_level_box(Box const& box, BlockContain
 
     if (independent_formatting_context) {
         // This box establishes a new formatting context. Pass control to it.
-        independent_formatting_context->run(box, layout_mode, box_state.available_inner_space_or_constraints_from(available_space));
+        auto available_inner_space = box_state.available_inner_space_or_constraints_from(available_space);
+        if (!reuse_previous_layout_inside(box, layout_mode, available_inner_space))
+            run_and_remember_layout_inside(*independent_formatting_context, box, layout_mode, available_inner_space);
     } else {
         // This box participates in the current block container's flow.
         if (box.children_are_inline()) {
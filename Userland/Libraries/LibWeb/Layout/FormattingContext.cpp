@@ -174,6 +174,23 @@ struct DummyFormattingContext : public FormattingContext {
     virtual void run(Box const&, LayoutMode, AvailableSpace const&) override { }
 };
 
+// Stands in for the formatting context of a box whose insides were taken from the previous layout.
+struct ReusedFormattingContext : public FormattingContext {
+    ReusedFormattingContext(LayoutState& state, Box const& box, CSSPixels automatic_content_width, CSSPixels automatic_content_height)
+        : FormattingContext(Type::Block, state, box)
+        , m_automatic_content_width(automatic_content_width)
+        , m_automatic_content_height(automatic_content_height)
+    {
+    }
+    virtual CSSPixels automatic_content_width() const override { return m_automatic_content_width; }
+    virtual CSSPixels automatic_content_height() const override { return m_automatic_content_height; }
+    virtual void run(Box const&, LayoutMode, AvailableSpace const&) override { }
+
+private:
+    CSSPixels m_automatic_content_width;
+    CSSPixels m_automatic_content_height;
+};
+
 OwnPtr<FormattingContext> FormattingContext::create_independent_formatting_context_if_needed(LayoutState& state, Box const& child_box)
 {
     auto type = formatting_context_type_created_by_box(child_box);
@@ -224,14 +241,140 @@ OwnPtr<FormattingContext> FormattingContext::layout_inside(Box const& child_box,
         return {};
 
     auto independent_formatting_context = create_independent_formatting_context_if_needed(m_state, child_box);
-    if (independent_formatting_context)
-        independent_formatting_context->run(child_box, layout_mode, available_space);
-    else
+    if (independent_formatting_context) {
+        if (auto reused_formatting_context = reuse_previous_layout_inside(child_box, layout_mode, available_space))
+            return reused_formatting_context;
+        run_and_remember_layout_inside(*independent_formatting_context, child_box, layout_mode, available_space);
+    } else {
         run(child_box, layout_mode, available_space);
+    }
 
     return independent_formatting_context;
 }
 
+static bool is_dimensioned_the_same_way(LayoutState::UsedValues const& a, LayoutState::UsedValues const& b)
+{
+    return a.content_width() == b.content_width()
+        && a.content_height() == b.content_height()
+        && a.has_definite_width() == b.has_definite_width()
+        && a.has_definite_height() == b.has_definite_height()
+        && a.width_constraint == b.width_constraint
+        && a.height_constraint == b.height_constraint
+        && a.margin_left == b.margin_left
+        && a.margin_right == b.margin_right
+        && a.margin_top == b.margin_top
+        && a.margin_bottom == b.margin_bottom
+        && a.border_left == b.border_left
+        && a.border_right == b.border_right
+        && a.border_top == b.border_top
+        && a.border_bottom == b.border_bottom
+        && a.padding_left == b.padding_left
+        && a.padding_right == b.padding_right
+        && a.padding_top == b.padding_top
+        && a.padding_bottom == b.padding_bottom
+        && a.inset_left == b.inset_left
+        && a.inset_right == b.inset_right
+        && a.inset_top == b.inset_top
+        && a.inset_bottom == b.inset_bottom;
+}
+
+// Absolutely positioned boxes are laid out against their containing block, which might be outside of `box`.
+static bool has_descendant_with_containing_block_outside_of(Box const& box)
+{
+    bool found = false;
+    box.for_each_in_subtree_of_type<Box>([&](Box const& descendant) {
+        if (descendant.is_absolutely_positioned() && !box.is_inclusive_ancestor_of(*descendant.containing_block())) {
+            found = true;
+            return IterationDecision::Break;
+        }
+        return IterationDecision::Continue;
+    });
+    return found;
+}
+
+// Only layouts of the root state end up being committed, so those are the only ones that can be reused.
+static bool can_remember_layout_inside(LayoutState const& state, LayoutMode layout_mode)
+{
+    return layout_mode == LayoutMode::Normal && !state.m_parent;
+}
+
+OwnPtr<FormattingContext> FormattingContext::reuse_previous_layout_inside(Box const& box, LayoutMode layout_mode, AvailableSpace const& available_space)
+{
+    if (!can_remember_layout_inside(m_state, layout_mode))
+        return nullptr;
+
+    auto* previous_layout = m_state.previous_layout;
+    if (!previous_layout || box.is_or_contains_node_that_needs_layout_update())
+        return nullptr;
+
+    auto const* snapshot = previous_layout->inside_layout_snapshots.get(&box).value_or(nullptr);
+    if (!snapshot || snapshot->available_space != available_space)
+        return nullptr;
+
+    auto& box_state = m_state.get_mutable(box);
+    if (!is_dimensioned_the_same_way(snapshot->used_values_before, box_state))
+        return nullptr;
+
+    if (has_descendant_with_containing_block_outside_of(box))
+        return nullptr;
+
+    // Everything inside is positioned relative to a containing block within `box`, so the used values still apply as they are.
+    box.for_each_in_subtree_of_type<NodeWithStyleAndBoxModelMetrics>([&](NodeWithStyleAndBoxModelMetrics const& descendant) {
+        if (auto const* used_values = previous_layout->used_values_per_layout_node.get(&descendant).value_or(nullptr)) {
+            m_state.used_values_per_layout_node.set(&descendant, adopt_own(*new LayoutState::UsedValues(*used_values)));
+            ++m_state.reused_used_values_count;
+        }
+        if (is<Box>(descendant)) {
+            if (auto const* descendant_snapshot = previous_layout->inside_layout_snapshots.get(&static_cast<Box const&>(descendant)).value_or(nullptr))
+                m_state.inside_layout_snapshots.set(&static_cast<Box const&>(descendant), adopt_own(*new LayoutState::InsideLayoutSnapshot(*descendant_snapshot)));
+        }
+        return IterationDecision::Continue;
+    });
+
+    // The parent context may have placed `box` somewhere else this time.
+    auto offset = box_state.offset;
+    auto containing_line_box_fragment = box_state.containing_line_box_fragment;
+    box_state = snapshot->used_values_after;
+    box_state.offset = offset;
+    box_state.containing_line_box_fragment = containing_line_box_fragment;
+    ++m_state.reused_used_values_count;
+
+    m_state.inside_layout_snapshots.set(&box, adopt_own(*new LayoutState::InsideLayoutSnapshot(*snapshot)));
+
+    return make<ReusedFormattingContext>(m_state, box, snapshot->automatic_content_width, snapshot->automatic_content_height);
+}
+
+void FormattingContext::run_and_remember_layout_inside(FormattingContext& context, Box const& box, LayoutMode layout_mode, AvailableSpace const& available_space)
+{
+    if (!can_remember_layout_inside(m_state, layout_mode)) {
+        context.run(box, layout_mode, available_space);
+        return;
+    }
+
+    auto used_values_before = m_state.get(box);
+    context.run(box, layout_mode, available_space);
+
+    // NOTE: Asking for the automatic content size looks at the used values of all children, which creates them for
+    //       children the context never dimensioned (like whitespace blocks in a table). Those must not get committed.
+    Vector<Box const*> children_without_used_values;
+    box.for_each_child_of_type<Box>([&](Box const& child) {
+        if (!m_state.used_values_per_layout_node.contains(&child))
+            children_without_used_values.append(&child);
+    });
+    auto automatic_content_width = context.automatic_content_width();
+    auto automatic_content_height = context.automatic_content_height();
+    for (auto const* child : children_without_used_values)
+        m_state.used_values_per_layout_node.remove(child);
+
+    m_state.inside_layout_snapshots.set(&box, adopt_own(*new LayoutState::InsideLayoutSnapshot {
+                                                  .available_space = available_space,
+                                                  .used_values_before = move(used_values_before),
+                                                  .used_values_after = m_state.get(box),
+                                                  .automatic_content_width = automatic_content_width,
+                                                  .automatic_content_height = automatic_content_height,
+                                              }));
+}
+
 CSSPixels FormattingContext::greatest_child_width(Box const& box) const
 {
     CSSPixels max_width = 0;
@@ -1157,7 +1300,7 @@ CSSPixels FormattingContext::calculate_min_content_width(Layout::Box const& box)
 
     auto& root_state = m_state.m_root;
 
-    auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
+    auto& cache = root_state.intrinsic_sizes_for(box);
     if (cache.min_content_width.has_value())
         return *cache.min_content_width;
 
@@ -1195,7 +1338,7 @@ CSSPixels FormattingContext::calculate_max_content_width(Layout::Box const& box)
 
     auto& root_state = m_state.m_root;
 
-    auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
+    auto& cache = root_state.intrinsic_sizes_for(box);
     if (cache.max_content_width.has_value())
         return *cache.max_content_width;
 
@@ -1242,7 +1385,7 @@ CSSPixels FormattingContext::calculate_min_content_height(Layout::Box const& box
         if (!is_cacheable)
             return {};
         auto& root_state = m_state.m_root;
-        auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
+        auto& cache = root_state.intrinsic_sizes_for(box);
         if (available_width.is_definite())
             return &cache.min_content_height_with_definite_available_width.ensure(available_width.to_px());
         if (available_width.is_min_content())
@@ -1297,7 +1440,7 @@ CSSPixels FormattingContext::calculate_max_content_height(Layout::Box const& box
         if (!is_cacheable)
             return {};
         auto& root_state = m_state.m_root;
-        auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
+        auto& cache = root_state.intrinsic_sizes_for(box);
         if (available_width.is_definite())
             return &cache.max_content_height_with_definite_available_width.ensure(available_width.to_px());
         if (available_width.is_min_content())
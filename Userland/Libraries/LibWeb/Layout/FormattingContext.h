@@ -100,6 +100,12 @@ protected:
     static bool should_treat_height_as_auto(Box const&, AvailableSpace const&);
 
     OwnPtr<FormattingContext> layout_inside(Box const&, LayoutMode, AvailableSpace const&);
+
+    // If nothing inside `box` changed since the previous layout, and it is dimensioned the same way as back then,
+    // this takes the layout of its insides from the previous layout and returns a context standing in for the one that produced it.
+    OwnPtr<FormattingContext> reuse_previous_layout_inside(Box const&, LayoutMode, AvailableSpace const&);
+    void run_and_remember_layout_inside(FormattingContext&, Box const&, LayoutMode, AvailableSpace const&);
+
     void compute_inset(Box const& box);
 
     struct SpaceUsedByFloats {
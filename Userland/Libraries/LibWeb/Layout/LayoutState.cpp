@@ -113,6 +113,8 @@ void LayoutState::commit()
         node.box_model().border = { used_values.border_top.value(), used_values.border_right.value(), used_values.border_bottom.value(), used_values.border_left.value() };
         node.box_model().margin = { used_values.margin_top.value(), used_values.margin_right.value(), used_values.margin_bottom.value(), used_values.margin_left.value() };
 
+        // FIXME: Paintables are created anew for every node, even for the ones whose used values were reused from the
+        //        previous layout unchanged. Only the formatting work is saved on an incremental relayout so far.
         node.set_paintable(node.create_paintable());
 
         // For boxes, transfer all the state needed for painting.
@@ -133,7 +135,9 @@ void LayoutState::commit()
                             text_nodes.set(static_cast<Layout::TextNode*>(const_cast<Layout::Node*>(&fragment.layout_node())));
                     }
                 }
-                static_cast<Painting::PaintableWithLines&>(paintable_box).set_line_boxes(move(used_values.line_boxes));
+                // NOTE: The line boxes are copied, as the used values are kept around for the next layout to reuse.
+                auto line_boxes = used_values.line_boxes;
+                static_cast<Painting::PaintableWithLines&>(paintable_box).set_line_boxes(move(line_boxes));
             }
         }
     }
@@ -164,6 +168,34 @@ void LayoutState::commit()
         text_node->set_paintable(text_node->create_paintable());
 }
 
+LayoutState::IntrinsicSizes& LayoutState::intrinsic_sizes_for(NodeWithStyleAndBoxModelMetrics const& box) const
+{
+    return *intrinsic_sizes.ensure(&box, [&] {
+        if (previous_layout && !box.is_or_contains_node_that_needs_layout_update()) {
+            if (auto const* previous_intrinsic_sizes = previous_layout->intrinsic_sizes.get(&box).value_or(nullptr))
+                return adopt_own(*new IntrinsicSizes(*previous_intrinsic_sizes));
+        }
+        return adopt_own(*new IntrinsicSizes);
+    });
+}
+
+void LayoutState::take_over_unchanged_results_from_previous_layout()
+{
+    if (!previous_layout)
+        return;
+
+    // NOTE: Used values and snapshots of unchanged subtrees have already been copied over when they were reused,
+    //       but intrinsic sizes are only looked up on demand, so the ones we didn't need this time are carried over here.
+    for (auto& it : previous_layout->intrinsic_sizes) {
+        if (it.key->is_or_contains_node_that_needs_layout_update())
+            continue;
+        if (!intrinsic_sizes.contains(it.key))
+            intrinsic_sizes.set(it.key, move(it.value));
+    }
+
+    previous_layout = nullptr;
+}
+
 void LayoutState::UsedValues::set_node(NodeWithStyleAndBoxModelMetrics& node, UsedValues const* containing_block_used_values)
 {
     m_node = &node;
@@ -8,6 +8,7 @@
 
 #include <AK/HashMap.h>
 #include <LibGfx/Point.h>
+#include <LibWeb/Layout/AvailableSpace.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/LineBox.h>
 #include <LibWeb/Painting/PaintableBox.h>
@@ -20,9 +21,6 @@ enum class SizeConstraint {
     MaxContent,
 };
 
-class AvailableSize;
-class AvailableSpace;
-
 struct LayoutState {
     LayoutState()
         : m_root(*this)
@@ -165,6 +163,29 @@ struct LayoutState {
 
     HashMap<JS::GCPtr<NodeWithStyleAndBoxModelMetrics const>, NonnullOwnPtr<IntrinsicSizes>> mutable intrinsic_sizes;
 
+    // Returns the cached intrinsic sizes of `box`, starting out with the ones from the previous layout if nothing inside `box` changed since.
+    IntrinsicSizes& intrinsic_sizes_for(NodeWithStyleAndBoxModelMetrics const& box) const;
+
+    // How the insides of an independent formatting context root were laid out the last time. If nothing inside the root
+    // changed, and it is dimensioned the same way again, the next layout can take the results from here.
+    struct InsideLayoutSnapshot {
+        AvailableSpace available_space;
+        UsedValues used_values_before;
+        UsedValues used_values_after;
+        CSSPixels automatic_content_width;
+        CSSPixels automatic_content_height;
+    };
+
+    HashMap<JS::GCPtr<Box const>, NonnullOwnPtr<InsideLayoutSnapshot>> inside_layout_snapshots;
+
+    // The committed state of the previous layout, if only the nodes marked with Node::set_needs_layout_update() changed since.
+    LayoutState* previous_layout { nullptr };
+
+    // Keeps the results of the previous layout that are still valid, so the layout after this one can reuse them as well.
+    void take_over_unchanged_results_from_previous_layout();
+
+    size_t reused_used_values_count { 0 };
+
     LayoutState const* m_parent { nullptr };
     LayoutState const& m_root;
 };
@@ -221,6 +221,31 @@ void Node::set_needs_display()
     });
 }
 
+void Node::set_needs_layout_update()
+{
+    if (m_needs_layout_update)
+        return;
+    m_needs_layout_update = true;
+
+    for (auto* ancestor = parent(); ancestor && !ancestor->m_child_needs_layout_update; ancestor = ancestor->parent())
+        ancestor->m_child_needs_layout_update = true;
+
+    document().set_needs_layout({});
+}
+
+void Node::clear_needs_layout_update_in_subtree()
+{
+    // NOTE: Only the marked paths are walked, so this is proportional to the amount of changed nodes.
+    m_needs_layout_update = false;
+    if (!m_child_needs_layout_update)
+        return;
+    m_child_needs_layout_update = false;
+    for_each_child([](Node& child) {
+        if (child.is_or_contains_node_that_needs_layout_update())
+            child.clear_needs_layout_update_in_subtree();
+    });
+}
+
 CSSPixelPoint Node::box_type_agnostic_position() const
 {
     if (is<Box>(*this))
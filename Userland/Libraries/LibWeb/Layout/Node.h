@@ -139,6 +139,14 @@ public:
 
     virtual void set_needs_display();
 
+    // Marks this node as changed in a way that affects layout. Its ancestors are marked as having a changed
+    // descendant, so the next layout can reuse the previous results of every subtree that isn't marked.
+    void set_needs_layout_update();
+    bool needs_layout_update() const { return m_needs_layout_update; }
+    bool child_needs_layout_update() const { return m_child_needs_layout_update; }
+    bool is_or_contains_node_that_needs_layout_update() const { return m_needs_layout_update || m_child_needs_layout_update; }
+    void clear_needs_layout_update_in_subtree();
+
     bool children_are_inline() const { return m_children_are_inline; }
     void set_children_are_inline(bool value) { m_children_are_inline = value; }
 
@@ -176,6 +184,9 @@ private:
 
     bool m_is_flex_item { false };
     bool m_generated { false };
+
+    bool m_needs_layout_update { false };
+    bool m_child_needs_layout_update { false };
 };
 
 class NodeWithStyle : public Node {
@@ -156,6 +156,113 @@ static void store_response_cookies(Page& page, AK::URL const& url, DeprecatedStr
 
 static size_t resource_id = 0;
 
+// A load started by load_speculatively(), which is handed over to the first load() of the same URL that would get the same response.
+struct SpeculativeLoad : public RefCounted<SpeculativeLoad> {
+    enum class State {
+        Pending,
+        Loaded,
+        Failed,
+    };
+
+    State state { State::Pending };
+    HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> request_headers;
+    ByteBuffer data;
+    HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> response_headers;
+    Optional<u32> status_code;
+    DeprecatedString error;
+
+    // Once a load() has taken over, the result goes straight to its callbacks.
+    bool is_taken { false };
+    Function<void(ReadonlyBytes, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, Optional<u32> status_code)> success_callback;
+    Function<void(DeprecatedString const&, Optional<u32> status_code)> error_callback;
+};
+
+static HashMap<DeprecatedString, NonnullRefPtr<SpeculativeLoad>> s_speculative_loads;
+
+static bool may_use_speculative_load(LoadRequest const& request)
+{
+    auto const& url = request.url();
+    if (url.scheme() != "http"sv && url.scheme() != "https"sv)
+        return false;
+    if (request.method() != "GET"sv || !request.body().is_empty())
+        return false;
+
+    // NOTE: CORS, range and explicitly credentialed requests get a different response than a plain fetch of the same URL.
+    //       LoadRequest does not carry a credentials mode, so an Authorization header is the only sign of non-default credentials.
+    auto const& headers = request.headers();
+    return !headers.contains("Origin"sv) && !headers.contains("Range"sv) && !headers.contains("Authorization"sv);
+}
+
+static bool have_same_response_changing_headers(HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& a, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& b)
+{
+    // NOTE: Fetch adds headers like Accept, Accept-Language and User-Agent that the speculative request doesn't have.
+    //       Those only state preferences, so just the headers that can get a different response for the URL are compared.
+    for (auto name : { "Cookie"sv, "Authorization"sv, "Range"sv, "Origin"sv }) {
+        if (a.get(name) != b.get(name))
+            return false;
+    }
+    return true;
+}
+
+static RefPtr<SpeculativeLoad> take_speculative_load(LoadRequest const& request)
+{
+    if (s_speculative_loads.is_empty() || !may_use_speculative_load(request))
+        return nullptr;
+    auto url_string = request.url().to_deprecated_string();
+    auto speculative_load = s_speculative_loads.get(url_string);
+    if (!speculative_load.has_value() || !have_same_response_changing_headers((*speculative_load)->request_headers, request.headers()))
+        return nullptr;
+    return s_speculative_loads.take(url_string).release_value();
+}
+
+void ResourceLoader::load_speculatively(LoadRequest& request)
+{
+    if (!may_use_speculative_load(request))
+        return;
+
+    auto url_string = request.url().to_deprecated_string();
+    if (s_speculative_loads.contains(url_string))
+        return;
+
+    auto speculative_load = adopt_ref(*new SpeculativeLoad);
+    speculative_load->request_headers = request.headers();
+    load(
+        request,
+        [speculative_load](auto data, auto& response_headers, auto status_code) {
+            if (speculative_load->is_taken) {
+                speculative_load->success_callback(data, response_headers, status_code);
+                return;
+            }
+            auto data_copy = ByteBuffer::copy(data);
+            if (data_copy.is_error()) {
+                speculative_load->state = SpeculativeLoad::State::Failed;
+                speculative_load->error = DeprecatedString::formatted("{}", data_copy.error());
+                return;
+            }
+            speculative_load->state = SpeculativeLoad::State::Loaded;
+            speculative_load->data = data_copy.release_value();
+            speculative_load->response_headers = response_headers;
+            speculative_load->status_code = status_code;
+        },
+        [speculative_load](auto& error, auto status_code) {
+            if (speculative_load->is_taken) {
+                if (speculative_load->error_callback)
+                    speculative_load->error_callback(error, status_code);
+                return;
+            }
+            speculative_load->state = SpeculativeLoad::State::Failed;
+            speculative_load->error = error;
+            speculative_load->status_code = status_code;
+        });
+    s_speculative_loads.set(move(url_string), move(speculative_load));
+}
+
+void ResourceLoader::cancel_speculative_load(AK::URL const& url)
+{
+    // NOTE: If the load is still pending, its result is simply dropped when it comes in.
+    s_speculative_loads.remove(url.to_deprecated_string());
+}
+
 void ResourceLoader::load(LoadRequest& request, Function<void(ReadonlyBytes, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, Optional<u32> status_code)> success_callback, Function<void(DeprecatedString const&, Optional<u32> status_code)> error_callback, Optional<u32> timeout, Function<void()> timeout_callback)
 {
     auto& url = request.url();
@@ -290,6 +397,30 @@ void ResourceLoader::load(LoadRequest& request, Function<void(ReadonlyBytes, Has
         return;
     }
 
+    if (auto speculative_load = take_speculative_load(request)) {
+        dbgln_if(CACHE_DEBUG, "Using speculative load for: {}", url_for_logging);
+        switch (speculative_load->state) {
+        case SpeculativeLoad::State::Pending:
+            speculative_load->is_taken = true;
+            speculative_load->success_callback = move(success_callback);
+            speculative_load->error_callback = move(error_callback);
+            break;
+        case SpeculativeLoad::State::Loaded:
+            Platform::EventLoopPlugin::the().deferred_invoke([speculative_load, success_callback = move(success_callback)] {
+                success_callback(speculative_load->data, speculative_load->response_headers, speculative_load->status_code);
+            });
+            break;
+        case SpeculativeLoad::State::Failed:
+            if (error_callback) {
+                Platform::EventLoopPlugin::the().deferred_invoke([speculative_load, error_callback = move(error_callback)] {
+                    error_callback(speculative_load->error, speculative_load->status_code);
+                });
+            }
+            break;
+        }
+        return;
+    }
+
     if (url.scheme() == "http" || url.scheme() == "https" || url.scheme() == "gemini") {
         auto proxy = ProxyMappings::the().proxy_for_url(url);
 
@@ -389,6 +520,7 @@ void ResourceLoader::clear_cache()
 {
     dbgln_if(CACHE_DEBUG, "Clearing {} items from ResourceLoader cache", s_resource_cache.size());
     s_resource_cache.clear();
+    s_speculative_loads.clear();
 }
 
 void ResourceLoader::evict_from_cache(LoadRequest const& request)
@@ -103,6 +103,14 @@ public:
     void prefetch_dns(AK::URL const&);
     void preconnect(AK::URL const&);
 
+    // Starts loading a resource the page is expected to ask for later (see HTML::SpeculativeHTMLParser). The next GET
+    // request for the same URL and with the same Cookie header passed to load() is then answered by this load, instead of
+    // going to the network again.
+    void load_speculatively(LoadRequest&);
+
+    // Drops the speculative load of the URL, if nothing has asked for it yet.
+    void cancel_speculative_load(AK::URL const&);
+
     Function<void()> on_load_counter_change;
 
     int pending_loads() const { return m_pending_loads; }
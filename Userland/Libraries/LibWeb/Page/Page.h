@@ -200,6 +200,7 @@ public:
     virtual void page_did_hover_link(const AK::URL&) { }
     virtual void page_did_unhover_link() { }
     virtual void page_did_invalidate(CSSPixelRect const&) { }
+    virtual void page_did_invalidate_all() { }
     virtual void page_did_change_favicon(Gfx::Bitmap const&) { }
     virtual void page_did_layout() { }
     virtual void page_did_request_scroll(i32, i32) { }
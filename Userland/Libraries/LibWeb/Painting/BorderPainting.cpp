@@ -14,6 +14,14 @@
 
 namespace Web::Painting {
 
+Gfx::AntiAliasingPainter::CornerRadius BorderRadiusData::as_corner(PaintContext& context) const
+{
+    return Gfx::AntiAliasingPainter::CornerRadius {
+        context.floored_device_pixels(horizontal_radius).value(),
+        context.floored_device_pixels(vertical_radius).value()
+    };
+}
+
 BorderRadiiData normalized_border_radii_data(Layout::Node const& node, CSSPixelRect const& rect, CSS::BorderRadiusData top_left_radius, CSS::BorderRadiusData top_right_radius, CSS::BorderRadiusData bottom_right_radius, CSS::BorderRadiusData bottom_left_radius)
 {
     BorderRadiusData bottom_left_radius_px {};
@@ -54,7 +62,7 @@ BorderRadiiData normalized_border_radii_data(Layout::Node const& node, CSSPixelR
     return BorderRadiiData { top_left_radius_px, top_right_radius_px, bottom_right_radius_px, bottom_left_radius_px };
 }
 
-void paint_border(PaintContext& context, BorderEdge edge, DevicePixelRect const& rect, BorderRadiiData const& border_radii_data, BordersData const& borders_data)
+void paint_border(Gfx::Painter& painter, BorderEdge edge, DevicePixelRect const& rect, CornerRadii const& corner_radii, BordersDataDevicePixels const& borders_data)
 {
     auto const& border_data = [&] {
         switch (edge) {
@@ -69,13 +77,12 @@ void paint_border(PaintContext& context, BorderEdge edge, DevicePixelRect const&
         }
     }();
 
-    CSSPixels width = border_data.width;
-    if (width <= 0)
+    auto device_pixel_width = border_data.width;
+    if (device_pixel_width <= 0)
         return;
 
     auto color = border_data.color;
     auto border_style = border_data.line_style;
-    auto device_pixel_width = context.enclosing_device_pixels(width);
 
     struct Points {
         DevicePixelPoint p1;
@@ -132,11 +139,11 @@ void paint_border(PaintContext& context, BorderEdge edge, DevicePixelRect const&
             break;
         }
         if (border_style == CSS::LineStyle::Dotted) {
-            Gfx::AntiAliasingPainter aa_painter { context.painter() };
+            Gfx::AntiAliasingPainter aa_painter { painter };
             aa_painter.draw_line(p1.to_type<int>(), p2.to_type<int>(), color, device_pixel_width.value(), gfx_line_style);
             return;
         }
-        context.painter().draw_line(p1.to_type<int>(), p2.to_type<int>(), color, device_pixel_width.value(), gfx_line_style);
+        painter.draw_line(p1.to_type<int>(), p2.to_type<int>(), color, device_pixel_width.value(), gfx_line_style);
         return;
     }
 
@@ -144,13 +151,13 @@ void paint_border(PaintContext& context, BorderEdge edge, DevicePixelRect const&
         // Note: Using fill_rect() here since draw_line() produces some overlapping pixels
         // at the end of a line, which cause issues on borders with transparency.
         p2.translate_by(1, 1);
-        context.painter().fill_rect(Gfx::IntRect::from_two_points(p1.template to_type<int>(), p2.template to_type<int>()), color);
+        painter.fill_rect(Gfx::IntRect::from_two_points(p1.template to_type<int>(), p2.template to_type<int>()), color);
     };
 
     auto draw_border = [&](auto const& border, auto const& radius, auto const& opposite_border, auto const& opposite_radius, auto p1_step_translate, auto p2_step_translate) {
         auto [p1, p2] = points_for_edge(edge, rect);
-        auto p1_step = radius ? 0 : border.width / device_pixel_width.value();
-        auto p2_step = opposite_radius ? 0 : opposite_border.width / device_pixel_width.value();
+        auto p1_step = radius ? 0 : border.width.value() / device_pixel_width.value();
+        auto p2_step = opposite_radius ? 0 : opposite_border.width.value() / device_pixel_width.value();
         for (DevicePixels i = 0; i < device_pixel_width; ++i) {
             draw_horizontal_or_vertical_line(p1, p2);
             p1_step_translate(p1, p1_step);
@@ -164,7 +171,7 @@ void paint_border(PaintContext& context, BorderEdge edge, DevicePixelRect const&
     switch (edge) {
     case BorderEdge::Top:
         draw_border(
-            borders_data.left, border_radii_data.top_left, borders_data.right, border_radii_data.top_right,
+            borders_data.left, corner_radii.top_left, borders_data.right, corner_radii.top_right,
             [](auto& current_p1, auto step) {
                 current_p1.translate_by(step, 1);
             },
@@ -174,7 +181,7 @@ void paint_border(PaintContext& context, BorderEdge edge, DevicePixelRect const&
         break;
     case BorderEdge::Right:
         draw_border(
-            borders_data.top, border_radii_data.top_right, borders_data.bottom, border_radii_data.bottom_right,
+            borders_data.top, corner_radii.top_right, borders_data.bottom, corner_radii.bottom_right,
             [](auto& current_p1, auto step) {
                 current_p1.translate_by(-1, step);
             },
@@ -184,7 +191,7 @@ void paint_border(PaintContext& context, BorderEdge edge, DevicePixelRect const&
         break;
     case BorderEdge::Bottom:
         draw_border(
-            borders_data.left, border_radii_data.bottom_left, borders_data.right, border_radii_data.bottom_right,
+            borders_data.left, corner_radii.bottom_left, borders_data.right, corner_radii.bottom_right,
             [](auto& current_p1, auto step) {
                 current_p1.translate_by(step, -1);
             },
@@ -194,7 +201,7 @@ void paint_border(PaintContext& context, BorderEdge edge, DevicePixelRect const&
         break;
     case BorderEdge::Left:
         draw_border(
-            borders_data.top, border_radii_data.top_left, borders_data.bottom, border_radii_data.bottom_left,
+            borders_data.top, corner_radii.top_left, borders_data.bottom, corner_radii.bottom_left,
             [](auto& current_p1, auto step) {
                 current_p1.translate_by(1, step);
             },
@@ -235,12 +242,37 @@ void paint_all_borders(PaintContext& context, CSSPixelRect const& bordered_rect,
     if (borders_data.top.width <= 0 && borders_data.right.width <= 0 && borders_data.left.width <= 0 && borders_data.bottom.width <= 0)
         return;
 
-    auto border_rect = context.rounded_device_rect(bordered_rect);
+    auto to_device_pixels = [&](CSS::BorderData const& border_data) {
+        return BorderDataDevicePixels {
+            border_data.color,
+            border_data.line_style,
+            border_data.width > 0 ? context.enclosing_device_pixels(border_data.width) : DevicePixels { 0 }
+        };
+    };
+
+    CornerRadii corner_radii {
+        .top_left = border_radii_data.top_left.as_corner(context),
+        .top_right = border_radii_data.top_right.as_corner(context),
+        .bottom_right = border_radii_data.bottom_right.as_corner(context),
+        .bottom_left = border_radii_data.bottom_left.as_corner(context),
+    };
+
+    BordersDataDevicePixels device_borders_data {
+        .top = to_device_pixels(borders_data.top),
+        .right = to_device_pixels(borders_data.right),
+        .bottom = to_device_pixels(borders_data.bottom),
+        .left = to_device_pixels(borders_data.left),
+    };
 
-    auto top_left = border_radii_data.top_left.as_corner(context);
-    auto top_right = border_radii_data.top_right.as_corner(context);
-    auto bottom_right = border_radii_data.bottom_right.as_corner(context);
-    auto bottom_left = border_radii_data.bottom_left.as_corner(context);
+    context.painter().paint_borders(context.rounded_device_rect(bordered_rect), corner_radii, device_borders_data);
+}
+
+void paint_all_borders(Gfx::Painter& painter, DevicePixelRect const& border_rect, CornerRadii const& corner_radii, BordersDataDevicePixels const& borders_data)
+{
+    auto top_left = corner_radii.top_left;
+    auto top_right = corner_radii.top_right;
+    auto bottom_right = corner_radii.bottom_right;
+    auto bottom_left = corner_radii.bottom_left;
 
     // Disable border radii if the corresponding borders don't exist:
     if (borders_data.bottom.width <= 0 && borders_data.left.width <= 0)
@@ -256,24 +288,24 @@ void paint_all_borders(PaintContext& context, CSSPixelRect const& bordered_rect,
         border_rect.x() + top_left.horizontal_radius,
         border_rect.y(),
         border_rect.width() - top_left.horizontal_radius - top_right.horizontal_radius,
-        context.enclosing_device_pixels(borders_data.top.width)
+        borders_data.top.width
     };
     DevicePixelRect right_border_rect = {
-        border_rect.x() + (border_rect.width() - context.enclosing_device_pixels(borders_data.right.width)),
+        border_rect.x() + (border_rect.width() - borders_data.right.width),
         border_rect.y() + top_right.vertical_radius,
-        context.enclosing_device_pixels(borders_data.right.width),
+        borders_data.right.width,
         border_rect.height() - top_right.vertical_radius - bottom_right.vertical_radius
     };
     DevicePixelRect bottom_border_rect = {
         border_rect.x() + bottom_left.horizontal_radius,
-        border_rect.y() + (border_rect.height() - context.enclosing_device_pixels(borders_data.bottom.width)),
+        border_rect.y() + (border_rect.height() - borders_data.bottom.width),
         border_rect.width() - bottom_left.horizontal_radius - bottom_right.horizontal_radius,
-        context.enclosing_device_pixels(borders_data.bottom.width)
+        borders_data.bottom.width
     };
     DevicePixelRect left_border_rect = {
         border_rect.x(),
         border_rect.y() + top_left.vertical_radius,
-        context.enclosing_device_pixels(borders_data.left.width),
+        borders_data.left.width,
         border_rect.height() - top_left.vertical_radius - bottom_left.vertical_radius
     };
 
@@ -291,17 +323,17 @@ void paint_all_borders(PaintContext& context, CSSPixelRect const& bordered_rect,
     border_color_no_alpha.set_alpha(255);
 
     // Paint the strait line part of the border:
-    paint_border(context, BorderEdge::Top, top_border_rect, border_radii_data, borders_data);
-    paint_border(context, BorderEdge::Right, right_border_rect, border_radii_data, borders_data);
-    paint_border(context, BorderEdge::Bottom, bottom_border_rect, border_radii_data, borders_data);
-    paint_border(context, BorderEdge::Left, left_border_rect, border_radii_data, borders_data);
+    paint_border(painter, BorderEdge::Top, top_border_rect, corner_radii, borders_data);
+    paint_border(painter, BorderEdge::Right, right_border_rect, corner_radii, borders_data);
+    paint_border(painter, BorderEdge::Bottom, bottom_border_rect, corner_radii, borders_data);
+    paint_border(painter, BorderEdge::Left, left_border_rect, corner_radii, borders_data);
 
     if (!top_left && !top_right && !bottom_left && !bottom_right)
         return;
 
     // Cache the smallest possible bitmap to render just the corners for the border.
-    auto expand_width = abs(context.enclosing_device_pixels(borders_data.left.width) - context.enclosing_device_pixels(borders_data.right.width));
-    auto expand_height = abs(context.enclosing_device_pixels(borders_data.top.width) - context.enclosing_device_pixels(borders_data.bottom.width));
+    auto expand_width = abs(borders_data.left.width - borders_data.right.width);
+    auto expand_height = abs(borders_data.top.width - borders_data.bottom.width);
     DevicePixelRect corner_mask_rect {
         0, 0,
         max(
@@ -315,9 +347,9 @@ void paint_all_borders(PaintContext& context, CSSPixelRect const& bordered_rect,
     auto corner_bitmap = get_cached_corner_bitmap(corner_mask_rect.size());
     if (!corner_bitmap)
         return;
-    Gfx::Painter painter { *corner_bitmap };
+    Gfx::Painter corner_painter { *corner_bitmap };
 
-    Gfx::AntiAliasingPainter aa_painter { painter };
+    Gfx::AntiAliasingPainter aa_painter { corner_painter };
 
     // Paint a little tile sheet for the corners
     // TODO: Support various line styles on the corners (dotted, dashes, etc)
@@ -327,28 +359,28 @@ void paint_all_borders(PaintContext& context, CSSPixelRect const& bordered_rect,
 
     // Subtract the inner corner rectangle:
     auto inner_corner_mask_rect = corner_mask_rect.shrunken(
-        context.enclosing_device_pixels(borders_data.top.width),
-        context.enclosing_device_pixels(borders_data.right.width),
-        context.enclosing_device_pixels(borders_data.bottom.width),
-        context.enclosing_device_pixels(borders_data.left.width));
+        borders_data.top.width,
+        borders_data.right.width,
+        borders_data.bottom.width,
+        borders_data.left.width);
     auto inner_top_left = top_left;
     auto inner_top_right = top_right;
     auto inner_bottom_right = bottom_right;
     auto inner_bottom_left = bottom_left;
-    inner_top_left.horizontal_radius = max(0, inner_top_left.horizontal_radius - context.enclosing_device_pixels(borders_data.left.width).value());
-    inner_top_left.vertical_radius = max(0, inner_top_left.vertical_radius - context.enclosing_device_pixels(borders_data.top.width).value());
-    inner_top_right.horizontal_radius = max(0, inner_top_right.horizontal_radius - context.enclosing_device_pixels(borders_data.right.width).value());
-    inner_top_right.vertical_radius = max(0, inner_top_right.vertical_radius - context.enclosing_device_pixels(borders_data.top.width).value());
-    inner_bottom_right.horizontal_radius = max(0, inner_bottom_right.horizontal_radius - context.enclosing_device_pixels(borders_data.right.width).value());
-    inner_bottom_right.vertical_radius = max(0, inner_bottom_right.vertical_radius - context.enclosing_device_pixels(borders_data.bottom.width).value());
-    inner_bottom_left.horizontal_radius = max(0, inner_bottom_left.horizontal_radius - context.enclosing_device_pixels(borders_data.left.width).value());
-    inner_bottom_left.vertical_radius = max(0, inner_bottom_left.vertical_radius - context.enclosing_device_pixels(borders_data.bottom.width).value());
+    inner_top_left.horizontal_radius = max(0, inner_top_left.horizontal_radius - borders_data.left.width.value());
+    inner_top_left.vertical_radius = max(0, inner_top_left.vertical_radius - borders_data.top.width.value());
+    inner_top_right.horizontal_radius = max(0, inner_top_right.horizontal_radius - borders_data.right.width.value());
+    inner_top_right.vertical_radius = max(0, inner_top_right.vertical_radius - borders_data.top.width.value());
+    inner_bottom_right.horizontal_radius = max(0, inner_bottom_right.horizontal_radius - borders_data.right.width.value());
+    inner_bottom_right.vertical_radius = max(0, inner_bottom_right.vertical_radius - borders_data.bottom.width.value());
+    inner_bottom_left.horizontal_radius = max(0, inner_bottom_left.horizontal_radius - borders_data.left.width.value());
+    inner_bottom_left.vertical_radius = max(0, inner_bottom_left.vertical_radius - borders_data.bottom.width.value());
     aa_painter.fill_rect_with_rounded_corners(inner_corner_mask_rect.to_type<int>(), border_color_no_alpha, inner_top_left, inner_top_right, inner_bottom_right, inner_bottom_left, Gfx::AntiAliasingPainter::BlendMode::AlphaSubtract);
 
     // TODO: Support dual color corners. Other browsers will render a rounded corner between two borders of
     // different colors using both colours, normally split at a 45 degree angle (though the exact angle is interpolated).
     auto blit_corner = [&](Gfx::IntPoint position, Gfx::IntRect const& src_rect, Color corner_color) {
-        context.painter().blit_filtered(position, *corner_bitmap, src_rect, [&](auto const& corner_pixel) {
+        painter.blit_filtered(position, *corner_bitmap, src_rect, [&](auto const& corner_pixel) {
             return corner_color.with_alpha((corner_color.alpha() * corner_pixel.alpha()) / 255);
         });
     };
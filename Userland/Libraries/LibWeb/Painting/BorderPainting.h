@@ -9,7 +9,8 @@
 #include <LibGfx/AntiAliasingPainter.h>
 #include <LibGfx/Forward.h>
 #include <LibWeb/CSS/ComputedValues.h>
-#include <LibWeb/Painting/PaintContext.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/PixelUnits.h>
 
 namespace Web::Painting {
 
@@ -17,13 +18,7 @@ struct BorderRadiusData {
     CSSPixels horizontal_radius { 0 };
     CSSPixels vertical_radius { 0 };
 
-    Gfx::AntiAliasingPainter::CornerRadius as_corner(PaintContext& context) const
-    {
-        return Gfx::AntiAliasingPainter::CornerRadius {
-            context.floored_device_pixels(horizontal_radius).value(),
-            context.floored_device_pixels(vertical_radius).value()
-        };
-    };
+    Gfx::AntiAliasingPainter::CornerRadius as_corner(PaintContext& context) const;
 
     inline operator bool() const
     {
@@ -72,9 +67,30 @@ struct BordersData {
     CSS::BorderData left;
 };
 
+using CornerRadius = Gfx::AntiAliasingPainter::CornerRadius;
+struct CornerRadii {
+    CornerRadius top_left;
+    CornerRadius top_right;
+    CornerRadius bottom_right;
+    CornerRadius bottom_left;
+};
+
+struct BorderDataDevicePixels {
+    Color color { Color::Transparent };
+    CSS::LineStyle line_style { CSS::LineStyle::None };
+    DevicePixels width { 0 };
+};
+struct BordersDataDevicePixels {
+    BorderDataDevicePixels top;
+    BorderDataDevicePixels right;
+    BorderDataDevicePixels bottom;
+    BorderDataDevicePixels left;
+};
+
 RefPtr<Gfx::Bitmap> get_cached_corner_bitmap(DevicePixelSize corners_size);
 
-void paint_border(PaintContext& context, BorderEdge edge, DevicePixelRect const& rect, BorderRadiiData const& border_radii_data, BordersData const& borders_data);
+void paint_border(Gfx::Painter& painter, BorderEdge edge, DevicePixelRect const& rect, CornerRadii const& corner_radii, BordersDataDevicePixels const& borders_data);
+void paint_all_borders(Gfx::Painter& painter, DevicePixelRect const& border_rect, CornerRadii const& corner_radii, BordersDataDevicePixels const&);
 void paint_all_borders(PaintContext& context, CSSPixelRect const& bordered_rect, BorderRadiiData const& border_radii_data, BordersData const&);
 
 }
@@ -6,30 +6,30 @@
 
 #pragma once
 
+#include <AK/RefCounted.h>
 #include <LibGfx/AntiAliasingPainter.h>
 #include <LibWeb/Painting/BorderPainting.h>
 
 namespace Web::Painting {
 
+class RecordingPainter;
+
 enum class CornerClip {
     Outside,
     Inside
 };
 
-class BorderRadiusCornerClipper {
+// NOTE: A clipper is shared by every execution of the display list it was recorded into (possibly on several threads
+//       at once), so it does not keep the sampled pixels itself. Whoever samples the corners holds on to them until
+//       they are blitted back.
+class BorderRadiusCornerClipper : public RefCounted<BorderRadiusCornerClipper> {
 public:
-    enum class UseCachedBitmap {
-        Yes,
-        No
-    };
-
-    static ErrorOr<BorderRadiusCornerClipper> create(PaintContext&, DevicePixelRect const& border_rect, BorderRadiiData const& border_radii, CornerClip corner_clip = CornerClip::Outside, UseCachedBitmap use_cached_bitmap = UseCachedBitmap::Yes);
+    static ErrorOr<NonnullRefPtr<BorderRadiusCornerClipper>> create(PaintContext&, DevicePixelRect const& border_rect, BorderRadiiData const& border_radii, CornerClip corner_clip = CornerClip::Outside);
 
-    void sample_under_corners(Gfx::Painter& page_painter);
-    void blit_corner_clipping(Gfx::Painter& page_painter);
+    ErrorOr<NonnullRefPtr<Gfx::Bitmap>> sample_under_corners(Gfx::Painter& page_painter) const;
+    void blit_corner_clipping(Gfx::Painter& page_painter, Gfx::Bitmap const& sampled_corners) const;
 
 private:
-    using CornerRadius = Gfx::AntiAliasingPainter::CornerRadius;
     struct CornerData {
         struct CornerRadii {
             CornerRadius top_left;
@@ -48,44 +48,25 @@ private:
         DevicePixelSize corner_bitmap_size;
     } m_data;
 
-    NonnullRefPtr<Gfx::Bitmap> m_corner_bitmap;
-    bool m_has_sampled { false };
     CornerClip m_corner_clip { false };
 
-    BorderRadiusCornerClipper(CornerData corner_data, NonnullRefPtr<Gfx::Bitmap> corner_bitmap, CornerClip corner_clip)
+    BorderRadiusCornerClipper(CornerData corner_data, CornerClip corner_clip)
         : m_data(move(corner_data))
-        , m_corner_bitmap(corner_bitmap)
         , m_corner_clip(corner_clip)
     {
     }
 };
 
 struct ScopedCornerRadiusClip {
-    ScopedCornerRadiusClip(PaintContext& context, Gfx::Painter& painter, DevicePixelRect const& border_rect, BorderRadiiData const& border_radii, CornerClip corner_clip = CornerClip::Outside, BorderRadiusCornerClipper::UseCachedBitmap use_cached_bitmap = BorderRadiusCornerClipper::UseCachedBitmap::Yes)
-        : m_painter(painter)
-    {
-        if (border_radii.has_any_radius()) {
-            auto clipper = BorderRadiusCornerClipper::create(context, border_rect, border_radii, corner_clip, use_cached_bitmap);
-            if (!clipper.is_error()) {
-                m_corner_clipper = clipper.release_value();
-                m_corner_clipper->sample_under_corners(m_painter);
-            }
-        }
-    }
-
-    ~ScopedCornerRadiusClip()
-    {
-        if (m_corner_clipper.has_value()) {
-            m_corner_clipper->blit_corner_clipping(m_painter);
-        }
-    }
+    ScopedCornerRadiusClip(PaintContext& context, RecordingPainter& painter, DevicePixelRect const& border_rect, BorderRadiiData const& border_radii, CornerClip corner_clip = CornerClip::Outside);
+    ~ScopedCornerRadiusClip();
 
     AK_MAKE_NONMOVABLE(ScopedCornerRadiusClip);
     AK_MAKE_NONCOPYABLE(ScopedCornerRadiusClip);
 
 private:
-    Gfx::Painter& m_painter;
-    Optional<BorderRadiusCornerClipper> m_corner_clipper;
+    RecordingPainter& m_painter;
+    RefPtr<BorderRadiusCornerClipper> m_corner_clipper;
 };
 
 }
@@ -6,7 +6,6 @@
  */
 
 #include <LibGUI/Event.h>
-#include <LibGfx/AntiAliasingPainter.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/GrayscaleBitmap.h>
 #include <LibWeb/HTML/BrowsingContext.h>
@@ -103,7 +102,7 @@ void CheckBoxPaintable::paint(PaintContext& context, PaintPhase phase) const
 
     auto const& checkbox = static_cast<HTML::HTMLInputElement const&>(layout_box().dom_node());
     bool enabled = layout_box().dom_node().enabled();
-    Gfx::AntiAliasingPainter painter { context.painter() };
+    auto& painter = context.painter();
     auto checkbox_rect = context.enclosing_device_rect(absolute_rect()).to_type<int>();
     auto checkbox_radius = checkbox_rect.width() / 5;
 
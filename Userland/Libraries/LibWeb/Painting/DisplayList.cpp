@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashMap.h>
+#include <AK/OwnPtr.h>
+#include <LibThreading/Mutex.h>
+#include <LibWeb/Painting/DisplayList.h>
+
+namespace Web::Painting {
+
+namespace {
+
+// NOTE: Drawing text goes through the glyph caches of the fonts (and refcounts the cached glyph bitmaps), none of
+//       which are thread safe. So only one thread at a time gets to draw text, everything else can run in parallel.
+Threading::Mutex s_text_painting_mutex;
+
+struct Layer {
+    OwnPtr<Gfx::Painter> painter;
+    RefPtr<Gfx::Bitmap> bitmap;
+    Gfx::IntRect destination_rect;
+    float opacity;
+};
+
+class DisplayListExecutor {
+public:
+    DisplayListExecutor(Gfx::Bitmap& target, Gfx::IntPoint translation, Gfx::IntPoint viewport_origin)
+        : m_viewport_origin(viewport_origin)
+    {
+        auto painter = make<Gfx::Painter>(target);
+        painter->translate(translation);
+        m_layers.append({ .painter = move(painter), .bitmap = nullptr, .destination_rect = {}, .opacity = 1.0f });
+    }
+
+    void execute(ReadonlySpan<PaintingCommand> commands)
+    {
+        for (size_t i = 0; i < commands.size(); ++i) {
+            if (commands[i].has<PushStackingContext>()) {
+                if (push_stacking_context(commands[i].get<PushStackingContext>()))
+                    continue;
+                // NOTE: If we could not allocate a layer, skip everything that was supposed to be painted into it.
+                size_t depth = 1;
+                while (depth > 0 && ++i < commands.size()) {
+                    if (commands[i].has<PushStackingContext>())
+                        ++depth;
+                    else if (commands[i].has<PopStackingContext>())
+                        --depth;
+                }
+                continue;
+            }
+            execute_command(commands[i]);
+        }
+        VERIFY(m_layers.size() == 1);
+    }
+
+private:
+    Gfx::Painter& painter() { return *m_layers.last().painter; }
+
+    bool push_stacking_context(PushStackingContext const& command)
+    {
+        auto destination_rect = command.transformed_destination_rect.to_rounded<int>();
+
+        // FIXME: We should find a way to scale the paintable, rather than paint into a separate bitmap,
+        // then scale it. This snippet now copies the background at the destination, then scales it down/up
+        // to the size of the source (which could add some artefacts, though just scaling the bitmap already does that).
+        // We need to copy the background at the destination because a bunch of our rendering effects now rely on
+        // being able to sample the painter (see border radii, shadows, filters, etc).
+        Gfx::FloatPoint destination_clipped_fixup {};
+        auto try_get_scaled_destination_bitmap = [&]() -> ErrorOr<NonnullRefPtr<Gfx::Bitmap>> {
+            Gfx::IntRect actual_destination_rect;
+            auto bitmap = TRY(painter().get_region_bitmap(destination_rect, Gfx::BitmapFormat::BGRA8888, actual_destination_rect));
+            // get_region_bitmap() may clip to a smaller region if the requested rect goes outside the painter, so we need to account for that.
+            destination_clipped_fixup = Gfx::FloatPoint { destination_rect.location() - actual_destination_rect.location() };
+            destination_rect = actual_destination_rect;
+            if (command.source_rect.size() != command.transformed_destination_rect.size()) {
+                auto sx = static_cast<float>(command.source_rect.width()) / command.transformed_destination_rect.width();
+                auto sy = static_cast<float>(command.source_rect.height()) / command.transformed_destination_rect.height();
+                bitmap = TRY(bitmap->scaled(sx, sy));
+                destination_clipped_fixup.scale_by(sx, sy);
+            }
+            return bitmap;
+        };
+
+        auto bitmap_or_error = try_get_scaled_destination_bitmap();
+        if (bitmap_or_error.is_error())
+            return false;
+        auto bitmap = bitmap_or_error.release_value();
+        auto layer_painter = make<Gfx::Painter>(*bitmap);
+        layer_painter->translate((command.painter_translation + destination_clipped_fixup).to_rounded<int>());
+        m_layers.append({ .painter = move(layer_painter), .bitmap = move(bitmap), .destination_rect = destination_rect, .opacity = command.opacity });
+        return true;
+    }
+
+    void pop_stacking_context()
+    {
+        auto layer = m_layers.take_last();
+        auto& bitmap = *layer.bitmap;
+        if (layer.destination_rect.size() == bitmap.size())
+            painter().blit(layer.destination_rect.location(), bitmap, bitmap.rect(), layer.opacity);
+        else
+            painter().draw_scaled_bitmap(layer.destination_rect, bitmap, bitmap.rect(), layer.opacity, Gfx::Painter::ScalingMode::BilinearBlend);
+    }
+
+    void apply_backdrop_filter(ApplyBackdropFilter const& command)
+    {
+        // Note: The region bitmap can be smaller than the backdrop_region if it's at the edge of canvas.
+        // Note: This is in DevicePixels, but we use an IntRect because `get_region_bitmap()` below writes to it.
+        Gfx::IntRect actual_region {};
+
+        // FIXME: Go through the steps to find the "Backdrop Root Image"
+        // https://drafts.fxtf.org/filter-effects-2/#BackdropRoot
+
+        // 1. Copy the Backdrop Root Image into a temporary buffer, such as a raster image. Call this buffer T’.
+        auto maybe_backdrop_bitmap = painter().get_region_bitmap(command.backdrop_region, Gfx::BitmapFormat::BGRA8888, actual_region);
+        if (actual_region.is_empty())
+            return;
+        if (maybe_backdrop_bitmap.is_error()) {
+            dbgln("Failed get region bitmap for backdrop-filter");
+            return;
+        }
+        auto backdrop_bitmap = maybe_backdrop_bitmap.release_value();
+        // 2. Apply the backdrop-filter’s filter operations to the entire contents of T'.
+        apply_filter_list(*backdrop_bitmap, command.backdrop_filter.filters);
+
+        // FIXME: 3. If element B has any transforms (between B and the Backdrop Root), apply the inverse of those transforms to the contents of T’.
+
+        // FIXME: 5. Draw all of element B, including its background, border, and any children elements, into T’.
+
+        // FXIME: 6. If element B has any transforms, effects, or clips, apply those to T’.
+
+        // 7. Composite the contents of T’ into element B’s parent, using source-over compositing.
+        painter().blit(actual_region.location(), *backdrop_bitmap, backdrop_bitmap->rect());
+    }
+
+    void execute_command(PaintingCommand const& command)
+    {
+        command.visit(
+            [&](SaveState const&) {
+                painter().save();
+            },
+            [&](RestoreState const&) {
+                painter().restore();
+            },
+            [&](AddClipRect const& command) {
+                painter().add_clip_rect(command.rect);
+            },
+            [&](Translate const& command) {
+                painter().translate(command.delta);
+            },
+            [&](SetTranslation const& command) {
+                auto origin = m_layers.size() == 1 ? m_viewport_origin : Gfx::IntPoint {};
+                painter().translate(origin + command.translation - painter().translation());
+            },
+            [&](PushStackingContext const&) {
+                VERIFY_NOT_REACHED();
+            },
+            [&](PopStackingContext const&) {
+                pop_stacking_context();
+            },
+            [&](FillRect const& command) {
+                painter().fill_rect(command.rect, command.color);
+            },
+            [&](ClearRect const& command) {
+                painter().clear_rect(command.rect, command.color);
+            },
+            [&](DrawRect const& command) {
+                painter().draw_rect(command.rect, command.color, command.rough);
+            },
+            [&](DrawFocusRect const& command) {
+                painter().draw_focus_rect(command.rect, command.color);
+            },
+            [&](DrawText const& command) {
+                Threading::MutexLocker locker(s_text_painting_mutex);
+                painter().draw_text(command.rect, command.raw_text, *command.font, command.alignment, command.color, command.elision, command.wrapping);
+            },
+            [&](DrawTextRun const& command) {
+                Threading::MutexLocker locker(s_text_painting_mutex);
+                painter().draw_text_run(command.baseline_start, Utf8View(command.string), *command.font, command.color);
+            },
+            [&](DrawScaledBitmap const& command) {
+                painter().draw_scaled_bitmap(command.dst_rect, *command.bitmap, command.src_rect, command.opacity, command.scaling_mode);
+            },
+            [&](Blit const& command) {
+                painter().blit(command.position, *command.bitmap, command.src_rect, command.opacity, command.apply_alpha);
+            },
+            [&](DrawLine const& command) {
+                painter().draw_line(command.from, command.to, command.color, command.thickness, command.style, command.alternate_color);
+            },
+            [&](DrawTriangleWave const& command) {
+                painter().draw_triangle_wave(command.p1, command.p2, command.color, command.amplitude, command.thickness);
+            },
+            [&](DrawSignedDistanceField const& command) {
+                painter().draw_signed_distance_field(command.rect, command.color, command.sdf, command.smoothing);
+            },
+            [&](FillRectWithLinearGradient const& command) {
+                painter().fill_rect_with_linear_gradient(command.rect, command.data.color_stops.list, command.data.gradient_angle, command.data.color_stops.repeat_length);
+            },
+            [&](FillRectWithConicGradient const& command) {
+                painter().fill_rect_with_conic_gradient(command.rect, command.data.color_stops.list, command.position, command.data.start_angle, command.data.color_stops.repeat_length);
+            },
+            [&](FillRectWithRadialGradient const& command) {
+                painter().fill_rect_with_radial_gradient(command.rect, command.data.color_stops.list, command.center, command.size, command.data.color_stops.repeat_length);
+            },
+            [&](FillRectWithRoundedCorners const& command) {
+                Gfx::AntiAliasingPainter aa_painter(painter());
+                auto const& radii = command.corner_radii;
+                aa_painter.fill_rect_with_rounded_corners(command.rect, command.color, radii.top_left, radii.top_right, radii.bottom_right, radii.bottom_left, command.blend_mode);
+            },
+            [&](FillEllipse const& command) {
+                Gfx::AntiAliasingPainter aa_painter(painter());
+                aa_painter.fill_ellipse(command.rect, command.color, command.blend_mode);
+            },
+            [&](DrawEllipse const& command) {
+                Gfx::AntiAliasingPainter aa_painter(painter());
+                aa_painter.draw_ellipse(command.rect, command.color, command.thickness);
+            },
+            [&](FillPathUsingColor const& command) {
+                Gfx::AntiAliasingPainter aa_painter(painter());
+                aa_painter.translate(command.aa_translation);
+                aa_painter.fill_path(command.path, command.color, command.winding_rule);
+            },
+            [&](FillPathUsingPaintStyle const& command) {
+                Gfx::AntiAliasingPainter aa_painter(painter());
+                aa_painter.translate(command.aa_translation);
+                aa_painter.fill_path(command.path, *command.paint_style, command.opacity, command.winding_rule);
+            },
+            [&](StrokePathUsingColor const& command) {
+                Gfx::AntiAliasingPainter aa_painter(painter());
+                aa_painter.translate(command.aa_translation);
+                aa_painter.stroke_path(command.path, command.color, command.thickness);
+            },
+            [&](StrokePathUsingPaintStyle const& command) {
+                Gfx::AntiAliasingPainter aa_painter(painter());
+                aa_painter.translate(command.aa_translation);
+                aa_painter.stroke_path(command.path, *command.paint_style, command.thickness, command.opacity);
+            },
+            [&](PaintFrame const& command) {
+                Threading::MutexLocker locker(s_text_painting_mutex);
+                Gfx::StylePainter::paint_frame(painter(), command.rect, command.palette, command.style);
+            },
+            [&](PaintProgressbar const& command) {
+                Threading::MutexLocker locker(s_text_painting_mutex);
+                Gfx::StylePainter::paint_progressbar(painter(), command.rect, command.palette, command.min, command.max, command.value, command.text);
+            },
+            [&](PaintBorders const& command) {
+                paint_all_borders(painter(), command.border_rect, command.corner_radii, command.borders_data);
+            },
+            [&](SampleUnderCorners const& command) {
+                auto sampled_corners = command.corner_clipper->sample_under_corners(painter());
+                if (sampled_corners.is_error()) {
+                    dbgln("Failed to sample under corners: {}", sampled_corners.error());
+                    return;
+                }
+                m_sampled_corners.set(command.corner_clipper.ptr(), sampled_corners.release_value());
+            },
+            [&](BlitCornerClipping const& command) {
+                auto sampled_corners = m_sampled_corners.take(command.corner_clipper.ptr());
+                if (!sampled_corners.has_value())
+                    return;
+                command.corner_clipper->blit_corner_clipping(painter(), **sampled_corners);
+            },
+            [&](ApplyBackdropFilter const& command) {
+                apply_backdrop_filter(command);
+            });
+    }
+
+    Vector<Layer, 4> m_layers;
+    Gfx::IntPoint m_viewport_origin;
+    HashMap<BorderRadiusCornerClipper const*, NonnullRefPtr<Gfx::Bitmap>> m_sampled_corners;
+};
+
+}
+
+void DisplayList::execute(Gfx::Bitmap& target, Gfx::IntPoint translation, Gfx::IntPoint viewport_origin) const
+{
+    DisplayListExecutor executor(target, translation, viewport_origin);
+    executor.execute(m_commands);
+}
+
+}
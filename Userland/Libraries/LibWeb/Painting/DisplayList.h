@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullRefPtr.h>
+#include <AK/String.h>
+#include <AK/Variant.h>
+#include <AK/Vector.h>
+#include <LibGfx/AntiAliasingPainter.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/Color.h>
+#include <LibGfx/Font/Font.h>
+#include <LibGfx/GrayscaleBitmap.h>
+#include <LibGfx/PaintStyle.h>
+#include <LibGfx/Painter.h>
+#include <LibGfx/Palette.h>
+#include <LibGfx/Path.h>
+#include <LibGfx/Point.h>
+#include <LibGfx/Rect.h>
+#include <LibGfx/StylePainter.h>
+#include <LibGfx/TextAlignment.h>
+#include <LibGfx/TextElision.h>
+#include <LibGfx/TextWrapping.h>
+#include <LibWeb/Painting/BorderPainting.h>
+#include <LibWeb/Painting/BorderRadiusCornerClipper.h>
+#include <LibWeb/Painting/FilterPainting.h>
+#include <LibWeb/Painting/GradientPainting.h>
+
+namespace Web::Painting {
+
+// All coordinates in painting commands are relative to the painter state (translation and clip) at the time
+// the command is executed, exactly like they would be for a Gfx::Painter.
+
+struct SaveState { };
+struct RestoreState { };
+
+struct AddClipRect {
+    Gfx::IntRect rect;
+};
+
+struct Translate {
+    Gfx::IntPoint delta;
+};
+
+// Replaces the current translation, rather than adding to it. This is used to paint fixed-position content, which
+// has to end up in the same place no matter which scroll offset the display list is executed for.
+struct SetTranslation {
+    Gfx::IntPoint translation;
+};
+
+// Everything between a PushStackingContext and its PopStackingContext is painted into a separate layer bitmap,
+// which is then composited back with the given opacity (and scaled into the destination rect for transforms).
+struct PushStackingContext {
+    float opacity;
+    Gfx::FloatRect source_rect;
+    Gfx::FloatRect transformed_destination_rect;
+    Gfx::FloatPoint painter_translation;
+};
+
+struct PopStackingContext { };
+
+struct FillRect {
+    Gfx::IntRect rect;
+    Color color;
+};
+
+struct ClearRect {
+    Gfx::IntRect rect;
+    Color color;
+};
+
+struct DrawRect {
+    Gfx::IntRect rect;
+    Color color;
+    bool rough;
+};
+
+struct DrawFocusRect {
+    Gfx::IntRect rect;
+    Color color;
+};
+
+struct DrawText {
+    Gfx::IntRect rect;
+    String raw_text;
+    NonnullRefPtr<Gfx::Font const> font;
+    Gfx::TextAlignment alignment;
+    Color color;
+    Gfx::TextElision elision;
+    Gfx::TextWrapping wrapping;
+};
+
+struct DrawTextRun {
+    Gfx::IntPoint baseline_start;
+    String string;
+    NonnullRefPtr<Gfx::Font const> font;
+    Color color;
+};
+
+struct DrawScaledBitmap {
+    Gfx::IntRect dst_rect;
+    NonnullRefPtr<Gfx::Bitmap const> bitmap;
+    Gfx::IntRect src_rect;
+    float opacity;
+    Gfx::Painter::ScalingMode scaling_mode;
+};
+
+struct Blit {
+    Gfx::IntPoint position;
+    NonnullRefPtr<Gfx::Bitmap const> bitmap;
+    Gfx::IntRect src_rect;
+    float opacity;
+    bool apply_alpha;
+};
+
+struct DrawLine {
+    Gfx::IntPoint from;
+    Gfx::IntPoint to;
+    Color color;
+    int thickness;
+    Gfx::Painter::LineStyle style;
+    Color alternate_color;
+};
+
+struct DrawTriangleWave {
+    Gfx::IntPoint p1;
+    Gfx::IntPoint p2;
+    Color color;
+    int amplitude;
+    int thickness;
+};
+
+struct DrawSignedDistanceField {
+    Gfx::IntRect rect;
+    Color color;
+    // NOTE: A GrayscaleBitmap does not own its pixels, so the SDF data has to outlive the display list.
+    Gfx::GrayscaleBitmap sdf;
+    float smoothing;
+};
+
+struct FillRectWithLinearGradient {
+    Gfx::IntRect rect;
+    LinearGradientData data;
+};
+
+struct FillRectWithConicGradient {
+    Gfx::IntRect rect;
+    ConicGradientData data;
+    Gfx::IntPoint position;
+};
+
+struct FillRectWithRadialGradient {
+    Gfx::IntRect rect;
+    RadialGradientData data;
+    Gfx::IntPoint center;
+    Gfx::IntSize size;
+};
+
+struct FillRectWithRoundedCorners {
+    Gfx::IntRect rect;
+    Color color;
+    CornerRadii corner_radii;
+    Gfx::AntiAliasingPainter::BlendMode blend_mode;
+};
+
+struct FillEllipse {
+    Gfx::IntRect rect;
+    Color color;
+    Gfx::AntiAliasingPainter::BlendMode blend_mode;
+};
+
+struct DrawEllipse {
+    Gfx::IntRect rect;
+    Color color;
+    int thickness;
+};
+
+struct FillPathUsingColor {
+    Gfx::Path path;
+    Color color;
+    Gfx::Painter::WindingRule winding_rule;
+    Gfx::FloatPoint aa_translation;
+};
+
+struct FillPathUsingPaintStyle {
+    Gfx::Path path;
+    NonnullRefPtr<Gfx::PaintStyle const> paint_style;
+    Gfx::Painter::WindingRule winding_rule;
+    float opacity;
+    Gfx::FloatPoint aa_translation;
+};
+
+struct StrokePathUsingColor {
+    Gfx::Path path;
+    Color color;
+    float thickness;
+    Gfx::FloatPoint aa_translation;
+};
+
+struct StrokePathUsingPaintStyle {
+    Gfx::Path path;
+    NonnullRefPtr<Gfx::PaintStyle const> paint_style;
+    float thickness;
+    float opacity;
+    Gfx::FloatPoint aa_translation;
+};
+
+struct PaintFrame {
+    Gfx::IntRect rect;
+    Palette palette;
+    Gfx::FrameStyle style;
+};
+
+struct PaintProgressbar {
+    Gfx::IntRect rect;
+    Palette palette;
+    int min;
+    int max;
+    int value;
+    String text;
+};
+
+struct PaintBorders {
+    DevicePixelRect border_rect;
+    CornerRadii corner_radii;
+    BordersDataDevicePixels borders_data;
+};
+
+struct SampleUnderCorners {
+    NonnullRefPtr<BorderRadiusCornerClipper> corner_clipper;
+};
+
+struct BlitCornerClipping {
+    NonnullRefPtr<BorderRadiusCornerClipper> corner_clipper;
+};
+
+struct ApplyBackdropFilter {
+    Gfx::IntRect backdrop_region;
+    ResolvedBackdropFilter backdrop_filter;
+};
+
+using PaintingCommand = Variant<
+    SaveState,
+    RestoreState,
+    AddClipRect,
+    Translate,
+    SetTranslation,
+    PushStackingContext,
+    PopStackingContext,
+    FillRect,
+    ClearRect,
+    DrawRect,
+    DrawFocusRect,
+    DrawText,
+    DrawTextRun,
+    DrawScaledBitmap,
+    Blit,
+    DrawLine,
+    DrawTriangleWave,
+    DrawSignedDistanceField,
+    FillRectWithLinearGradient,
+    FillRectWithConicGradient,
+    FillRectWithRadialGradient,
+    FillRectWithRoundedCorners,
+    FillEllipse,
+    DrawEllipse,
+    FillPathUsingColor,
+    FillPathUsingPaintStyle,
+    StrokePathUsingColor,
+    StrokePathUsingPaintStyle,
+    PaintFrame,
+    PaintProgressbar,
+    PaintBorders,
+    SampleUnderCorners,
+    BlitCornerClipping,
+    ApplyBackdropFilter>;
+
+// A list of painting commands recorded by a RecordingPainter, which can be executed (any number of times)
+// against a target bitmap. Recording walks the paint tree, executing only touches pixels.
+// A list can be executed on several threads at once (e.g. to rasterize separate tiles of the same page).
+class DisplayList {
+public:
+    void append(PaintingCommand&& command)
+    {
+        if (command.has<SetTranslation>())
+            m_has_viewport_relative_content = true;
+        m_commands.append(move(command));
+    }
+
+    size_t command_count() const { return m_commands.size(); }
+    bool is_empty() const { return m_commands.is_empty(); }
+
+    // Whether anything is positioned relative to the viewport rather than the document (see SetTranslation).
+    bool has_viewport_relative_content() const { return m_has_viewport_relative_content; }
+
+    // Executes all commands against the target bitmap. The translation is applied on top of everything in the list,
+    // which lets a list recorded for one scroll offset be replayed for another. SetTranslation commands are relative
+    // to viewport_origin instead, which is where the top left corner of the viewport is in the target.
+    void execute(Gfx::Bitmap& target, Gfx::IntPoint translation = {}, Gfx::IntPoint viewport_origin = {}) const;
+
+private:
+    Vector<PaintingCommand> m_commands;
+    bool m_has_viewport_relative_content { false };
+};
+
+}
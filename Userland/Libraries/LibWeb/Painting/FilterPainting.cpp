@@ -16,10 +16,32 @@
 #include <LibWeb/Layout/Node.h>
 #include <LibWeb/Painting/BorderRadiusCornerClipper.h>
 #include <LibWeb/Painting/FilterPainting.h>
+#include <LibWeb/Painting/PaintContext.h>
 
 namespace Web::Painting {
 
-void apply_filter_list(Gfx::Bitmap& target_bitmap, Layout::Node const& node, ReadonlySpan<CSS::FilterFunction> filter_list)
+ResolvedBackdropFilter resolve_backdrop_filter(Layout::Node const& node, CSS::BackdropFilter const& backdrop_filter)
+{
+    ResolvedBackdropFilter resolved_backdrop_filter;
+    for (auto& filter_function : backdrop_filter.filters()) {
+        filter_function.visit(
+            [&](CSS::Filter::Blur const& blur) {
+                resolved_backdrop_filter.filters.append(ResolvedBackdropFilter::Blur { blur.resolved_radius(node) });
+            },
+            [&](CSS::Filter::Color const& color) {
+                resolved_backdrop_filter.filters.append(ResolvedBackdropFilter::ColorOperation { color.operation, color.resolved_amount() });
+            },
+            [&](CSS::Filter::HueRotate const& hue_rotate) {
+                resolved_backdrop_filter.filters.append(ResolvedBackdropFilter::HueRotate { hue_rotate.angle_degrees() });
+            },
+            [&](CSS::Filter::DropShadow const&) {
+                dbgln("TODO: Implement drop-shadow() filter function!");
+            });
+    }
+    return resolved_backdrop_filter;
+}
+
+void apply_filter_list(Gfx::Bitmap& target_bitmap, ReadonlySpan<ResolvedBackdropFilter::FilterFunction> filter_list)
 {
     auto apply_color_filter = [&](Gfx::ColorFilter const& filter) {
         const_cast<Gfx::ColorFilter&>(filter).apply(target_bitmap, target_bitmap.rect(), target_bitmap, target_bitmap.rect());
@@ -27,14 +49,14 @@ void apply_filter_list(Gfx::Bitmap& target_bitmap, Layout::Node const& node, Rea
     for (auto& filter_function : filter_list) {
         // See: https://drafts.fxtf.org/filter-effects-1/#supported-filter-functions
         filter_function.visit(
-            [&](CSS::Filter::Blur const& blur) {
+            [&](ResolvedBackdropFilter::Blur const& blur) {
                 // Applies a Gaussian blur to the input image.
                 // The passed parameter defines the value of the standard deviation to the Gaussian function.
                 Gfx::StackBlurFilter filter { target_bitmap };
-                filter.process_rgba(blur.resolved_radius(node), Color::Transparent);
+                filter.process_rgba(blur.radius, Color::Transparent);
             },
-            [&](CSS::Filter::Color const& color) {
-                auto amount = color.resolved_amount();
+            [&](ResolvedBackdropFilter::ColorOperation const& color) {
+                auto amount = color.amount;
                 auto amount_clamped = clamp(amount, 0.0f, 1.0f);
                 switch (color.operation) {
                 case CSS::Filter::Color::Operation::Grayscale: {
@@ -86,14 +108,11 @@ void apply_filter_list(Gfx::Bitmap& target_bitmap, Layout::Node const& node, Rea
                     break;
                 }
             },
-            [&](CSS::Filter::HueRotate const& hue_rotate) {
+            [&](ResolvedBackdropFilter::HueRotate const& hue_rotate) {
                 // Applies a hue rotation on the input image.
                 // The passed parameter defines the number of degrees around the color circle the input samples will be adjusted.
                 // A value of 0deg leaves the input unchanged. Implementations must not normalize this value in order to allow animations beyond 360deg.
-                apply_color_filter(Gfx::HueRotateFilter { hue_rotate.angle_degrees() });
-            },
-            [&](CSS::Filter::DropShadow const&) {
-                dbgln("TODO: Implement drop-shadow() filter function!");
+                apply_color_filter(Gfx::HueRotateFilter { hue_rotate.angle_degrees });
             });
     }
 }
@@ -104,36 +123,12 @@ void apply_backdrop_filter(PaintContext& context, Layout::Node const& node, CSSP
 
     auto backdrop_region = context.rounded_device_rect(backdrop_rect);
 
-    // Note: The region bitmap can be smaller than the backdrop_region if it's at the edge of canvas.
-    // Note: This is in DevicePixels, but we use an IntRect because `get_region_bitmap()` below writes to it.
-    Gfx::IntRect actual_region {};
-
-    // FIXME: Go through the steps to find the "Backdrop Root Image"
-    // https://drafts.fxtf.org/filter-effects-2/#BackdropRoot
-
-    // 1. Copy the Backdrop Root Image into a temporary buffer, such as a raster image. Call this buffer T’.
-    auto maybe_backdrop_bitmap = context.painter().get_region_bitmap(backdrop_region.to_type<int>(), Gfx::BitmapFormat::BGRA8888, actual_region);
-    if (actual_region.is_empty())
-        return;
-    if (maybe_backdrop_bitmap.is_error()) {
-        dbgln("Failed get region bitmap for backdrop-filter");
-        return;
-    }
-    auto backdrop_bitmap = maybe_backdrop_bitmap.release_value();
-    // 2. Apply the backdrop-filter’s filter operations to the entire contents of T'.
-    apply_filter_list(*backdrop_bitmap, node, backdrop_filter.filters());
-
-    // FIXME: 3. If element B has any transforms (between B and the Backdrop Root), apply the inverse of those transforms to the contents of T’.
-
     // 4. Apply a clip to the contents of T’, using the border box of element B, including border-radius if specified. Note that the children of B are not considered for the sizing or location of this clip.
     ScopedCornerRadiusClip corner_clipper { context, context.painter(), backdrop_region, border_radii_data };
 
-    // FIXME: 5. Draw all of element B, including its background, border, and any children elements, into T’.
-
-    // FXIME: 6. If element B has any transforms, effects, or clips, apply those to T’.
-
-    // 7. Composite the contents of T’ into element B’s parent, using source-over compositing.
-    context.painter().blit(actual_region.location(), *backdrop_bitmap, backdrop_bitmap->rect());
+    // NOTE: Steps 1, 2 and 7 need the pixels painted so far, so they're performed when the display list is executed.
+    //       See the ApplyBackdropFilter command.
+    context.painter().apply_backdrop_filter(backdrop_region.to_type<int>(), resolve_backdrop_filter(node, backdrop_filter));
 }
 
 }
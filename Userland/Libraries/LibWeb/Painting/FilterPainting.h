@@ -6,13 +6,34 @@
 
 #pragma once
 
+#include <AK/Variant.h>
+#include <AK/Vector.h>
 #include <LibGfx/Forward.h>
 #include <LibWeb/CSS/BackdropFilter.h>
 #include <LibWeb/Forward.h>
 
 namespace Web::Painting {
 
-void apply_filter_list(Gfx::Bitmap& target_bitmap, Layout::Node const& node, ReadonlySpan<CSS::FilterFunction> filter_list);
+// A backdrop-filter with all of its lengths resolved, so it can be applied without access to the layout tree.
+struct ResolvedBackdropFilter {
+    struct Blur {
+        float radius;
+    };
+    struct ColorOperation {
+        CSS::Filter::Color::Operation operation;
+        float amount;
+    };
+    struct HueRotate {
+        float angle_degrees;
+    };
+
+    using FilterFunction = Variant<Blur, ColorOperation, HueRotate>;
+    Vector<FilterFunction> filters;
+};
+
+ResolvedBackdropFilter resolve_backdrop_filter(Layout::Node const&, CSS::BackdropFilter const&);
+
+void apply_filter_list(Gfx::Bitmap& target_bitmap, ReadonlySpan<ResolvedBackdropFilter::FilterFunction> filter_list);
 
 void apply_backdrop_filter(PaintContext&, Layout::Node const&, CSSPixelRect const&, BorderRadiiData const&, CSS::BackdropFilter const&);
 
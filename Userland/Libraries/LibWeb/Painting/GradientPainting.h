@@ -11,7 +11,7 @@
 #include <LibGfx/Color.h>
 #include <LibGfx/Gradients.h>
 #include <LibWeb/Forward.h>
-#include <LibWeb/Painting/PaintContext.h>
+#include <LibWeb/PixelUnits.h>
 
 namespace Web::Painting {
 
@@ -11,6 +11,7 @@
 #include <LibGfx/Forward.h>
 #include <LibGfx/Palette.h>
 #include <LibGfx/Rect.h>
+#include <LibWeb/Painting/RecordingPainter.h>
 #include <LibWeb/PixelUnits.h>
 #include <LibWeb/SVG/SVGContext.h>
 
@@ -18,9 +19,9 @@ namespace Web {
 
 class PaintContext {
 public:
-    PaintContext(Gfx::Painter& painter, Palette const& palette, double device_pixels_per_css_pixel);
+    PaintContext(Painting::RecordingPainter& painter, Palette const& palette, double device_pixels_per_css_pixel);
 
-    Gfx::Painter& painter() const { return m_painter; }
+    Painting::RecordingPainter& painter() const { return m_painter; }
     Palette const& palette() const { return m_palette; }
 
     bool has_svg_context() const { return m_svg_context.has_value(); }
@@ -54,26 +55,22 @@ public:
     CSSPixelSize scale_to_css_size(DevicePixelSize) const;
     CSSPixelRect scale_to_css_rect(DevicePixelRect) const;
 
-    PaintContext clone(Gfx::Painter& painter) const
-    {
-        auto clone = PaintContext(painter, m_palette, m_device_pixels_per_css_pixel);
-        clone.m_device_viewport_rect = m_device_viewport_rect;
-        clone.m_should_show_line_box_borders = m_should_show_line_box_borders;
-        clone.m_focus = m_focus;
-        clone.m_svg_context = m_svg_context;
-        return clone;
-    }
+    // Set when something was painted relative to the viewport rather than the document (e.g. a fixed background),
+    // which means the recorded display list can't be replayed for a different scroll offset.
+    bool has_scroll_dependent_content() const { return m_has_scroll_dependent_content; }
+    void set_has_scroll_dependent_content() { m_has_scroll_dependent_content = true; }
 
     double device_pixels_per_css_pixel() const { return m_device_pixels_per_css_pixel; }
 
 private:
-    Gfx::Painter& m_painter;
+    Painting::RecordingPainter& m_painter;
     Palette m_palette;
     Optional<SVGContext> m_svg_context;
     double m_device_pixels_per_css_pixel { 0 };
     DevicePixelRect m_device_viewport_rect;
     bool m_should_show_line_box_borders { false };
     bool m_focus { false };
+    bool m_has_scroll_dependent_content { false };
 };
 
 }
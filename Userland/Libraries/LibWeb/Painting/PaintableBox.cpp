@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/GenericShorthands.h>
 #include <LibUnicode/CharacterTypes.h>
 #include <LibWeb/DOM/Document.h>
@@ -258,6 +259,19 @@ void PaintableBox::paint_background(PaintContext& context) const
             background_layers = document().background_layers();
             background_color = document().background_color();
         }
+
+        // NOTE: The painter may record more than the viewport (so the display list can be reused when scrolling),
+        //       so a plain background color has to cover everything it records. Background images are positioned
+        //       relative to the viewport though, which makes them depend on the scroll offset.
+        auto has_background_images = background_layers && any_of(*background_layers, [](auto& layer) {
+            return layer.background_image && layer.background_image->is_paintable();
+        });
+        if (has_background_images) {
+            context.set_has_scroll_dependent_content();
+        } else {
+            auto recorded_rect = context.painter().clip_rect().translated(-context.painter().translation());
+            background_rect = background_rect.united(context.scale_to_css_rect(recorded_rect.to_type<DevicePixels>()));
+        }
     } else {
         background_rect = absolute_padding_box_rect();
     }
@@ -368,13 +382,13 @@ void PaintableBox::apply_clip_overflow_rect(PaintContext& context, PaintPhase ph
     if (!clip_rect->is_empty() && overflow_y == CSS::Overflow::Hidden && overflow_x == CSS::Overflow::Hidden) {
         auto border_radii_data = normalized_border_radii_data(ShrinkRadiiForBorders::Yes);
         if (border_radii_data.has_any_radius()) {
-            auto corner_clipper = BorderRadiusCornerClipper::create(context, context.rounded_device_rect(*clip_rect), border_radii_data, CornerClip::Outside, BorderRadiusCornerClipper::UseCachedBitmap::No);
+            auto corner_clipper = BorderRadiusCornerClipper::create(context, context.rounded_device_rect(*clip_rect), border_radii_data, CornerClip::Outside);
             if (corner_clipper.is_error()) {
                 dbgln("Failed to create overflow border-radius corner clipper: {}", corner_clipper.error());
                 return;
             }
             m_overflow_corner_radius_clipper = corner_clipper.release_value();
-            m_overflow_corner_radius_clipper->sample_under_corners(context.painter());
+            context.painter().sample_under_corners(*m_overflow_corner_radius_clipper);
         }
     }
 }
@@ -389,9 +403,9 @@ void PaintableBox::clear_clip_overflow_rect(PaintContext& context, PaintPhase ph
         context.painter().restore();
         m_clipping_overflow = false;
     }
-    if (m_overflow_corner_radius_clipper.has_value()) {
-        m_overflow_corner_radius_clipper->blit_corner_clipping(context.painter());
-        m_overflow_corner_radius_clipper = {};
+    if (m_overflow_corner_radius_clipper) {
+        context.painter().blit_corner_clipping(*m_overflow_corner_radius_clipper);
+        m_overflow_corner_radius_clipper = nullptr;
     }
 }
 
@@ -429,7 +443,7 @@ static void paint_cursor_if_needed(PaintContext& context, Layout::TextNode const
     context.painter().draw_rect(cursor_device_rect, text_node.computed_values().color());
 }
 
-static void paint_text_decoration(PaintContext& context, Gfx::Painter& painter, Layout::Node const& text_node, Layout::LineBoxFragment const& fragment)
+static void paint_text_decoration(PaintContext& context, RecordingPainter& painter, Layout::Node const& text_node, Layout::LineBoxFragment const& fragment)
 {
     auto& font = fragment.layout_node().font();
     auto fragment_box = fragment.absolute_rect();
@@ -533,7 +547,7 @@ static void paint_text_fragment(PaintContext& context, Layout::TextNode const& t
         auto selection_rect = context.enclosing_device_rect(fragment.selection_rect(text_node.font())).to_type<int>();
         if (!selection_rect.is_empty()) {
             painter.fill_rect(selection_rect, context.palette().selection());
-            Gfx::PainterStateSaver saver(painter);
+            RecordingPainterStateSaver saver(painter);
             painter.add_clip_rect(selection_rect);
             painter.draw_text_run(baseline_start.to_type<int>(), view, scaled_font, context.palette().selection_text());
         }
@@ -554,7 +568,7 @@ void PaintableWithLines::paint(PaintContext& context, PaintPhase phase) const
         return;
 
     bool should_clip_overflow = computed_values().overflow_x() != CSS::Overflow::Visible && computed_values().overflow_y() != CSS::Overflow::Visible;
-    Optional<BorderRadiusCornerClipper> corner_clipper;
+    RefPtr<BorderRadiusCornerClipper> corner_clipper;
 
     if (should_clip_overflow) {
         context.painter().save();
@@ -569,7 +583,7 @@ void PaintableWithLines::paint(PaintContext& context, PaintPhase phase) const
             auto clipper = BorderRadiusCornerClipper::create(context, clip_box, border_radii);
             if (!clipper.is_error()) {
                 corner_clipper = clipper.release_value();
-                corner_clipper->sample_under_corners(context.painter());
+                context.painter().sample_under_corners(*corner_clipper);
             }
         }
     }
@@ -622,8 +636,8 @@ void PaintableWithLines::paint(PaintContext& context, PaintPhase phase) const
 
     if (should_clip_overflow) {
         context.painter().restore();
-        if (corner_clipper.has_value())
-            corner_clipper->blit_corner_clipping(context.painter());
+        if (corner_clipper)
+            context.painter().blit_corner_clipping(*corner_clipper);
     }
 
     // FIXME: Merge this loop with the above somehow..
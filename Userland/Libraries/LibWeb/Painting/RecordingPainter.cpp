@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/Font/FontDatabase.h>
+#include <LibWeb/Painting/RecordingPainter.h>
+
+namespace Web::Painting {
+
+RecordingPainter::RecordingPainter(DisplayList& display_list, Gfx::IntRect clip_rect)
+    : m_display_list(display_list)
+{
+    m_state_stack.append(State { .translation = {}, .clip_rect = clip_rect, .font = nullptr });
+}
+
+void RecordingPainter::fill_rect(Gfx::IntRect const& rect, Color color)
+{
+    if (would_be_fully_clipped(rect))
+        return;
+    push_command(FillRect { .rect = rect, .color = color });
+}
+
+void RecordingPainter::clear_rect(Gfx::IntRect const& rect, Color color)
+{
+    if (would_be_fully_clipped(rect))
+        return;
+    push_command(ClearRect { .rect = rect, .color = color });
+}
+
+void RecordingPainter::draw_rect(Gfx::IntRect const& rect, Color color, bool rough)
+{
+    if (would_be_fully_clipped(rect))
+        return;
+    push_command(DrawRect { .rect = rect, .color = color, .rough = rough });
+}
+
+void RecordingPainter::draw_focus_rect(Gfx::IntRect const& rect, Color color)
+{
+    if (would_be_fully_clipped(rect))
+        return;
+    push_command(DrawFocusRect { .rect = rect, .color = color });
+}
+
+void RecordingPainter::draw_scaled_bitmap(Gfx::IntRect const& dst_rect, Gfx::Bitmap const& bitmap, Gfx::IntRect const& src_rect, float opacity, Gfx::Painter::ScalingMode scaling_mode)
+{
+    if (would_be_fully_clipped(dst_rect))
+        return;
+    push_command(DrawScaledBitmap {
+        .dst_rect = dst_rect,
+        .bitmap = bitmap,
+        .src_rect = src_rect,
+        .opacity = opacity,
+        .scaling_mode = scaling_mode,
+    });
+}
+
+void RecordingPainter::blit(Gfx::IntPoint position, Gfx::Bitmap const& bitmap, Gfx::IntRect const& src_rect, float opacity, bool apply_alpha)
+{
+    if (would_be_fully_clipped({ position, src_rect.size() }))
+        return;
+    push_command(Blit {
+        .position = position,
+        .bitmap = bitmap,
+        .src_rect = src_rect,
+        .opacity = opacity,
+        .apply_alpha = apply_alpha,
+    });
+}
+
+void RecordingPainter::draw_line(Gfx::IntPoint from, Gfx::IntPoint to, Color color, int thickness, Gfx::Painter::LineStyle style, Color alternate_color)
+{
+    push_command(DrawLine {
+        .from = from,
+        .to = to,
+        .color = color,
+        .thickness = thickness,
+        .style = style,
+        .alternate_color = alternate_color,
+    });
+}
+
+void RecordingPainter::draw_triangle_wave(Gfx::IntPoint p1, Gfx::IntPoint p2, Color color, int amplitude, int thickness)
+{
+    push_command(DrawTriangleWave {
+        .p1 = p1,
+        .p2 = p2,
+        .color = color,
+        .amplitude = amplitude,
+        .thickness = thickness,
+    });
+}
+
+void RecordingPainter::draw_text(Gfx::IntRect const& rect, StringView raw_text, Gfx::TextAlignment alignment, Color color, Gfx::TextElision elision, Gfx::TextWrapping wrapping)
+{
+    draw_text(rect, raw_text, font(), alignment, color, elision, wrapping);
+}
+
+void RecordingPainter::draw_text(Gfx::IntRect const& rect, StringView raw_text, Gfx::Font const& font, Gfx::TextAlignment alignment, Color color, Gfx::TextElision elision, Gfx::TextWrapping wrapping)
+{
+    push_command(DrawText {
+        .rect = rect,
+        .raw_text = MUST(String::from_utf8(raw_text)),
+        .font = font,
+        .alignment = alignment,
+        .color = color,
+        .elision = elision,
+        .wrapping = wrapping,
+    });
+}
+
+void RecordingPainter::draw_text_run(Gfx::IntPoint baseline_start, Utf8View string, Gfx::Font const& font, Color color)
+{
+    push_command(DrawTextRun {
+        .baseline_start = baseline_start,
+        .string = MUST(String::from_utf8(string.as_string())),
+        .font = font,
+        .color = color,
+    });
+}
+
+void RecordingPainter::draw_signed_distance_field(Gfx::IntRect const& dst_rect, Color color, Gfx::GrayscaleBitmap const& sdf, float smoothing)
+{
+    if (would_be_fully_clipped(dst_rect))
+        return;
+    push_command(DrawSignedDistanceField {
+        .rect = dst_rect,
+        .color = color,
+        .sdf = sdf,
+        .smoothing = smoothing,
+    });
+}
+
+void RecordingPainter::fill_rect_with_linear_gradient(Gfx::IntRect const& rect, LinearGradientData const& data)
+{
+    if (would_be_fully_clipped(rect))
+        return;
+    push_command(FillRectWithLinearGradient { .rect = rect, .data = data });
+}
+
+void RecordingPainter::fill_rect_with_conic_gradient(Gfx::IntRect const& rect, ConicGradientData const& data, Gfx::IntPoint const& position)
+{
+    if (would_be_fully_clipped(rect))
+        return;
+    push_command(FillRectWithConicGradient { .rect = rect, .data = data, .position = position });
+}
+
+void RecordingPainter::fill_rect_with_radial_gradient(Gfx::IntRect const& rect, RadialGradientData const& data, Gfx::IntPoint center, Gfx::IntSize size)
+{
+    if (would_be_fully_clipped(rect))
+        return;
+    push_command(FillRectWithRadialGradient { .rect = rect, .data = data, .center = center, .size = size });
+}
+
+void RecordingPainter::fill_rect_with_rounded_corners(Gfx::IntRect const& rect, Color color, int radius)
+{
+    fill_rect_with_rounded_corners(rect, color, { radius, radius }, { radius, radius }, { radius, radius }, { radius, radius });
+}
+
+void RecordingPainter::fill_rect_with_rounded_corners(Gfx::IntRect const& rect, Color color, CornerRadius top_left, CornerRadius top_right, CornerRadius bottom_right, CornerRadius bottom_left, Gfx::AntiAliasingPainter::BlendMode blend_mode)
+{
+    if (would_be_fully_clipped(rect))
+        return;
+    push_command(FillRectWithRoundedCorners {
+        .rect = rect,
+        .color = color,
+        .corner_radii = {
+            .top_left = top_left,
+            .top_right = top_right,
+            .bottom_right = bottom_right,
+            .bottom_left = bottom_left,
+        },
+        .blend_mode = blend_mode,
+    });
+}
+
+void RecordingPainter::fill_ellipse(Gfx::IntRect const& rect, Color color, Gfx::AntiAliasingPainter::BlendMode blend_mode)
+{
+    if (would_be_fully_clipped(rect))
+        return;
+    push_command(FillEllipse { .rect = rect, .color = color, .blend_mode = blend_mode });
+}
+
+void RecordingPainter::draw_ellipse(Gfx::IntRect const& rect, Color color, int thickness)
+{
+    if (would_be_fully_clipped(rect.inflated(thickness, thickness)))
+        return;
+    push_command(DrawEllipse { .rect = rect, .color = color, .thickness = thickness });
+}
+
+void RecordingPainter::fill_path(FillPathUsingColorParams params)
+{
+    if (would_be_fully_clipped(path_bounding_rect(params.path, params.translation, 0)))
+        return;
+    push_command(FillPathUsingColor {
+        .path = move(params.path),
+        .color = params.color,
+        .winding_rule = params.winding_rule,
+        .aa_translation = params.translation,
+    });
+}
+
+void RecordingPainter::fill_path(FillPathUsingPaintStyleParams params)
+{
+    if (would_be_fully_clipped(path_bounding_rect(params.path, params.translation, 0)))
+        return;
+    push_command(FillPathUsingPaintStyle {
+        .path = move(params.path),
+        .paint_style = move(params.paint_style),
+        .winding_rule = params.winding_rule,
+        .opacity = params.opacity,
+        .aa_translation = params.translation,
+    });
+}
+
+void RecordingPainter::stroke_path(StrokePathUsingColorParams params)
+{
+    if (would_be_fully_clipped(path_bounding_rect(params.path, params.translation, params.thickness)))
+        return;
+    push_command(StrokePathUsingColor {
+        .path = move(params.path),
+        .color = params.color,
+        .thickness = params.thickness,
+        .aa_translation = params.translation,
+    });
+}
+
+void RecordingPainter::stroke_path(StrokePathUsingPaintStyleParams params)
+{
+    if (would_be_fully_clipped(path_bounding_rect(params.path, params.translation, params.thickness)))
+        return;
+    push_command(StrokePathUsingPaintStyle {
+        .path = move(params.path),
+        .paint_style = move(params.paint_style),
+        .thickness = params.thickness,
+        .opacity = params.opacity,
+        .aa_translation = params.translation,
+    });
+}
+
+Gfx::IntRect RecordingPainter::path_bounding_rect(Gfx::Path const& path, Gfx::FloatPoint translation, float thickness)
+{
+    // NOTE: This also makes the path compute its split lines now, rather than lazily when the display list is
+    //       executed, which might happen on several threads at once.
+    if (path.segments().is_empty())
+        return {};
+    auto inflation = ceilf(thickness) + 1;
+    return enclosing_int_rect(path.bounding_box().translated(translation).inflated(inflation, inflation));
+}
+
+void RecordingPainter::paint_frame(Gfx::IntRect const& rect, Palette const& palette, Gfx::FrameStyle style)
+{
+    push_command(PaintFrame { .rect = rect, .palette = palette, .style = style });
+}
+
+void RecordingPainter::paint_progressbar(Gfx::IntRect const& rect, Palette const& palette, int min, int max, int value, StringView text)
+{
+    push_command(PaintProgressbar {
+        .rect = rect,
+        .palette = palette,
+        .min = min,
+        .max = max,
+        .value = value,
+        .text = MUST(String::from_utf8(text)),
+    });
+}
+
+void RecordingPainter::paint_borders(DevicePixelRect const& border_rect, CornerRadii const& corner_radii, BordersDataDevicePixels const& borders_data)
+{
+    if (would_be_fully_clipped(border_rect.to_type<int>()))
+        return;
+    push_command(PaintBorders { .border_rect = border_rect, .corner_radii = corner_radii, .borders_data = borders_data });
+}
+
+void RecordingPainter::sample_under_corners(BorderRadiusCornerClipper& corner_clipper)
+{
+    push_command(SampleUnderCorners { .corner_clipper = corner_clipper });
+}
+
+void RecordingPainter::blit_corner_clipping(BorderRadiusCornerClipper& corner_clipper)
+{
+    push_command(BlitCornerClipping { .corner_clipper = corner_clipper });
+}
+
+void RecordingPainter::apply_backdrop_filter(Gfx::IntRect const& backdrop_region, ResolvedBackdropFilter backdrop_filter)
+{
+    push_command(ApplyBackdropFilter { .backdrop_region = backdrop_region, .backdrop_filter = move(backdrop_filter) });
+}
+
+void RecordingPainter::push_stacking_context(PushStackingContextParams params)
+{
+    push_command(PushStackingContext {
+        .opacity = params.opacity,
+        .source_rect = params.source_rect,
+        .transformed_destination_rect = params.transformed_destination_rect,
+        .painter_translation = params.painter_translation,
+    });
+    m_state_stack.append(State {
+        .translation = params.painter_translation.to_rounded<int>(),
+        .clip_rect = { {}, params.source_rect.size().to_rounded<int>() },
+        .font = state().font,
+    });
+}
+
+void RecordingPainter::pop_stacking_context()
+{
+    m_state_stack.take_last();
+    push_command(PopStackingContext {});
+}
+
+void RecordingPainter::translate(Gfx::IntPoint delta)
+{
+    state().translation.translate_by(delta);
+    push_command(Translate { .delta = delta });
+}
+
+void RecordingPainter::set_translation(Gfx::IntPoint translation)
+{
+    state().translation = translation;
+    push_command(SetTranslation { .translation = translation });
+}
+
+void RecordingPainter::add_clip_rect(Gfx::IntRect const& rect)
+{
+    state().clip_rect.intersect(rect.translated(state().translation));
+    push_command(AddClipRect { .rect = rect });
+}
+
+Gfx::Font const& RecordingPainter::font() const
+{
+    if (!state().font)
+        return Gfx::FontDatabase::default_font();
+    return *state().font;
+}
+
+void RecordingPainter::set_font(Gfx::Font const& font)
+{
+    state().font = font;
+}
+
+void RecordingPainter::save()
+{
+    m_state_stack.append(m_state_stack.last());
+    push_command(SaveState {});
+}
+
+void RecordingPainter::restore()
+{
+    VERIFY(m_state_stack.size() > 1);
+    m_state_stack.take_last();
+    push_command(RestoreState {});
+}
+
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/Utf8View.h>
+#include <AK/Vector.h>
+#include <LibWeb/Painting/DisplayList.h>
+
+namespace Web::Painting {
+
+// A painter that records painting commands into a DisplayList instead of touching any pixels.
+// It keeps track of the translation and clip rect (like a Gfx::Painter would) so that paintables can query them,
+// and so commands that would be fully clipped can be dropped at record time.
+class RecordingPainter {
+    AK_MAKE_NONCOPYABLE(RecordingPainter);
+    AK_MAKE_NONMOVABLE(RecordingPainter);
+
+public:
+    RecordingPainter(DisplayList&, Gfx::IntRect clip_rect);
+
+    void fill_rect(Gfx::IntRect const&, Color);
+    void clear_rect(Gfx::IntRect const&, Color);
+    void draw_rect(Gfx::IntRect const&, Color, bool rough = false);
+    void draw_focus_rect(Gfx::IntRect const&, Color);
+
+    void draw_scaled_bitmap(Gfx::IntRect const& dst_rect, Gfx::Bitmap const&, Gfx::IntRect const& src_rect, float opacity = 1.0f, Gfx::Painter::ScalingMode = Gfx::Painter::ScalingMode::NearestNeighbor);
+    void blit(Gfx::IntPoint, Gfx::Bitmap const&, Gfx::IntRect const& src_rect, float opacity = 1.0f, bool apply_alpha = true);
+
+    void draw_line(Gfx::IntPoint from, Gfx::IntPoint to, Color, int thickness = 1, Gfx::Painter::LineStyle = Gfx::Painter::LineStyle::Solid, Color alternate_color = Color::Transparent);
+    void draw_triangle_wave(Gfx::IntPoint, Gfx::IntPoint, Color, int amplitude, int thickness = 1);
+
+    void draw_text(Gfx::IntRect const&, StringView, Gfx::TextAlignment = Gfx::TextAlignment::TopLeft, Color = Color::Black, Gfx::TextElision = Gfx::TextElision::None, Gfx::TextWrapping = Gfx::TextWrapping::DontWrap);
+    void draw_text(Gfx::IntRect const&, StringView, Gfx::Font const&, Gfx::TextAlignment = Gfx::TextAlignment::TopLeft, Color = Color::Black, Gfx::TextElision = Gfx::TextElision::None, Gfx::TextWrapping = Gfx::TextWrapping::DontWrap);
+    void draw_text_run(Gfx::IntPoint baseline_start, Utf8View, Gfx::Font const&, Color);
+
+    void draw_signed_distance_field(Gfx::IntRect const& dst_rect, Color, Gfx::GrayscaleBitmap const&, float smoothing);
+
+    void fill_rect_with_linear_gradient(Gfx::IntRect const&, LinearGradientData const&);
+    void fill_rect_with_conic_gradient(Gfx::IntRect const&, ConicGradientData const&, Gfx::IntPoint const& position);
+    void fill_rect_with_radial_gradient(Gfx::IntRect const&, RadialGradientData const&, Gfx::IntPoint center, Gfx::IntSize size);
+
+    // Anti-aliased drawing, see Gfx::AntiAliasingPainter.
+    void fill_rect_with_rounded_corners(Gfx::IntRect const&, Color, int radius);
+    void fill_rect_with_rounded_corners(Gfx::IntRect const&, Color, CornerRadius top_left, CornerRadius top_right, CornerRadius bottom_right, CornerRadius bottom_left, Gfx::AntiAliasingPainter::BlendMode = Gfx::AntiAliasingPainter::BlendMode::Normal);
+    void fill_ellipse(Gfx::IntRect const&, Color, Gfx::AntiAliasingPainter::BlendMode = Gfx::AntiAliasingPainter::BlendMode::Normal);
+    void draw_ellipse(Gfx::IntRect const&, Color, int thickness);
+
+    struct FillPathUsingColorParams {
+        Gfx::Path path;
+        Color color;
+        Gfx::Painter::WindingRule winding_rule = Gfx::Painter::WindingRule::Nonzero;
+        Gfx::FloatPoint translation {};
+    };
+    void fill_path(FillPathUsingColorParams params);
+
+    struct FillPathUsingPaintStyleParams {
+        Gfx::Path path;
+        NonnullRefPtr<Gfx::PaintStyle const> paint_style;
+        Gfx::Painter::WindingRule winding_rule = Gfx::Painter::WindingRule::Nonzero;
+        float opacity;
+        Gfx::FloatPoint translation {};
+    };
+    void fill_path(FillPathUsingPaintStyleParams params);
+
+    struct StrokePathUsingColorParams {
+        Gfx::Path path;
+        Color color;
+        float thickness;
+        Gfx::FloatPoint translation {};
+    };
+    void stroke_path(StrokePathUsingColorParams params);
+
+    struct StrokePathUsingPaintStyleParams {
+        Gfx::Path path;
+        NonnullRefPtr<Gfx::PaintStyle const> paint_style;
+        float thickness;
+        float opacity;
+        Gfx::FloatPoint translation {};
+    };
+    void stroke_path(StrokePathUsingPaintStyleParams params);
+
+    void paint_frame(Gfx::IntRect const&, Palette const&, Gfx::FrameStyle);
+    void paint_progressbar(Gfx::IntRect const&, Palette const&, int min, int max, int value, StringView text);
+
+    void paint_borders(DevicePixelRect const& border_rect, CornerRadii const&, BordersDataDevicePixels const&);
+    void sample_under_corners(BorderRadiusCornerClipper&);
+    void blit_corner_clipping(BorderRadiusCornerClipper&);
+    void apply_backdrop_filter(Gfx::IntRect const& backdrop_region, ResolvedBackdropFilter);
+
+    struct PushStackingContextParams {
+        float opacity;
+        Gfx::FloatRect source_rect;
+        Gfx::FloatRect transformed_destination_rect;
+        Gfx::FloatPoint painter_translation;
+    };
+    // Everything painted until the matching pop_stacking_context() goes into a separate layer, whose origin is
+    // painter_translation. The layer is composited back into transformed_destination_rect with the given opacity.
+    void push_stacking_context(PushStackingContextParams params);
+    void pop_stacking_context();
+
+    void translate(int dx, int dy) { translate({ dx, dy }); }
+    void translate(Gfx::IntPoint delta);
+    void set_translation(Gfx::IntPoint translation);
+    Gfx::IntPoint translation() const { return state().translation; }
+
+    void add_clip_rect(Gfx::IntRect const& rect);
+    Gfx::IntRect clip_rect() const { return state().clip_rect; }
+
+    Gfx::Font const& font() const;
+    void set_font(Gfx::Font const& font);
+
+    void save();
+    void restore();
+
+private:
+    struct State {
+        Gfx::IntPoint translation;
+        Gfx::IntRect clip_rect;
+        RefPtr<Gfx::Font const> font;
+    };
+    State& state() { return m_state_stack.last(); }
+    State const& state() const { return m_state_stack.last(); }
+
+    bool would_be_fully_clipped(Gfx::IntRect const& rect) const
+    {
+        return !state().clip_rect.intersects(rect.translated(state().translation));
+    }
+
+    static Gfx::IntRect path_bounding_rect(Gfx::Path const&, Gfx::FloatPoint translation, float thickness);
+
+    void push_command(PaintingCommand&& command) { m_display_list.append(move(command)); }
+
+    DisplayList& m_display_list;
+    Vector<State, 32> m_state_stack;
+};
+
+class RecordingPainterStateSaver {
+public:
+    explicit RecordingPainterStateSaver(RecordingPainter& painter)
+        : m_painter(painter)
+    {
+        m_painter.save();
+    }
+
+    ~RecordingPainterStateSaver()
+    {
+        m_painter.restore();
+    }
+
+private:
+    RecordingPainter& m_painter;
+};
+
+}
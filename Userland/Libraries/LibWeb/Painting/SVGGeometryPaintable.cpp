@@ -5,7 +5,6 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <LibGfx/AntiAliasingPainter.h>
 #include <LibWeb/Layout/ImageBox.h>
 #include <LibWeb/Painting/SVGGeometryPaintable.h>
 #include <LibWeb/SVG/SVGSVGElement.h>
@@ -66,13 +65,11 @@ void SVGGeometryPaintable::paint(PaintContext& context, PaintPhase phase) const
 
     auto& geometry_element = layout_box().dom_node();
 
-    Gfx::AntiAliasingPainter painter { context.painter() };
+    auto& painter = context.painter();
     auto& svg_context = context.svg_context();
 
     // FIXME: This should not be trucated to an int.
-    Gfx::PainterStateSaver save_painter { context.painter() };
     auto offset = context.floored_device_point(svg_context.svg_element_position()).to_type<int>().to_type<float>();
-    painter.translate(offset);
 
     auto const* svg_element = geometry_element.shadow_including_first_ancestor_of_type<SVG::SVGSVGElement>();
     auto maybe_view_box = svg_element->view_box();
@@ -115,16 +112,20 @@ void SVGGeometryPaintable::paint(PaintContext& context, PaintPhase phase) const
     auto winding_rule = to_gfx_winding_rule(geometry_element.fill_rule().value_or(svg_context.fill_rule()));
 
     if (auto paint_style = geometry_element.fill_paint_style(paint_context); paint_style.has_value()) {
-        painter.fill_path(
-            closed_path(),
-            *paint_style,
-            fill_opacity,
-            winding_rule);
+        painter.fill_path({
+            .path = closed_path(),
+            .paint_style = *paint_style,
+            .winding_rule = winding_rule,
+            .opacity = fill_opacity,
+            .translation = offset,
+        });
     } else if (auto fill_color = geometry_element.fill_color().value_or(svg_context.fill_color()).with_opacity(fill_opacity); fill_color.alpha() > 0) {
-        painter.fill_path(
-            closed_path(),
-            fill_color,
-            winding_rule);
+        painter.fill_path({
+            .path = closed_path(),
+            .color = fill_color,
+            .winding_rule = winding_rule,
+            .translation = offset,
+        });
     }
 
     auto stroke_opacity = geometry_element.stroke_opacity().value_or(svg_context.stroke_opacity());
@@ -133,16 +134,20 @@ void SVGGeometryPaintable::paint(PaintContext& context, PaintPhase phase) const
     float stroke_thickness = geometry_element.stroke_width().value_or(svg_context.stroke_width()) * viewbox_scale;
 
     if (auto paint_style = geometry_element.stroke_paint_style(paint_context); paint_style.has_value()) {
-        painter.stroke_path(
-            path,
-            *paint_style,
-            stroke_thickness,
-            stroke_opacity);
+        painter.stroke_path({
+            .path = path,
+            .paint_style = *paint_style,
+            .thickness = stroke_thickness,
+            .opacity = stroke_opacity,
+            .translation = offset,
+        });
     } else if (auto stroke_color = geometry_element.stroke_color().value_or(svg_context.stroke_color()).with_opacity(stroke_opacity); stroke_color.alpha() > 0) {
-        painter.stroke_path(
-            path,
-            stroke_color,
-            stroke_thickness);
+        painter.stroke_path({
+            .path = path,
+            .color = stroke_color,
+            .thickness = stroke_thickness,
+            .translation = offset,
+        });
     }
 }
 
@@ -38,7 +38,7 @@ void SVGTextPaintable::paint(PaintContext& context, PaintPhase phase) const
 
     auto& painter = context.painter();
 
-    Gfx::PainterStateSaver save_painter { painter };
+    RecordingPainterStateSaver save_painter { painter };
     auto& svg_context = context.svg_context();
     auto svg_context_offset = context.floored_device_point(svg_context.svg_element_position()).to_type<int>();
     painter.translate(svg_context_offset);
@@ -61,7 +61,7 @@ static void paint_inner_box_shadow(PaintContext& context, CSSPixelRect const& co
     }
     Gfx::StackBlurFilter filter(*shadow_bitmap);
     filter.process_rgba(blur_radius.value(), box_shadow_data.color);
-    Gfx::PainterStateSaver save { painter };
+    RecordingPainterStateSaver save { painter };
     painter.add_clip_rect(device_content_rect_int);
     painter.blit({ device_content_rect_int.left(), device_content_rect_int.top() },
         *shadow_bitmap, shadow_bitmap->rect(), box_shadow_data.color.alpha() / 255.);
@@ -282,7 +282,7 @@ static void paint_outer_box_shadow(PaintContext& context, CSSPixelRect const& co
     auto bottom_right_corner_blit_pos = inner_bounding_rect.bottom_right().translated(-bottom_right_corner_size.width() + double_radius, -bottom_right_corner_size.height() + double_radius);
 
     auto paint_shadow = [&](DevicePixelRect clip_rect) {
-        Gfx::PainterStateSaver save { painter };
+        RecordingPainterStateSaver save { painter };
         painter.add_clip_rect(clip_rect.to_type<int>());
 
         paint_shadow_infill();
@@ -364,9 +364,9 @@ Gfx::AffineTransform StackingContext::affine_transform_matrix() const
 
 void StackingContext::paint(PaintContext& context) const
 {
-    Gfx::PainterStateSaver saver(context.painter());
+    RecordingPainterStateSaver saver(context.painter());
     if (m_box->is_fixed_position()) {
-        context.painter().translate(-context.painter().translation());
+        context.painter().set_translation({});
     }
 
     auto opacity = m_box->computed_values().opacity();
@@ -381,44 +381,18 @@ void StackingContext::paint(PaintContext& context) const
         auto transform_origin = this->transform_origin();
         auto source_rect = context.enclosing_device_rect(paintable_box().absolute_paint_rect()).to_type<int>().to_type<float>().translated(-transform_origin);
         auto transformed_destination_rect = affine_transform.map(source_rect).translated(transform_origin);
-        auto destination_rect = transformed_destination_rect.to_rounded<int>();
-
-        // FIXME: We should find a way to scale the paintable, rather than paint into a separate bitmap,
-        // then scale it. This snippet now copies the background at the destination, then scales it down/up
-        // to the size of the source (which could add some artefacts, though just scaling the bitmap already does that).
-        // We need to copy the background at the destination because a bunch of our rendering effects now rely on
-        // being able to sample the painter (see border radii, shadows, filters, etc).
-        CSSPixelPoint destination_clipped_fixup {};
-        auto try_get_scaled_destination_bitmap = [&]() -> ErrorOr<NonnullRefPtr<Gfx::Bitmap>> {
-            Gfx::IntRect actual_destination_rect;
-            auto bitmap = TRY(context.painter().get_region_bitmap(destination_rect, Gfx::BitmapFormat::BGRA8888, actual_destination_rect));
-            // get_region_bitmap() may clip to a smaller region if the requested rect goes outside the painter, so we need to account for that.
-            destination_clipped_fixup = CSSPixelPoint { destination_rect.location() - actual_destination_rect.location() };
-            destination_rect = actual_destination_rect;
-            if (source_rect.size() != transformed_destination_rect.size()) {
-                auto sx = static_cast<float>(source_rect.width()) / transformed_destination_rect.width();
-                auto sy = static_cast<float>(source_rect.height()) / transformed_destination_rect.height();
-                bitmap = TRY(bitmap->scaled(sx, sy));
-                destination_clipped_fixup.scale_by(sx, sy);
-            }
-            return bitmap;
-        };
 
-        auto bitmap_or_error = try_get_scaled_destination_bitmap();
-        if (bitmap_or_error.is_error())
-            return;
-        auto bitmap = bitmap_or_error.release_value_but_fixme_should_propagate_errors();
-        Gfx::Painter painter(bitmap);
-        painter.translate(context.rounded_device_point(-paintable_box().absolute_paint_rect().location() + destination_clipped_fixup).to_type<int>());
-        auto paint_context = context.clone(painter);
-        paint_internal(paint_context);
-
-        if (destination_rect.size() == bitmap->size())
-            context.painter().blit(destination_rect.location(), *bitmap, bitmap->rect(), opacity);
-        else
-            context.painter().draw_scaled_bitmap(destination_rect, *bitmap, bitmap->rect(), opacity, Gfx::Painter::ScalingMode::BilinearBlend);
+        // NOTE: The layer itself is set up (and composited back) when the display list is executed, see PushStackingContext.
+        context.painter().push_stacking_context({
+            .opacity = opacity,
+            .source_rect = source_rect,
+            .transformed_destination_rect = transformed_destination_rect,
+            .painter_translation = context.rounded_device_point(-paintable_box().absolute_paint_rect().location()).to_type<int>().to_type<float>(),
+        });
+        paint_internal(context);
+        context.painter().pop_stacking_context();
     } else {
-        Gfx::PainterStateSaver saver(context.painter());
+        RecordingPainterStateSaver saver(context.painter());
         context.painter().translate(affine_transform.translation().to_rounded<int>());
         paint_internal(context);
     }
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <LibGfx/Painter.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/TileCache.h>
+#include <unistd.h>
+
+namespace Web::Painting {
+
+// Beyond this, the threads mostly end up waiting for each other to draw text.
+static constexpr size_t max_thread_count = 8;
+
+size_t TileCache::default_thread_count()
+{
+    auto processor_count = sysconf(_SC_NPROCESSORS_ONLN);
+    if (processor_count < 1)
+        return 1;
+    return min(static_cast<size_t>(processor_count), max_thread_count);
+}
+
+NonnullOwnPtr<TileCache> TileCache::create(size_t thread_count)
+{
+    auto tile_cache = adopt_own(*new TileCache);
+    // NOTE: The thread calling paint() rasterizes tiles as well, so one thread fewer has to be created.
+    for (size_t i = 1; i < thread_count; ++i) {
+        auto worker_thread = Threading::WorkerThread<Error>::create("Tile rasterizer"sv);
+        if (worker_thread.is_error()) {
+            dbgln("Failed to create tile rasterization thread: {}", worker_thread.error());
+            break;
+        }
+        tile_cache->m_worker_threads.append(worker_thread.release_value());
+    }
+    return tile_cache;
+}
+
+TileCache::~TileCache() = default;
+
+static int floor_to_tile_size(int value)
+{
+    if (value >= 0)
+        return value - value % TileCache::tile_size;
+    return -ceil_div(-value, TileCache::tile_size) * TileCache::tile_size;
+}
+
+DevicePixelRect TileCache::tile_aligned_rect(DevicePixelRect const& rect)
+{
+    if (rect.is_empty())
+        return {};
+    auto left = floor_to_tile_size(rect.left().value());
+    auto top = floor_to_tile_size(rect.top().value());
+    auto right = floor_to_tile_size(rect.right().value() - 1) + tile_size;
+    auto bottom = floor_to_tile_size(rect.bottom().value() - 1) + tile_size;
+    return { left, top, right - left, bottom - top };
+}
+
+DevicePixelRect TileCache::tile_rect(Gfx::IntPoint index)
+{
+    return { index.x() * tile_size, index.y() * tile_size, tile_size, tile_size };
+}
+
+void TileCache::invalidate(DevicePixelRect const& rect)
+{
+    for (auto& it : m_tiles) {
+        if (tile_rect(it.key).intersects(rect))
+            it.value.is_stale = true;
+    }
+}
+
+void TileCache::invalidate_all()
+{
+    for (auto& it : m_tiles)
+        it.value.is_stale = true;
+    m_viewport_location_of_tiles.clear();
+}
+
+void TileCache::clear()
+{
+    m_tiles.clear();
+    m_viewport_location_of_tiles.clear();
+}
+
+void TileCache::paint(PaintParams const& params, Gfx::Bitmap& target)
+{
+    auto const& viewport_rect = params.viewport_rect;
+    if (m_viewport_location_of_tiles.has_value() && *m_viewport_location_of_tiles != viewport_rect.location())
+        invalidate_all();
+
+    // Keep the tiles we are likely to scroll to soon around, and drop everything else.
+    auto retained_rect = viewport_rect.inflated(viewport_rect.width(), viewport_rect.height() * 2);
+    m_tiles.remove_all_matching([&](auto const& index, auto const&) {
+        return !tile_rect(index).intersects(retained_rect);
+    });
+
+    rasterize_stale_tiles(params);
+    if (params.depends_on_viewport_location)
+        m_viewport_location_of_tiles = viewport_rect.location();
+
+    Gfx::Painter painter(target);
+    auto tiles_rect = tile_aligned_rect(viewport_rect);
+    for (auto y = tiles_rect.top().value(); y < tiles_rect.bottom().value(); y += tile_size) {
+        for (auto x = tiles_rect.left().value(); x < tiles_rect.right().value(); x += tile_size) {
+            Gfx::IntPoint index { x / tile_size, y / tile_size };
+            auto location = (tile_rect(index).location() - viewport_rect.location()).to_type<int>();
+            auto tile = m_tiles.get(index);
+            if (!tile.has_value()) {
+                painter.fill_rect({ location, { tile_size, tile_size } }, params.background_color);
+                continue;
+            }
+            painter.blit(location, *tile->bitmap, tile->bitmap->rect());
+        }
+    }
+}
+
+void TileCache::rasterize_tile(Tile& tile, DevicePixelRect const& tile_rect, PaintParams const& params)
+{
+    tile.bitmap->fill(params.background_color);
+    auto translation = params.display_list_viewport_rect.location() - tile_rect.location();
+    auto viewport_origin = params.viewport_rect.location() - tile_rect.location();
+    params.display_list.execute(*tile.bitmap, translation.to_type<int>(), viewport_origin.to_type<int>());
+    tile.is_stale = false;
+}
+
+void TileCache::rasterize_stale_tiles(PaintParams const& params)
+{
+    m_last_rasterized_tile_count = 0;
+
+    Vector<Gfx::IntPoint> visible_tile_indices;
+    auto tiles_rect = tile_aligned_rect(params.viewport_rect);
+    for (auto y = tiles_rect.top().value(); y < tiles_rect.bottom().value(); y += tile_size) {
+        for (auto x = tiles_rect.left().value(); x < tiles_rect.right().value(); x += tile_size) {
+            Gfx::IntPoint index { x / tile_size, y / tile_size };
+            visible_tile_indices.append(index);
+            if (m_tiles.contains(index))
+                continue;
+            auto bitmap = Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, { tile_size, tile_size });
+            if (bitmap.is_error()) {
+                dbgln("Failed to allocate tile bitmap: {}", bitmap.error());
+                continue;
+            }
+            m_tiles.set(index, Tile { .bitmap = bitmap.release_value(), .is_stale = true });
+        }
+    }
+
+    // NOTE: Only collect pointers to the tiles once we are done adding them, as that may move them around.
+    struct StaleTile {
+        Tile* tile;
+        DevicePixelRect rect;
+    };
+    Vector<StaleTile> stale_tiles;
+    for (auto index : visible_tile_indices) {
+        auto it = m_tiles.find(index);
+        if (it != m_tiles.end() && it->value.is_stale)
+            stale_tiles.append({ &it->value, tile_rect(index) });
+    }
+    if (stale_tiles.is_empty())
+        return;
+
+    Atomic<size_t> next_stale_tile { 0 };
+    auto rasterize_until_done = [&] {
+        while (true) {
+            auto i = next_stale_tile.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+            if (i >= stale_tiles.size())
+                return;
+            rasterize_tile(*stale_tiles[i].tile, stale_tiles[i].rect, params);
+        }
+    };
+
+    auto worker_count = min(m_worker_threads.size(), stale_tiles.size() - 1);
+    for (size_t i = 0; i < worker_count; ++i) {
+        auto started = m_worker_threads[i]->start_task([&]() -> ErrorOr<void> {
+            rasterize_until_done();
+            return {};
+        });
+        VERIFY(started);
+    }
+    rasterize_until_done();
+    for (size_t i = 0; i < worker_count; ++i)
+        MUST(m_worker_threads[i]->wait_until_task_is_finished());
+
+    m_last_rasterized_tile_count = stale_tiles.size();
+}
+
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/Color.h>
+#include <LibThreading/WorkerThread.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/PixelUnits.h>
+
+namespace Web::Painting {
+
+// Keeps the page rasterized in fixed-size tiles. Tiles are positioned in device pixels relative to the document
+// (not the viewport), so they stay valid while scrolling. Tiles that are stale (because they were never painted,
+// or were invalidated since) are rasterized from a DisplayList, in parallel on a pool of worker threads.
+class TileCache {
+    AK_MAKE_NONCOPYABLE(TileCache);
+    AK_MAKE_NONMOVABLE(TileCache);
+
+public:
+    static constexpr int tile_size = 256;
+
+    static size_t default_thread_count();
+    static NonnullOwnPtr<TileCache> create(size_t thread_count = default_thread_count());
+    ~TileCache();
+
+    // The smallest rect made out of whole tiles that contains the given rect.
+    static DevicePixelRect tile_aligned_rect(DevicePixelRect const&);
+
+    // Marks the tiles intersecting the given rect (in device pixels relative to the document) as stale.
+    void invalidate(DevicePixelRect const&);
+    void invalidate_all();
+    // Throws away all tiles, e.g. because the device pixel ratio changed.
+    void clear();
+
+    struct PaintParams {
+        DisplayList const& display_list;
+        // The viewport the display list was recorded for. It has to have been recorded for (at least)
+        // tile_aligned_rect(viewport_rect), so stale tiles can be rasterized entirely from it.
+        DevicePixelRect display_list_viewport_rect;
+        // Whether anything in the display list moves relative to the document when the viewport is scrolled.
+        bool depends_on_viewport_location { false };
+        DevicePixelRect viewport_rect;
+        Color background_color;
+    };
+    // Rasterizes all stale tiles intersecting the viewport, then blits the viewport into the target bitmap.
+    void paint(PaintParams const&, Gfx::Bitmap& target);
+
+    size_t thread_count() const { return m_worker_threads.size() + 1; }
+    size_t tile_count() const { return m_tiles.size(); }
+    size_t last_rasterized_tile_count() const { return m_last_rasterized_tile_count; }
+
+private:
+    TileCache() = default;
+
+    struct Tile {
+        NonnullRefPtr<Gfx::Bitmap> bitmap;
+        bool is_stale { true };
+    };
+
+    static DevicePixelRect tile_rect(Gfx::IntPoint index);
+    static void rasterize_tile(Tile&, DevicePixelRect const& tile_rect, PaintParams const&);
+
+    void rasterize_stale_tiles(PaintParams const&);
+
+    HashMap<Gfx::IntPoint, Tile> m_tiles;
+    Vector<NonnullOwnPtr<Threading::WorkerThread<Error>>> m_worker_threads;
+
+    // If the tiles were rasterized from a display list with viewport relative content, this is where the viewport was.
+    Optional<DevicePixelPoint> m_viewport_location_of_tiles;
+
+    size_t m_last_rasterized_tile_count { 0 };
+};
+
+}
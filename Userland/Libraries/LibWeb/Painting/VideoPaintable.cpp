@@ -7,7 +7,6 @@
 #include <AK/Array.h>
 #include <AK/NumberFormat.h>
 #include <LibGUI/Event.h>
-#include <LibGfx/AntiAliasingPainter.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/HTML/HTMLMediaElement.h>
 #include <LibWeb/HTML/HTMLVideoElement.h>
@@ -204,15 +203,18 @@ void VideoPaintable::paint_loaded_video_controls(PaintContext& context, HTML::HT
     control_box_rect.take_from_left(playback_padding);
 }
 
-static void fill_triangle(Gfx::Painter& painter, Gfx::IntPoint location, Array<Gfx::IntPoint, 3> coordinates, Color color)
+static void fill_triangle(RecordingPainter& painter, Gfx::IntPoint location, Array<Gfx::IntPoint, 3> coordinates, Color color)
 {
-    Gfx::AntiAliasingPainter aa_painter { painter };
     Gfx::Path path;
     path.move_to((coordinates[0] + location).to_type<float>());
     path.line_to((coordinates[1] + location).to_type<float>());
     path.line_to((coordinates[2] + location).to_type<float>());
     path.close();
-    aa_painter.fill_path(path, color, Gfx::Painter::WindingRule::EvenOdd);
+    painter.fill_path({
+        .path = path,
+        .color = color,
+        .winding_rule = Gfx::Painter::WindingRule::EvenOdd,
+    });
 }
 
 DevicePixelRect VideoPaintable::paint_control_bar_playback_button(PaintContext& context, HTML::HTMLVideoElement const& video_element, DevicePixelRect control_box_rect, Optional<DevicePixelPoint> const& mouse_position) const
@@ -275,7 +277,7 @@ DevicePixelRect VideoPaintable::paint_control_bar_timeline(PaintContext& context
     auto timeline_button_size = min(maximum_timeline_button_size, timeline_rect.height() / 2);
     auto timeline_button_offset_x = static_cast<DevicePixels>(round(playback_position));
 
-    Gfx::AntiAliasingPainter painter { context.painter() };
+    auto& painter = context.painter();
 
     auto playback_timelime_scrub_rect = timeline_rect;
     playback_timelime_scrub_rect.shrink(0, timeline_rect.height() - timeline_button_size / 2);
@@ -353,8 +355,7 @@ void VideoPaintable::paint_placeholder_video_controls(PaintContext& context, Dev
     auto playback_button_is_hovered = mouse_position.has_value() && control_box_rect.contains(*mouse_position);
     auto playback_button_color = control_button_color(playback_button_is_hovered);
 
-    Gfx::AntiAliasingPainter painter { context.painter() };
-    painter.fill_ellipse(control_box_rect.to_type<int>(), control_box_color);
+    context.painter().fill_ellipse(control_box_rect.to_type<int>(), control_box_color);
     fill_triangle(context.painter(), playback_button_location.to_type<int>(), play_button_coordinates, playback_button_color);
 }
 
@@ -5,6 +5,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibGfx/Bitmap.h>
+#include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Platform/ImageCodecPlugin.h>
 
 namespace Web::Platform {
@@ -25,4 +27,21 @@ void ImageCodecPlugin::install(ImageCodecPlugin& plugin)
     s_the = &plugin;
 }
 
+void ImageCodecPlugin::start_decoding_image(ReadonlyBytes bytes, Optional<Gfx::IntSize> ideal_size, Function<void(Optional<DecodedImage>)> on_complete)
+{
+    auto image = decode_image(bytes);
+    if (image.has_value() && ideal_size.has_value() && !ideal_size->is_empty()) {
+        for (auto& frame : image->frames) {
+            if (frame.bitmap->width() <= ideal_size->width() && frame.bitmap->height() <= ideal_size->height())
+                continue;
+            auto scale = min(static_cast<float>(ideal_size->width()) / frame.bitmap->width(), static_cast<float>(ideal_size->height()) / frame.bitmap->height());
+            if (auto scaled_bitmap = frame.bitmap->scaled(scale, scale); !scaled_bitmap.is_error())
+                frame.bitmap = scaled_bitmap.release_value();
+        }
+    }
+    EventLoopPlugin::the().deferred_invoke([on_complete = move(on_complete), image = move(image)]() mutable {
+        on_complete(move(image));
+    });
+}
+
 }
@@ -7,9 +7,11 @@
 
 #pragma once
 
+#include <AK/Function.h>
 #include <AK/RefPtr.h>
 #include <AK/Vector.h>
 #include <LibGfx/Forward.h>
+#include <LibGfx/Size.h>
 
 namespace Web::Platform {
 
@@ -32,6 +34,10 @@ public:
     virtual ~ImageCodecPlugin();
 
     virtual Optional<DecodedImage> decode_image(ReadonlyBytes) = 0;
+
+    // Like decode_image(), but this may return before the image has been decoded, and calls on_complete once it is.
+    // Frames larger than the ideal size are scaled down to it.
+    virtual void start_decoding_image(ReadonlyBytes, Optional<Gfx::IntSize> ideal_size, Function<void(Optional<DecodedImage>)> on_complete);
 };
 
 }
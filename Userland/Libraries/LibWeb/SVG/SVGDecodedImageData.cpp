@@ -93,10 +93,13 @@ void SVGDecodedImageData::render(Gfx::IntSize size) const
     m_document->browsing_context()->set_viewport_rect({ 0, 0, size.width(), size.height() });
     m_document->update_layout();
 
-    Gfx::Painter painter(*m_bitmap);
-    PaintContext context(painter, m_page_client->palette(), m_page_client->device_pixels_per_css_pixel());
+    Painting::DisplayList display_list;
+    Painting::RecordingPainter recording_painter(display_list, m_bitmap->rect());
+    PaintContext context(recording_painter, m_page_client->palette(), m_page_client->device_pixels_per_css_pixel());
 
     m_document->layout_node()->paint_all_phases(context);
+
+    display_list.execute(*m_bitmap);
 }
 
 RefPtr<Gfx::Bitmap const> SVGDecodedImageData::bitmap(size_t, Gfx::IntSize size) const
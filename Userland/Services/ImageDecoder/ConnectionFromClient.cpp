@@ -22,22 +22,39 @@ void ConnectionFromClient::die()
     Core::EventLoop::current().quit(0);
 }
 
-static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Vector<Gfx::ShareableBitmap>& bitmaps, Vector<u32>& durations)
+static ErrorOr<NonnullRefPtr<Gfx::Bitmap>> scale_down_to_ideal_size(NonnullRefPtr<Gfx::Bitmap> bitmap, Optional<Gfx::IntSize> const& ideal_size)
+{
+    if (!ideal_size.has_value() || ideal_size->is_empty())
+        return bitmap;
+    if (bitmap->width() <= ideal_size->width() && bitmap->height() <= ideal_size->height())
+        return bitmap;
+
+    auto scale = min(static_cast<float>(ideal_size->width()) / bitmap->width(), static_cast<float>(ideal_size->height()) / bitmap->height());
+    return bitmap->scaled(scale, scale);
+}
+
+static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> const& ideal_size, Vector<Gfx::ShareableBitmap>& bitmaps, Vector<u32>& durations)
 {
     for (size_t i = 0; i < decoder.frame_count(); ++i) {
         auto frame_or_error = decoder.frame(i);
         if (frame_or_error.is_error()) {
             bitmaps.append(Gfx::ShareableBitmap {});
             durations.append(0);
-        } else {
-            auto frame = frame_or_error.release_value();
-            bitmaps.append(frame.image->to_shareable_bitmap());
-            durations.append(frame.duration);
+            continue;
         }
+        auto frame = frame_or_error.release_value();
+        auto bitmap_or_error = scale_down_to_ideal_size(*frame.image, ideal_size);
+        if (bitmap_or_error.is_error()) {
+            bitmaps.append(Gfx::ShareableBitmap {});
+            durations.append(0);
+            continue;
+        }
+        bitmaps.append(bitmap_or_error.value()->to_shareable_bitmap());
+        durations.append(frame.duration);
     }
 }
 
-static void decode_image_to_details(Core::AnonymousBuffer const& encoded_buffer, Optional<DeprecatedString> const& known_mime_type, bool& is_animated, u32& loop_count, Vector<Gfx::ShareableBitmap>& bitmaps, Vector<u32>& durations)
+static void decode_image_to_details(Core::AnonymousBuffer const& encoded_buffer, Optional<DeprecatedString> const& known_mime_type, Optional<Gfx::IntSize> const& ideal_size, bool& is_animated, u32& loop_count, Vector<Gfx::ShareableBitmap>& bitmaps, Vector<u32>& durations)
 {
     VERIFY(bitmaps.size() == 0);
     VERIFY(durations.size() == 0);
@@ -54,7 +71,7 @@ static void decode_image_to_details(Core::AnonymousBuffer const& encoded_buffer,
     }
     is_animated = decoder->is_animated();
     loop_count = decoder->loop_count();
-    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, bitmaps, durations);
+    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, ideal_size, bitmaps, durations);
 }
 
 Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_image(Core::AnonymousBuffer const& encoded_buffer, Optional<DeprecatedString> const& mime_type)
@@ -68,8 +85,28 @@ Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_i
     u32 loop_count = 0;
     Vector<Gfx::ShareableBitmap> bitmaps;
     Vector<u32> durations;
-    decode_image_to_details(encoded_buffer, mime_type, is_animated, loop_count, bitmaps, durations);
+    decode_image_to_details(encoded_buffer, mime_type, {}, is_animated, loop_count, bitmaps, durations);
     return { is_animated, loop_count, bitmaps, durations };
 }
 
+void ConnectionFromClient::start_decoding_image(i64 image_id, Core::AnonymousBuffer const& encoded_buffer, Optional<Gfx::IntSize> const& ideal_size, Optional<DeprecatedString> const& mime_type)
+{
+    if (!encoded_buffer.is_valid()) {
+        dbgln_if(IMAGE_DECODER_DEBUG, "Encoded data is invalid");
+        async_did_fail_to_decode_image(image_id);
+        return;
+    }
+
+    bool is_animated = false;
+    u32 loop_count = 0;
+    Vector<Gfx::ShareableBitmap> bitmaps;
+    Vector<u32> durations;
+    decode_image_to_details(encoded_buffer, mime_type, ideal_size, is_animated, loop_count, bitmaps, durations);
+    if (bitmaps.is_empty()) {
+        async_did_fail_to_decode_image(image_id);
+        return;
+    }
+    async_did_decode_image(image_id, is_animated, loop_count, move(bitmaps), move(durations));
+}
+
 }
@@ -27,6 +27,7 @@ private:
     explicit ConnectionFromClient(NonnullOwnPtr<Core::LocalSocket>);
 
     virtual Messages::ImageDecoderServer::DecodeImageResponse decode_image(Core::AnonymousBuffer const&, Optional<DeprecatedString> const& mime_type) override;
+    virtual void start_decoding_image(i64 image_id, Core::AnonymousBuffer const&, Optional<Gfx::IntSize> const& ideal_size, Optional<DeprecatedString> const& mime_type) override;
 };
 
 }
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <RequestServer/CachedRequest.h>
+
+namespace RequestServer {
+
+CachedRequest::CachedRequest(ConnectionFromClient& client, URL url, CachedResponse cached_response, NonnullOwnPtr<ResponseStream>&& output_stream)
+    : Request(client, move(output_stream))
+    , m_url(move(url))
+{
+    // NOTE: The client only learns the ID of the request once we have returned it, so the response is sent from the event loop.
+    m_start_timer = Core::Timer::create_single_shot(0, [this, cached_response = move(cached_response)]() mutable {
+        use_cached_response(move(cached_response));
+        send_cached_response_body();
+    }).release_value_but_fixme_should_propagate_errors();
+    m_start_timer->start();
+}
+
+NonnullOwnPtr<CachedRequest> CachedRequest::create(ConnectionFromClient& client, URL url, CachedResponse cached_response, NonnullOwnPtr<ResponseStream>&& output_stream)
+{
+    return adopt_own(*new CachedRequest(client, move(url), move(cached_response), move(output_stream)));
+}
+
+}
@@ -8,6 +8,7 @@
 #include <AK/NonnullOwnPtr.h>
 #include <LibCore/Proxy.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/DiskCache.h>
 #include <RequestServer/Protocol.h>
 #include <RequestServer/Request.h>
 #include <RequestServer/RequestClientEndpoint.h>
@@ -26,8 +27,13 @@ ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<Core::LocalSocket> sock
 void ConnectionFromClient::die()
 {
     s_connections.remove(client_id());
-    if (s_connections.is_empty())
+    if (s_connections.is_empty()) {
+        if (auto* disk_cache = DiskCache::the()) {
+            if (auto result = disk_cache->save_index(); result.is_error())
+                dbgln("Failed to save the disk cache index: {}", result.error());
+        }
         Core::EventLoop::current().quit(0);
+    }
 }
 
 Messages::RequestServer::IsSupportedProtocolResponse ConnectionFromClient::is_supported_protocol(DeprecatedString const& protocol)
@@ -0,0 +1,613 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Hex.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/LexicalPath.h>
+#include <AK/QuickSort.h>
+#include <LibCore/DateTime.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <RequestServer/DiskCache.h>
+#include <sys/file.h>
+
+namespace RequestServer {
+
+static constexpr u64 index_version = 2;
+static constexpr int index_save_delay_ms = 1000;
+
+// RFC 9111 section 4.2.2 suggests 10% of the time since the last modification, this caps it to a day.
+static constexpr i64 max_heuristic_freshness_lifetime = 24 * 60 * 60;
+
+static OwnPtr<DiskCache> s_the;
+
+ErrorOr<NonnullOwnPtr<DiskCache>> DiskCache::create(DeprecatedString const& directory, u64 size_limit)
+{
+    TRY(Core::Directory::create(LexicalPath::join(directory, "bodies"sv), Core::Directory::CreateDirectories::Yes));
+
+    // NOTE: Every process keeps the index in memory, and removes body files it does not know about. So two of them
+    //       using the same directory would lose each other's entries, and even remove bodies the other one just stored.
+    auto lock_fd = TRY(Core::System::open(LexicalPath::join(directory, "lock"sv).string(), O_RDWR | O_CREAT | O_CLOEXEC, 0600));
+    if (flock(lock_fd, LOCK_EX | LOCK_NB) < 0) {
+        auto error = errno;
+        (void)Core::System::close(lock_fd);
+        if (error == EWOULDBLOCK)
+            return Error::from_string_literal("The cache directory is in use by another process");
+        return Error::from_errno(error);
+    }
+
+    auto disk_cache = adopt_own(*new DiskCache(directory, size_limit, lock_fd));
+    if (auto result = disk_cache->load_index(); result.is_error()) {
+        dbgln("DiskCache: Failed to load the index, starting out empty: {}", result.error());
+        disk_cache->m_entries.clear();
+        disk_cache->m_body_files.clear();
+        disk_cache->m_size = 0;
+    }
+    disk_cache->remove_unreferenced_body_files();
+    disk_cache->evict_least_recently_used_entries();
+    return disk_cache;
+}
+
+ErrorOr<void> DiskCache::initialize(DeprecatedString const& directory, u64 size_limit)
+{
+    VERIFY(!s_the);
+    s_the = TRY(create(directory, size_limit));
+    return {};
+}
+
+DiskCache* DiskCache::the()
+{
+    return s_the.ptr();
+}
+
+DiskCache::DiskCache(DeprecatedString directory, u64 size_limit, int lock_fd)
+    : m_directory(move(directory))
+    , m_size_limit(size_limit)
+    , m_lock_fd(lock_fd)
+{
+    m_index_save_timer = Core::Timer::create_single_shot(index_save_delay_ms, [this] {
+        if (auto result = save_index(); result.is_error())
+            dbgln("DiskCache: Failed to save the index: {}", result.error());
+    }).release_value_but_fixme_should_propagate_errors();
+}
+
+DiskCache::~DiskCache()
+{
+    (void)Core::System::close(m_lock_fd);
+}
+
+static DeprecatedString cache_key(URL const& url)
+{
+    return url.serialize(URL::ExcludeFragment::Yes);
+}
+
+static Optional<DeprecatedString> request_header(HashMap<DeprecatedString, DeprecatedString> const& request_headers, StringView name)
+{
+    for (auto const& header : request_headers) {
+        if (header.key.equals_ignoring_ascii_case(name))
+            return header.value;
+    }
+    return {};
+}
+
+// https://www.rfc-editor.org/rfc/rfc9111#section-5.2
+struct CacheControl {
+    bool no_store { false };
+    bool no_cache { false };
+    Optional<i64> max_age;
+    Optional<i64> min_fresh;
+};
+
+static CacheControl parse_cache_control(Optional<DeprecatedString> const& value)
+{
+    CacheControl cache_control;
+    if (!value.has_value())
+        return cache_control;
+
+    for (auto directive : value->split_view(',')) {
+        directive = directive.trim_whitespace();
+        auto name = directive;
+        StringView argument;
+        if (auto equals_sign = directive.find('='); equals_sign.has_value()) {
+            name = directive.substring_view(0, *equals_sign).trim_whitespace();
+            argument = directive.substring_view(*equals_sign + 1).trim_whitespace();
+            if (argument.length() >= 2 && argument.starts_with('"') && argument.ends_with('"'))
+                argument = argument.substring_view(1, argument.length() - 2);
+        }
+
+        // NOTE: An invalid delta-seconds value makes the response stale, see RFC 9111 section 1.2.2.
+        auto delta_seconds = [&] {
+            return static_cast<i64>(argument.to_uint<u32>().value_or(0));
+        };
+
+        if (name.equals_ignoring_ascii_case("no-store"sv))
+            cache_control.no_store = true;
+        // NOTE: The qualified form of no-cache (with a list of header names) is treated like the unqualified form.
+        else if (name.equals_ignoring_ascii_case("no-cache"sv))
+            cache_control.no_cache = true;
+        else if (name.equals_ignoring_ascii_case("max-age"sv))
+            cache_control.max_age = delta_seconds();
+        else if (name.equals_ignoring_ascii_case("min-fresh"sv))
+            cache_control.min_fresh = delta_seconds();
+    }
+    return cache_control;
+}
+
+static CacheControl parse_request_cache_control(HashMap<DeprecatedString, DeprecatedString> const& request_headers)
+{
+    auto cache_control = request_header(request_headers, "Cache-Control"sv);
+    if (cache_control.has_value())
+        return parse_cache_control(cache_control);
+
+    // https://www.rfc-editor.org/rfc/rfc9111#section-5.4
+    CacheControl pragma;
+    if (auto value = request_header(request_headers, "Pragma"sv); value.has_value())
+        pragma.no_cache = value->contains("no-cache"sv, CaseSensitivity::CaseInsensitive);
+    return pragma;
+}
+
+// https://www.rfc-editor.org/rfc/rfc9110#section-5.6.7
+static Optional<i64> parse_http_date(DeprecatedString const& value)
+{
+    // FIXME: Support the obsolete RFC 850 and asctime() formats.
+    auto date_time = Core::DateTime::parse("%a, %d %b %Y %T GMT"sv, value);
+    if (!date_time.has_value())
+        return {};
+
+    // NOTE: DateTime::parse() takes the time to be local time, but HTTP dates are always in UTC. So only its fields are used.
+    return UnixDateTime::from_unix_time_parts(date_time->year(), date_time->month(), date_time->day(), date_time->hour(), date_time->minute(), date_time->second(), 0).seconds_since_epoch();
+}
+
+// https://www.rfc-editor.org/rfc/rfc9110#section-15.1
+static bool is_heuristically_cacheable_status(u32 status_code)
+{
+    switch (status_code) {
+    case 200:
+    case 203:
+    case 204:
+    case 300:
+    case 301:
+    case 308:
+    case 404:
+    case 405:
+    case 410:
+    case 414:
+    case 501:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool has_validators(HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers)
+{
+    return response_headers.contains("ETag"sv) || response_headers.contains("Last-Modified"sv);
+}
+
+static Vector<StringView> vary_header_names(HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers)
+{
+    Vector<StringView> names;
+    if (auto vary = response_headers.get("Vary"sv); vary.has_value()) {
+        for (auto name : vary->split_view(','))
+            names.append(name.trim_whitespace());
+    }
+    return names;
+}
+
+// Header fields that are not stored: hop-by-hop ones, which only apply to the connection the response came in on, and
+// cookies, which were already handed to the client with the response and must not be set again by a cached copy of it.
+static bool is_unstored_header(StringView name)
+{
+    return name.is_one_of_ignoring_ascii_case("Connection"sv, "Keep-Alive"sv, "Proxy-Connection"sv, "TE"sv, "Transfer-Encoding"sv, "Upgrade"sv, "Set-Cookie"sv, "Set-Cookie2"sv);
+}
+
+// https://www.rfc-editor.org/rfc/rfc9111#section-4.2.1
+static i64 freshness_lifetime(u32 status_code, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, i64 date)
+{
+    auto cache_control = parse_cache_control(response_headers.get("Cache-Control"sv));
+    if (cache_control.max_age.has_value())
+        return *cache_control.max_age;
+
+    if (auto expires = response_headers.get("Expires"sv); expires.has_value()) {
+        // NOTE: Invalid dates (like "0") are in the past.
+        auto expiration_date = parse_http_date(*expires);
+        if (!expiration_date.has_value())
+            return 0;
+        return max(*expiration_date - date, 0);
+    }
+
+    // https://www.rfc-editor.org/rfc/rfc9111#section-4.2.2
+    if (is_heuristically_cacheable_status(status_code)) {
+        if (auto last_modified = response_headers.get("Last-Modified"sv); last_modified.has_value()) {
+            if (auto last_modified_date = parse_http_date(*last_modified); last_modified_date.has_value())
+                return clamp((date - *last_modified_date) / 10, 0, max_heuristic_freshness_lifetime);
+        }
+    }
+    return 0;
+}
+
+// https://www.rfc-editor.org/rfc/rfc9111#section-4.2.3
+void DiskCache::update_age(Entry& entry, UnixDateTime request_time, UnixDateTime response_time, Optional<DeprecatedString> const& age)
+{
+    entry.response_time = response_time.seconds_since_epoch();
+
+    auto date = entry.response_time;
+    if (auto value = entry.response_headers.get("Date"sv); value.has_value())
+        date = parse_http_date(*value).value_or(date);
+
+    i64 age_value = 0;
+    if (age.has_value())
+        age_value = age->to_uint<u32>().value_or(0);
+
+    auto apparent_age = max(entry.response_time - date, 0);
+    auto response_delay = max(entry.response_time - request_time.seconds_since_epoch(), 0);
+    entry.corrected_initial_age = max(apparent_age, age_value + response_delay);
+    entry.freshness_lifetime = freshness_lifetime(entry.status_code, entry.response_headers, date);
+}
+
+bool DiskCache::is_cacheable_request(DeprecatedString const& method, HashMap<DeprecatedString, DeprecatedString> const& request_headers)
+{
+    if (!method.equals_ignoring_ascii_case("GET"sv))
+        return false;
+
+    // NOTE: Requests that are already conditional, or ask for part of the response, are left to the server.
+    for (auto name : { "If-Match"sv, "If-None-Match"sv, "If-Modified-Since"sv, "If-Unmodified-Since"sv, "If-Range"sv, "Range"sv }) {
+        if (request_header(request_headers, name).has_value())
+            return false;
+    }
+
+    return !parse_request_cache_control(request_headers).no_store;
+}
+
+void DiskCache::add_validators(CachedResponse const& response, HashMap<DeprecatedString, DeprecatedString>& request_headers)
+{
+    if (auto etag = response.response_headers.get("ETag"sv); etag.has_value())
+        request_headers.set("If-None-Match", *etag);
+    if (auto last_modified = response.response_headers.get("Last-Modified"sv); last_modified.has_value())
+        request_headers.set("If-Modified-Since", *last_modified);
+}
+
+// https://www.rfc-editor.org/rfc/rfc9111#section-3
+bool DiskCache::is_storable(u32 status_code, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers)
+{
+    // NOTE: Partial content is not stored, and 304 (Not Modified) responses only update what is stored.
+    if (status_code < 200 || status_code >= 600 || status_code == 206 || status_code == 304)
+        return false;
+
+    auto cache_control = parse_cache_control(response_headers.get("Cache-Control"sv));
+    if (cache_control.no_store)
+        return false;
+
+    for (auto name : vary_header_names(response_headers)) {
+        if (name == "*"sv)
+            return false;
+    }
+
+    // Without a way to tell how long the response stays fresh, or to revalidate it, it could never be used.
+    bool has_explicit_expiration_time = cache_control.max_age.has_value() || response_headers.contains("Expires"sv);
+    if (!has_explicit_expiration_time && !(is_heuristically_cacheable_status(status_code) && has_validators(response_headers)))
+        return false;
+    return true;
+}
+
+Optional<CachedResponse> DiskCache::find(URL const& url, HashMap<DeprecatedString, DeprecatedString> const& request_headers)
+{
+    auto key = cache_key(url);
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return {};
+    auto& entry = it->value;
+
+    // https://www.rfc-editor.org/rfc/rfc9111#section-4.1
+    for (auto name : vary_header_names(entry.response_headers)) {
+        if (request_header(request_headers, name) != entry.vary_request_headers.get(name))
+            return {};
+    }
+
+    // https://www.rfc-editor.org/rfc/rfc9111#section-4.2.3
+    auto now = UnixDateTime::now().seconds_since_epoch();
+    auto current_age = entry.corrected_initial_age + max(now - entry.response_time, 0);
+
+    auto response_cache_control = parse_cache_control(entry.response_headers.get("Cache-Control"sv));
+    auto request_cache_control = parse_request_cache_control(request_headers);
+    bool is_fresh = entry.freshness_lifetime > current_age;
+    if (request_cache_control.max_age.has_value() && current_age > *request_cache_control.max_age)
+        is_fresh = false;
+    if (request_cache_control.min_fresh.has_value() && entry.freshness_lifetime - current_age < *request_cache_control.min_fresh)
+        is_fresh = false;
+
+    bool needs_revalidation = !is_fresh || response_cache_control.no_cache || request_cache_control.no_cache;
+    if (needs_revalidation && !has_validators(entry.response_headers))
+        return {};
+
+    auto body = [&]() -> ErrorOr<ByteBuffer> {
+        auto file = TRY(Core::File::open(body_path(entry.body_digest), Core::File::OpenMode::Read));
+        return file->read_until_eof();
+    }();
+    if (body.is_error() || body.value().size() != entry.body_size) {
+        dbgln("DiskCache: Dropping {}, its body could not be read", key);
+        remove_entry(key);
+        schedule_index_save();
+        return {};
+    }
+
+    entry.last_used = m_next_use++;
+    schedule_index_save();
+
+    CachedResponse response {
+        .status_code = entry.status_code,
+        .response_headers = entry.response_headers,
+        .body = body.release_value(),
+        .needs_revalidation = needs_revalidation,
+    };
+    response.response_headers.set("Age", DeprecatedString::number(current_age));
+    return response;
+}
+
+void DiskCache::store(CacheableRequest const& request, u32 status_code, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, ReadonlyBytes body, UnixDateTime response_time)
+{
+    if (!is_storable(status_code, response_headers) || body.size() > max_body_size())
+        return;
+
+    auto digest = encode_hex(Crypto::Hash::SHA256::hash(body).bytes());
+    if (!m_body_files.contains(digest)) {
+        if (auto result = write_body_file(digest, body); result.is_error()) {
+            dbgln("DiskCache: Failed to store the body of {}: {}", request.url, result.error());
+            return;
+        }
+    }
+
+    Entry entry;
+    entry.status_code = status_code;
+    for (auto const& header : response_headers) {
+        if (!is_unstored_header(header.key))
+            entry.response_headers.set(header.key, header.value);
+    }
+    for (auto name : vary_header_names(response_headers)) {
+        if (auto value = request_header(request.request_headers, name); value.has_value())
+            entry.vary_request_headers.set(name, value.release_value());
+    }
+    entry.body_digest = digest;
+    entry.body_size = body.size();
+
+    update_age(entry, request.request_time, response_time, response_headers.get("Age"sv));
+    entry.last_used = m_next_use++;
+
+    // NOTE: Add the new reference to the body first, in case the old entry had the same one.
+    auto key = cache_key(request.url);
+    add_body_reference(digest, body.size());
+    remove_entry(key);
+    m_entries.set(key, move(entry));
+
+    evict_least_recently_used_entries();
+    schedule_index_save();
+}
+
+Optional<CachedResponse> DiskCache::update_after_revalidation(CacheableRequest const& request, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, UnixDateTime response_time)
+{
+    auto key = cache_key(request.url);
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return {};
+    auto& entry = it->value;
+
+    // NOTE: The stored body stays the same, so its length does too.
+    for (auto const& header : response_headers) {
+        if (!is_unstored_header(header.key) && !header.key.equals_ignoring_ascii_case("Content-Length"sv))
+            entry.response_headers.set(header.key, header.value);
+    }
+
+    update_age(entry, request.request_time, response_time, response_headers.get("Age"sv));
+    schedule_index_save();
+
+    // NOTE: The revalidated request was made by the cache, so the response it returns is fresh enough for it.
+    auto response = find(request.url, request.request_headers);
+    if (!response.has_value())
+        return {};
+    response->needs_revalidation = false;
+    return response;
+}
+
+void DiskCache::invalidate(URL const& url)
+{
+    auto key = cache_key(url);
+    if (!m_entries.contains(key))
+        return;
+    remove_entry(key);
+    schedule_index_save();
+}
+
+DeprecatedString DiskCache::body_path(StringView digest) const
+{
+    return LexicalPath::join(m_directory, "bodies"sv, digest).string();
+}
+
+ErrorOr<void> DiskCache::write_body_file(StringView digest, ReadonlyBytes body)
+{
+    // NOTE: The body is written to a temporary file first, so there never is a partially written body under its digest.
+    auto path = body_path(digest);
+    auto temporary_path = DeprecatedString::formatted("{}.tmp", path);
+    {
+        auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate, 0600));
+        TRY(file->write_until_depleted(body));
+    }
+    TRY(Core::System::rename(temporary_path, path));
+    return {};
+}
+
+void DiskCache::add_body_reference(StringView digest, u64 size)
+{
+    auto& body_file = m_body_files.ensure(digest, [&] {
+        m_size += size;
+        return BodyFile { .size = size, .reference_count = 0 };
+    });
+    ++body_file.reference_count;
+}
+
+void DiskCache::remove_body_reference(StringView digest)
+{
+    auto it = m_body_files.find(digest);
+    VERIFY(it != m_body_files.end());
+    if (--it->value.reference_count > 0)
+        return;
+
+    m_size -= it->value.size;
+    if (auto result = Core::System::unlink(body_path(digest)); result.is_error())
+        dbgln("DiskCache: Failed to remove body {}: {}", digest, result.error());
+    m_body_files.remove(it);
+}
+
+void DiskCache::remove_entry(DeprecatedString const& key)
+{
+    auto entry = m_entries.take(key);
+    if (entry.has_value())
+        remove_body_reference(entry->body_digest);
+}
+
+void DiskCache::evict_least_recently_used_entries()
+{
+    if (m_size <= m_size_limit)
+        return;
+
+    struct Use {
+        DeprecatedString key;
+        u64 last_used { 0 };
+    };
+    Vector<Use> uses;
+    uses.ensure_capacity(m_entries.size());
+    for (auto const& it : m_entries)
+        uses.append({ it.key, it.value.last_used });
+    quick_sort(uses, [](auto const& a, auto const& b) { return a.last_used < b.last_used; });
+
+    for (auto const& use : uses) {
+        if (m_size <= m_size_limit)
+            break;
+        remove_entry(use.key);
+    }
+}
+
+void DiskCache::schedule_index_save()
+{
+    if (!m_index_save_timer->is_active())
+        m_index_save_timer->start();
+}
+
+static JsonObject headers_to_json(HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& headers)
+{
+    JsonObject object;
+    for (auto const& header : headers)
+        object.set(header.key, header.value);
+    return object;
+}
+
+static HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> headers_from_json(Optional<JsonObject const&> object)
+{
+    HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> headers;
+    if (!object.has_value())
+        return headers;
+    object->for_each_member([&](auto& name, auto& value) {
+        if (value.is_string())
+            headers.set(name, value.as_string());
+    });
+    return headers;
+}
+
+ErrorOr<void> DiskCache::save_index()
+{
+    m_index_save_timer->stop();
+
+    JsonObject entries;
+    for (auto const& it : m_entries) {
+        auto const& entry = it.value;
+        JsonObject object;
+        object.set("status_code", entry.status_code);
+        object.set("response_headers", headers_to_json(entry.response_headers));
+        object.set("vary_request_headers", headers_to_json(entry.vary_request_headers));
+        object.set("body_digest", entry.body_digest);
+        object.set("body_size", entry.body_size);
+        object.set("response_time", entry.response_time);
+        object.set("corrected_initial_age", entry.corrected_initial_age);
+        object.set("freshness_lifetime", entry.freshness_lifetime);
+        object.set("last_used", entry.last_used);
+        entries.set(it.key, move(object));
+    }
+
+    JsonObject index;
+    index.set("version", index_version);
+    index.set("entries", move(entries));
+
+    auto path = LexicalPath::join(m_directory, "index.json"sv).string();
+    auto temporary_path = DeprecatedString::formatted("{}.tmp", path);
+    {
+        auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate, 0600));
+        TRY(file->write_until_depleted(index.to_deprecated_string().bytes()));
+    }
+    TRY(Core::System::rename(temporary_path, path));
+    return {};
+}
+
+ErrorOr<void> DiskCache::load_index()
+{
+    auto path = LexicalPath::join(m_directory, "index.json"sv).string();
+    auto file_or_error = Core::File::open(path, Core::File::OpenMode::Read);
+    if (file_or_error.is_error() && file_or_error.error().is_errno() && file_or_error.error().code() == ENOENT)
+        return {};
+    auto file = TRY(move(file_or_error));
+    auto json = TRY(JsonValue::from_string(TRY(file->read_until_eof())));
+    if (!json.is_object())
+        return Error::from_string_literal("The index is not a JSON object");
+    auto const& index = json.as_object();
+    if (index.get_u64("version"sv) != index_version)
+        return Error::from_string_literal("The index has an unsupported version");
+
+    auto entries = index.get_object("entries"sv);
+    if (!entries.has_value())
+        return {};
+
+    entries->for_each_member([&](auto& key, auto& value) {
+        if (!value.is_object())
+            return;
+        auto const& object = value.as_object();
+        auto body_digest = object.get_deprecated_string("body_digest"sv);
+        if (!body_digest.has_value())
+            return;
+
+        Entry entry;
+        entry.status_code = object.get_u32("status_code"sv).value_or(0);
+        entry.response_headers = headers_from_json(object.get_object("response_headers"sv));
+        entry.vary_request_headers = headers_from_json(object.get_object("vary_request_headers"sv));
+        entry.body_digest = body_digest.release_value();
+        entry.body_size = object.get_u64("body_size"sv).value_or(0);
+        entry.response_time = object.get_i64("response_time"sv).value_or(0);
+        entry.corrected_initial_age = object.get_i64("corrected_initial_age"sv).value_or(0);
+        entry.freshness_lifetime = object.get_i64("freshness_lifetime"sv).value_or(0);
+        entry.last_used = object.get_u64("last_used"sv).value_or(0);
+
+        m_next_use = max(m_next_use, entry.last_used + 1);
+        add_body_reference(entry.body_digest, entry.body_size);
+        m_entries.set(key, move(entry));
+    });
+    return {};
+}
+
+void DiskCache::remove_unreferenced_body_files()
+{
+    // NOTE: These are left behind if RequestServer went away before saving the index, or while writing a body.
+    auto bodies_path = LexicalPath::join(m_directory, "bodies"sv).string();
+    auto result = Core::Directory::for_each_entry(bodies_path, Core::DirIterator::SkipParentAndBaseDir, [&](auto const& entry, auto const&) -> ErrorOr<IterationDecision> {
+        if (!m_body_files.contains(entry.name))
+            TRY(Core::System::unlink(LexicalPath::join(bodies_path, entry.name).string()));
+        return IterationDecision::Continue;
+    });
+    if (result.is_error())
+        dbgln("DiskCache: Failed to remove unreferenced bodies: {}", result.error());
+}
+
+}
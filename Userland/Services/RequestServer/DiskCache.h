@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/DeprecatedString.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/Time.h>
+#include <AK/URL.h>
+#include <LibCore/Timer.h>
+
+namespace RequestServer {
+
+// A response from the disk cache, as returned by DiskCache::find().
+struct CachedResponse {
+    u32 status_code { 0 };
+    HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> response_headers;
+    ByteBuffer body;
+
+    // The response is stale (or must not be used without asking the server), so it has to be revalidated first.
+    bool needs_revalidation { false };
+};
+
+// A request that goes to the network, and whose response may be stored in the disk cache.
+struct CacheableRequest {
+    URL url;
+    HashMap<DeprecatedString, DeprecatedString> request_headers;
+    UnixDateTime request_time;
+
+    // The cached response this request revalidates, if it is a conditional request made on behalf of the cache.
+    Optional<CachedResponse> revalidated_response;
+};
+
+// An RFC 9111 private cache of HTTP responses, kept on disk so it survives restarts.
+//
+// Response bodies are stored content-addressed, in files named after the SHA-256 digest of their contents, so a
+// body served from several URLs is only stored once. An index maps each URL to its response headers, along with
+// what is needed to compute the response's age. When the bodies grow past the size limit, the least recently
+// used responses are evicted.
+//
+// Only one process can use a cache directory at a time, it is locked for as long as the DiskCache exists.
+class DiskCache {
+    AK_MAKE_NONCOPYABLE(DiskCache);
+    AK_MAKE_NONMOVABLE(DiskCache);
+
+public:
+    static constexpr u64 default_size_limit = 256 * MiB;
+
+    static ErrorOr<NonnullOwnPtr<DiskCache>> create(DeprecatedString const& directory, u64 size_limit = default_size_limit);
+    static ErrorOr<void> initialize(DeprecatedString const& directory, u64 size_limit = default_size_limit);
+
+    ~DiskCache();
+
+    // Returns nullptr if the cache was not initialized.
+    static DiskCache* the();
+
+    // Whether a request may be answered from the cache, and its response stored in it (RFC 9111 section 2).
+    static bool is_cacheable_request(DeprecatedString const& method, HashMap<DeprecatedString, DeprecatedString> const& request_headers);
+
+    // Makes a request conditional on the cached response having changed, using its ETag and Last-Modified headers
+    // (RFC 9111 section 4.3.1).
+    static void add_validators(CachedResponse const&, HashMap<DeprecatedString, DeprecatedString>& request_headers);
+
+    Optional<CachedResponse> find(URL const&, HashMap<DeprecatedString, DeprecatedString> const& request_headers);
+
+    // The limit applies to each body, bodies that are larger are not stored.
+    size_t max_body_size() const { return m_size_limit / 8; }
+
+    static bool is_storable(u32 status_code, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers);
+    void store(CacheableRequest const&, u32 status_code, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, ReadonlyBytes body, UnixDateTime response_time);
+
+    // Updates the cached response with the headers of a 304 (Not Modified) response to its revalidation, and
+    // returns it (RFC 9111 section 4.3.4).
+    Optional<CachedResponse> update_after_revalidation(CacheableRequest const&, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, UnixDateTime response_time);
+
+    void invalidate(URL const&);
+
+    u64 size() const { return m_size; }
+    size_t entry_count() const { return m_entries.size(); }
+
+    ErrorOr<void> save_index();
+
+private:
+    DiskCache(DeprecatedString directory, u64 size_limit, int lock_fd);
+
+    struct Entry {
+        u32 status_code { 0 };
+        HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> response_headers;
+
+        // The values of the request headers named by the Vary response header, as they were for the stored response.
+        HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> vary_request_headers;
+
+        DeprecatedString body_digest;
+        u64 body_size { 0 };
+
+        // See RFC 9111 section 4.2.3.
+        i64 response_time { 0 };
+        i64 corrected_initial_age { 0 };
+        i64 freshness_lifetime { 0 };
+
+        // Entries with a lower value were used less recently.
+        u64 last_used { 0 };
+    };
+
+    struct BodyFile {
+        u64 size { 0 };
+        size_t reference_count { 0 };
+    };
+
+    static void update_age(Entry&, UnixDateTime request_time, UnixDateTime response_time, Optional<DeprecatedString> const& age);
+
+    ErrorOr<void> load_index();
+    void remove_unreferenced_body_files();
+    void schedule_index_save();
+
+    DeprecatedString body_path(StringView digest) const;
+    ErrorOr<void> write_body_file(StringView digest, ReadonlyBytes body);
+    void add_body_reference(StringView digest, u64 size);
+    void remove_body_reference(StringView digest);
+
+    void remove_entry(DeprecatedString const& url);
+    void evict_least_recently_used_entries();
+
+    DeprecatedString m_directory;
+    u64 m_size_limit { 0 };
+    int m_lock_fd { -1 };
+
+    HashMap<DeprecatedString, Entry> m_entries;
+    HashMap<DeprecatedString, BodyFile> m_body_files;
+    u64 m_size { 0 };
+    u64 m_next_use { 1 };
+
+    RefPtr<Core::Timer> m_index_save_timer;
+};
+
+}
@@ -13,9 +13,12 @@
 #include <AK/Optional.h>
 #include <AK/OwnPtr.h>
 #include <AK/Types.h>
+#include <AK/Time.h>
 #include <LibHTTP/HttpRequest.h>
+#include <RequestServer/CachedRequest.h>
 #include <RequestServer/ConnectionCache.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/DiskCache.h>
 #include <RequestServer/Request.h>
 
 namespace RequestServer::Detail {
@@ -90,17 +93,43 @@ OwnPtr<Request> start_request(TBadgedProtocol&& protocol, ConnectionFromClient&
     else
         request.set_method(HTTP::HttpRequest::Method::GET);
     request.set_url(url);
-    request.set_headers(headers);
+
+    auto output_stream = make<ResponseStream>(MUST(Core::File::adopt_fd(pipe_result.value().write_fd, Core::File::OpenMode::Write)));
+
+    // Answer the request from the disk cache if we can. If the cached response has to be revalidated first, the request
+    // is made conditional, and the cached response is used if the server answers with 304 (Not Modified).
+    auto* disk_cache = DiskCache::the();
+    auto request_headers = headers;
+    Optional<CacheableRequest> cacheable_request;
+    if (disk_cache && DiskCache::is_cacheable_request(method, headers)) {
+        auto cached_response = disk_cache->find(url, headers);
+        if (cached_response.has_value() && !cached_response->needs_revalidation) {
+            auto cached_request = CachedRequest::create(client, url, cached_response.release_value(), move(output_stream));
+            cached_request->set_request_fd(pipe_result.value().read_fd);
+            return cached_request;
+        }
+        if (cached_response.has_value())
+            DiskCache::add_validators(*cached_response, request_headers);
+        cacheable_request = CacheableRequest { url, headers, UnixDateTime::now(), move(cached_response) };
+    } else if (disk_cache) {
+        // https://www.rfc-editor.org/rfc/rfc9111#section-4.4
+        auto request_method = request.method();
+        bool is_safe_method = request_method == HTTP::HttpRequest::Method::GET || request_method == HTTP::HttpRequest::Method::HEAD || request_method == HTTP::HttpRequest::Method::OPTIONS || request_method == HTTP::HttpRequest::Method::TRACE;
+        if (!is_safe_method)
+            disk_cache->invalidate(url);
+    }
+    request.set_headers(request_headers);
 
     auto allocated_body_result = ByteBuffer::copy(body);
     if (allocated_body_result.is_error())
         return {};
     request.set_body(allocated_body_result.release_value());
 
-    auto output_stream = MUST(Core::File::adopt_fd(pipe_result.value().write_fd, Core::File::OpenMode::Write));
     auto job = TJob::construct(move(request), *output_stream);
     auto protocol_request = TRequest::create_with_job(forward<TBadgedProtocol>(protocol), client, (TJob&)*job, move(output_stream));
     protocol_request->set_request_fd(pipe_result.value().read_fd);
+    if (cacheable_request.has_value())
+        protocol_request->set_cacheable_request(cacheable_request.release_value());
 
     if constexpr (IsSame<typename TBadgedProtocol::Type, HttpsProtocol>)
         ConnectionCache::get_or_create_connection(ConnectionCache::g_tls_connection_cache, url, *job, proxy_data);
@@ -12,7 +12,7 @@ namespace RequestServer {
 // FIXME: What about rollover?
 static i32 s_next_id = 1;
 
-Request::Request(ConnectionFromClient& client, NonnullOwnPtr<Core::File>&& output_stream)
+Request::Request(ConnectionFromClient& client, NonnullOwnPtr<ResponseStream>&& output_stream)
     : m_client(client)
     , m_id(s_next_id++)
     , m_output_stream(move(output_stream))
@@ -24,18 +24,94 @@ void Request::stop()
     m_client.did_finish_request({}, *this, false);
 }
 
+void Request::set_cacheable_request(CacheableRequest cacheable_request)
+{
+    m_cacheable_request = move(cacheable_request);
+}
+
+void Request::set_status_code(u32 status_code)
+{
+    // NOTE: Once a cached response is used, the status code of the 304 (Not Modified) response that allowed it is ignored.
+    if (m_uses_cached_response)
+        return;
+    m_status_code = status_code;
+}
+
 void Request::set_response_headers(HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers)
 {
+    if (m_uses_cached_response)
+        return;
+
+    // NOTE: The headers are set again once the request finishes, by then we have already decided what to do.
+    auto* disk_cache = DiskCache::the();
+    if (disk_cache && m_cacheable_request.has_value() && !m_response_time.has_value()) {
+        m_response_time = UnixDateTime::now();
+        if (m_status_code == 304u && m_cacheable_request->revalidated_response.has_value()) {
+            if (auto cached_response = disk_cache->update_after_revalidation(*m_cacheable_request, response_headers, *m_response_time); cached_response.has_value()) {
+                use_cached_response(cached_response.release_value());
+                return;
+            }
+        } else if (m_status_code.has_value() && DiskCache::is_storable(*m_status_code, response_headers)) {
+            m_output_stream->start_copying(disk_cache->max_body_size());
+        }
+    }
+
     m_response_headers = response_headers;
     m_client.did_receive_headers({}, *this);
 }
 
+void Request::use_cached_response(CachedResponse cached_response)
+{
+    m_uses_cached_response = true;
+    m_output_stream->stop_copying();
+    m_status_code = cached_response.status_code;
+    m_response_headers = move(cached_response.response_headers);
+    m_cached_response_body = move(cached_response.body);
+    m_client.did_receive_headers({}, *this);
+}
+
+void Request::send_cached_response_body()
+{
+    VERIFY(m_uses_cached_response);
+
+    // NOTE: The body may not fit into the pipe all at once, so it is written whenever the client has made room for more.
+    m_cached_response_body_notifier = Core::Notifier::construct(m_output_stream->fd(), Core::Notifier::Type::Write);
+    m_cached_response_body_notifier->on_activation = [this] {
+        auto remaining_body = m_cached_response_body.bytes().slice(m_cached_response_body_offset);
+        auto result = m_output_stream->write_some(remaining_body);
+        if (result.is_error()) {
+            if (result.error().is_errno() && (result.error().code() == EAGAIN || result.error().code() == EINTR))
+                return;
+            dbgln("Request: Failed to send cached response body for {}: {}", url(), result.error());
+            m_cached_response_body_notifier->set_enabled(false);
+            m_client.did_finish_request({}, *this, false);
+            return;
+        }
+
+        m_cached_response_body_offset += result.value();
+        did_progress(m_cached_response_body.size(), m_cached_response_body_offset);
+        if (m_cached_response_body_offset < m_cached_response_body.size())
+            return;
+
+        m_cached_response_body_notifier->set_enabled(false);
+        m_client.did_finish_request({}, *this, true);
+    };
+}
+
 void Request::set_certificate(DeprecatedString, DeprecatedString)
 {
 }
 
 void Request::did_finish(bool success)
 {
+    if (m_uses_cached_response && success)
+        return send_cached_response_body();
+
+    if (auto* disk_cache = DiskCache::the(); disk_cache && success && m_cacheable_request.has_value() && m_status_code.has_value() && m_response_time.has_value()) {
+        if (auto body = m_output_stream->take_copy(); body.has_value())
+            disk_cache->store(*m_cacheable_request, *m_status_code, m_response_headers, *body, *m_response_time);
+    }
+
     m_client.did_finish_request({}, *this, success);
 }
 
@@ -11,7 +11,10 @@
 #include <AK/Optional.h>
 #include <AK/RefCounted.h>
 #include <AK/URL.h>
+#include <LibCore/Notifier.h>
+#include <RequestServer/DiskCache.h>
 #include <RequestServer/Forward.h>
+#include <RequestServer/ResponseStream.h>
 
 namespace RequestServer {
 
@@ -36,14 +39,22 @@ public:
 
     void did_finish(bool success);
     void did_progress(Optional<u32> total_size, u32 downloaded_size);
-    void set_status_code(u32 status_code) { m_status_code = status_code; }
+    void set_status_code(u32 status_code);
     void did_request_certificates();
     void set_response_headers(HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const&);
     void set_downloaded_size(size_t size) { m_downloaded_size = size; }
-    Core::File const& output_stream() const { return *m_output_stream; }
+    ResponseStream& output_stream() { return *m_output_stream; }
+
+    // Lets the response be stored in the disk cache, or revalidate a response that is stored in it.
+    void set_cacheable_request(CacheableRequest);
 
 protected:
-    explicit Request(ConnectionFromClient&, NonnullOwnPtr<Core::File>&&);
+    explicit Request(ConnectionFromClient&, NonnullOwnPtr<ResponseStream>&&);
+
+    // Answers the request with a response from the disk cache instead. The headers are sent right away, and the body
+    // once send_cached_response_body() is called.
+    void use_cached_response(CachedResponse);
+    void send_cached_response_body();
 
 private:
     ConnectionFromClient& m_client;
@@ -52,8 +63,16 @@ private:
     Optional<u32> m_status_code;
     Optional<u32> m_total_size {};
     size_t m_downloaded_size { 0 };
-    NonnullOwnPtr<Core::File> m_output_stream;
+    NonnullOwnPtr<ResponseStream> m_output_stream;
     HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> m_response_headers;
+
+    Optional<CacheableRequest> m_cacheable_request;
+    Optional<UnixDateTime> m_response_time;
+
+    bool m_uses_cached_response { false };
+    ByteBuffer m_cached_response_body;
+    size_t m_cached_response_body_offset { 0 };
+    RefPtr<Core::Notifier> m_cached_response_body_notifier;
 };
 
 }
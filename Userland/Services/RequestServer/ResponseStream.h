@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/Stream.h>
+#include <LibCore/File.h>
+
+namespace RequestServer {
+
+// The stream protocol jobs write response bodies into. Everything is passed on to the pipe the client reads the
+// response from, and a copy of what went through can be kept for the disk cache.
+class ResponseStream final : public Stream {
+public:
+    explicit ResponseStream(NonnullOwnPtr<Core::File> pipe)
+        : m_pipe(move(pipe))
+    {
+    }
+
+    virtual ErrorOr<Bytes> read_some(Bytes) override { return Error::from_errno(EBADF); }
+
+    virtual ErrorOr<size_t> write_some(ReadonlyBytes bytes) override
+    {
+        auto written = TRY(m_pipe->write_some(bytes));
+        if (m_copy.has_value()) {
+            if (m_copy->size() + written > m_copy_size_limit || m_copy->try_append(bytes.trim(written)).is_error())
+                stop_copying();
+        }
+        return written;
+    }
+
+    virtual bool is_eof() const override { return m_pipe->is_eof(); }
+    virtual bool is_open() const override { return m_pipe->is_open(); }
+    virtual void close() override { m_pipe->close(); }
+
+    int fd() const { return m_pipe->fd(); }
+
+    // Starts keeping a copy of everything written from now on. If it grows past the given size, copying stops.
+    void start_copying(size_t size_limit)
+    {
+        m_copy = ByteBuffer {};
+        m_copy_size_limit = size_limit;
+    }
+    void stop_copying() { m_copy.clear(); }
+    Optional<ByteBuffer> take_copy() { return exchange(m_copy, {}); }
+
+private:
+    NonnullOwnPtr<Core::File> m_pipe;
+    Optional<ByteBuffer> m_copy;
+    size_t m_copy_size_limit { 0 };
+};
+
+}
@@ -392,6 +392,10 @@ void ConnectionFromClient::debug_request(DeprecatedString const& request, Deprec
         Web::Bindings::main_thread_vm().heap().collect_garbage(JS::Heap::CollectionType::CollectGarbage, true);
     }
 
+    if (request == "dump-gc-statistics") {
+        Web::Bindings::main_thread_vm().heap().garbage_collection_statistics().dump();
+    }
+
     if (request == "set-line-box-borders") {
         bool state = argument == "on";
         m_page_host->set_should_show_line_box_borders(state);
@@ -665,6 +669,11 @@ Messages::WebContentServer::DumpTextResponse ConnectionFromClient::dump_text()
     return document->body()->inner_text();
 }
 
+Messages::WebContentServer::BenchmarkPaintingResponse ConnectionFromClient::benchmark_painting(u32 iterations)
+{
+    return m_page_host->benchmark_painting(iterations);
+}
+
 void ConnectionFromClient::set_content_filters(Vector<String> const& filters)
 {
     Web::ContentFilter::the().set_patterns(filters).release_value_but_fixme_should_propagate_errors();
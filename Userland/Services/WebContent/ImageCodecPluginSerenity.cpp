@@ -13,16 +13,19 @@ namespace WebContent {
 ImageCodecPluginSerenity::ImageCodecPluginSerenity() = default;
 ImageCodecPluginSerenity::~ImageCodecPluginSerenity() = default;
 
-Optional<Web::Platform::DecodedImage> ImageCodecPluginSerenity::decode_image(ReadonlyBytes bytes)
+static ImageDecoderClient::Client& ensure_client(RefPtr<ImageDecoderClient::Client>& client)
 {
-    if (!m_client) {
-        m_client = ImageDecoderClient::Client::try_create().release_value_but_fixme_should_propagate_errors();
-        m_client->on_death = [&] {
-            m_client = nullptr;
+    if (!client) {
+        client = ImageDecoderClient::Client::try_create().release_value_but_fixme_should_propagate_errors();
+        client->on_death = [&client] {
+            client = nullptr;
         };
     }
+    return *client;
+}
 
-    auto result_or_empty = m_client->decode_image(bytes);
+static Optional<Web::Platform::DecodedImage> to_decoded_image(Optional<ImageDecoderClient::DecodedImage> result_or_empty)
+{
     if (!result_or_empty.has_value())
         return {};
     auto result = result_or_empty.release_value();
@@ -39,4 +42,29 @@ Optional<Web::Platform::DecodedImage> ImageCodecPluginSerenity::decode_image(Rea
     return decoded_image;
 }
 
+Optional<Web::Platform::DecodedImage> ImageCodecPluginSerenity::decode_image(ReadonlyBytes bytes)
+{
+    return to_decoded_image(ensure_client(m_client).decode_image(bytes));
+}
+
+ImageDecoderClient::Client& ImageCodecPluginSerenity::client_for_next_decode()
+{
+    // Start up the decoders one at a time, as they are needed: a new one is only used while all others are busy.
+    RefPtr<ImageDecoderClient::Client>* least_busy_client = nullptr;
+    for (auto& client : m_decoder_pool) {
+        if (!client || client->pending_decode_count() == 0)
+            return ensure_client(client);
+        if (!least_busy_client || client->pending_decode_count() < (*least_busy_client)->pending_decode_count())
+            least_busy_client = &client;
+    }
+    return ensure_client(*least_busy_client);
+}
+
+void ImageCodecPluginSerenity::start_decoding_image(ReadonlyBytes bytes, Optional<Gfx::IntSize> ideal_size, Function<void(Optional<Web::Platform::DecodedImage>)> on_complete)
+{
+    client_for_next_decode().start_decoding_image(bytes, ideal_size, [on_complete = move(on_complete)](auto result) {
+        on_complete(to_decoded_image(move(result)));
+    });
+}
+
 }
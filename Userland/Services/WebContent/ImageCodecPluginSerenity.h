@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/RefPtr.h>
 #include <LibWeb/Platform/ImageCodecPlugin.h>
 
@@ -22,9 +23,16 @@ public:
     virtual ~ImageCodecPluginSerenity() override;
 
     virtual Optional<Web::Platform::DecodedImage> decode_image(ReadonlyBytes) override;
+    virtual void start_decoding_image(ReadonlyBytes, Optional<Gfx::IntSize> ideal_size, Function<void(Optional<Web::Platform::DecodedImage>)> on_complete) override;
 
 private:
+    ImageDecoderClient::Client& client_for_next_decode();
+
     RefPtr<ImageDecoderClient::Client> m_client;
+
+    // Every connection gets its own ImageDecoder process, so images can be decoded in parallel.
+    static constexpr size_t decoder_pool_size = 4;
+    Array<RefPtr<ImageDecoderClient::Client>, decoder_pool_size> m_decoder_pool;
 };
 
 }
@@ -9,10 +9,13 @@
 #include "ConnectionFromClient.h"
 #include <LibGfx/Painter.h>
 #include <LibGfx/ShareableBitmap.h>
+#include <LibCore/ElapsedTimer.h>
 #include <LibGfx/SystemTheme.h>
 #include <LibWeb/Cookie/ParsedCookie.h>
 #include <LibWeb/HTML/BrowsingContext.h>
+#include <LibWeb/HTML/DecodedImageCache.h>
 #include <LibWeb/Layout/Viewport.h>
+#include <LibWeb/Painting/PaintContext.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Platform/Timer.h>
 #include <WebContent/WebContentClientEndpoint.h>
@@ -23,6 +26,7 @@ namespace WebContent {
 PageHost::PageHost(ConnectionFromClient& client)
     : m_client(client)
     , m_page(make<Web::Page>(*this))
+    , m_tile_cache(Web::Painting::TileCache::create())
 {
     setup_palette();
     m_invalidation_coalescing_timer = Web::Platform::Timer::create_single_shot(0, [this] {
@@ -36,6 +40,22 @@ PageHost::~PageHost() = default;
 void PageHost::set_has_focus(bool has_focus)
 {
     m_has_focus = has_focus;
+    m_cached_display_list.clear();
+    m_tile_cache->invalidate_all();
+}
+
+void PageHost::set_device_pixels_per_css_pixel(float device_pixels_per_css_pixel)
+{
+    m_device_pixels_per_css_pixel = device_pixels_per_css_pixel;
+    m_cached_display_list.clear();
+    m_tile_cache->clear();
+}
+
+void PageHost::set_should_show_line_box_borders(bool should_show_line_box_borders)
+{
+    m_should_show_line_box_borders = should_show_line_box_borders;
+    m_cached_display_list.clear();
+    m_tile_cache->invalidate_all();
 }
 
 void PageHost::setup_palette()
@@ -63,6 +83,8 @@ Gfx::Palette PageHost::palette() const
 void PageHost::set_palette_impl(Gfx::PaletteImpl& impl)
 {
     m_palette_impl = impl;
+    m_cached_display_list.clear();
+    m_tile_cache->invalidate_all();
     if (auto* document = page().top_level_browsing_context().active_document())
         document->invalidate_style();
 }
@@ -70,6 +92,8 @@ void PageHost::set_palette_impl(Gfx::PaletteImpl& impl)
 void PageHost::set_preferred_color_scheme(Web::CSS::PreferredColorScheme color_scheme)
 {
     m_preferred_color_scheme = color_scheme;
+    m_cached_display_list.clear();
+    m_tile_cache->invalidate_all();
     if (auto* document = page().top_level_browsing_context().active_document())
         document->invalidate_style();
 }
@@ -118,28 +142,128 @@ Gfx::Color PageHost::background_color() const
 
 void PageHost::paint(Web::DevicePixelRect const& content_rect, Gfx::Bitmap& target)
 {
-    Gfx::Painter painter(target);
-    Gfx::IntRect bitmap_rect { {}, content_rect.size().to_type<int>() };
-
     if (auto* document = page().top_level_browsing_context().active_document())
         document->update_layout();
 
     auto background_color = this->background_color();
-
     if (background_color.alpha() < 255)
-        painter.clear_rect(bitmap_rect, palette().base());
-    painter.fill_rect(bitmap_rect, background_color);
+        background_color = palette().base().blend(background_color);
 
     auto* layout_root = this->layout_root();
     if (!layout_root) {
+        Gfx::Painter painter(target);
+        painter.fill_rect({ {}, content_rect.size().to_type<int>() }, background_color);
         return;
     }
 
-    Web::PaintContext context(painter, palette(), device_pixels_per_css_pixel());
+    if (!can_replay_display_list(content_rect))
+        record_display_list(*layout_root, content_rect);
+
+    auto const& cached_display_list = *m_cached_display_list;
+    m_tile_cache->paint({
+                            .display_list = cached_display_list.display_list,
+                            .display_list_viewport_rect = cached_display_list.viewport_rect,
+                            .depends_on_viewport_location = cached_display_list.has_scroll_dependent_content || cached_display_list.display_list.has_viewport_relative_content(),
+                            .viewport_rect = content_rect,
+                            .background_color = background_color,
+                        },
+        target);
+}
+
+bool PageHost::can_replay_display_list(Web::DevicePixelRect const& content_rect) const
+{
+    if (!m_cached_display_list.has_value())
+        return false;
+    auto const& cached_display_list = *m_cached_display_list;
+    if (cached_display_list.viewport_rect == content_rect)
+        return true;
+    if (cached_display_list.has_scroll_dependent_content || cached_display_list.viewport_rect.size() != content_rect.size())
+        return false;
+    return cached_display_list.recorded_rect.contains(Web::Painting::TileCache::tile_aligned_rect(content_rect));
+}
+
+void PageHost::record_display_list(Web::Layout::Viewport& layout_root, Web::DevicePixelRect const& content_rect)
+{
+    // Record one viewport height above and below the viewport (and half a width on either side),
+    // so that the display list can be replayed while scrolling around a bit. It has to cover all
+    // tiles that are (partially) visible, as those get rasterized from it in their entirety.
+    auto recorded_rect = content_rect.inflated(content_rect.width(), content_rect.height() * 2).united(Web::Painting::TileCache::tile_aligned_rect(content_rect));
+
+    m_cached_display_list = CachedDisplayList {
+        .display_list = {},
+        .viewport_rect = content_rect,
+        .recorded_rect = recorded_rect,
+        .has_scroll_dependent_content = false,
+    };
+
+    // NOTE: Decoded images that are not used while recording this display list are not needed to paint it either.
+    Web::HTML::DecodedImageCache::the().did_start_painting();
+
+    Web::Painting::RecordingPainter recording_painter(m_cached_display_list->display_list, recorded_rect.translated(-content_rect.location()).to_type<int>());
+    Web::PaintContext context(recording_painter, palette(), device_pixels_per_css_pixel());
     context.set_should_show_line_box_borders(m_should_show_line_box_borders);
     context.set_device_viewport_rect(content_rect);
     context.set_has_focus(m_has_focus);
-    layout_root->paint_all_phases(context);
+    layout_root.paint_all_phases(context);
+
+    m_cached_display_list->has_scroll_dependent_content = context.has_scroll_dependent_content();
+}
+
+DeprecatedString PageHost::benchmark_painting(u32 iterations)
+{
+    auto* document = page().top_level_browsing_context().active_document();
+    if (!document)
+        return "(no DOM tree)";
+    document->update_layout();
+    auto* layout_root = this->layout_root();
+    if (!layout_root)
+        return "(no layout tree)";
+
+    auto content_rect = page().enclosing_device_rect(page().top_level_browsing_context().viewport_rect());
+    auto bitmap_or_error = Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, content_rect.size().to_type<int>());
+    if (bitmap_or_error.is_error())
+        return DeprecatedString::formatted("(unable to allocate bitmap: {})", bitmap_or_error.error());
+    auto bitmap = bitmap_or_error.release_value();
+
+    // NOTE: This uses a tile cache of its own, so the tiles of the page are left alone.
+    auto tile_cache = Web::Painting::TileCache::create();
+
+    Duration record_time;
+    Duration replay_time;
+    Duration tiled_replay_time;
+    for (u32 i = 0; i < iterations; ++i) {
+        auto timer = Core::ElapsedTimer::start_new();
+        record_display_list(*layout_root, content_rect);
+        record_time += timer.elapsed_time();
+
+        timer.start();
+        m_cached_display_list->display_list.execute(*bitmap);
+        replay_time += timer.elapsed_time();
+
+        tile_cache->invalidate_all();
+        timer.start();
+        tile_cache->paint({
+                              .display_list = m_cached_display_list->display_list,
+                              .display_list_viewport_rect = content_rect,
+                              .depends_on_viewport_location = false,
+                              .viewport_rect = content_rect,
+                              .background_color = background_color(),
+                          },
+            *bitmap);
+        tiled_replay_time += timer.elapsed_time();
+    }
+
+    auto average_milliseconds = [&](Duration total) {
+        return static_cast<double>(total.to_microseconds()) / iterations / 1000.0;
+    };
+
+    StringBuilder builder;
+    builder.appendff("Painting commands: {}\n", m_cached_display_list->display_list.command_count());
+    builder.appendff("Iterations: {}\n", iterations);
+    builder.appendff("Record: {:.3} ms on average\n", average_milliseconds(record_time));
+    builder.appendff("Replay: {:.3} ms on average\n", average_milliseconds(replay_time));
+    builder.appendff("Replay into {} tiles on {} threads: {:.3} ms on average\n", tile_cache->last_rasterized_tile_count(), tile_cache->thread_count(), average_milliseconds(tiled_replay_time));
+    return builder.to_deprecated_string();
 }
 
 void PageHost::set_viewport_rect(Web::DevicePixelRect const& rect)
@@ -149,11 +273,27 @@ void PageHost::set_viewport_rect(Web::DevicePixelRect const& rect)
 
 void PageHost::page_did_invalidate(Web::CSSPixelRect const& content_rect)
 {
+    // NOTE: The cached display list (and the tile cache) cover more than the viewport, so anything invalidated might be in it.
+    m_cached_display_list.clear();
+    m_tile_cache->invalidate(page().enclosing_device_rect(content_rect));
+    if (!page().top_level_browsing_context().viewport_rect().intersects(content_rect))
+        return;
+
     m_invalidation_rect = m_invalidation_rect.united(page().enclosing_device_rect(content_rect));
     if (!m_invalidation_coalescing_timer->is_active())
         m_invalidation_coalescing_timer->start();
 }
 
+void PageHost::page_did_invalidate_all()
+{
+    m_cached_display_list.clear();
+    m_tile_cache->invalidate_all();
+
+    m_invalidation_rect = page().enclosing_device_rect(page().top_level_browsing_context().viewport_rect());
+    if (!m_invalidation_coalescing_timer->is_active())
+        m_invalidation_coalescing_timer->start();
+}
+
 void PageHost::page_did_change_selection()
 {
     m_client.async_did_change_selection();
@@ -166,6 +306,8 @@ void PageHost::page_did_request_cursor_change(Gfx::StandardCursor cursor)
 
 void PageHost::page_did_layout()
 {
+    m_cached_display_list.clear();
+    m_tile_cache->invalidate_all();
     auto* layout_root = this->layout_root();
     VERIFY(layout_root);
     if (layout_root->paintable_box()->has_overflow())
@@ -9,6 +9,8 @@
 
 #include <LibGfx/Rect.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/TileCache.h>
 #include <LibWeb/PixelUnits.h>
 #include <WebContent/Forward.h>
 
@@ -32,9 +34,9 @@ public:
     void set_palette_impl(Gfx::PaletteImpl&);
     void set_viewport_rect(Web::DevicePixelRect const&);
     void set_screen_rects(Vector<Gfx::IntRect, 4> const& rects, size_t main_screen_index) { m_screen_rect = rects[main_screen_index].to_type<Web::DevicePixels>(); }
-    void set_device_pixels_per_css_pixel(float device_pixels_per_css_pixel) { m_device_pixels_per_css_pixel = device_pixels_per_css_pixel; }
+    void set_device_pixels_per_css_pixel(float device_pixels_per_css_pixel);
     void set_preferred_color_scheme(Web::CSS::PreferredColorScheme);
-    void set_should_show_line_box_borders(bool b) { m_should_show_line_box_borders = b; }
+    void set_should_show_line_box_borders(bool);
     void set_has_focus(bool);
     void set_is_scripting_enabled(bool);
     void set_window_position(Web::DevicePixelPoint);
@@ -55,6 +57,8 @@ public:
 
     [[nodiscard]] Gfx::Color background_color() const;
 
+    DeprecatedString benchmark_painting(u32 iterations);
+
 private:
     // ^PageClient
     virtual bool is_connection_open() const override;
@@ -63,6 +67,7 @@ private:
     virtual double device_pixels_per_css_pixel() const override { return m_device_pixels_per_css_pixel; }
     virtual Web::CSS::PreferredColorScheme preferred_color_scheme() const override { return m_preferred_color_scheme; }
     virtual void page_did_invalidate(Web::CSSPixelRect const&) override;
+    virtual void page_did_invalidate_all() override;
     virtual void page_did_change_selection() override;
     virtual void page_did_request_cursor_change(Gfx::StandardCursor) override;
     virtual void page_did_layout() override;
@@ -115,6 +120,9 @@ private:
     Web::Layout::Viewport* layout_root();
     void setup_palette();
 
+    bool can_replay_display_list(Web::DevicePixelRect const& content_rect) const;
+    void record_display_list(Web::Layout::Viewport&, Web::DevicePixelRect const& content_rect);
+
     ConnectionFromClient& m_client;
     NonnullOwnPtr<Web::Page> m_page;
     RefPtr<Gfx::PaletteImpl> m_palette_impl;
@@ -129,6 +137,19 @@ private:
     Web::CSS::PreferredColorScheme m_preferred_color_scheme { Web::CSS::PreferredColorScheme::Auto };
 
     RefPtr<WebDriverConnection> m_webdriver;
+
+    // The display list from the last paint. It covers more than the viewport it was recorded for, so scrolling
+    // around within recorded_rect only has to replay it (into whichever tiles are stale). It is thrown away
+    // whenever the page is invalidated.
+    struct CachedDisplayList {
+        Web::Painting::DisplayList display_list;
+        Web::DevicePixelRect viewport_rect;
+        Web::DevicePixelRect recorded_rect;
+        bool has_scroll_dependent_content { false };
+    };
+    Optional<CachedDisplayList> m_cached_display_list;
+
+    NonnullOwnPtr<Web::Painting::TileCache> m_tile_cache;
 };
 
 }
@@ -5,12 +5,15 @@
  */
 
 #include "ImageCodecPluginSerenity.h"
+#include <AK/LexicalPath.h>
+#include <LibCore/Directory.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/LocalServer.h>
 #include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
 #include <LibFileSystem/FileSystem.h>
 #include <LibIPC/SingleServer.h>
+#include <LibJS/Script.h>
 #include <LibMain/Main.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/Loader/ResourceLoader.h>
@@ -25,9 +28,17 @@
 ErrorOr<int> serenity_main(Main::Arguments)
 {
     Core::EventLoop event_loop;
-    TRY(Core::System::pledge("stdio recvfd sendfd accept unix rpath thread"));
+    TRY(Core::System::pledge("stdio recvfd sendfd accept unix rpath wpath cpath thread"));
 
-    // This must be first; we can't check if /tmp/webdriver exists once we've unveiled other paths.
+    // What was learned from parsing large scripts is kept around for the WebContent processes that load them next.
+    auto script_cache_directory = LexicalPath::join(Core::StandardPaths::cache_directory(), "WebContent"sv, "Scripts"sv).string();
+    auto has_script_cache = true;
+    if (auto result = Core::Directory::create(script_cache_directory, Core::Directory::CreateDirectories::Yes); result.is_error()) {
+        dbgln("Failed to create the script cache in {}, scripts will be parsed from scratch: {}", script_cache_directory, result.error());
+        has_script_cache = false;
+    }
+
+    // This must be the first unveil; we can't check if /tmp/webdriver exists once we've unveiled other paths.
     auto webdriver_socket_path = DeprecatedString::formatted("{}/webdriver", TRY(Core::StandardPaths::runtime_directory()));
     if (FileSystem::exists(webdriver_socket_path))
         TRY(Core::System::unveil(webdriver_socket_path, "rw"sv));
@@ -38,8 +49,13 @@ ErrorOr<int> serenity_main(Main::Arguments)
     TRY(Core::System::unveil("/tmp/session/%sid/portal/request", "rw"));
     TRY(Core::System::unveil("/tmp/session/%sid/portal/image", "rw"));
     TRY(Core::System::unveil("/tmp/session/%sid/portal/websocket", "rw"));
+    if (has_script_cache)
+        TRY(Core::System::unveil(script_cache_directory, "rwc"sv));
     TRY(Core::System::unveil(nullptr, nullptr));
 
+    if (has_script_cache)
+        JS::Script::set_preparse_data_cache_directory(script_cache_directory);
+
     Web::Platform::EventLoopPlugin::install(*new Web::Platform::EventLoopPluginSerenity);
     Web::Platform::ImageCodecPlugin::install(*new WebContent::ImageCodecPluginSerenity);
     Web::Platform::FontPlugin::install(*new Web::Platform::FontPluginSerenity);
@@ -86,6 +86,11 @@ public:
         return String::from_deprecated_string(client().dump_text());
     }
 
+    ErrorOr<String> benchmark_painting(u32 iterations)
+    {
+        return String::from_deprecated_string(client().benchmark_painting(iterations));
+    }
+
     void clear_content_filters()
     {
         client().async_set_content_filters({});
@@ -392,6 +397,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     StringView web_driver_ipc_path;
     bool dump_layout_tree = false;
     bool dump_text = false;
+    u32 benchmark_painting_iterations = 0;
     bool is_layout_test_mode = false;
     StringView test_root_path;
 
@@ -400,6 +406,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.add_option(screenshot_timeout, "Take a screenshot after [n] seconds (default: 1)", "screenshot", 's', "n");
     args_parser.add_option(dump_layout_tree, "Dump layout tree and exit", "dump-layout-tree", 'd');
     args_parser.add_option(dump_text, "Dump text and exit", "dump-text", 'T');
+    args_parser.add_option(benchmark_painting_iterations, "Record and replay the page's display list [n] times, print timings and exit", "benchmark-painting", 0, "n");
     args_parser.add_option(test_root_path, "Run tests in path", "run-tests", 'R', "test-root-path");
     args_parser.add_option(resources_folder, "Path of the base resources folder (defaults to /res)", "resources", 'r', "resources-root-path");
     args_parser.add_option(web_driver_ipc_path, "Path to the WebDriver IPC socket", "webdriver-ipc-path", 0, "path");
@@ -448,6 +455,15 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
             out("{}", text);
             fflush(stdout);
 
+            event_loop.quit(0);
+        };
+    } else if (benchmark_painting_iterations > 0) {
+        view->on_load_finish = [&](auto const&) {
+            auto results = view->benchmark_painting(benchmark_painting_iterations).release_value_but_fixme_should_propagate_errors();
+
+            out("{}", results);
+            fflush(stdout);
+
             event_loop.quit(0);
         };
     } else if (web_driver_ipc_path.is_empty()) {
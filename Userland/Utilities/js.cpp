@@ -13,6 +13,7 @@
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/PropertyLookupCache.h>
 #include <LibJS/Console.h>
 #include <LibJS/Contrib/Test262/GlobalObject.h>
 #include <LibJS/Interpreter.h>
@@ -225,6 +226,8 @@ static ErrorOr<bool> parse_and_run(JS::Interpreter& interpreter, StringView sour
                 auto& passes = JS::Bytecode::Interpreter::optimization_pipeline(JS::Bytecode::Interpreter::OptimizationLevel::Optimize);
                 passes.perform(*executable);
                 dbgln("Optimisation passes took {}us", passes.elapsed());
+                auto const& statistics = *executable->optimization_statistics;
+                dbgln("Optimisation went from {} to {} instructions", statistics.instructions_before, statistics.instructions_after);
             }
 
             if (JS::Bytecode::g_dump_bytecode)
@@ -601,6 +604,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     bool disable_syntax_highlight = false;
     bool disable_debug_printing = false;
     bool use_test262_global = false;
+    bool dump_bytecode_stats = false;
     StringView evaluate_script;
     Vector<StringView> script_paths;
 
@@ -610,6 +614,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
     args_parser.add_option(s_run_bytecode, "Run the bytecode", "run-bytecode", 'b');
     args_parser.add_option(s_opt_bytecode, "Optimize the bytecode", "optimize-bytecode", 'p');
+    args_parser.add_option(dump_bytecode_stats, "Dump bytecode property lookup cache statistics on exit", "dump-bytecode-stats", {});
     args_parser.add_option(s_as_module, "Treat as module", "as-module", 'm');
     args_parser.add_option(s_print_last_result, "Print last result", "print-last-result", 'l');
     args_parser.add_option(s_strip_ansi, "Disable ANSI colors", "disable-ansi-colors", 'i');
@@ -912,9 +917,15 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
         // We resolve modules as if it is the first file
 
-        if (!TRY(parse_and_run(*interpreter, builder.string_view(), source_name)))
+        bool succeeded = TRY(parse_and_run(*interpreter, builder.string_view(), source_name));
+        if (dump_bytecode_stats)
+            JS::Bytecode::g_property_lookup_cache_statistics.dump();
+        if (!succeeded)
             return 1;
+        return 0;
     }
 
+    if (dump_bytecode_stats)
+        JS::Bytecode::g_property_lookup_cache_statistics.dump();
     return 0;
 }
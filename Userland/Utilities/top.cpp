@@ -89,9 +89,9 @@ struct Snapshot {
     u64 total_time_scheduled_kernel { 0 };
 };
 
-static ErrorOr<Snapshot> get_snapshot(HashTable<pid_t> const& pids)
+static ErrorOr<Snapshot> get_snapshot(Core::AllProcessesStatistics& all_processes, HashTable<pid_t> const& pids)
 {
-    auto all_processes = TRY(Core::ProcessStatisticsReader::get_all());
+    TRY(Core::ProcessStatisticsReader::update(all_processes));
 
     Snapshot snapshot;
     for (auto& process : all_processes.processes) {
@@ -219,6 +219,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 {
     TRY(Core::System::pledge("stdio rpath tty sigaction"));
     TRY(Core::System::unveil("/sys/kernel/processes", "r"));
+    TRY(Core::System::unveil("/sys/kernel/processes_binary", "r"));
     TRY(Core::System::unveil("/etc/passwd", "r"));
     unveil(nullptr, nullptr);
 
@@ -236,7 +237,8 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     enable_nonblocking_stdin();
 
     Vector<ThreadData*> threads;
-    auto prev = TRY(get_snapshot(top_option.pids_to_filter_by));
+    Core::AllProcessesStatistics all_processes {};
+    auto prev = TRY(get_snapshot(all_processes, top_option.pids_to_filter_by));
     usleep(10000);
     for (;;) {
         if (g_window_size_changed) {
@@ -244,7 +246,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
             g_window_size_changed = false;
         }
 
-        auto current = TRY(get_snapshot(top_option.pids_to_filter_by));
+        auto current = TRY(get_snapshot(all_processes, top_option.pids_to_filter_by));
         auto total_scheduled_diff = current.total_time_scheduled - prev.total_time_scheduled;
 
         printf("\033[3J\033[H\033[2J");